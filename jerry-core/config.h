@@ -31,12 +31,27 @@
  */
 #define CONFIG_MEM_POOL_MAX_CHUNKS_NUMBER_LOG (8)
 
+/**
+ * Server profile
+ *
+ * The profile is intended for hosts with large amount of memory (Linux):
+ *  - size of heap is chosen upon engine's initialization (see also: jerry_init_with_heap_size),
+ *    the heap's area is reserved with mmap, and its pages are committed by the kernel upon first access;
+ *  - compressed pointers are widened from 15 to 28 bits, so the heap's size can be up to 2GB;
+ *  - so, ECMA Object Model's data types are larger, and are placed in 16-byte pool chunks.
+ */
+// #define CONFIG_JERRY_SERVER_PROFILE
+
 /**
  * Size of pool chunk
  *
  * Should not be less than size of any of ECMA Object Model's data types.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#else /* CONFIG_JERRY_SERVER_PROFILE */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#endif /* !CONFIG_JERRY_SERVER_PROFILE */
 
 /**
  * Minimum number of chunks in a pool allocated by pools' manager.
@@ -50,9 +65,15 @@
 
 /**
  * Size of heap
+ *
+ * With CONFIG_JERRY_SERVER_PROFILE - default size, that can be overridden upon engine's initialization.
  */
 #ifndef CONFIG_MEM_HEAP_AREA_SIZE
-# define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# ifdef CONFIG_JERRY_SERVER_PROFILE
+#  define CONFIG_MEM_HEAP_AREA_SIZE (64 * 1024 * 1024)
+# else /* CONFIG_JERRY_SERVER_PROFILE */
+#  define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# endif /* !CONFIG_JERRY_SERVER_PROFILE */
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
 /**
@@ -70,7 +91,11 @@
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+# define CONFIG_MEM_HEAP_OFFSET_LOG (31)
+#else /* CONFIG_JERRY_SERVER_PROFILE */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#endif /* !CONFIG_JERRY_SERVER_PROFILE */
 
 /**
  * Number of lower bits in key of literal hash table.
@@ -90,11 +115,40 @@
  */
 #define CONFIG_ECMA_REFERENCE_COUNTER_WIDTH (10)
 
+/**
+ * Maximum depth of nested calls of functions with JavaScript code
+ *
+ * Each active call holds stack references to objects, it works with (usually, one or two references to the called
+ * function and to the 'this' object), so deeper calls are rejected with RangeError well before the reference
+ * counters (see also: CONFIG_ECMA_REFERENCE_COUNTER_WIDTH) are exhausted.
+ */
+#ifndef CONFIG_VM_MAX_CALL_DEPTH
+# define CONFIG_VM_MAX_CALL_DEPTH ((1u << CONFIG_ECMA_REFERENCE_COUNTER_WIDTH) / 4u)
+#endif /* !CONFIG_VM_MAX_CALL_DEPTH */
+
 /**
  * Maximum length of strings' concatenation
  */
 #define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (1048576)
 
+/**
+ * Number of entries in the cache of byte-code, compiled from eval code and from Function constructor's arguments
+ *
+ * Zero value disables the cache.
+ */
+#ifndef CONFIG_ECMA_EVAL_CACHE_SIZE
+# define CONFIG_ECMA_EVAL_CACHE_SIZE (8)
+#endif /* !CONFIG_ECMA_EVAL_CACHE_SIZE */
+
+/**
+ * Number of the most recent garbage collections, described in the GC log (see also: jerry_get_gc_events)
+ *
+ * Zero value disables the log.
+ */
+#ifndef CONFIG_ECMA_GC_LOG_SIZE
+# define CONFIG_ECMA_GC_LOG_SIZE (16)
+#endif /* !CONFIG_ECMA_GC_LOG_SIZE */
+
 /**
  * Use 32-bit/64-bit float for ecma-numbers
  */
@@ -20,18 +20,18 @@
 #include "jrt.h"
 #include "mem-poolman.h"
 
-JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_property_t) <= MEM_POOL_CHUNK_SIZE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= sizeof (uint64_t));
-JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE);
-JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (uint64_t) * JERRY_BITSINBYTE);
+JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_OBJ_TYPE_SIZE <= sizeof (ecma_object_t) * JERRY_BITSINBYTE);
+JERRY_STATIC_ASSERT (ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= sizeof (ecma_object_t) * JERRY_BITSINBYTE);
 
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_completion_value_t) == sizeof (uint32_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_label_descriptor_t) == sizeof (uint64_t));
-JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_completion_value_t) <= sizeof (uint64_t));
+JERRY_STATIC_ASSERT (sizeof (ecma_label_descriptor_t) <= MEM_POOL_CHUNK_SIZE);
+JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= MEM_POOL_CHUNK_SIZE);
 
 /** \addtogroup ecma ECMA
  * @{
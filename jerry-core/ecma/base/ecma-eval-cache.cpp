@@ -0,0 +1,275 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-eval-cache.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Cache of compiled eval code
+ * @{
+ *
+ * The cache maps code, passed to eval or to Function constructor, to byte-code, compiled from the code,
+ * so that repeated evaluation of the same code doesn't involve the parser.
+ *
+ * Entries of the cache are kept in order of their use (the most recently used entry is the first);
+ * upon insertion to the full cache the least recently used entry is evicted.
+ *
+ * Key of an entry is copy of the code, each part of which (i.e. argument of Function constructor)
+ * is prefixed with the part's size.
+ *
+ * Note:
+ *      byte-code of eval code and Function constructor's bodies is kept until the engine's cleanup
+ *      (see also: serializer_free), so entries of the cache don't hold the byte-code,
+ *      and eviction of an entry releases only the key's copy.
+ */
+
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+/**
+ * Calculate hash of the code (32-bit FNV-1a of the key's representation and the flags)
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_eval_cache_calc_hash (const lit_utf8_byte_t **parts_p, /**< parts of the code */
+                           const size_t *parts_size_p, /**< sizes of the parts */
+                           size_t parts_count, /**< number of the parts */
+                           uint8_t flags) /**< flags of the code (ecma_eval_cache_flags_t) */
+{
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < parts_count; i++)
+  {
+    hash = (hash ^ (uint32_t) parts_size_p[i]) * 16777619u;
+
+    for (size_t j = 0; j < parts_size_p[i]; j++)
+    {
+      hash = (hash ^ parts_p[i][j]) * 16777619u;
+    }
+  }
+
+  return (hash ^ flags) * 16777619u;
+} /* ecma_eval_cache_calc_hash */
+
+/**
+ * Calculate size of the key for specified code
+ *
+ * @return size of the key's block
+ */
+static size_t
+ecma_eval_cache_get_key_size (const size_t *parts_size_p, /**< sizes of the code's parts */
+                              size_t parts_count) /**< number of the parts */
+{
+  size_t key_size = 0;
+
+  for (size_t i = 0; i < parts_count; i++)
+  {
+    key_size += sizeof (uint32_t) + parts_size_p[i];
+  }
+
+  return key_size;
+} /* ecma_eval_cache_get_key_size */
+
+/**
+ * Check whether the entry's key is equal to the specified code
+ *
+ * @return true - if the key corresponds to the code,
+ *         false - otherwise.
+ */
+static bool
+ecma_eval_cache_is_key_equal (const ecma_eval_cache_entry_t *entry_p, /**< non-empty entry */
+                              const lit_utf8_byte_t **parts_p, /**< parts of the code */
+                              const size_t *parts_size_p, /**< sizes of the parts */
+                              size_t parts_count) /**< number of the parts */
+{
+  const uint8_t *key_p = MEM_CP_GET_NON_NULL_POINTER (uint8_t, entry_p->key_cp);
+
+  for (size_t i = 0; i < parts_count; i++)
+  {
+    uint32_t part_size;
+    memcpy (&part_size, key_p, sizeof (part_size));
+    key_p += sizeof (part_size);
+
+    if (part_size != parts_size_p[i]
+        || memcmp (key_p, parts_p[i], part_size) != 0)
+    {
+      return false;
+    }
+
+    key_p += part_size;
+  }
+
+  return true;
+} /* ecma_eval_cache_is_key_equal */
+
+/**
+ * Evict the entry from the cache
+ */
+static void
+ecma_eval_cache_invalidate_entry (ecma_eval_cache_entry_t *entry_p) /**< non-empty entry */
+{
+  JERRY_ASSERT (entry_p->key_cp != MEM_CP_NULL);
+
+  mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (uint8_t, entry_p->key_cp));
+
+  entry_p->key_cp = MEM_CP_NULL;
+  entry_p->opcodes_p = NULL;
+} /* ecma_eval_cache_invalidate_entry */
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+
+/**
+ * Initialize the cache
+ */
+void
+ecma_eval_cache_init (void)
+{
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+  memset (JERRY_CONTEXT (ecma_eval_cache), 0, sizeof (JERRY_CONTEXT (ecma_eval_cache)));
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+} /* ecma_eval_cache_init */
+
+/**
+ * Evict all entries from the cache
+ */
+void
+ecma_eval_cache_invalidate_all (void)
+{
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+  for (uint32_t i = 0; i < CONFIG_ECMA_EVAL_CACHE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (ecma_eval_cache)[i].key_cp != MEM_CP_NULL)
+    {
+      ecma_eval_cache_invalidate_entry (&JERRY_CONTEXT (ecma_eval_cache)[i]);
+    }
+  }
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+} /* ecma_eval_cache_invalidate_all */
+
+/**
+ * Look up byte-code, compiled from the specified code
+ *
+ * Note:
+ *      the found entry becomes the most recently used one
+ *
+ * @return pointer to the byte-code - if the code is in the cache,
+ *         NULL - otherwise.
+ */
+const opcode_t *
+ecma_eval_cache_lookup (const lit_utf8_byte_t **parts_p, /**< parts of the code
+                                                          *   (the only part, for eval code;
+                                                          *    the arguments, for Function constructor) */
+                        const size_t *parts_size_p, /**< sizes of the parts */
+                        size_t parts_count, /**< number of the parts */
+                        uint8_t flags) /**< flags of the code (ecma_eval_cache_flags_t) */
+{
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+  const uint32_t hash = ecma_eval_cache_calc_hash (parts_p, parts_size_p, parts_count, flags);
+  const size_t key_size = ecma_eval_cache_get_key_size (parts_size_p, parts_count);
+
+  for (uint32_t i = 0; i < CONFIG_ECMA_EVAL_CACHE_SIZE; i++)
+  {
+    ecma_eval_cache_entry_t entry = JERRY_CONTEXT (ecma_eval_cache)[i];
+
+    if (entry.key_cp != MEM_CP_NULL
+        && entry.hash == hash
+        && entry.flags == flags
+        && entry.key_size == key_size
+        && ecma_eval_cache_is_key_equal (&entry, parts_p, parts_size_p, parts_count))
+    {
+      memmove (&JERRY_CONTEXT (ecma_eval_cache)[1],
+               &JERRY_CONTEXT (ecma_eval_cache)[0],
+               i * sizeof (ecma_eval_cache_entry_t));
+      JERRY_CONTEXT (ecma_eval_cache)[0] = entry;
+
+      return entry.opcodes_p;
+    }
+  }
+#else /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+  (void) parts_p;
+  (void) parts_size_p;
+  (void) parts_count;
+  (void) flags;
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE == 0 */
+
+  return NULL;
+} /* ecma_eval_cache_lookup */
+
+/**
+ * Insert byte-code, compiled from the specified code, to the cache
+ *
+ * Note:
+ *      the inserted entry becomes the most recently used one,
+ *      and the least recently used entry is evicted, if the cache is full
+ */
+void
+ecma_eval_cache_insert (const lit_utf8_byte_t **parts_p, /**< parts of the code
+                                                          *   (see also: ecma_eval_cache_lookup) */
+                        const size_t *parts_size_p, /**< sizes of the parts */
+                        size_t parts_count, /**< number of the parts */
+                        uint8_t flags, /**< flags of the code (ecma_eval_cache_flags_t) */
+                        const opcode_t *opcodes_p) /**< byte-code, compiled from the code */
+{
+  JERRY_ASSERT (opcodes_p != NULL);
+
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+  const size_t key_size = ecma_eval_cache_get_key_size (parts_size_p, parts_count);
+
+  /* the allocation can evict entries through the 'try to give memory back' callback,
+   * so it is performed before the entries are updated */
+  uint8_t *key_p = (uint8_t *) mem_heap_alloc_block (key_size, MEM_HEAP_ALLOC_LONG_TERM);
+
+  ecma_eval_cache_entry_t entry;
+  entry.opcodes_p = opcodes_p;
+  entry.hash = ecma_eval_cache_calc_hash (parts_p, parts_size_p, parts_count, flags);
+  entry.key_size = (uint32_t) key_size;
+  entry.flags = flags;
+  MEM_CP_SET_NON_NULL_POINTER (entry.key_cp, key_p);
+
+  for (size_t i = 0; i < parts_count; i++)
+  {
+    uint32_t part_size = (uint32_t) parts_size_p[i];
+    memcpy (key_p, &part_size, sizeof (part_size));
+    key_p += sizeof (part_size);
+
+    memcpy (key_p, parts_p[i], part_size);
+    key_p += part_size;
+  }
+
+  ecma_eval_cache_entry_t *last_entry_p = &JERRY_CONTEXT (ecma_eval_cache)[CONFIG_ECMA_EVAL_CACHE_SIZE - 1];
+
+  if (last_entry_p->key_cp != MEM_CP_NULL)
+  {
+    ecma_eval_cache_invalidate_entry (last_entry_p);
+  }
+
+  memmove (&JERRY_CONTEXT (ecma_eval_cache)[1],
+           &JERRY_CONTEXT (ecma_eval_cache)[0],
+           (CONFIG_ECMA_EVAL_CACHE_SIZE - 1) * sizeof (ecma_eval_cache_entry_t));
+  JERRY_CONTEXT (ecma_eval_cache)[0] = entry;
+#else /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+  (void) parts_p;
+  (void) parts_size_p;
+  (void) parts_count;
+  (void) flags;
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE == 0 */
+} /* ecma_eval_cache_insert */
+
+/**
+ * @}
+ * @}
+ */
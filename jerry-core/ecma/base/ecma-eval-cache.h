@@ -0,0 +1,61 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_EVAL_CACHE_H
+#define ECMA_EVAL_CACHE_H
+
+#include "ecma-globals.h"
+#include "opcodes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Cache of compiled eval code
+ * @{
+ */
+
+/**
+ * Flags of code, compiled to byte-code (the code is looked up in the cache, considering the flags)
+ */
+typedef enum
+{
+  ECMA_EVAL_CACHE_FLAG_STRICT = (1u << 0), /**< the code is parsed as strict mode code */
+  ECMA_EVAL_CACHE_FLAG_DIRECT = (1u << 1), /**< the code is passed to direct call to eval */
+  ECMA_EVAL_CACHE_FLAG_NEW_FUNCTION = (1u << 2) /**< the code consists of Function constructor's arguments */
+} ecma_eval_cache_flags_t;
+
+/**
+ * Entry of the cache
+ */
+typedef struct
+{
+  const opcode_t *opcodes_p; /**< byte-code, compiled from the code */
+  uint32_t hash; /**< hash of the code */
+  uint32_t key_size; /**< size of the key's block */
+  mem_cpointer_t key_cp; /**< block, containing copy of the code (MEM_CP_NULL marks entry empty) */
+  uint8_t flags; /**< flags of the code (ecma_eval_cache_flags_t) */
+} ecma_eval_cache_entry_t;
+
+extern void ecma_eval_cache_init (void);
+extern void ecma_eval_cache_invalidate_all (void);
+extern const opcode_t *ecma_eval_cache_lookup (const lit_utf8_byte_t **, const size_t *, size_t, uint8_t);
+extern void ecma_eval_cache_insert (const lit_utf8_byte_t **, const size_t *, size_t, uint8_t, const opcode_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_EVAL_CACHE_H */
@@ -25,11 +25,13 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-eval-cache.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-stack.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
@@ -37,43 +39,13 @@
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
 
-/**
- * An object's GC color
- *
- * Tri-color marking:
- *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
- */
-typedef enum
-{
-  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
-  ECMA_GC_COLOR_BLACK, /**< black */
-  ECMA_GC_COLOR__COUNT /**< number of colors */
-} ecma_gc_color_t;
-
-/**
- * List of marked (visited during current GC session) and umarked objects
- */
-static ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT];
-
-/**
- * Current state of an object's visited flag that indicates whether the object is in visited state:
- *  visited_field | visited_flip_flag | real_value
- *         false  |            false  |     false
- *         false  |             true  |      true
- *          true  |            false  |      true
- *          true  |             true  |     false
- */
-static bool ecma_gc_visited_flip_flag = false;
-
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
 
 /**
  * Get GC reference counter of the object.
  */
-static uint32_t
+uint32_t
 ecma_gc_get_object_refs (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
@@ -101,7 +73,7 @@ ecma_gc_set_object_refs (ecma_object_t *object_p, /**< object */
 /**
  * Get next object in list of objects with same generation.
  */
-static ecma_object_t*
+ecma_object_t*
 ecma_gc_get_object_next (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
@@ -146,7 +118,7 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
                                                   ECMA_OBJECT_GC_VISITED_POS,
                                                   ECMA_OBJECT_GC_VISITED_WIDTH);
 
-  return (flag_value != ecma_gc_visited_flip_flag);
+  return (flag_value != JERRY_CONTEXT (ecma_gc_visited_flip_flag));
 } /* ecma_gc_is_object_visited */
 
 /**
@@ -158,7 +130,7 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  if (ecma_gc_visited_flip_flag)
+  if (JERRY_CONTEXT (ecma_gc_visited_flip_flag))
   {
     is_visited = !is_visited;
   }
@@ -177,8 +149,8 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
   ecma_gc_set_object_refs (object_p, 1);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  ecma_gc_set_object_next (object_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY]);
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
 
   /* Should be set to false at the beginning of garbage collection */
   ecma_gc_set_object_visited (object_p, false);
@@ -186,11 +158,24 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 
 /**
  * Increase reference counter of an object
+ *
+ * Note:
+ *      if the counter can't be increased, the engine is terminated with ERR_REF_COUNT_LIMIT, as overflow
+ *      of the counter would lead to freeing of a referenced object (depth of calls is limited with
+ *      CONFIG_VM_MAX_CALL_DEPTH, so the termination is only possible if each call holds several references
+ *      to the same object).
  */
 void
 ecma_ref_object (ecma_object_t *object_p) /**< object */
 {
-  ecma_gc_set_object_refs (object_p, ecma_gc_get_object_refs (object_p) + 1);
+  uint32_t refs = ecma_gc_get_object_refs (object_p) + 1;
+
+  if (unlikely (refs >= (1u << ECMA_OBJECT_GC_REFS_WIDTH)))
+  {
+    jerry_fatal (ERR_REF_COUNT_LIMIT);
+  }
+
+  ecma_gc_set_object_refs (object_p, refs);
 } /* ecma_ref_object */
 
 /**
@@ -209,8 +194,12 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
 void
 ecma_gc_init (void)
 {
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  JERRY_CONTEXT (ecma_gc_log).collections_number = 0;
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
 } /* ecma_gc_init */
 
 /**
@@ -323,6 +312,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
             case ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET: /* an integer */
             case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
+            case ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE: /* an external pointer */
             case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
             case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an object's native free callback */
             case ECMA_INTERNAL_PROPERTY_BUILT_IN_ID: /* an integer */
@@ -401,21 +391,145 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+/**
+ * Get memory usage, described in the GC log
+ *
+ * @return allocated bytes of the heap, excluding free chunks of the pools
+ */
+static size_t
+ecma_gc_log_get_memory_usage (void)
+{
+  return JERRY_CONTEXT (mem_heap).allocated_bytes - JERRY_CONTEXT (mem_free_chunks_number) * MEM_POOL_CHUNK_SIZE;
+} /* ecma_gc_log_get_memory_usage */
+
+/**
+ * Register a garbage collection in the GC log, replacing description of the oldest collection, if the log is full
+ */
+static void
+ecma_gc_log_register (ecma_gc_cause_t cause, /**< cause of the collection */
+                      uint64_t start_cycles, /**< cycle counter's value at the start of the collection */
+                      size_t bytes_before, /**< memory usage before the collection */
+                      uint32_t objects_before, /**< number of objects before the collection */
+                      uint32_t objects_freed) /**< number of freed objects */
+{
+  ecma_gc_log_t *log_p = &JERRY_CONTEXT (ecma_gc_log);
+
+  ecma_gc_log_entry_t *entry_p = &log_p->entries[log_p->collections_number % CONFIG_ECMA_GC_LOG_SIZE];
+  log_p->collections_number++;
+
+  entry_p->sequence_number = log_p->collections_number;
+  entry_p->cause = cause;
+  entry_p->duration_cycles = jrt_get_cycles () - start_cycles;
+  entry_p->objects_before = objects_before;
+  entry_p->objects_after = objects_before - objects_freed;
+  entry_p->bytes_before = bytes_before;
+  entry_p->bytes_after = ecma_gc_log_get_memory_usage ();
+} /* ecma_gc_log_register */
+
+/**
+ * Get descriptions of the most recent garbage collections from the GC log
+ *
+ * @return number of descriptions, copied to the output array (in order of the collections)
+ */
+uint32_t
+ecma_gc_log_get_entries (ecma_gc_log_entry_t *out_entries_p, /**< out: descriptions of the collections */
+                         uint32_t max_entries_number) /**< size of the output array */
+{
+  const ecma_gc_log_t *log_p = &JERRY_CONTEXT (ecma_gc_log);
+
+  uint32_t entries_number = JERRY_MIN (log_p->collections_number, (uint32_t) CONFIG_ECMA_GC_LOG_SIZE);
+  entries_number = JERRY_MIN (entries_number, max_entries_number);
+
+  for (uint32_t i = 0; i < entries_number; i++)
+  {
+    uint32_t collection_index = log_p->collections_number - entries_number + i;
+
+    out_entries_p[i] = log_p->entries[collection_index % CONFIG_ECMA_GC_LOG_SIZE];
+  }
+
+  return entries_number;
+} /* ecma_gc_log_get_entries */
+
+/**
+ * Print the GC log
+ */
+void
+ecma_gc_log_print (void)
+{
+  static const char *cause_names[ECMA_GC_CAUSE__COUNT] =
+  {
+    "low memory",
+    "critical memory",
+    "string refs overflow",
+    "each opcode",
+    "heap snapshot",
+    "engine cleanup"
+  };
+
+  ecma_gc_log_entry_t entries[CONFIG_ECMA_GC_LOG_SIZE];
+  uint32_t entries_number = ecma_gc_log_get_entries (entries, CONFIG_ECMA_GC_LOG_SIZE);
+
+  printf ("GC log (%u collections, the last %u are listed):\n",
+          JERRY_CONTEXT (ecma_gc_log).collections_number,
+          entries_number);
+
+  if (entries_number == 0)
+  {
+    printf ("\n");
+    return;
+  }
+
+  printf ("  %6s %-20s %12s %10s %10s %10s %10s %10s\n",
+          "#", "Cause", "Kcycles", "Objects", "Freed", "Bytes", "After", "Reclaimed");
+
+  for (uint32_t i = 0; i < entries_number; i++)
+  {
+    const ecma_gc_log_entry_t *entry_p = &entries[i];
+
+    printf ("  %6u %-20s %12u %10u %10u %10u %10u %10u\n",
+            entry_p->sequence_number,
+            cause_names[entry_p->cause],
+            (uint32_t) (entry_p->duration_cycles / 1000u),
+            entry_p->objects_before,
+            entry_p->objects_before - entry_p->objects_after,
+            (uint32_t) entry_p->bytes_before,
+            (uint32_t) entry_p->bytes_after,
+            (uint32_t) (entry_p->bytes_before > entry_p->bytes_after ? entry_p->bytes_before - entry_p->bytes_after
+                                                                     : 0));
+  }
+
+  printf ("\n");
+} /* ecma_gc_log_print */
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+
 /**
  * Run garbage collecting
  */
 void
-ecma_gc_run (void)
+ecma_gc_run (ecma_gc_cause_t cause) /**< cause of the collection */
 {
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] == NULL);
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  const uint64_t start_cycles = jrt_get_cycles ();
+  const size_t bytes_before = ecma_gc_log_get_memory_usage ();
+#else /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+  (void) cause;
+#endif /* CONFIG_ECMA_GC_LOG_SIZE == 0 */
+
+  uint32_t objects_before = 0;
+  uint32_t objects_freed = 0;
 
   /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
        obj_iter_p != NULL;
        obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
   {
     JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
 
+    objects_before++;
+
     if (ecma_gc_get_object_refs (obj_iter_p) > 0)
     {
       ecma_gc_set_object_visited (obj_iter_p, true);
@@ -447,7 +561,9 @@ ecma_gc_run (void)
   {
     marked_anything_during_current_iteration = false;
 
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
+    for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY],
+                       *obj_prev_p = NULL,
+                       *obj_next_p;
          obj_iter_p != NULL;
          obj_iter_p = obj_next_p)
     {
@@ -456,8 +572,8 @@ ecma_gc_run (void)
       if (ecma_gc_is_object_visited (obj_iter_p))
       {
         /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
+        ecma_gc_set_object_next (obj_iter_p, JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK]);
+        JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = obj_iter_p;
 
         if (likely (obj_prev_p != NULL))
         {
@@ -467,7 +583,7 @@ ecma_gc_run (void)
         }
         else
         {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
+          JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
         }
 
         ecma_gc_mark (obj_iter_p);
@@ -482,7 +598,7 @@ ecma_gc_run (void)
   while (marked_anything_during_current_iteration);
 
   /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
        obj_iter_p != NULL;
        obj_iter_p = obj_next_p)
   {
@@ -491,13 +607,22 @@ ecma_gc_run (void)
     JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
 
     ecma_gc_sweep (obj_iter_p);
+    objects_freed++;
   }
 
   /* Unmarking all objects */
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK];
-  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
-
-  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY] =
+    JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK];
+  JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_BLACK] = NULL;
+
+  JERRY_CONTEXT (ecma_gc_visited_flip_flag) = !JERRY_CONTEXT (ecma_gc_visited_flip_flag);
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  ecma_gc_log_register (cause, start_cycles, bytes_before, objects_before, objects_freed);
+#else /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+  (void) objects_before;
+  (void) objects_freed;
+#endif /* CONFIG_ECMA_GC_LOG_SIZE == 0 */
 } /* ecma_gc_run */
 
 /**
@@ -509,12 +634,14 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 {
   if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW)
   {
-    ecma_gc_run ();
+    ecma_gc_run (ECMA_GC_CAUSE_LOW_MEMORY);
   }
   else if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_MEDIUM
            || severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH)
   {
-    /* we have already done simple GC as requests come in ascending severity order */
+    /* we have already done simple GC as requests come in ascending severity order,
+     * so only memory of caches can be given back */
+    ecma_eval_cache_invalidate_all ();
   }
   else
   {
@@ -522,8 +649,9 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
 
     /* Freeing as much memory as we currently can */
     ecma_lcache_invalidate_all ();
+    ecma_eval_cache_invalidate_all ();
 
-    ecma_gc_run ();
+    ecma_gc_run (ECMA_GC_CAUSE_CRITICAL_MEMORY);
   }
 } /* ecma_try_to_give_back_some_memory */
 
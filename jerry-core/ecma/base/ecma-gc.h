@@ -26,13 +26,80 @@
 #include "ecma-globals.h"
 #include "mem-allocator.h"
 
+/**
+ * An object's GC color
+ *
+ * Tri-color marking:
+ *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
+ *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
+ *   BLACK                 -> BLACK // all referenced objects are gray or black
+ */
+typedef enum
+{
+  ECMA_GC_COLOR_WHITE_GRAY, /**< white or gray */
+  ECMA_GC_COLOR_BLACK, /**< black */
+  ECMA_GC_COLOR__COUNT /**< number of colors */
+} ecma_gc_color_t;
+
+/**
+ * Cause of a garbage collection
+ */
+typedef enum
+{
+  ECMA_GC_CAUSE_LOW_MEMORY, /**< 'try to give memory back' request of low severity */
+  ECMA_GC_CAUSE_CRITICAL_MEMORY, /**< 'try to give memory back' request of critical severity */
+  ECMA_GC_CAUSE_STRING_REFS_OVERFLOW, /**< overflow of a string's reference counter */
+  ECMA_GC_CAUSE_EACH_OPCODE, /**< collection after each opcode (CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE) */
+  ECMA_GC_CAUSE_HEAP_SNAPSHOT, /**< snapshot of the heap (see also: jerry_api_dump_heap_snapshot) */
+  ECMA_GC_CAUSE_ENGINE_CLEANUP, /**< finalization of the engine */
+  ECMA_GC_CAUSE__COUNT /**< number of causes */
+} ecma_gc_cause_t;
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+/**
+ * Description of a garbage collection in the GC log
+ *
+ * Memory usage is the heap's allocated bytes, excluding free chunks of the pools,
+ * so it reflects memory, freed to the pools, as well as to the heap.
+ */
+typedef struct
+{
+  uint32_t sequence_number; /**< number of the collection since the engine's initialization (starting from 1) */
+  ecma_gc_cause_t cause; /**< cause of the collection */
+  uint64_t duration_cycles; /**< duration of the collection in processor cycles (zero - if the cycle counter
+                             *   is not supported on the architecture) */
+  uint32_t objects_before; /**< number of objects and lexical environments before the collection */
+  uint32_t objects_after; /**< number of objects and lexical environments after the collection */
+  size_t bytes_before; /**< memory usage before the collection */
+  size_t bytes_after; /**< memory usage after the collection */
+} ecma_gc_log_entry_t;
+
+/**
+ * Ring buffer of the most recent garbage collections' descriptions
+ */
+typedef struct
+{
+  uint32_t collections_number; /**< number of collections since the engine's initialization */
+  ecma_gc_log_entry_t entries[CONFIG_ECMA_GC_LOG_SIZE]; /**< descriptions of the collections
+                                                         *   (entry of n-th collection is at index
+                                                         *   (n - 1) % CONFIG_ECMA_GC_LOG_SIZE) */
+} ecma_gc_log_t;
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+
 extern void ecma_gc_init (void);
 extern void ecma_init_gc_info (ecma_object_t *object_p);
+extern uint32_t ecma_gc_get_object_refs (ecma_object_t *object_p);
+extern ecma_object_t *ecma_gc_get_object_next (ecma_object_t *object_p);
 extern void ecma_ref_object (ecma_object_t *object_p);
 extern void ecma_deref_object (ecma_object_t *object_p);
-extern void ecma_gc_run (void);
+extern void ecma_gc_run (ecma_gc_cause_t cause);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity);
 
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+extern uint32_t ecma_gc_log_get_entries (ecma_gc_log_entry_t *out_entries_p, uint32_t max_entries_number);
+extern void ecma_gc_log_print (void);
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+
 #endif /* !ECMA_GC_H */
 
 /**
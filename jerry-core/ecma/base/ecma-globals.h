@@ -25,6 +25,7 @@
 
 #include "config.h"
 #include "jrt.h"
+#include "jrt-bit-fields.h"
 #include "lit-globals.h"
 #include "lit-magic-strings.h"
 #include "mem-allocator.h"
@@ -156,11 +157,18 @@ typedef uint32_t ecma_value_t;
  *
  * See also: ECMA-262 v5, 8.9.
  *
- *                                               value (16)
+ *                                               value (ECMA_VALUE_SIZE)
  * Bit-field structure: type (8) | padding (8) <
  *                                               break / continue target
+ *
+ * Note:
+ *      with compressed pointers wider than 16 bits, the structure doesn't fit into 32 bits.
  */
+#if ECMA_POINTER_FIELD_WIDTH <= 16
 typedef uint32_t ecma_completion_value_t;
+#else /* ECMA_POINTER_FIELD_WIDTH > 16 */
+typedef uint64_t ecma_completion_value_t;
+#endif /* ECMA_POINTER_FIELD_WIDTH > 16 */
 
 /**
  * Value
@@ -172,9 +180,12 @@ typedef uint32_t ecma_completion_value_t;
 
 /**
  * Break / continue jump target
+ *
+ * Note:
+ *      the field should be able to hold any opcode counter (see also: OPCODE_COUNTER_WIDTH)
  */
 #define ECMA_COMPLETION_VALUE_TARGET_POS (0)
-#define ECMA_COMPLETION_VALUE_TARGET_WIDTH ((uint32_t) sizeof (opcode_counter_t) * JERRY_BITSINBYTE)
+#define ECMA_COMPLETION_VALUE_TARGET_WIDTH (24u)
 
 /**
  * Type (ecma_completion_type_t)
@@ -221,6 +232,7 @@ typedef enum
   ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET, /**< second part of [[Code]] - offset in bytecode array and code flags
                                                  *   (see also: ecma_pack_code_internal_property_value) */
   ECMA_INTERNAL_PROPERTY_NATIVE_CODE, /**< native handler location descriptor */
+  ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE, /**< signature of native fast-call handler */
   ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE, /**< native handle associated with an object */
   ECMA_INTERNAL_PROPERTY_FREE_CALLBACK, /**< object's native free callback */
   ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS, /**< [[FormalParameters]] */
@@ -516,7 +528,11 @@ typedef struct ecma_object_t
 #define ECMA_OBJECT_LEX_ENV_TYPE_SIZE (ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS + \
                                        ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH)
 
+#if ECMA_OBJECT_OBJ_TYPE_SIZE <= 64 && ECMA_OBJECT_LEX_ENV_TYPE_SIZE <= 64
   uint64_t container; /**< container for fields described above */
+#else /* ECMA_OBJECT_OBJ_TYPE_SIZE > 64 || ECMA_OBJECT_LEX_ENV_TYPE_SIZE > 64 */
+  jrt_wide_bit_field_container_t container; /**< container for fields described above */
+#endif /* ECMA_OBJECT_OBJ_TYPE_SIZE > 64 || ECMA_OBJECT_LEX_ENV_TYPE_SIZE > 64 */
 } ecma_object_t;
 
 
@@ -703,7 +719,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Place for the collection's data */
-  uint8_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
+  uint8_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
 } ecma_collection_header_t;
 
 /**
@@ -715,7 +731,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Characters */
-  lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
+  lit_utf8_byte_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) ];
 } ecma_collection_chunk_t;
 
 /**
@@ -791,7 +807,11 @@ typedef struct ecma_string_t
     lit_magic_string_ex_id_t magic_string_ex_id;
 
     /** For zeroing and comparison in some cases */
+#if ECMA_POINTER_FIELD_WIDTH <= 16
     uint32_t common_field;
+#else /* ECMA_POINTER_FIELD_WIDTH > 16 */
+    uint64_t common_field;
+#endif /* ECMA_POINTER_FIELD_WIDTH > 16 */
   } u;
 } ecma_string_t;
 
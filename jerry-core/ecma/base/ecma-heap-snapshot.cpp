@@ -0,0 +1,649 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-heap-snapshot.h"
+#include "ecma-helpers.h"
+#include "ecma-stack.h"
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "lit-magic-strings.h"
+#include "lit-strings.h"
+
+#ifdef JERRY_ENABLE_HEAP_SNAPSHOT
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapsnapshot Heap snapshot
+ * @{
+ *
+ * The snapshot is a JSON document, describing graph of objects and lexical environments, that are alive
+ * after a full garbage collection:
+ *
+ *   {
+ *     "format": "jerry-heap-snapshot",
+ *     "version": 1,
+ *     "heap": { "size": <heap size>, "allocated_bytes": <currently allocated bytes> },
+ *     "nodes": [ <node>, ... ]
+ *   }
+ *
+ * The first node is the synthetic root ("id": 0, "type": "(roots)"), referencing objects, held by the engine
+ * or the host (edge type "reference"), and objects in registers of the active interpreter frames
+ * (edge type "register"). Other nodes are:
+ *
+ *   {
+ *     "id": <unique non-zero identifier>,
+ *     "type": "object" | "function" | "lexical environment",
+ *     "class": <object's [[Class]], or type of lexical environment: "declarative" | "object-bound">,
+ *     "builtin": true | false,
+ *     "size": <bytes, occupied by the object and its properties>,
+ *     "refs": <number of references from the engine or the host>,
+ *     "edges": [ <edge>, ... ]
+ *   }
+ *
+ * Each edge describes a property, a binding, or an internal reference of the node:
+ *
+ *   {
+ *     "type": "property" | "variable" | "getter" | "setter" | "prototype" | "outer" | "binding" | "internal"
+ *             | "reference" | "register",
+ *     "name": <property's name, variable's name, internal property's or register's description>,
+ *     "to": <identifier of the referenced node>
+ *   }
+ *
+ * Edges, holding primitive values, contain "value_type" ("undefined" | "null" | "boolean" | "number" | "string")
+ * instead of "to", and, except for undefined and null, the value's string representation in "value".
+ * Edges, holding strings, also contain the string's size in bytes in "size"; strings, that are longer than
+ * ECMA_HEAP_SNAPSHOT_MAX_STRING_SIZE bytes, are written as empty strings, marked with "truncated": true.
+ *
+ * Strings are written as JSON strings, with non-ASCII characters escaped as \uXXXX code units.
+ */
+
+/**
+ * Maximum size of a string value, included in the snapshot
+ */
+#define ECMA_HEAP_SNAPSHOT_MAX_STRING_SIZE (256u)
+
+/**
+ * Size of the buffer, the snapshot is formatted in before it is written to the output file
+ */
+#define ECMA_HEAP_SNAPSHOT_OUTPUT_BUFFER_SIZE (1024u)
+
+/**
+ * Buffered output of the snapshot
+ *
+ * Note:
+ *      the snapshot is written without allocations on the engine's heap, as an allocation
+ *      can trigger garbage collection, which reorders the list of objects, being walked
+ */
+typedef struct
+{
+  FILE *file_p; /**< output file */
+  bool is_write_failed; /**< did writing to the file fail */
+  size_t size; /**< number of bytes in the buffer */
+  char data[ECMA_HEAP_SNAPSHOT_OUTPUT_BUFFER_SIZE]; /**< the buffer */
+} ecma_heap_snapshot_output_t;
+
+/**
+ * Write contents of the output buffer to the file
+ */
+static void
+ecma_heap_snapshot_flush (ecma_heap_snapshot_output_t *output_p) /**< output buffer */
+{
+  if (fwrite (output_p->data, 1, output_p->size, output_p->file_p) != output_p->size)
+  {
+    output_p->is_write_failed = true;
+  }
+
+  output_p->size = 0;
+} /* ecma_heap_snapshot_flush */
+
+/**
+ * Append a character to the output buffer
+ */
+static void
+ecma_heap_snapshot_append_char (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                char c) /**< the character */
+{
+  if (output_p->size == sizeof (output_p->data))
+  {
+    ecma_heap_snapshot_flush (output_p);
+  }
+
+  output_p->data[output_p->size++] = c;
+} /* ecma_heap_snapshot_append_char */
+
+/**
+ * Append a string to the output buffer
+ */
+static void
+ecma_heap_snapshot_append_string (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                  const char *str_p) /**< zero-terminated string */
+{
+  while (*str_p != '\0')
+  {
+    ecma_heap_snapshot_append_char (output_p, *str_p++);
+  }
+} /* ecma_heap_snapshot_append_string */
+
+/**
+ * Append decimal representation of an unsigned integer to the output buffer
+ */
+static void
+ecma_heap_snapshot_append_uint (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                uint32_t value) /**< the value */
+{
+  char str[11];
+  size_t pos = sizeof (str) - 1;
+  str[pos] = '\0';
+
+  do
+  {
+    str[--pos] = (char) ('0' + value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+
+  ecma_heap_snapshot_append_string (output_p, str + pos);
+} /* ecma_heap_snapshot_append_uint */
+
+/**
+ * Append a CESU-8 string, quoted and escaped as a JSON string, to the output buffer
+ */
+static void
+ecma_heap_snapshot_append_json_string (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                       const lit_utf8_byte_t *str_p, /**< string */
+                                       lit_utf8_size_t str_size) /**< string's size */
+{
+  const char hex_digits[] = "0123456789abcdef";
+
+  ecma_heap_snapshot_append_char (output_p, '"');
+
+  lit_utf8_iterator_t iter = lit_utf8_iterator_create (str_p, str_size);
+
+  while (!lit_utf8_iterator_reached_buffer_end (&iter))
+  {
+    ecma_char_t code_unit = lit_utf8_iterator_read_code_unit_and_increment (&iter);
+
+    if (code_unit == '"' || code_unit == '\\')
+    {
+      ecma_heap_snapshot_append_char (output_p, '\\');
+      ecma_heap_snapshot_append_char (output_p, (char) code_unit);
+    }
+    else if (code_unit < 0x20 || code_unit >= 0x7f)
+    {
+      ecma_heap_snapshot_append_string (output_p, "\\u");
+
+      for (int shift = 12; shift >= 0; shift -= 4)
+      {
+        ecma_heap_snapshot_append_char (output_p, hex_digits[(code_unit >> shift) & 0xf]);
+      }
+    }
+    else
+    {
+      ecma_heap_snapshot_append_char (output_p, (char) code_unit);
+    }
+  }
+
+  ecma_heap_snapshot_append_char (output_p, '"');
+} /* ecma_heap_snapshot_append_json_string */
+
+/**
+ * Append a magic string, quoted as a JSON string, to the output buffer
+ */
+static void
+ecma_heap_snapshot_append_magic_string (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                        lit_magic_string_id_t id) /**< magic string id */
+{
+  ecma_heap_snapshot_append_json_string (output_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_heap_snapshot_append_magic_string */
+
+/**
+ * Append an ecma-string, quoted and escaped as a JSON string, to the output buffer
+ *
+ * @return true - if the string was appended,
+ *         false - if the string is longer than ECMA_HEAP_SNAPSHOT_MAX_STRING_SIZE (nothing is appended).
+ */
+static bool
+ecma_heap_snapshot_append_ecma_string (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                       const ecma_string_t *string_p) /**< ecma-string */
+{
+  lit_utf8_byte_t buffer[ECMA_HEAP_SNAPSHOT_MAX_STRING_SIZE];
+
+  ssize_t size = ecma_string_to_utf8_string (string_p, buffer, (ssize_t) sizeof (buffer));
+
+  if (size < 0)
+  {
+    return false;
+  }
+
+  ecma_heap_snapshot_append_json_string (output_p, buffer, (lit_utf8_size_t) size);
+
+  return true;
+} /* ecma_heap_snapshot_append_ecma_string */
+
+/**
+ * Get identifier of an object's node
+ *
+ * @return non-zero identifier
+ */
+static uint32_t
+ecma_heap_snapshot_get_node_id (const ecma_object_t *object_p) /**< object or lexical environment */
+{
+  return (uint32_t) mem_compress_pointer (object_p);
+} /* ecma_heap_snapshot_get_node_id */
+
+/**
+ * Start an edge, appending its type and name
+ *
+ * The name is either an ecma-string (if name_string_p is not NULL), or a zero-terminated string.
+ */
+static void
+ecma_heap_snapshot_start_edge (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                               bool *is_first_edge_p, /**< in: is the edge first in the node's edges list,
+                                                       *   out: false */
+                               const char *type_p, /**< edge's type */
+                               const ecma_string_t *name_string_p, /**< edge's name as ecma-string, or NULL */
+                               const char *name_p) /**< edge's name, if name_string_p is NULL */
+{
+  ecma_heap_snapshot_append_string (output_p, *is_first_edge_p ? "\n    {\"type\":\"" : ",\n    {\"type\":\"");
+  *is_first_edge_p = false;
+
+  ecma_heap_snapshot_append_string (output_p, type_p);
+  ecma_heap_snapshot_append_string (output_p, "\",\"name\":");
+
+  if (name_string_p == NULL
+      || !ecma_heap_snapshot_append_ecma_string (output_p, name_string_p))
+  {
+    ecma_heap_snapshot_append_char (output_p, '"');
+    ecma_heap_snapshot_append_string (output_p, name_string_p == NULL ? name_p : "(long name)");
+    ecma_heap_snapshot_append_char (output_p, '"');
+  }
+} /* ecma_heap_snapshot_start_edge */
+
+/**
+ * Append an edge, referencing an object
+ */
+static void
+ecma_heap_snapshot_append_object_edge (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                       bool *is_first_edge_p, /**< in: is the edge first in the node's edges list,
+                                                               *   out: false */
+                                       const char *type_p, /**< edge's type */
+                                       const ecma_string_t *name_string_p, /**< edge's name as ecma-string,
+                                                                            *   or NULL */
+                                       const char *name_p, /**< edge's name, if name_string_p is NULL */
+                                       const ecma_object_t *object_p) /**< referenced object */
+{
+  ecma_heap_snapshot_start_edge (output_p, is_first_edge_p, type_p, name_string_p, name_p);
+  ecma_heap_snapshot_append_string (output_p, ",\"to\":");
+  ecma_heap_snapshot_append_uint (output_p, ecma_heap_snapshot_get_node_id (object_p));
+  ecma_heap_snapshot_append_char (output_p, '}');
+} /* ecma_heap_snapshot_append_object_edge */
+
+/**
+ * Append an edge, holding an ecma-value
+ */
+static void
+ecma_heap_snapshot_append_value_edge (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                      bool *is_first_edge_p, /**< in: is the edge first in the node's edges list,
+                                                              *   out: false */
+                                      const char *type_p, /**< edge's type */
+                                      const ecma_string_t *name_string_p, /**< edge's name */
+                                      ecma_value_t value) /**< the value */
+{
+  if (ecma_is_value_object (value))
+  {
+    ecma_heap_snapshot_append_object_edge (output_p,
+                                           is_first_edge_p,
+                                           type_p,
+                                           name_string_p,
+                                           NULL,
+                                           ecma_get_object_from_value (value));
+    return;
+  }
+
+  ecma_heap_snapshot_start_edge (output_p, is_first_edge_p, type_p, name_string_p, NULL);
+
+  if (ecma_is_value_undefined (value) || ecma_is_value_empty (value))
+  {
+    ecma_heap_snapshot_append_string (output_p, ",\"value_type\":\"undefined\"");
+  }
+  else if (ecma_is_value_null (value))
+  {
+    ecma_heap_snapshot_append_string (output_p, ",\"value_type\":\"null\"");
+  }
+  else if (ecma_is_value_boolean (value))
+  {
+    ecma_heap_snapshot_append_string (output_p, ",\"value_type\":\"boolean\",\"value\":");
+    ecma_heap_snapshot_append_string (output_p, ecma_is_value_true (value) ? "\"true\"" : "\"false\"");
+  }
+  else if (ecma_is_value_number (value))
+  {
+    lit_utf8_byte_t buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+    lit_utf8_size_t size = ecma_number_to_utf8_string (*ecma_get_number_from_value (value),
+                                                       buffer,
+                                                       (ssize_t) sizeof (buffer));
+
+    ecma_heap_snapshot_append_string (output_p, ",\"value_type\":\"number\",\"value\":");
+    ecma_heap_snapshot_append_json_string (output_p, buffer, size);
+  }
+  else
+  {
+    JERRY_ASSERT (ecma_is_value_string (value));
+
+    const ecma_string_t *string_p = ecma_get_string_from_value (value);
+
+    ecma_heap_snapshot_append_string (output_p, ",\"value_type\":\"string\",\"size\":");
+    ecma_heap_snapshot_append_uint (output_p, ecma_string_get_size (string_p));
+    ecma_heap_snapshot_append_string (output_p, ",\"value\":");
+
+    if (!ecma_heap_snapshot_append_ecma_string (output_p, string_p))
+    {
+      ecma_heap_snapshot_append_string (output_p, "\"\",\"truncated\":true");
+    }
+  }
+
+  ecma_heap_snapshot_append_char (output_p, '}');
+} /* ecma_heap_snapshot_append_value_edge */
+
+/**
+ * Append the synthetic root node, referencing objects, that are roots for the garbage collector
+ */
+static void
+ecma_heap_snapshot_append_roots_node (ecma_heap_snapshot_output_t *output_p) /**< output buffer */
+{
+  bool is_first_edge = true;
+
+  ecma_heap_snapshot_append_string (output_p, "\n  {\"id\":0,\"type\":\"(roots)\",\"class\":\"(roots)\","
+                                    "\"builtin\":false,\"size\":0,\"refs\":0,\"edges\":[");
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
+    if (ecma_gc_get_object_refs (obj_iter_p) > 0)
+    {
+      ecma_heap_snapshot_append_object_edge (output_p, &is_first_edge, "reference", NULL, "(engine)", obj_iter_p);
+    }
+  }
+
+  for (ecma_stack_frame_t *frame_iter_p = ecma_stack_get_top_frame ();
+       frame_iter_p != NULL;
+       frame_iter_p = frame_iter_p->prev_frame_p)
+  {
+    for (int32_t reg_index = 0; reg_index < frame_iter_p->regs_number; reg_index++)
+    {
+      ecma_value_t reg_value = ecma_stack_frame_get_reg_value (frame_iter_p, reg_index);
+
+      if (ecma_is_value_object (reg_value))
+      {
+        ecma_heap_snapshot_append_object_edge (output_p,
+                                               &is_first_edge,
+                                               "register",
+                                               NULL,
+                                               "(register)",
+                                               ecma_get_object_from_value (reg_value));
+      }
+    }
+  }
+
+  ecma_heap_snapshot_append_string (output_p, "]}");
+} /* ecma_heap_snapshot_append_roots_node */
+
+/**
+ * Append node of an object or a lexical environment
+ */
+static void
+ecma_heap_snapshot_append_object_node (ecma_heap_snapshot_output_t *output_p, /**< output buffer */
+                                       ecma_object_t *object_p) /**< object or lexical environment */
+{
+  bool is_lex_env = ecma_is_lexical_environment (object_p);
+
+  /* object-bound lexical environments have no properties, but reference the binding object */
+  bool traverse_properties = (!is_lex_env
+                              || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  uint32_t properties_number = 0;
+
+  if (traverse_properties)
+  {
+    for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+         property_p != NULL;
+         property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+    {
+      properties_number++;
+    }
+  }
+
+  ecma_heap_snapshot_append_string (output_p, ",\n  {\"id\":");
+  ecma_heap_snapshot_append_uint (output_p, ecma_heap_snapshot_get_node_id (object_p));
+
+  if (is_lex_env)
+  {
+    ecma_heap_snapshot_append_string (output_p, ",\"type\":\"lexical environment\",\"class\":");
+
+    ecma_heap_snapshot_append_string (output_p,
+                                      traverse_properties ? "\"declarative\",\"builtin\":false"
+                                                          : "\"object-bound\",\"builtin\":false");
+  }
+  else
+  {
+    lit_magic_string_id_t class_name;
+
+    switch (ecma_get_object_type (object_p))
+    {
+      case ECMA_OBJECT_TYPE_FUNCTION:
+      case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+      case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+      case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
+      {
+        ecma_heap_snapshot_append_string (output_p, ",\"type\":\"function\",\"class\":");
+        class_name = LIT_MAGIC_STRING_FUNCTION_UL;
+        break;
+      }
+      case ECMA_OBJECT_TYPE_ARRAY:
+      {
+        ecma_heap_snapshot_append_string (output_p, ",\"type\":\"object\",\"class\":");
+        class_name = LIT_MAGIC_STRING_ARRAY_UL;
+        break;
+      }
+      case ECMA_OBJECT_TYPE_STRING:
+      {
+        ecma_heap_snapshot_append_string (output_p, ",\"type\":\"object\",\"class\":");
+        class_name = LIT_MAGIC_STRING_STRING_UL;
+        break;
+      }
+      case ECMA_OBJECT_TYPE_ARGUMENTS:
+      {
+        ecma_heap_snapshot_append_string (output_p, ",\"type\":\"object\",\"class\":");
+        class_name = LIT_MAGIC_STRING_ARGUMENTS_UL;
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL);
+
+        ecma_property_t *class_prop_p = ecma_find_internal_property (object_p, ECMA_INTERNAL_PROPERTY_CLASS);
+
+        ecma_heap_snapshot_append_string (output_p, ",\"type\":\"object\",\"class\":");
+        class_name = (class_prop_p == NULL ? LIT_MAGIC_STRING_OBJECT_UL
+                                           : (lit_magic_string_id_t) class_prop_p->u.internal_property.value);
+        break;
+      }
+    }
+
+    ecma_heap_snapshot_append_magic_string (output_p, class_name);
+    ecma_heap_snapshot_append_string (output_p,
+                                      ecma_get_object_is_builtin (object_p) ? ",\"builtin\":true"
+                                                                            : ",\"builtin\":false");
+  }
+
+  ecma_heap_snapshot_append_string (output_p, ",\"size\":");
+  ecma_heap_snapshot_append_uint (output_p, (uint32_t) (MEM_POOL_CHUNK_SIZE * (1u + properties_number)));
+  ecma_heap_snapshot_append_string (output_p, ",\"refs\":");
+  ecma_heap_snapshot_append_uint (output_p, ecma_gc_get_object_refs (object_p));
+  ecma_heap_snapshot_append_string (output_p, ",\"edges\":[");
+
+  bool is_first_edge = true;
+
+  if (is_lex_env)
+  {
+    ecma_object_t *outer_lex_env_p = ecma_get_lex_env_outer_reference (object_p);
+
+    if (outer_lex_env_p != NULL)
+    {
+      ecma_heap_snapshot_append_object_edge (output_p, &is_first_edge, "outer", NULL, "(outer)", outer_lex_env_p);
+    }
+
+    if (!traverse_properties)
+    {
+      ecma_heap_snapshot_append_object_edge (output_p,
+                                             &is_first_edge,
+                                             "binding",
+                                             NULL,
+                                             "(binding object)",
+                                             ecma_get_lex_env_binding_object (object_p));
+    }
+  }
+  else
+  {
+    ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
+
+    if (proto_p != NULL)
+    {
+      ecma_heap_snapshot_append_object_edge (output_p, &is_first_edge, "prototype", NULL, "__proto__", proto_p);
+    }
+  }
+
+  if (traverse_properties)
+  {
+    for (ecma_property_t *property_p = ecma_get_property_list (object_p);
+         property_p != NULL;
+         property_p = ECMA_GET_POINTER (ecma_property_t, property_p->next_property_p))
+    {
+      switch ((ecma_property_type_t) property_p->type)
+      {
+        case ECMA_PROPERTY_NAMEDDATA:
+        {
+          ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                             property_p->u.named_data_property.name_p);
+
+          ecma_heap_snapshot_append_value_edge (output_p,
+                                                &is_first_edge,
+                                                is_lex_env ? "variable" : "property",
+                                                name_p,
+                                                ecma_get_named_data_property_value (property_p));
+          break;
+        }
+
+        case ECMA_PROPERTY_NAMEDACCESSOR:
+        {
+          ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                             property_p->u.named_accessor_property.name_p);
+          ecma_object_t *getter_obj_p = ecma_get_named_accessor_property_getter (property_p);
+          ecma_object_t *setter_obj_p = ecma_get_named_accessor_property_setter (property_p);
+
+          if (getter_obj_p != NULL)
+          {
+            ecma_heap_snapshot_append_object_edge (output_p, &is_first_edge, "getter", name_p, NULL, getter_obj_p);
+          }
+
+          if (setter_obj_p != NULL)
+          {
+            ecma_heap_snapshot_append_object_edge (output_p, &is_first_edge, "setter", name_p, NULL, setter_obj_p);
+          }
+
+          break;
+        }
+
+        case ECMA_PROPERTY_INTERNAL:
+        {
+          /* only the internal properties, traversed by the garbage collector, reference objects */
+          ecma_internal_property_id_t property_id = (ecma_internal_property_id_t) property_p->u.internal_property.type;
+
+          if (property_id == ECMA_INTERNAL_PROPERTY_SCOPE
+              || property_id == ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP)
+          {
+            ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, property_p->u.internal_property.value);
+
+            ecma_heap_snapshot_append_object_edge (output_p,
+                                                   &is_first_edge,
+                                                   "internal",
+                                                   NULL,
+                                                   (property_id == ECMA_INTERNAL_PROPERTY_SCOPE ? "[[Scope]]"
+                                                                                                : "[[ParameterMap]]"),
+                                                   obj_p);
+          }
+
+          break;
+        }
+      }
+    }
+  }
+
+  ecma_heap_snapshot_append_string (output_p, "]}");
+} /* ecma_heap_snapshot_append_object_node */
+
+/**
+ * Run garbage collection and write snapshot of the remaining objects and lexical environments to the file
+ *
+ * @return true - if the snapshot was written successfully,
+ *         false - if the file could not be opened or written.
+ */
+bool
+ecma_heap_snapshot_dump (const char *file_name_p) /**< output file name */
+{
+  FILE *file_p = fopen (file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  /* only reachable objects are included, so the snapshot doesn't depend on time of the last collection */
+  ecma_gc_run (ECMA_GC_CAUSE_HEAP_SNAPSHOT);
+
+  ecma_heap_snapshot_output_t output;
+  output.file_p = file_p;
+  output.is_write_failed = false;
+  output.size = 0;
+
+  ecma_heap_snapshot_append_string (&output, "{\"format\":\"jerry-heap-snapshot\",\"version\":1,\"heap\":{\"size\":");
+  ecma_heap_snapshot_append_uint (&output, (uint32_t) JERRY_CONTEXT (mem_heap).heap_size);
+  ecma_heap_snapshot_append_string (&output, ",\"allocated_bytes\":");
+  ecma_heap_snapshot_append_uint (&output, (uint32_t) JERRY_CONTEXT (mem_heap).allocated_bytes);
+  ecma_heap_snapshot_append_string (&output, "},\"nodes\":[");
+
+  ecma_heap_snapshot_append_roots_node (&output);
+
+  for (ecma_object_t *obj_iter_p = JERRY_CONTEXT (ecma_gc_objects_lists)[ECMA_GC_COLOR_WHITE_GRAY];
+       obj_iter_p != NULL;
+       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  {
+    ecma_heap_snapshot_append_object_node (&output, obj_iter_p);
+  }
+
+  ecma_heap_snapshot_append_string (&output, "\n]}\n");
+  ecma_heap_snapshot_flush (&output);
+
+  return (fclose (file_p) == 0 && !output.is_write_failed);
+} /* ecma_heap_snapshot_dump */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_ENABLE_HEAP_SNAPSHOT */
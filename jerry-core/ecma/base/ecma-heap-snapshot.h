@@ -0,0 +1,37 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HEAP_SNAPSHOT_H
+#define ECMA_HEAP_SNAPSHOT_H
+
+#ifdef JERRY_ENABLE_HEAP_SNAPSHOT
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapsnapshot Heap snapshot
+ * @{
+ */
+
+extern bool ecma_heap_snapshot_dump (const char *file_name_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_ENABLE_HEAP_SNAPSHOT */
+
+#endif /* !ECMA_HEAP_SNAPSHOT_H */
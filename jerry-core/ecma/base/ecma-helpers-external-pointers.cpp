@@ -30,6 +30,7 @@
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  *
@@ -43,6 +44,7 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
                                        ecma_external_pointer_t ptr_value) /**< value to store in the property */
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || id == ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
                 || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
 
@@ -83,6 +85,7 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  *
@@ -96,6 +99,7 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
                                  ecma_external_pointer_t *out_pointer_p) /**< out: value of the external pointer */
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || id == ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
                 || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
 
@@ -130,6 +134,7 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  */
@@ -137,6 +142,7 @@ void
 ecma_free_external_pointer_in_property (ecma_property_t *prop_p) /**< internal property */
 {
   JERRY_ASSERT (prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE
                 || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
                 || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
 
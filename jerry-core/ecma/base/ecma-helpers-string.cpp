@@ -620,7 +620,12 @@ ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t id) /**<
 /**
  * Concatenate ecma-strings
  *
- * @return concatenation of two ecma-strings
+ * Note:
+ *      callers, concatenating strings of a script, should raise an error (see also: opfunc_addition),
+ *      if the concatenation is not performed because of its length.
+ *
+ * @return concatenation of two ecma-strings,
+ *         or NULL - if size of the concatenation would exceed ECMA_STRING_MAX_CONCATENATION_LENGTH.
  */
 ecma_string_t*
 ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
@@ -643,9 +648,9 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   int64_t length = (int64_t) str1_size + (int64_t) str2_size;
 
-  if (length > ECMA_STRING_MAX_CONCATENATION_LENGTH)
+  if (unlikely (length > ECMA_STRING_MAX_CONCATENATION_LENGTH))
   {
-    jerry_fatal (ERR_OUT_OF_MEMORY);
+    return NULL;
   }
 
   ecma_string_t* string_desc_p = ecma_alloc_string ();
@@ -718,6 +723,7 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       ecma_string_t *part2_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, string_desc_p->u.concatenation.string2_cp);
 
       new_str_p = ecma_concat_ecma_strings (part1_p, part2_p);
+      JERRY_ASSERT (new_str_p != NULL);
 
       break;
     }
@@ -786,7 +792,7 @@ ecma_copy_or_ref_ecma_string (ecma_string_t *string_desc_p) /**< string descript
 
       /* First trying to free unreachable objects that maybe refer to the string */
       ecma_lcache_invalidate_all ();
-      ecma_gc_run ();
+      ecma_gc_run (ECMA_GC_CAUSE_STRING_REFS_OVERFLOW);
 
       if (current_refs == string_desc_p->refs)
       {
@@ -779,6 +779,7 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     }
 
     case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
+    case ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an external pointer */
     {
@@ -14,6 +14,7 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
@@ -37,6 +38,7 @@ ecma_init (void)
 {
   ecma_init_builtins ();
   ecma_lcache_init ();
+  ecma_eval_cache_init ();
   ecma_stack_init ();
   ecma_init_environment ();
 
@@ -55,7 +57,8 @@ ecma_finalize (void)
   ecma_stack_finalize ();
   ecma_finalize_builtins ();
   ecma_lcache_invalidate_all ();
-  ecma_gc_run ();
+  ecma_eval_cache_invalidate_all ();
+  ecma_gc_run (ECMA_GC_CAUSE_ENGINE_CLEANUP);
 } /* ecma_finalize */
 
 /**
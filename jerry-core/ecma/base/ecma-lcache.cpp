@@ -17,6 +17,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "jcontext.h"
 #include "jrt-libc-includes.h"
 
 /** \addtogroup ecma ECMA
@@ -27,45 +28,7 @@
  */
 
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-/**
- * Entry of LCache hash table
- */
-typedef struct
-{
-  /** Compressed pointer to object (ECMA_NULL_POINTER marks record empty) */
-  mem_cpointer_t object_cp;
-
-  /** Compressed pointer to property's name */
-  mem_cpointer_t prop_name_cp;
-
-  /** Compressed pointer to a property of the object */
-  mem_cpointer_t prop_cp;
-
-  /** Padding structure to 8 bytes size */
-  uint16_t padding;
-} ecma_lcache_hash_entry_t;
-
-JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
-
-/**
- * LCache hash value length, in bits
- */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
-
-/**
- * Number of rows in LCache's hash table
- */
-#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
-
-/**
- * Number of entries in a row of LCache's hash table
- */
-#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
-
-/**
- * LCache's hash table
- */
-static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == 4 * sizeof (mem_cpointer_t));
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -75,7 +38,7 @@ void
 ecma_lcache_init (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  memset (ecma_lcache_hash_table, 0, sizeof (ecma_lcache_hash_table));
+  memset (JERRY_CONTEXT (ecma_lcache_hash_table), 0, sizeof (JERRY_CONTEXT (ecma_lcache_hash_table)));
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_init */
 
@@ -116,9 +79,9 @@ ecma_lcache_invalidate_all (void)
   {
     for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
     {
-      if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp != ECMA_NULL_POINTER)
+      if (JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].object_cp != ECMA_NULL_POINTER)
       {
-        ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
+        ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ]);
       }
     }
   }
@@ -139,10 +102,10 @@ ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< in
 {
   for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp == object_cp
-        && ecma_lcache_hash_table[ row_index ][ entry_index ].prop_cp == property_cp)
+    if (JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].object_cp == object_cp
+        && JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ].prop_cp == property_cp)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
+      ecma_lcache_invalidate_entry (&JERRY_CONTEXT (ecma_lcache_hash_table)[ row_index ][ entry_index ]);
     }
   }
 } /* ecma_lcache_invalidate_row_for_object_property_pair */
@@ -165,6 +128,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   prop_name_p = ecma_copy_or_ref_ecma_string (prop_name_p);
 
   lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  ecma_lcache_hash_entry_t *row_p = JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key];
 
   if (prop_p != NULL)
   {
@@ -176,13 +140,12 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       int32_t entry_index;
       for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
       {
-        if (ecma_lcache_hash_table[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
-            && ecma_lcache_hash_table[hash_key][entry_index].prop_cp == prop_cp)
+        if (row_p[entry_index].object_cp != ECMA_NULL_POINTER
+            && row_p[entry_index].prop_cp == prop_cp)
         {
 #ifndef JERRY_NDEBUG
           ecma_object_t* obj_in_entry_p;
-          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                      ecma_lcache_hash_table[hash_key][entry_index].object_cp);
+          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, row_p[entry_index].object_cp);
           JERRY_ASSERT (obj_in_entry_p == object_p);
 #endif /* !JERRY_NDEBUG */
           break;
@@ -190,7 +153,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       }
 
       JERRY_ASSERT (entry_index != ECMA_LCACHE_HASH_ROW_LENGTH);
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][entry_index]);
+      ecma_lcache_invalidate_entry (&row_p[entry_index]);
     }
 
     JERRY_ASSERT (!ecma_is_property_lcached (prop_p));
@@ -200,7 +163,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   int32_t entry_index;
   for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
+    if (row_p[entry_index].object_cp == ECMA_NULL_POINTER)
     {
       break;
     }
@@ -211,16 +174,16 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
     /* No empty entry was found, invalidating the whole row */
     for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][i]);
+      ecma_lcache_invalidate_entry (&row_p[i]);
     }
 
     entry_index = 0;
   }
 
   ecma_ref_object (object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].object_cp, object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_name_cp, prop_name_p);
-  ECMA_SET_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_cp, prop_p);
+  ECMA_SET_NON_NULL_POINTER (row_p[ entry_index ].object_cp, object_p);
+  ECMA_SET_NON_NULL_POINTER (row_p[ entry_index ].prop_name_cp, prop_name_p);
+  ECMA_SET_POINTER (row_p[ entry_index ].prop_cp, prop_p);
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) prop_p;
 #endif /* CONFIG_ECMA_LCACHE_DISABLE */
@@ -244,20 +207,20 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  ecma_lcache_hash_entry_t *row_p = JERRY_CONTEXT (ecma_lcache_hash_table)[hash_key];
 
   unsigned int object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
-    if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
+    if (row_p[i].object_cp == object_cp)
     {
-      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                    ecma_lcache_hash_table[hash_key][i].prop_name_cp);
+      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, row_p[i].prop_name_cp);
 
       if (ecma_compare_ecma_strings_equal_hashes (prop_name_p, entry_prop_name_p))
       {
-        ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, ecma_lcache_hash_table[hash_key][i].prop_cp);
+        ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, row_p[i].prop_cp);
         JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
 
         *prop_p_p = prop_p;
@@ -15,6 +15,7 @@
 
 #include "ecma-helpers.h"
 #include "ecma-stack.h"
+#include "jcontext.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -35,18 +36,13 @@
 #define ECMA_STACK_SLOTS_IN_DYNAMIC_CHUNK ((ECMA_STACK_DYNAMIC_CHUNK_SIZE - sizeof (ecma_stack_chunk_header_t)) / \
                                            sizeof (ecma_value_t))
 
-/**
- * The top-most ecma-stack frame
- */
-ecma_stack_frame_t* ecma_stack_top_frame_p;
-
 /**
  * Initialize ecma-stack
  */
 void
 ecma_stack_init (void)
 {
-  ecma_stack_top_frame_p = NULL;
+  JERRY_CONTEXT (ecma_stack_top_frame_p) = NULL;
 } /* ecma_stack_init */
 
 /**
@@ -55,7 +51,7 @@ ecma_stack_init (void)
 void
 ecma_stack_finalize ()
 {
-  JERRY_ASSERT (ecma_stack_top_frame_p == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_stack_top_frame_p) == NULL);
 } /* ecma_stack_finalize */
 
 /**
@@ -66,7 +62,7 @@ ecma_stack_finalize ()
 ecma_stack_frame_t*
 ecma_stack_get_top_frame (void)
 {
-  return ecma_stack_top_frame_p;
+  return JERRY_CONTEXT (ecma_stack_top_frame_p);
 } /* ecma_stack_get_top_frame */
 
 /**
@@ -77,8 +73,8 @@ ecma_stack_add_frame (ecma_stack_frame_t *frame_p, /**< frame to initialize */
                       ecma_value_t *regs_p, /**< array of register variables' values */
                       int32_t regs_num) /**< number of register variables */
 {
-  frame_p->prev_frame_p = ecma_stack_top_frame_p;
-  ecma_stack_top_frame_p = frame_p;
+  frame_p->prev_frame_p = JERRY_CONTEXT (ecma_stack_top_frame_p);
+  JERRY_CONTEXT (ecma_stack_top_frame_p) = frame_p;
 
   frame_p->top_chunk_p = NULL;
   frame_p->dynamically_allocated_value_slots_p = frame_p->inlined_values;
@@ -102,9 +98,9 @@ void
 ecma_stack_free_frame (ecma_stack_frame_t *frame_p) /**< frame to initialize */
 {
   /* the frame should be the top-most frame */
-  JERRY_ASSERT (ecma_stack_top_frame_p == frame_p);
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_stack_top_frame_p) == frame_p);
 
-  ecma_stack_top_frame_p = frame_p->prev_frame_p;
+  JERRY_CONTEXT (ecma_stack_top_frame_p) = frame_p->prev_frame_p;
 
   while (frame_p->top_chunk_p != NULL)
   {
@@ -36,7 +36,7 @@
  */
 typedef struct
 {
-  uint16_t prev_chunk_p; /**< previous chunk of same frame */
+  mem_cpointer_t prev_chunk_p; /**< previous chunk of same frame */
 } ecma_stack_chunk_header_t;
 
 /**
@@ -378,6 +378,12 @@ ecma_builtin_array_prototype_join (const ecma_value_t this_arg, /**< this argume
       /* 10.a */
       ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
 
+      if (part_string_p == NULL)
+      {
+        ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+        break;
+      }
+
       /* 10.b, 10.c */
       ECMA_TRY_CATCH (next_string_value,
                       ecma_op_array_get_to_string_at_index (obj_p, k),
@@ -385,10 +391,18 @@ ecma_builtin_array_prototype_join (const ecma_value_t this_arg, /**< this argume
 
       ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
 
-      ecma_deref_ecma_string (return_string_p);
-
       /* 10.d */
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      ecma_string_t *concat_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+
+      if (concat_string_p == NULL)
+      {
+        ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+      }
+      else
+      {
+        ecma_deref_ecma_string (return_string_p);
+        return_string_p = concat_string_p;
+      }
 
       ECMA_FINALIZE (next_string_value);
 
@@ -529,15 +543,29 @@ ecma_builtin_array_prototype_object_to_locale_string (const ecma_value_t this_ar
     {
       ecma_string_t *part_string_p = ecma_concat_ecma_strings (return_string_p, separator_string_p);
 
+      if (part_string_p == NULL)
+      {
+        ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+        break;
+      }
+
       ECMA_TRY_CATCH (next_string_value,
                       ecma_builtin_helper_get_to_locale_string_at_index (obj_p, k),
                       ret_value);
 
       ecma_string_t *next_string_p = ecma_get_string_from_value (next_string_value);
 
-      ecma_deref_ecma_string (return_string_p);
+      ecma_string_t *concat_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
 
-      return_string_p = ecma_concat_ecma_strings (part_string_p, next_string_p);
+      if (concat_string_p == NULL)
+      {
+        ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+      }
+      else
+      {
+        ecma_deref_ecma_string (return_string_p);
+        return_string_p = concat_string_p;
+      }
 
       ECMA_FINALIZE (next_string_value);
 
@@ -15,6 +15,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-conversion.h"
+#include "ecma-eval-cache.h"
 #include "ecma-exceptions.h"
 #include "ecma-gc.h"
 #include "ecma-function-object.h"
@@ -138,10 +139,31 @@ ecma_builtin_function_dispatch_construct (const ecma_value_t *arguments_list_p,
     const opcode_t* opcodes_p;
     bool is_syntax_correct;
 
-    is_syntax_correct = parser_parse_new_function ((const jerry_api_char_t **) utf8_string_params_p,
-                                                   utf8_string_params_size,
-                                                   params_count,
-                                                   &opcodes_p);
+    opcodes_p = ecma_eval_cache_lookup ((const lit_utf8_byte_t **) utf8_string_params_p,
+                                        utf8_string_params_size,
+                                        params_count,
+                                        ECMA_EVAL_CACHE_FLAG_NEW_FUNCTION);
+
+    if (opcodes_p != NULL)
+    {
+      is_syntax_correct = true;
+    }
+    else
+    {
+      is_syntax_correct = parser_parse_new_function ((const jerry_api_char_t **) utf8_string_params_p,
+                                                     utf8_string_params_size,
+                                                     params_count,
+                                                     &opcodes_p);
+
+      if (is_syntax_correct)
+      {
+        ecma_eval_cache_insert ((const lit_utf8_byte_t **) utf8_string_params_p,
+                                utf8_string_params_size,
+                                params_count,
+                                ECMA_EVAL_CACHE_FLAG_NEW_FUNCTION,
+                                opcodes_p);
+      }
+    }
 
     if (!is_syntax_correct)
     {
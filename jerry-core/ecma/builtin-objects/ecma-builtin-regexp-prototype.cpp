@@ -162,15 +162,15 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
     ecma_property_t *source_prop_p = ecma_op_object_get_property (obj_p, magic_string_p);
     ecma_deref_ecma_string (magic_string_p);
 
-    ecma_string_t *src_sep_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_SLASH_CHAR);
     ecma_string_t *source_str_p = ecma_get_string_from_value (source_prop_p->u.named_data_property.value);
-    ecma_string_t *output_str_p = ecma_concat_ecma_strings (src_sep_str_p, ecma_copy_or_ref_ecma_string (source_str_p));
-    ecma_deref_ecma_string (source_str_p);
 
-    ecma_string_t *concat_p = ecma_concat_ecma_strings (output_str_p, src_sep_str_p);
-    ecma_deref_ecma_string (src_sep_str_p);
-    ecma_deref_ecma_string (output_str_p);
-    output_str_p = concat_p;
+    /* Parts of the output: '/', source, '/' and the flags */
+    ecma_string_t *parts_p[6];
+    uint32_t parts_number = 0;
+
+    parts_p[parts_number++] = ecma_get_magic_string (LIT_MAGIC_STRING_SLASH_CHAR);
+    parts_p[parts_number++] = ecma_copy_or_ref_ecma_string (source_str_p);
+    parts_p[parts_number++] = ecma_get_magic_string (LIT_MAGIC_STRING_SLASH_CHAR);
 
     /* Check the global flag */
     magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_GLOBAL);
@@ -179,11 +179,7 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
 
     if (ecma_is_value_true (global_prop_p->u.named_data_property.value))
     {
-      ecma_string_t *g_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_G_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, g_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (g_flag_str_p);
-      output_str_p = concat_p;
+      parts_p[parts_number++] = ecma_get_magic_string (LIT_MAGIC_STRING_G_CHAR);
     }
 
     /* Check the ignoreCase flag */
@@ -193,28 +189,44 @@ ecma_builtin_regexp_prototype_to_string (ecma_value_t this_arg) /**< this argume
 
     if (ecma_is_value_true (ignorecase_prop_p->u.named_data_property.value))
     {
-      ecma_string_t *ic_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_I_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, ic_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (ic_flag_str_p);
-      output_str_p = concat_p;
+      parts_p[parts_number++] = ecma_get_magic_string (LIT_MAGIC_STRING_I_CHAR);
     }
 
-    /* Check the global flag */
+    /* Check the multiline flag */
     magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_MULTILINE);
     ecma_property_t *multiline_prop_p = ecma_op_object_get_property (obj_p, magic_string_p);
     ecma_deref_ecma_string (magic_string_p);
 
     if (ecma_is_value_true (multiline_prop_p->u.named_data_property.value))
     {
-      ecma_string_t *m_flag_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_M_CHAR);
-      concat_p = ecma_concat_ecma_strings (output_str_p, m_flag_str_p);
-      ecma_deref_ecma_string (output_str_p);
-      ecma_deref_ecma_string (m_flag_str_p);
-      output_str_p = concat_p;
+      parts_p[parts_number++] = ecma_get_magic_string (LIT_MAGIC_STRING_M_CHAR);
     }
 
-    ret_value = ecma_make_normal_completion_value (ecma_make_string_value (output_str_p));
+    JERRY_ASSERT (parts_number <= sizeof (parts_p) / sizeof (parts_p[0]));
+
+    /* the source can be as long as the longest string, so the output can be too long */
+    ecma_string_t *output_str_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+
+    for (uint32_t i = 0; i < parts_number; i++)
+    {
+      if (output_str_p != NULL)
+      {
+        ecma_string_t *concat_p = ecma_concat_ecma_strings (output_str_p, parts_p[i]);
+        ecma_deref_ecma_string (output_str_p);
+        output_str_p = concat_p;
+      }
+
+      ecma_deref_ecma_string (parts_p[i]);
+    }
+
+    if (output_str_p == NULL)
+    {
+      ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+    }
+    else
+    {
+      ret_value = ecma_make_normal_completion_value (ecma_make_string_value (output_str_p));
+    }
 
     ECMA_FINALIZE (obj_this);
   }
@@ -178,7 +178,15 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
 
     string_to_return = ecma_concat_ecma_strings (string_to_return, ecma_get_string_from_value (get_arg_string));
 
-    ecma_deref_ecma_string (string_temp);
+    if (string_to_return == NULL)
+    {
+      ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+      string_to_return = string_temp;
+    }
+    else
+    {
+      ecma_deref_ecma_string (string_temp);
+    }
 
     ECMA_FINALIZE (get_arg_string);
   }
@@ -19,6 +19,7 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "jrt-bit-fields.h"
 
 #define ECMA_BUILTINS_INTERNAL
@@ -39,11 +40,6 @@ ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id,
                                ecma_length_t arguments_number);
 static void ecma_instantiate_builtin (ecma_builtin_id_t id);
 
-/**
- * Pointer to instances of built-in objects
- */
-static ecma_object_t* ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
-
 /**
  * Check if passed object is the instance of specified built-in.
  */
@@ -54,7 +50,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   JERRY_ASSERT (obj_p != NULL && !ecma_is_lexical_environment (obj_p));
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (ecma_builtin_objects[builtin_id] == NULL)
+  if (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL)
   {
     /* If a built-in object is not instantiated,
      * the specified object cannot be the built-in object */
@@ -62,7 +58,7 @@ ecma_builtin_is (ecma_object_t *obj_p, /**< pointer to an object */
   }
   else
   {
-    return (obj_p == ecma_builtin_objects[builtin_id]);
+    return (obj_p == JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
   }
 } /* ecma_builtin_is */
 
@@ -76,14 +72,14 @@ ecma_builtin_get (ecma_builtin_id_t builtin_id) /**< id of built-in to check on
 {
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
 
-  if (unlikely (ecma_builtin_objects[builtin_id] == NULL))
+  if (unlikely (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL))
   {
     ecma_instantiate_builtin (builtin_id);
   }
 
-  ecma_ref_object (ecma_builtin_objects[builtin_id]);
+  ecma_ref_object (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id]);
 
-  return ecma_builtin_objects[builtin_id];
+  return JERRY_CONTEXT (ecma_builtin_objects)[builtin_id];
 } /* ecma_builtin_get */
 
 /**
@@ -188,7 +184,7 @@ ecma_init_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    ecma_builtin_objects[id] = NULL;
+    JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
   }
 } /* ecma_init_builtins */
 
@@ -208,7 +204,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                 lowercase_name) \
     case builtin_id: \
     { \
-      JERRY_ASSERT (ecma_builtin_objects[builtin_id] == NULL); \
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] == NULL); \
       if (is_static) \
       { \
         ecma_builtin_ ## lowercase_name ## _sort_property_names (); \
@@ -221,11 +217,11 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
       } \
       else \
       { \
-        if (ecma_builtin_objects[object_prototype_builtin_id] == NULL) \
+        if (JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id] == NULL) \
         { \
           ecma_instantiate_builtin (object_prototype_builtin_id); \
         } \
-        prototype_obj_p = ecma_builtin_objects[object_prototype_builtin_id]; \
+        prototype_obj_p = JERRY_CONTEXT (ecma_builtin_objects)[object_prototype_builtin_id]; \
         JERRY_ASSERT (prototype_obj_p != NULL); \
       } \
       \
@@ -233,7 +229,7 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
                                                                prototype_obj_p, \
                                                                object_type, \
                                                                is_extensible); \
-      ecma_builtin_objects[builtin_id] = builtin_obj_p; \
+      JERRY_CONTEXT (ecma_builtin_objects)[builtin_id] = builtin_obj_p; \
       \
       break; \
     }
@@ -258,11 +254,11 @@ ecma_finalize_builtins (void)
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
   {
-    if (ecma_builtin_objects[id] != NULL)
+    if (JERRY_CONTEXT (ecma_builtin_objects)[id] != NULL)
     {
-      ecma_deref_object (ecma_builtin_objects[id]);
+      ecma_deref_object (JERRY_CONTEXT (ecma_builtin_objects)[id]);
 
-      ecma_builtin_objects[id] = NULL;
+      JERRY_CONTEXT (ecma_builtin_objects)[id] = NULL;
     }
   }
 } /* ecma_finalize_builtins */
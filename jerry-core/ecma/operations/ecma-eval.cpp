@@ -16,6 +16,7 @@
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -91,10 +92,34 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
 
   bool is_strict_call = (is_direct && is_called_from_strict_mode_code);
 
-  is_syntax_correct = parser_parse_eval (code_p,
-                                         code_buffer_size,
-                                         is_strict_call,
-                                         &opcodes_p);
+  uint8_t cache_flags = 0;
+  if (is_strict_call)
+  {
+    cache_flags |= ECMA_EVAL_CACHE_FLAG_STRICT;
+  }
+  if (is_direct)
+  {
+    cache_flags |= ECMA_EVAL_CACHE_FLAG_DIRECT;
+  }
+
+  opcodes_p = ecma_eval_cache_lookup (&code_p, &code_buffer_size, 1, cache_flags);
+
+  if (opcodes_p != NULL)
+  {
+    is_syntax_correct = true;
+  }
+  else
+  {
+    is_syntax_correct = parser_parse_eval (code_p,
+                                           code_buffer_size,
+                                           is_strict_call,
+                                           &opcodes_p);
+
+    if (is_syntax_correct)
+    {
+      ecma_eval_cache_insert (&code_p, &code_buffer_size, 1, cache_flags, opcodes_p);
+    }
+  }
 
   if (!is_syntax_correct)
   {
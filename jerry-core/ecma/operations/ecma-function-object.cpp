@@ -24,6 +24,9 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
+#include "jcontext.h"
+#include "parser.h"
+#include "serializer.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -211,7 +214,7 @@ ecma_op_create_function_object (ecma_string_t* formal_parameter_list_p[], /**< f
 
   // 12.
   ecma_property_t *opcodes_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
-  MEM_CP_SET_NON_NULL_POINTER (opcodes_prop_p->u.internal_property.value, opcodes_p);
+  opcodes_prop_p->u.internal_property.value = serializer_compress_bytecode_pointer (opcodes_p);
 
   ecma_property_t *code_prop_p = ecma_create_internal_property (f, ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
   code_prop_p->u.internal_property.value = ecma_pack_code_internal_property_value (is_strict,
@@ -630,6 +633,10 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                               arguments_list_p,
                                               arguments_list_len);
     }
+    else if (unlikely (JERRY_CONTEXT (vm_call_depth) >= CONFIG_VM_MAX_CALL_DEPTH))
+    {
+      ret_value = ecma_raise_range_error ("Maximum call stack size exceeded");
+    }
     else
     {
       /* Entering Function Code (ECMA-262 v5, 10.4.3) */
@@ -645,11 +652,30 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       // 8.
       bool is_strict;
       bool do_instantiate_args_obj;
-      const opcode_t *opcodes_p = MEM_CP_GET_POINTER (const opcode_t, opcodes_prop_p->u.internal_property.value);
+      const opcode_t *opcodes_p = serializer_decompress_bytecode_pointer (opcodes_prop_p->u.internal_property.value);
       opcode_counter_t code_first_opcode_idx = ecma_unpack_code_internal_property_value (code_prop_value,
                                                                                          &is_strict,
                                                                                          &do_instantiate_args_obj);
 
+      uint32_t lazy_function_idx;
+
+      if (unlikely (vm_is_lazy_function_stub (opcodes_p, code_first_opcode_idx, &lazy_function_idx)))
+      {
+        /* first call of the function object, which body was skipped by the parser */
+        if (!parser_compile_lazy_function (lazy_function_idx, &opcodes_p))
+        {
+          return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_SYNTAX));
+        }
+
+        /* the compiled code starts right after its scope code flags */
+        code_first_opcode_idx = 1;
+
+        opcodes_prop_p->u.internal_property.value = serializer_compress_bytecode_pointer (opcodes_p);
+        code_prop_p->u.internal_property.value = ecma_pack_code_internal_property_value (is_strict,
+                                                                                         do_instantiate_args_obj,
+                                                                                         code_first_opcode_idx);
+      }
+
       ecma_value_t this_binding;
       // 1.
       if (is_strict)
@@ -684,6 +710,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                                                do_instantiate_args_obj),
                       ret_value);
 
+      JERRY_CONTEXT (vm_call_depth)++;
+
       ecma_completion_value_t completion = vm_run_from_pos (opcodes_p,
                                                             code_first_opcode_idx,
                                                             this_binding,
@@ -691,6 +719,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                                             is_strict,
                                                             false);
 
+      JERRY_CONTEXT (vm_call_depth)--;
+
       if (ecma_is_completion_value_return (completion))
       {
         ret_value = ecma_make_normal_completion_value (ecma_get_completion_value_value (completion));
@@ -721,11 +751,28 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
                                                          &handler_p);
     JERRY_ASSERT (is_retrieved);
 
-    ret_value = jerry_dispatch_external_function (func_obj_p,
-                                                  handler_p,
-                                                  this_arg_value,
-                                                  arguments_list_p,
-                                                  arguments_list_len);
+    ecma_external_pointer_t signature_p;
+    bool is_fast_call = ecma_get_external_pointer_value (func_obj_p,
+                                                         ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE,
+                                                         &signature_p);
+
+    if (is_fast_call)
+    {
+      ret_value = jerry_dispatch_external_fast_function (func_obj_p,
+                                                         handler_p,
+                                                         signature_p,
+                                                         this_arg_value,
+                                                         arguments_list_p,
+                                                         arguments_list_len);
+    }
+    else
+    {
+      ret_value = jerry_dispatch_external_function (func_obj_p,
+                                                    handler_p,
+                                                    this_arg_value,
+                                                    arguments_list_p,
+                                                    arguments_list_len);
+    }
   }
   else
   {
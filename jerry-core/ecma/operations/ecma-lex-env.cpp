@@ -20,6 +20,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
+#include "jcontext.h"
 #include "jrt.h"
 
 /** \addtogroup ecma ECMA
@@ -36,13 +37,6 @@
  * @{
  */
 
-/**
- * Global lexical environment
- *
- * See also: ECMA-262 v5, 10.2.3
- */
-ecma_object_t* ecma_global_lex_env_p = NULL;
-
 /**
  * Initialize Global environment
  */
@@ -50,11 +44,11 @@ void
 ecma_init_environment (void)
 {
 #ifdef CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE
-  ecma_global_lex_env_p = ecma_create_decl_lex_env (NULL);
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ecma_create_decl_lex_env (NULL);
 #else /* !CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE */
   ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
 
-  ecma_global_lex_env_p = ecma_create_object_lex_env (NULL, glob_obj_p, false);
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ecma_create_object_lex_env (NULL, glob_obj_p, false);
 
   ecma_deref_object (glob_obj_p);
 #endif /* !CONFIG_ECMA_GLOBAL_ENVIRONMENT_DECLARATIVE */
@@ -66,8 +60,8 @@ ecma_init_environment (void)
 void
 ecma_finalize_environment (void)
 {
-  ecma_deref_object (ecma_global_lex_env_p);
-  ecma_global_lex_env_p = NULL;
+  ecma_deref_object (JERRY_CONTEXT (ecma_global_lex_env_p));
+  JERRY_CONTEXT (ecma_global_lex_env_p) = NULL;
 } /* ecma_finalize_environment */
 
 /**
@@ -78,9 +72,9 @@ ecma_finalize_environment (void)
 ecma_object_t*
 ecma_get_global_environment (void)
 {
-  ecma_ref_object (ecma_global_lex_env_p);
+  ecma_ref_object (JERRY_CONTEXT (ecma_global_lex_env_p));
 
-  return ecma_global_lex_env_p;
+  return JERRY_CONTEXT (ecma_global_lex_env_p);
 } /* ecma_get_global_environment */
 
 /**
@@ -95,7 +89,7 @@ ecma_is_lexical_environment_global (ecma_object_t *lex_env_p) /**< lexical envir
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
 
-  return (lex_env_p == ecma_global_lex_env_p);
+  return (lex_env_p == JERRY_CONTEXT (ecma_global_lex_env_p));
 } /* ecma_is_lexical_environment_global */
 
 /**
@@ -492,13 +492,13 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         if (!ecma_is_completion_value_throw (match_value))
         {
           re_ctx_p->recursion_depth--;
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
           }
           else
           {
-            JERRY_ASSERT (ecma_is_value_boolean (match_value));
+            JERRY_ASSERT (ecma_is_completion_value_normal_false (match_value));
             /* restore saved */
             memcpy (re_ctx_p->saved_p, saved_bck_p, size);
           }
@@ -618,7 +618,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           uint32_t offset = re_get_value (&bc_p);
           const lit_utf8_byte_t *sub_str_p;
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -702,7 +702,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
 
         /* Try to match after the close paren if zero is allowed */
         ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-        if (ecma_is_value_true (match_value))
+        if (ecma_is_completion_value_normal_true (match_value))
         {
           *res_p = sub_str_p;
           re_ctx_p->recursion_depth--;
@@ -760,7 +760,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         {
           offset = re_get_value (&bc_p);
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -783,7 +783,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         {
           JERRY_ASSERT (end_bc_p);
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, end_bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -838,7 +838,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
 
           const lit_utf8_byte_t *sub_str_p;
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -907,7 +907,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           old_start_p = re_ctx_p->saved_p[start_idx];
           re_ctx_p->saved_p[start_idx] = str_p;
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -931,7 +931,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
             re_ctx_p->saved_p[start_idx] = str_p;
 
             ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-            if (ecma_is_value_true (match_value))
+            if (ecma_is_completion_value_normal_true (match_value))
             {
               *res_p = sub_str_p;
               re_ctx_p->recursion_depth--;
@@ -952,7 +952,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         {
           /* Try to match the rest of the bytecode. */
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, old_bc_p, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -988,7 +988,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           if (num_of_iter >= min)
           {
             ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p + offset, str_p, &sub_str_p);
-            if (ecma_is_value_true (match_value))
+            if (ecma_is_completion_value_normal_true (match_value))
             {
               *res_p = sub_str_p;
               re_ctx_p->recursion_depth--;
@@ -1001,7 +1001,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
           }
 
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (!ecma_is_value_true (match_value))
+          if (!ecma_is_completion_value_normal_true (match_value))
           {
             break;
           }
@@ -1031,7 +1031,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         while (num_of_iter < max)
         {
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p, str_p, &sub_str_p);
-          if (!ecma_is_value_true (match_value))
+          if (!ecma_is_completion_value_normal_true (match_value))
           {
             break;
           }
@@ -1046,7 +1046,7 @@ re_match_regexp (re_matcher_ctx_t *re_ctx_p, /**< RegExp matcher context */
         while (num_of_iter >= min)
         {
           ecma_completion_value_t match_value = re_match_regexp (re_ctx_p, bc_p + offset, str_p, &sub_str_p);
-          if (ecma_is_value_true (match_value))
+          if (ecma_is_completion_value_normal_true (match_value))
           {
             *res_p = sub_str_p;
             re_ctx_p->recursion_depth--;
@@ -0,0 +1,40 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+
+/** \addtogroup context Engine context
+ * @{
+ */
+
+/**
+ * Default engine context
+ *
+ * Note:
+ *      As our libc library doesn't call constructors of static variables,
+ *      the context is initialized by the components' initializers (see also: jerry_init).
+ */
+jerry_ctx_t jerry_default_ctx;
+
+#ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+/**
+ * Active engine context
+ */
+JERRY_THREAD_LOCAL jerry_ctx_t *jerry_ctx_p = &jerry_default_ctx;
+#endif /* CONFIG_JERRY_ENABLE_CONTEXTS */
+
+/**
+ * @}
+ */
@@ -0,0 +1,167 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JCONTEXT_H
+#define JCONTEXT_H
+
+#include <signal.h>
+
+#include "bytecode-data.h"
+#include "ecma-builtins.h"
+#include "ecma-eval-cache.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-lcache.h"
+#include "ecma-stack.h"
+#include "jerry.h"
+#include "lit-literal-storage.h"
+#include "lit-magic-strings.h"
+#include "mem-alloc-profiler.h"
+#include "mem-allocator.h"
+#include "mem-heap.h"
+#include "mem-poolman.h"
+#include "opcodes.h"
+#include "vm-profiler.h"
+#include "vm-sampling-profiler.h"
+
+/** \addtogroup context Engine context
+ * @{
+ */
+
+typedef struct jerry_ctx_t jerry_ctx_t;
+
+/**
+ * Engine context
+ *
+ * The structure holds state of an engine instance, that is kept between API calls:
+ * heap and pools, literal storage, garbage collector's lists, property lookup cache,
+ * instances of built-in objects, byte-code and interpreter's state.
+ *
+ * Note:
+ *      state of parser is not the part of the context, as it is not kept between API calls.
+ */
+struct jerry_ctx_t
+{
+  /*
+   * Memory allocators
+   */
+  mem_heap_state_t mem_heap; /**< heap state */
+  struct mem_pool_state_t *mem_pools; /**< lists of pools */
+  size_t mem_free_chunks_number; /**< number of free chunks in the pools */
+  /** the 'try to give memory back' callbacks (in order of registration) */
+  mem_try_give_memory_back_callback_t mem_try_give_memory_back_callbacks[MEM_TRY_GIVE_MEMORY_BACK_CALLBACKS_NUMBER];
+  uint32_t mem_try_give_memory_back_callbacks_number; /**< number of registered 'try to give memory back'
+                                                       *   callbacks */
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  bool mem_is_heap_area_mapped; /**< is the heap's area mapped by the allocator (see also: mem_init_with_heap_size) */
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
+#ifdef MEM_STATS
+  mem_heap_stats_t mem_heap_stats; /**< heap's memory usage statistics */
+  mem_pools_stats_t mem_pools_stats; /**< pools' memory usage statistics */
+#endif /* MEM_STATS */
+#ifdef MEM_ALLOC_PROFILER
+  mem_alloc_profiler_state_t mem_alloc_profiler; /**< allocation-site profiler's state */
+#endif /* MEM_ALLOC_PROFILER */
+
+  /*
+   * Literals
+   */
+  lit_literal_storage_t lit_storage; /**< literal storage */
+  const lit_utf8_byte_t **lit_magic_string_ex_array; /**< external magic strings */
+  uint32_t lit_magic_string_ex_count; /**< number of external magic strings */
+  const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< sizes of external magic strings */
+
+  /*
+   * ECMA
+   */
+  ecma_object_t *ecma_gc_objects_lists[ECMA_GC_COLOR__COUNT]; /**< lists of marked (visited during current
+                                                               *   GC session) and unmarked objects */
+  bool ecma_gc_visited_flip_flag; /**< current state of an object's visited flag
+                                   *   (see also: ecma_gc_is_object_visited) */
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  ecma_gc_log_t ecma_gc_log; /**< descriptions of the most recent garbage collections */
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  /** LCache's hash table */
+  ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+#if CONFIG_ECMA_EVAL_CACHE_SIZE != 0
+  /** cache of byte-code, compiled from eval code and Function constructor's arguments (in order of use) */
+  ecma_eval_cache_entry_t ecma_eval_cache[CONFIG_ECMA_EVAL_CACHE_SIZE];
+#endif /* CONFIG_ECMA_EVAL_CACHE_SIZE != 0 */
+  ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< instances of built-in objects */
+  ecma_object_t *ecma_global_lex_env_p; /**< global lexical environment */
+  ecma_stack_frame_t *ecma_stack_top_frame_p; /**< the top-most ecma-stack frame */
+
+  /*
+   * Byte-code and interpreter
+   */
+  bytecode_data_t bytecode_data; /**< byte-code of parsed scripts */
+  const opcode_t *vm_program_p; /**< byte-code of global code */
+  int_data_t *vm_top_context_p; /**< top (current) interpreter context */
+  uint32_t vm_call_depth; /**< number of active calls of functions with JavaScript code
+                           *   (see also: CONFIG_VM_MAX_CALL_DEPTH) */
+  uint32_t vm_execution_budget_left; /**< number of interrupt checks, left in the current run's execution budget,
+                                      *   or 0 - if the budget is not limited (see also: vm_check_interrupt) */
+  bool vm_is_interrupted; /**< is the current run interrupted */
+  volatile sig_atomic_t vm_is_interrupt_requested; /**< flag, indicating that interruption of the current run
+                                                    *   was requested (see also: vm_request_interrupt) */
+#ifdef MEM_STATS
+  uint32_t vm_mem_stats_print_indentation; /**< indentation of per-opcode memory statistics dump */
+  bool vm_mem_stats_enabled; /**< is per-opcode memory statistics dump enabled */
+#endif /* MEM_STATS */
+#ifdef VM_OPCODE_PROFILER
+  vm_profiler_state_t vm_profiler; /**< opcode profiler's counters */
+#endif /* VM_OPCODE_PROFILER */
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  vm_sampling_profiler_state_t vm_sampling_profiler; /**< sampling profiler's state */
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
+
+  /*
+   * API
+   */
+  jerry_flag_t jerry_flags; /**< run-time configuration flags */
+  bool jerry_api_available; /**< API availability flag */
+  /** embedder's memory pressure callback (see also: jerry_api_register_memory_pressure_callback) */
+  jerry_api_memory_pressure_callback_t jerry_memory_pressure_callback;
+  size_t jerry_memory_budget; /**< budget of heap usage for each run (see also: jerry_set_memory_budget) */
+  uint32_t jerry_execution_budget; /**< execution budget of each run (see also: jerry_set_execution_budget) */
+  uint32_t jerry_run_depth; /**< number of nested runs of code, requested through API */
+#ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+  jerry_ctx_t *prev_ctx_p; /**< context, that was active before the context was pushed */
+#endif /* CONFIG_JERRY_ENABLE_CONTEXTS */
+};
+
+extern jerry_ctx_t jerry_default_ctx;
+
+#ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+extern JERRY_THREAD_LOCAL jerry_ctx_t *jerry_ctx_p;
+
+/**
+ * Access a field of the active engine context
+ */
+# define JERRY_CONTEXT(field) (jerry_ctx_p->field)
+#else /* CONFIG_JERRY_ENABLE_CONTEXTS */
+/**
+ * Access a field of the engine context
+ */
+# define JERRY_CONTEXT(field) (jerry_default_ctx.field)
+#endif /* !CONFIG_JERRY_ENABLE_CONTEXTS */
+
+/**
+ * @}
+ */
+
+#endif /* !JCONTEXT_H */
@@ -38,6 +38,11 @@ typedef enum
 {
   JERRY_COMPLETION_CODE_OK                  = 0, /**< successful completion */
   JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION = 1, /**< exception occured and it was not handled */
+  JERRY_COMPLETION_CODE_INVALID_SNAPSHOT    = 2, /**< snapshot is corrupted or was generated
+                                                  *   by an incompatible version of the engine */
+  JERRY_COMPLETION_CODE_INTERRUPTED         = 3, /**< execution was interrupted upon request or upon exhaustion
+                                                  *   of the execution budget (see also: jerry_request_interrupt,
+                                                  *   jerry_set_execution_budget) */
 } jerry_completion_code_t;
 
 /**
@@ -124,6 +129,15 @@ typedef struct jerry_api_value_t
   };
 } jerry_api_value_t;
 
+/**
+ * Description of an object's field for bulk object creation
+ */
+typedef struct
+{
+  jerry_api_string_t *name_p; /**< field name (preferably, created with jerry_api_create_interned_string_sz) */
+  jerry_api_value_t value; /**< field value */
+} jerry_api_object_field_t;
+
 /**
  * Jerry external function handler type
  */
@@ -133,11 +147,193 @@ typedef bool (*jerry_external_handler_t) (const jerry_api_object_t *function_obj
                                           const jerry_api_value_t args_p[],
                                           const jerry_api_length_t args_count);
 
+/**
+ * Jerry's raw engine value
+ *
+ * The values are passed to fast external function handlers as is, without conversion
+ * to jerry_api_value_t and without acquiring references to strings / objects.
+ *
+ * Bit-field structure: type (2) | value (30)
+ *
+ * Warning:
+ *         a raw value should only be inspected through jerry_api_raw_* accessors
+ */
+typedef uint32_t jerry_api_raw_value_t;
+
+/**
+ * Type field of raw value
+ */
+#define JERRY_API_RAW_VALUE_TYPE_MASK   (0x3u)
+#define JERRY_API_RAW_VALUE_TYPE_SIMPLE (0x0u) /**< undefined, null or boolean */
+#define JERRY_API_RAW_VALUE_TYPE_NUMBER (0x1u) /**< number */
+#define JERRY_API_RAW_VALUE_TYPE_STRING (0x2u) /**< string */
+#define JERRY_API_RAW_VALUE_TYPE_OBJECT (0x3u) /**< object */
+
+/**
+ * Raw simple values
+ */
+#define JERRY_API_RAW_VALUE_UNDEFINED   (0x4u)  /**< undefined */
+#define JERRY_API_RAW_VALUE_NULL        (0x8u)  /**< null */
+#define JERRY_API_RAW_VALUE_FALSE       (0xCu)  /**< false */
+#define JERRY_API_RAW_VALUE_TRUE        (0x10u) /**< true */
+
+/**
+ * Types of fast external function's arguments
+ */
+typedef enum
+{
+  JERRY_API_FAST_ARG_RAW, /**< argument is passed as raw value */
+  JERRY_API_FAST_ARG_BOOLEAN, /**< argument is converted with ToBoolean and passed unboxed */
+  JERRY_API_FAST_ARG_INT32, /**< argument is converted with ToInt32 and passed unboxed */
+  JERRY_API_FAST_ARG_UINT32, /**< argument is converted with ToUint32 and passed unboxed */
+  JERRY_API_FAST_ARG_FLOAT64 /**< argument is converted with ToNumber and passed unboxed */
+} jerry_api_fast_arg_type_t;
+
+/**
+ * Signature of a fast external function
+ *
+ * Note:
+ *      arguments that are not described by the signature are passed as raw values,
+ *      described arguments that are missing in a call are converted from undefined.
+ */
+typedef struct
+{
+  const jerry_api_fast_arg_type_t *arg_types_p; /**< types of arguments */
+  jerry_api_length_t args_count; /**< number of described arguments */
+} jerry_api_fast_signature_t;
+
+/**
+ * Argument of a fast external function (member is selected by the function's signature)
+ */
+typedef union
+{
+  jerry_api_raw_value_t v_raw; /**< raw value */
+  bool v_bool; /**< boolean */
+  int32_t v_int32; /**< number converted to 32-bit signed integer */
+  uint32_t v_uint32; /**< number converted to 32-bit unsigned integer */
+  double v_float64; /**< number */
+} jerry_api_fast_arg_t;
+
+/**
+ * Jerry fast external function handler type
+ *
+ * Note:
+ *      raw values of 'this' argument and of arguments are valid only during the handler's call;
+ *      value stored to ret_val_p should be created with one of jerry_api_raw_make_* routines
+ *      or copied with jerry_api_raw_copy_value, as the engine takes ownership of the value.
+ */
+typedef bool (*jerry_external_fast_handler_t) (const jerry_api_object_t *function_obj_p,
+                                               const jerry_api_raw_value_t this_val,
+                                               jerry_api_raw_value_t *ret_val_p,
+                                               const jerry_api_fast_arg_t args_p[],
+                                               const jerry_api_length_t args_count);
+
 /**
  * An object's native free callback
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * Severity of memory pressure (see also: jerry_api_register_memory_pressure_callback)
+ *
+ * Upon memory pressure, callbacks are called with increasing severity until enough memory is freed.
+ */
+typedef enum
+{
+  JERRY_API_MEMORY_PRESSURE_LOW, /**< heap usage reached the soft limit, or the engine's threshold
+                                 *   of garbage collection */
+  JERRY_API_MEMORY_PRESSURE_MEDIUM, /**< heap usage is still above the limit after the engine's garbage collection */
+  JERRY_API_MEMORY_PRESSURE_HIGH, /**< heap usage is still above the limit after releasing the engine's caches */
+  JERRY_API_MEMORY_PRESSURE_CRITICAL /**< an allocation failed, and the engine would be terminated
+                                      *   with ERR_OUT_OF_MEMORY, unless memory is freed */
+} jerry_api_memory_pressure_severity_t;
+
+/**
+ * Memory pressure callback
+ *
+ * The callback is expected to release references to objects and values, held by the embedder
+ * (for example, caches), in accordance with the severity.
+ *
+ * Warning:
+ *         the callback is called during an allocation, so it should not create values or run scripts.
+ */
+typedef void (*jerry_api_memory_pressure_callback_t) (jerry_api_memory_pressure_severity_t severity);
+
+/**
+ * Check if raw value is undefined
+ */
+static inline bool
+jerry_api_raw_is_undefined (jerry_api_raw_value_t value) /**< raw value */
+{
+  return (value == JERRY_API_RAW_VALUE_UNDEFINED);
+} /* jerry_api_raw_is_undefined */
+
+/**
+ * Check if raw value is null
+ */
+static inline bool
+jerry_api_raw_is_null (jerry_api_raw_value_t value) /**< raw value */
+{
+  return (value == JERRY_API_RAW_VALUE_NULL);
+} /* jerry_api_raw_is_null */
+
+/**
+ * Check if raw value is boolean
+ */
+static inline bool
+jerry_api_raw_is_boolean (jerry_api_raw_value_t value) /**< raw value */
+{
+  return (value == JERRY_API_RAW_VALUE_TRUE || value == JERRY_API_RAW_VALUE_FALSE);
+} /* jerry_api_raw_is_boolean */
+
+/**
+ * Get boolean from raw value
+ *
+ * Warning:
+ *         the value should be boolean
+ */
+static inline bool
+jerry_api_raw_get_boolean (jerry_api_raw_value_t value) /**< raw value */
+{
+  return (value == JERRY_API_RAW_VALUE_TRUE);
+} /* jerry_api_raw_get_boolean */
+
+/**
+ * Check if raw value is number
+ */
+static inline bool
+jerry_api_raw_is_number (jerry_api_raw_value_t value) /**< raw value */
+{
+  return ((value & JERRY_API_RAW_VALUE_TYPE_MASK) == JERRY_API_RAW_VALUE_TYPE_NUMBER);
+} /* jerry_api_raw_is_number */
+
+/**
+ * Check if raw value is string
+ */
+static inline bool
+jerry_api_raw_is_string (jerry_api_raw_value_t value) /**< raw value */
+{
+  return ((value & JERRY_API_RAW_VALUE_TYPE_MASK) == JERRY_API_RAW_VALUE_TYPE_STRING);
+} /* jerry_api_raw_is_string */
+
+/**
+ * Check if raw value is object
+ */
+static inline bool
+jerry_api_raw_is_object (jerry_api_raw_value_t value) /**< raw value */
+{
+  return ((value & JERRY_API_RAW_VALUE_TYPE_MASK) == JERRY_API_RAW_VALUE_TYPE_OBJECT);
+} /* jerry_api_raw_is_object */
+
+/**
+ * Make raw boolean value
+ */
+static inline jerry_api_raw_value_t
+jerry_api_raw_make_boolean (bool value) /**< boolean */
+{
+  return (value ? JERRY_API_RAW_VALUE_TRUE : JERRY_API_RAW_VALUE_FALSE);
+} /* jerry_api_raw_make_boolean */
+
 extern EXTERN_C ssize_t
 jerry_api_string_to_char_buffer (const jerry_api_string_t *string_p,
                                  jerry_api_char_t *buffer_p,
@@ -160,8 +356,13 @@ jerry_api_string_t *jerry_api_create_string (const jerry_api_char_t *v);
 extern EXTERN_C
 jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_api_size_t);
 extern EXTERN_C
+jerry_api_string_t *jerry_api_create_interned_string_sz (const jerry_api_char_t *, jerry_api_size_t);
+extern EXTERN_C
 jerry_api_object_t* jerry_api_create_object (void);
 extern EXTERN_C
+jerry_api_object_t* jerry_api_create_object_with_fields (const jerry_api_object_field_t *fields_p,
+                                                         jerry_api_length_t fields_count);
+extern EXTERN_C
 jerry_api_object_t* jerry_api_create_error (jerry_api_error_t error_type,
                                             const jerry_api_char_t *message_p);
 extern EXTERN_C
@@ -170,6 +371,33 @@ jerry_api_object_t* jerry_api_create_error_sz (jerry_api_error_t error_type,
                                                jerry_api_size_t message_size);
 extern EXTERN_C
 jerry_api_object_t* jerry_api_create_external_function (jerry_external_handler_t handler_p);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_create_external_function_fast (jerry_external_fast_handler_t handler_p,
+                                                             const jerry_api_fast_signature_t *signature_p);
+
+/*
+ * Numbers and strings are stored in the engine's heap, and are addressed from raw values with compressed pointers,
+ * so accessors of their content are not inline (unlike type checks above); to receive numbers without the calls,
+ * describe the arguments in the handler's signature (JERRY_API_FAST_ARG_INT32 / UINT32 / FLOAT64).
+ */
+extern EXTERN_C
+double jerry_api_raw_get_number (jerry_api_raw_value_t value);
+extern EXTERN_C
+ssize_t jerry_api_raw_get_string_bytes (jerry_api_raw_value_t value,
+                                        jerry_api_char_t *buffer_p,
+                                        ssize_t buffer_size);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_raw_get_object (jerry_api_raw_value_t value);
+extern EXTERN_C
+jerry_api_raw_value_t jerry_api_raw_make_number (double value);
+extern EXTERN_C
+jerry_api_raw_value_t jerry_api_raw_make_string_sz (const jerry_api_char_t *v, jerry_api_size_t v_size);
+extern EXTERN_C
+jerry_api_raw_value_t jerry_api_raw_make_object (jerry_api_object_t *object_p);
+extern EXTERN_C
+jerry_api_raw_value_t jerry_api_raw_copy_value (jerry_api_raw_value_t value);
+extern EXTERN_C
+void jerry_api_raw_release_value (jerry_api_raw_value_t value);
 
 extern EXTERN_C
 bool jerry_api_is_function (const jerry_api_object_t *object_p);
@@ -197,6 +425,12 @@ bool jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p,
                                           jerry_api_size_t field_name_size,
                                           jerry_api_value_t *field_value_p);
 
+extern EXTERN_C
+bool jerry_api_get_object_field_values (jerry_api_object_t *object_p,
+                                        jerry_api_string_t *const *field_names_p,
+                                        jerry_api_value_t *field_values_p,
+                                        jerry_api_length_t fields_count);
+
 extern EXTERN_C
 bool jerry_api_set_object_field_value (jerry_api_object_t *object_p,
                                        const jerry_api_char_t *field_name_p,
@@ -239,6 +473,16 @@ jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *source_p,
 extern EXTERN_C
 jerry_api_object_t* jerry_api_get_global (void);
 
+extern EXTERN_C
+bool jerry_api_dump_heap_snapshot (const char *file_name_p);
+
+extern EXTERN_C
+bool jerry_api_register_memory_pressure_callback (jerry_api_memory_pressure_callback_t callback);
+extern EXTERN_C
+void jerry_api_unregister_memory_pressure_callback (jerry_api_memory_pressure_callback_t callback);
+extern EXTERN_C
+bool jerry_api_set_heap_limits (size_t soft_limit, size_t hard_limit);
+
 extern EXTERN_C
 void jerry_register_external_magic_strings (const jerry_api_char_ptr_t* ex_str_items,
                                             uint32_t count,
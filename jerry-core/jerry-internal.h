@@ -30,6 +30,14 @@ jerry_dispatch_external_function (ecma_object_t *function_object_p,
                                   const ecma_value_t args_p[],
                                   ecma_length_t args_count);
 
+extern ecma_completion_value_t
+jerry_dispatch_external_fast_function (ecma_object_t *function_object_p,
+                                       ecma_external_pointer_t handler_p,
+                                       ecma_external_pointer_t signature_p,
+                                       ecma_value_t this_arg_value,
+                                       const ecma_value_t args_p[],
+                                       ecma_length_t args_count);
+
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p,
                                      ecma_external_pointer_t native_p);
@@ -17,17 +17,25 @@
 
 #include "ecma-alloc.h"
 #include "ecma-builtins.h"
+#include "ecma-conversion.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-heap-snapshot.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "ecma-try-catch-macro.h"
+#include "jcontext.h"
+#include "lit-literal.h"
 #include "lit-magic-strings.h"
+#include "mem-heap.h"
+#include "mem-poolman.h"
 #include "parser.h"
 #include "serializer.h"
+#include "vm.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -47,16 +55,6 @@ const char *jerry_commit_hash = JERRY_COMMIT_HASH;
  */
 const char *jerry_branch_name = JERRY_BRANCH_NAME;
 
-/**
- * Jerry run-time configuration flags
- */
-static jerry_flag_t jerry_flags;
-
-/**
- * Jerry API availability flag
- */
-static bool jerry_api_available;
-
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
  */
@@ -97,7 +95,7 @@ FILE *jerry_log_file = NULL;
 static void
 jerry_assert_api_available (void)
 {
-  if (!jerry_api_available)
+  if (!JERRY_CONTEXT (jerry_api_available))
   {
     JERRY_UNREACHABLE ();
   }
@@ -109,7 +107,7 @@ jerry_assert_api_available (void)
 static void
 jerry_make_api_available (void)
 {
-  jerry_api_available = true;
+  JERRY_CONTEXT (jerry_api_available) = true;
 } /* jerry_make_api_available */
 
 /**
@@ -118,9 +116,44 @@ jerry_make_api_available (void)
 static void
 jerry_make_api_unavailable (void)
 {
-  jerry_api_available = false;
+  JERRY_CONTEXT (jerry_api_available) = false;
 } /* jerry_make_api_unavailable */
 
+/**
+ * Start run of code, requested through API, activating per-run budgets if the run is not nested
+ * into another one (i.e. is not requested from an external function handler)
+ */
+static void
+jerry_start_run (void)
+{
+  if (JERRY_CONTEXT (jerry_run_depth)++ == 0)
+  {
+    mem_heap_start_budget (JERRY_CONTEXT (jerry_memory_budget));
+    vm_start_execution_budget (JERRY_CONTEXT (jerry_execution_budget));
+  }
+} /* jerry_start_run */
+
+/**
+ * Finish run of code, started with jerry_start_run
+ *
+ * @return true - if the run is not nested, and it was interrupted,
+ *         false - otherwise.
+ */
+static bool
+jerry_finish_run (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (jerry_run_depth) != 0);
+
+  if (--JERRY_CONTEXT (jerry_run_depth) == 0)
+  {
+    mem_heap_stop_budget ();
+
+    return vm_stop_execution_budget ();
+  }
+
+  return false;
+} /* jerry_finish_run */
+
 /**
  * Convert ecma-value to Jerry API value representation
  *
@@ -425,6 +458,32 @@ jerry_api_create_string_sz (const jerry_api_char_t *v, /**< string value */
                                          (lit_utf8_size_t) v_size);
 } /* jerry_api_create_string_sz */
 
+/**
+ * Create an interned string, i.e. a string that refers to an entry of the literal storage
+ *
+ * Note:
+ *      interned strings are intended to be created once and reused as property names
+ *      (see also: jerry_api_create_object_with_fields, jerry_api_get_object_field_values);
+ *      comparison of such a string with a property name, that was introduced by a script
+ *      through the same literal, does not require character-by-character comparison.
+ *
+ * Note:
+ *      caller should release the string with jerry_api_release_string, just when the value becomes unnecessary.
+ *
+ * @return pointer to created string
+ */
+jerry_api_string_t *
+jerry_api_create_interned_string_sz (const jerry_api_char_t *v, /**< string value */
+                                     jerry_api_size_t v_size) /**< size of the string in bytes */
+{
+  jerry_assert_api_available ();
+
+  literal_t lit = lit_find_or_create_literal_from_utf8_string ((const lit_utf8_byte_t *) v,
+                                                                (lit_utf8_size_t) v_size);
+
+  return ecma_new_ecma_string_from_lit_cp (lit_cpointer_t::compress (lit));
+} /* jerry_api_create_interned_string_sz */
+
 /**
  * Create an object
  *
@@ -441,6 +500,57 @@ jerry_api_create_object (void)
   return ecma_op_create_object_object_noarg ();
 } /* jerry_api_create_object */
 
+/**
+ * Create an object and initialize it with the specified fields
+ *
+ * Note:
+ *      each field is created as a writable, enumerable and configurable data property;
+ *      if a name is specified several times, the last value is used.
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created object
+ */
+jerry_api_object_t*
+jerry_api_create_object_with_fields (const jerry_api_object_field_t *fields_p, /**< fields to initialize
+                                                                                *   the object with */
+                                     jerry_api_length_t fields_count) /**< number of fields */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (fields_p != NULL || fields_count == 0);
+
+  ecma_object_t *obj_p = ecma_op_create_object_object_noarg ();
+
+  for (jerry_api_length_t field_index = 0; field_index < fields_count; field_index++)
+  {
+    ecma_string_t *field_name_p = fields_p[field_index].name_p;
+
+    ecma_value_t field_value;
+    jerry_api_convert_api_value_to_ecma_value (&field_value, &fields_p[field_index].value);
+
+    ecma_property_t *prop_p = ecma_find_named_property (obj_p, field_name_p);
+
+    if (prop_p == NULL)
+    {
+      prop_p = ecma_create_named_data_property (obj_p,
+                                                field_name_p,
+                                                true, /* writable */
+                                                true, /* enumerable */
+                                                true); /* configurable */
+    }
+
+    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDDATA);
+
+    ecma_named_data_property_assign_value (obj_p, prop_p, field_value);
+
+    ecma_free_value (field_value, true);
+  }
+
+  return obj_p;
+} /* jerry_api_create_object_with_fields */
+
 /**
  * Create an error object
  *
@@ -621,6 +731,371 @@ jerry_dispatch_external_function (ecma_object_t *function_object_p, /**< externa
   return completion_value;
 } /* jerry_dispatch_external_function */
 
+/**
+ * Check that fast external function's signature describes each argument with a known type
+ *
+ * @return true - if the signature is valid,
+ *         false - otherwise.
+ */
+static bool
+jerry_api_is_fast_signature_valid (const jerry_api_fast_signature_t *signature_p) /**< signature */
+{
+  if (signature_p->args_count != 0 && signature_p->arg_types_p == NULL)
+  {
+    return false;
+  }
+
+  for (jerry_api_length_t i = 0; i < signature_p->args_count; i++)
+  {
+    switch (signature_p->arg_types_p[i])
+    {
+      case JERRY_API_FAST_ARG_RAW:
+      case JERRY_API_FAST_ARG_BOOLEAN:
+      case JERRY_API_FAST_ARG_INT32:
+      case JERRY_API_FAST_ARG_UINT32:
+      case JERRY_API_FAST_ARG_FLOAT64:
+      {
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+} /* jerry_api_is_fast_signature_valid */
+
+/**
+ * Create an external function object with fast-call native handler
+ *
+ * Note:
+ *      the signature descriptor (if specified) is not copied, so it should be kept alive
+ *      while the function object exists (usually, it is a statically allocated descriptor);
+ *      if NULL is specified for the signature, all arguments are passed as raw values.
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created external function object - if the signature is valid,
+ *         NULL - otherwise (an argument's type is unknown).
+ */
+jerry_api_object_t*
+jerry_api_create_external_function_fast (jerry_external_fast_handler_t handler_p, /**< pointer to native handler
+                                                                                   *   for the function */
+                                         const jerry_api_fast_signature_t *signature_p) /**< signature of the handler
+                                                                                         *   or NULL */
+{
+  jerry_assert_api_available ();
+
+  if (signature_p != NULL
+      && !jerry_api_is_fast_signature_valid (signature_p))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *function_obj_p = ecma_op_create_external_function_object ((ecma_external_pointer_t) handler_p);
+
+  bool is_created = ecma_create_external_pointer_property (function_obj_p,
+                                                           ECMA_INTERNAL_PROPERTY_NATIVE_FAST_SIGNATURE,
+                                                           (ecma_external_pointer_t) signature_p);
+  JERRY_ASSERT (is_created);
+
+  return function_obj_p;
+} /* jerry_api_create_external_function_fast */
+
+/**
+ * Dispatch call to specified fast-call external function using the native handler
+ *
+ * Note:
+ *       arguments are passed to the handler as raw values, or, if it is specified by the handler's signature,
+ *       as unboxed numbers / booleans; if a conversion throws an exception, the handler is not called.
+ *
+ * Note:
+ *       if called native handler returns true, then dispatcher just returns value received
+ *       through 'return value' output argument, otherwise - throws the value as an exception.
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+jerry_dispatch_external_fast_function (ecma_object_t *function_object_p, /**< external function object */
+                                       ecma_external_pointer_t handler_p, /**< pointer to the function's
+                                                                           *   native handler */
+                                       ecma_external_pointer_t signature_p, /**< pointer to the handler's
+                                                                             *   signature or NULL */
+                                       ecma_value_t this_arg_value, /**< 'this' argument */
+                                       const ecma_value_t args_p[], /**< arguments list */
+                                       ecma_length_t args_count) /**< number of arguments */
+{
+  jerry_assert_api_available ();
+
+  JERRY_STATIC_ASSERT (sizeof (jerry_api_raw_value_t) == sizeof (ecma_value_t));
+
+  const jerry_api_fast_signature_t *signature_desc_p = (const jerry_api_fast_signature_t *) signature_p;
+
+  ecma_length_t fast_args_count = args_count;
+  if (signature_desc_p != NULL && signature_desc_p->args_count > fast_args_count)
+  {
+    fast_args_count = signature_desc_p->args_count;
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  MEM_DEFINE_LOCAL_ARRAY (fast_arg_values, fast_args_count, jerry_api_fast_arg_t);
+
+  for (ecma_length_t i = 0;
+       i < fast_args_count && ecma_is_completion_value_empty (ret_value);
+       i++)
+  {
+    ecma_value_t arg_value = (i < args_count ? args_p[i] : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+    jerry_api_fast_arg_type_t arg_type = JERRY_API_FAST_ARG_RAW;
+    if (signature_desc_p != NULL && i < signature_desc_p->args_count)
+    {
+      arg_type = signature_desc_p->arg_types_p[i];
+    }
+
+    switch (arg_type)
+    {
+      case JERRY_API_FAST_ARG_RAW:
+      {
+        fast_arg_values[i].v_raw = arg_value;
+
+        break;
+      }
+      case JERRY_API_FAST_ARG_BOOLEAN:
+      {
+        ecma_completion_value_t to_bool_completion = ecma_op_to_boolean (arg_value);
+        JERRY_ASSERT (ecma_is_completion_value_normal (to_bool_completion));
+
+        fast_arg_values[i].v_bool = ecma_is_completion_value_normal_true (to_bool_completion);
+
+        break;
+      }
+      case JERRY_API_FAST_ARG_INT32:
+      case JERRY_API_FAST_ARG_UINT32:
+      case JERRY_API_FAST_ARG_FLOAT64:
+      {
+        ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, arg_value, ret_value);
+
+        if (arg_type == JERRY_API_FAST_ARG_INT32)
+        {
+          fast_arg_values[i].v_int32 = ecma_number_to_int32 (arg_num);
+        }
+        else if (arg_type == JERRY_API_FAST_ARG_UINT32)
+        {
+          fast_arg_values[i].v_uint32 = ecma_number_to_uint32 (arg_num);
+        }
+        else
+        {
+          fast_arg_values[i].v_float64 = (double) arg_num;
+        }
+
+        ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
+
+        break;
+      }
+      default:
+      {
+        /* the signature was changed by the embedder after creation of the function */
+        ret_value = ecma_raise_type_error ("Invalid argument type in fast external function's signature");
+
+        break;
+      }
+    }
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    jerry_api_raw_value_t raw_ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+    bool is_successful = ((jerry_external_fast_handler_t) handler_p) (function_object_p,
+                                                                      this_arg_value,
+                                                                      &raw_ret_value,
+                                                                      fast_arg_values,
+                                                                      fast_args_count);
+
+    /* ownership on the returned value is passed from the handler to the completion value */
+    if (is_successful)
+    {
+      ret_value = ecma_make_normal_completion_value (raw_ret_value);
+    }
+    else
+    {
+      ret_value = ecma_make_throw_completion_value (raw_ret_value);
+    }
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (fast_arg_values);
+
+  return ret_value;
+} /* jerry_dispatch_external_fast_function */
+
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TYPE_MASK == ((1u << ECMA_VALUE_TYPE_WIDTH) - 1u) << ECMA_VALUE_TYPE_POS);
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TYPE_SIMPLE == (uint32_t) ECMA_TYPE_SIMPLE);
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TYPE_NUMBER == (uint32_t) ECMA_TYPE_NUMBER);
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TYPE_STRING == (uint32_t) ECMA_TYPE_STRING);
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TYPE_OBJECT == (uint32_t) ECMA_TYPE_OBJECT);
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_UNDEFINED == ((uint32_t) ECMA_SIMPLE_VALUE_UNDEFINED << ECMA_VALUE_VALUE_POS));
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_NULL == ((uint32_t) ECMA_SIMPLE_VALUE_NULL << ECMA_VALUE_VALUE_POS));
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_FALSE == ((uint32_t) ECMA_SIMPLE_VALUE_FALSE << ECMA_VALUE_VALUE_POS));
+JERRY_STATIC_ASSERT (JERRY_API_RAW_VALUE_TRUE == ((uint32_t) ECMA_SIMPLE_VALUE_TRUE << ECMA_VALUE_VALUE_POS));
+
+/**
+ * Get number from raw value
+ *
+ * Warning:
+ *         the value should be number
+ *
+ * @return the number
+ */
+double
+jerry_api_raw_get_number (jerry_api_raw_value_t value) /**< raw value */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (ecma_is_value_number (value));
+
+  return (double) *ecma_get_number_from_value (value);
+} /* jerry_api_raw_get_number */
+
+/**
+ * Copy UTF-8 bytes of string, represented with raw value, to specified buffer
+ *
+ * Warning:
+ *         the value should be string
+ *
+ * Note:
+ *      zero character is not appended at end of the copied bytes
+ *
+ * @return number of bytes, actually copied to the buffer - if string's content was copied successfully;
+ *         otherwise (in case size of buffer is insuficcient) - negative number, which is calculated
+ *         as negation of buffer size, that is required to hold the string's content.
+ */
+ssize_t
+jerry_api_raw_get_string_bytes (jerry_api_raw_value_t value, /**< raw value */
+                                jerry_api_char_t *buffer_p, /**< output characters buffer */
+                                ssize_t buffer_size) /**< size of output buffer */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (ecma_is_value_string (value));
+
+  return ecma_string_to_utf8_string (ecma_get_string_from_value (value),
+                                     (lit_utf8_byte_t *) buffer_p,
+                                     buffer_size);
+} /* jerry_api_raw_get_string_bytes */
+
+/**
+ * Get object from raw value
+ *
+ * Warning:
+ *         the value should be object
+ *
+ * Note:
+ *      reference to the object is not acquired, so the pointer is valid only while the raw value is valid;
+ *      to use the object after that, acquire it with jerry_api_acquire_object
+ *
+ * @return pointer to the object
+ */
+jerry_api_object_t*
+jerry_api_raw_get_object (jerry_api_raw_value_t value) /**< raw value */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (ecma_is_value_object (value));
+
+  return ecma_get_object_from_value (value);
+} /* jerry_api_raw_get_object */
+
+/**
+ * Make raw number value
+ *
+ * Note:
+ *      the value should be released with jerry_api_raw_release_value,
+ *      unless it is passed to the engine as return value of a fast external function.
+ *
+ * @return raw value
+ */
+jerry_api_raw_value_t
+jerry_api_raw_make_number (double value) /**< number */
+{
+  jerry_assert_api_available ();
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = static_cast<ecma_number_t> (value);
+
+  return ecma_make_number_value (num_p);
+} /* jerry_api_raw_make_number */
+
+/**
+ * Make raw string value
+ *
+ * Note:
+ *      the value should be released with jerry_api_raw_release_value,
+ *      unless it is passed to the engine as return value of a fast external function.
+ *
+ * @return raw value
+ */
+jerry_api_raw_value_t
+jerry_api_raw_make_string_sz (const jerry_api_char_t *v, /**< string characters */
+                              jerry_api_size_t v_size) /**< size of the string in bytes */
+{
+  jerry_assert_api_available ();
+
+  return ecma_make_string_value (ecma_new_ecma_string_from_utf8 ((lit_utf8_byte_t *) v,
+                                                                 (lit_utf8_size_t) v_size));
+} /* jerry_api_raw_make_string_sz */
+
+/**
+ * Make raw object value, acquiring reference to the object
+ *
+ * Note:
+ *      the value should be released with jerry_api_raw_release_value,
+ *      unless it is passed to the engine as return value of a fast external function.
+ *
+ * @return raw value
+ */
+jerry_api_raw_value_t
+jerry_api_raw_make_object (jerry_api_object_t *object_p) /**< object */
+{
+  jerry_assert_api_available ();
+
+  ecma_ref_object (object_p);
+
+  return ecma_make_object_value (object_p);
+} /* jerry_api_raw_make_object */
+
+/**
+ * Copy raw value (for example, to return an argument from fast external function)
+ *
+ * Note:
+ *      the copy should be released with jerry_api_raw_release_value,
+ *      unless it is passed to the engine as return value of a fast external function.
+ *
+ * @return copy of the raw value
+ */
+jerry_api_raw_value_t
+jerry_api_raw_copy_value (jerry_api_raw_value_t value) /**< raw value */
+{
+  jerry_assert_api_available ();
+
+  return ecma_copy_value (value, true);
+} /* jerry_api_raw_copy_value */
+
+/**
+ * Release raw value, created with one of jerry_api_raw_make_* routines or with jerry_api_raw_copy_value
+ */
+void
+jerry_api_raw_release_value (jerry_api_raw_value_t value) /**< raw value */
+{
+  jerry_assert_api_available ();
+
+  ecma_free_value (value, true);
+} /* jerry_api_raw_release_value */
+
 /**
  * Dispatch call to object's native free callback function
  *
@@ -832,31 +1307,85 @@ jerry_api_get_object_field_value_sz (jerry_api_object_t *object_p, /**< object *
 } /* jerry_api_get_object_field_value */
 
 /**
- * Set value of field in the specified object
+ * Get values of several fields of the specified object
  *
- * @return true, if field value was set successfully, i.e. upon the call:
- *                - field value is writable;
+ * Note:
+ *      values that were retrieved successfully should be freed
+ *      with jerry_api_release_value just when they become unnecessary.
+ *
+ * Note:
+ *      retrieval stops at first field, upon get of which an exception is thrown;
+ *      the field and all subsequent fields are set to undefined.
+ *
+ * @return true, if all field values were retrieved successfully,
  *         false - otherwise.
  */
 bool
-jerry_api_set_object_field_value (jerry_api_object_t *object_p, /**< object */
-                                  const jerry_api_char_t *field_name_p, /**< name of the field */
-                                  const jerry_api_value_t *field_value_p) /**< field value to set */
+jerry_api_get_object_field_values (jerry_api_object_t *object_p, /**< object */
+                                   jerry_api_string_t *const *field_names_p, /**< names of the fields */
+                                   jerry_api_value_t *field_values_p, /**< out: field values */
+                                   jerry_api_length_t fields_count) /**< number of fields */
 {
-  return jerry_api_set_object_field_value_sz (object_p,
-                                              field_name_p,
-                                              lit_zt_utf8_string_size (field_name_p),
-                                              field_value_p);
-}
+  jerry_assert_api_available ();
 
-/**
- * Set value of field in the specified object
- *
- * @return true, if field value was set successfully, i.e. upon the call:
- *                - field value is writable;
- *         false - otherwise.
- */
-bool
+  JERRY_ASSERT ((field_names_p != NULL && field_values_p != NULL) || fields_count == 0);
+
+  jerry_api_length_t field_index;
+
+  for (field_index = 0; field_index < fields_count; field_index++)
+  {
+    ecma_completion_value_t get_completion = ecma_op_object_get (object_p, field_names_p[field_index]);
+
+    if (!ecma_is_completion_value_normal (get_completion))
+    {
+      JERRY_ASSERT (ecma_is_completion_value_throw (get_completion));
+
+      ecma_free_completion_value (get_completion);
+      break;
+    }
+
+    jerry_api_convert_ecma_value_to_api_value (&field_values_p[field_index],
+                                               ecma_get_completion_value_value (get_completion));
+
+    ecma_free_completion_value (get_completion);
+  }
+
+  bool is_successful = (field_index == fields_count);
+
+  for (; field_index < fields_count; field_index++)
+  {
+    field_values_p[field_index].type = JERRY_API_DATA_TYPE_UNDEFINED;
+  }
+
+  return is_successful;
+} /* jerry_api_get_object_field_values */
+
+/**
+ * Set value of field in the specified object
+ *
+ * @return true, if field value was set successfully, i.e. upon the call:
+ *                - field value is writable;
+ *         false - otherwise.
+ */
+bool
+jerry_api_set_object_field_value (jerry_api_object_t *object_p, /**< object */
+                                  const jerry_api_char_t *field_name_p, /**< name of the field */
+                                  const jerry_api_value_t *field_value_p) /**< field value to set */
+{
+  return jerry_api_set_object_field_value_sz (object_p,
+                                              field_name_p,
+                                              lit_zt_utf8_string_size (field_name_p),
+                                              field_value_p);
+}
+
+/**
+ * Set value of field in the specified object
+ *
+ * @return true, if field value was set successfully, i.e. upon the call:
+ *                - field value is writable;
+ *         false - otherwise.
+ */
+bool
 jerry_api_set_object_field_value_sz (jerry_api_object_t *object_p, /**< object */
                                      const jerry_api_char_t *field_name_p, /**< name of the field */
                                      jerry_api_size_t field_name_size, /**< size of field name in bytes */
@@ -1003,6 +1532,8 @@ jerry_api_invoke_function (bool is_invoke_as_constructor, /**< true - invoke fun
 
   ecma_completion_value_t call_completion;
 
+  jerry_start_run ();
+
   if (is_invoke_as_constructor)
   {
     JERRY_ASSERT (this_arg_p == NULL);
@@ -1041,6 +1572,12 @@ jerry_api_invoke_function (bool is_invoke_as_constructor, /**< true - invoke fun
     is_successful = false;
   }
 
+  if (jerry_finish_run ())
+  {
+    /* the script could catch the interruption's error, but the call is not considered as completed */
+    is_successful = false;
+  }
+
   if (retval_p != NULL)
   {
     jerry_api_convert_ecma_value_to_api_value (retval_p,
@@ -1172,6 +1709,186 @@ jerry_api_get_global (void)
   return ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
 } /* jerry_api_get_global */
 
+/**
+ * Write snapshot of the engine's heap to the specified file
+ *
+ * Garbage collection is performed, and the remaining objects and lexical environments are written as a JSON graph:
+ * a node for each object (with its type, class and size) and an edge for each property, variable binding,
+ * prototype and scope reference (see also: ecma-heap-snapshot.cpp for description of the format).
+ *
+ * @return true - if the snapshot was written successfully,
+ *         false - if the file could not be written, or the snapshot is not supported in current
+ *                 build configuration (!JERRY_ENABLE_HEAP_SNAPSHOT).
+ */
+bool
+jerry_api_dump_heap_snapshot (const char *file_name_p) /**< name of the output file */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_ENABLE_HEAP_SNAPSHOT
+  return ecma_heap_snapshot_dump (file_name_p);
+#else /* JERRY_ENABLE_HEAP_SNAPSHOT */
+  (void) file_name_p;
+
+  JERRY_WARNING_MSG ("Ignoring heap snapshot request because of '!JERRY_ENABLE_HEAP_SNAPSHOT' build configuration.\n");
+
+  return false;
+#endif /* !JERRY_ENABLE_HEAP_SNAPSHOT */
+} /* jerry_api_dump_heap_snapshot */
+
+/**
+ * Pass memory pressure notification from the memory allocator to the embedder's callback
+ */
+static void
+jerry_run_memory_pressure_callback (mem_try_give_memory_back_severity_t severity) /**< severity of the request */
+{
+  JERRY_STATIC_ASSERT ((int) JERRY_API_MEMORY_PRESSURE_LOW == (int) MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW
+                       && (int) JERRY_API_MEMORY_PRESSURE_MEDIUM == (int) MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_MEDIUM
+                       && (int) JERRY_API_MEMORY_PRESSURE_HIGH == (int) MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH
+                       && (int) JERRY_API_MEMORY_PRESSURE_CRITICAL == (int) MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_CRITICAL);
+
+  JERRY_ASSERT (JERRY_CONTEXT (jerry_memory_pressure_callback) != NULL);
+
+  JERRY_CONTEXT (jerry_memory_pressure_callback) ((jerry_api_memory_pressure_severity_t) severity);
+} /* jerry_run_memory_pressure_callback */
+
+/**
+ * Register callback, that is called upon memory pressure, before the engine gives back its own memory
+ *
+ * The callback is called when heap usage exceeds the soft limit (see also: jerry_api_set_heap_limits),
+ * or when an allocation fails, with severity increasing until enough memory is freed. Besides, it is called
+ * with low severity each time heap usage reaches the engine's threshold of garbage collection.
+ *
+ * Note:
+ *      only one callback can be registered for an engine instance.
+ *
+ * @return true - if the callback was registered,
+ *         false - if another callback is already registered.
+ */
+bool
+jerry_api_register_memory_pressure_callback (jerry_api_memory_pressure_callback_t callback) /**< the callback */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (callback != NULL);
+
+  if (JERRY_CONTEXT (jerry_memory_pressure_callback) != NULL)
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (jerry_memory_pressure_callback) = callback;
+  mem_register_a_try_give_memory_back_callback (jerry_run_memory_pressure_callback);
+
+  return true;
+} /* jerry_api_register_memory_pressure_callback */
+
+/**
+ * Unregister memory pressure callback, registered with jerry_api_register_memory_pressure_callback
+ */
+void
+jerry_api_unregister_memory_pressure_callback (jerry_api_memory_pressure_callback_t callback) /**< the callback */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (JERRY_CONTEXT (jerry_memory_pressure_callback) == callback);
+
+  mem_unregister_a_try_give_memory_back_callback (jerry_run_memory_pressure_callback);
+  JERRY_CONTEXT (jerry_memory_pressure_callback) = NULL;
+} /* jerry_api_unregister_memory_pressure_callback */
+
+/**
+ * Set soft and hard limits of the engine's heap usage
+ *
+ * Upon exceeding the soft limit, memory pressure callbacks (the embedder's one, and then the engine's one)
+ * are called with severity increasing from low to high until heap usage returns under the limit,
+ * so the embedder can shed load gracefully. An allocation, that would exceed the hard limit,
+ * is handled as out of memory (the callbacks are called up to critical severity, and if not enough memory
+ * is freed, the engine is terminated with ERR_OUT_OF_MEMORY).
+ *
+ * Note:
+ *      zero value of the hard limit means that the limit is equal to heap size,
+ *      and zero value of the soft limit means that the limit is equal to the hard limit.
+ *
+ * @return true - if the limits were set,
+ *         false - if the soft limit is greater than the hard limit.
+ */
+bool
+jerry_api_set_heap_limits (size_t soft_limit, /**< soft limit of heap usage, in bytes */
+                           size_t hard_limit) /**< hard limit of heap usage, in bytes */
+{
+  jerry_assert_api_available ();
+
+  return mem_heap_set_limits (soft_limit, hard_limit);
+} /* jerry_api_set_heap_limits */
+
+/**
+ * Set budget of heap usage for each run of code (jerry_run, jerry_exec_snapshot, jerry_api_eval,
+ * jerry_api_call_function and jerry_api_construct_object)
+ *
+ * Upon exceeding the budget (if garbage collection can't return heap usage under the budget), RangeError
+ * is raised in the script, so the run can be unwound with a catchable error, and the engine remains usable.
+ * The budget is checked between execution of opcodes, so it can be exceeded by allocations of a single opcode
+ * (for example, a built-in routine).
+ *
+ * Note:
+ *      the budget is counted from heap usage at start of the run, and it is not reset by runs,
+ *      requested from external function handlers during the run.
+ *
+ * Note:
+ *      exhaustion of the whole heap still terminates the engine with ERR_OUT_OF_MEMORY,
+ *      so the budget should leave enough free heap space for the error's unwinding.
+ */
+void
+jerry_set_memory_budget (size_t budget) /**< number of bytes, that each run can allocate in addition
+                                         *   to heap usage at start of the run (0 - unlimited) */
+{
+  jerry_assert_api_available ();
+
+  JERRY_CONTEXT (jerry_memory_budget) = budget;
+} /* jerry_set_memory_budget */
+
+/**
+ * Set execution budget for each run of code (jerry_run, jerry_exec_snapshot, jerry_api_eval,
+ * jerry_api_call_function and jerry_api_construct_object, that are not nested into another run)
+ *
+ * The budget is counted in backward jumps and calls, so that each loop iteration and each call of a function
+ * spends a unit of the budget. Upon exhaustion of the budget, the run is interrupted: an error is raised,
+ * and raised again upon each subsequent backward jump or call, so the script can't continue its loops.
+ * The run's completion code is JERRY_COMPLETION_CODE_INTERRUPTED (jerry_api_call_function and
+ * jerry_api_construct_object return false).
+ *
+ * Note:
+ *      to limit time of a run, the budget can be combined with (or replaced by) a timer,
+ *      calling jerry_request_interrupt upon expiration.
+ */
+void
+jerry_set_execution_budget (uint32_t budget) /**< number of backward jumps and calls, that each run can perform,
+                                              *   or 0 - to remove the limit */
+{
+  jerry_assert_api_available ();
+
+  JERRY_CONTEXT (jerry_execution_budget) = budget;
+} /* jerry_set_execution_budget */
+
+/**
+ * Request interruption of the current run of code in the specified context
+ *
+ * The run is interrupted upon the next backward jump or call, in the same way,
+ * as upon exhaustion of execution budget (see also: jerry_set_execution_budget).
+ *
+ * Note:
+ *      the function is async-signal-safe, and can be called from a signal handler or another thread,
+ *      for example, upon expiration of a deadline's timer; a request, received while there is no active run,
+ *      is dropped upon start of the next run; runs in other contexts are not affected.
+ */
+void
+jerry_request_interrupt (jerry_ctx_t *ctx_p) /**< context to interrupt
+                                              *   (see also: jerry_get_active_ctx) */
+{
+  vm_request_interrupt (ctx_p);
+} /* jerry_request_interrupt */
+
 /**
  * Perform eval
  *
@@ -1193,11 +1910,15 @@ jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
 
   jerry_completion_code_t status;
 
+  jerry_start_run ();
+
   ecma_completion_value_t completion = ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
                                                                   source_size,
                                                                   is_direct,
                                                                   is_strict);
 
+  const bool is_interrupted = jerry_finish_run ();
+
   if (ecma_is_completion_value_normal (completion))
   {
     status = JERRY_COMPLETION_CODE_OK;
@@ -1223,14 +1944,21 @@ jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
 
   ecma_free_completion_value (completion);
 
+  if (is_interrupted)
+  {
+    status = JERRY_COMPLETION_CODE_INTERRUPTED;
+  }
+
   return status;
 } /* jerry_api_eval */
 
 /**
- * Jerry engine initialization
+ * Check combination of Jerry flags against build configuration
+ *
+ * @return the flags, with the options, that are not supported in current build configuration, cleared
  */
-void
-jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+static jerry_flag_t
+jerry_check_flags (jerry_flag_t flags) /**< combination of Jerry flags */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1257,15 +1985,103 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
       "Ignoring detailed memory statistics options because memory statistics dump mode is not enabled.\n");
   }
 
-  jerry_flags = flags;
+  if (flags & (JERRY_FLAG_OPCODE_PROFILE))
+  {
+#ifndef VM_OPCODE_PROFILER
+    flags &= ~(JERRY_FLAG_OPCODE_PROFILE);
+
+    JERRY_WARNING_MSG ("Ignoring opcode profile option because of '!VM_OPCODE_PROFILER' build configuration.\n");
+#endif /* !VM_OPCODE_PROFILER */
+  }
+
+  if (flags & (JERRY_FLAG_ALLOC_PROFILE))
+  {
+#ifndef MEM_ALLOC_PROFILER
+    flags &= ~(JERRY_FLAG_ALLOC_PROFILE);
+
+    JERRY_WARNING_MSG ("Ignoring allocation profile option because of '!MEM_ALLOC_PROFILER' build configuration.\n");
+#endif /* !MEM_ALLOC_PROFILER */
+  }
+
+  return flags;
+} /* jerry_check_flags */
+
+/**
+ * Jerry engine initialization
+ */
+void
+jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  JERRY_CONTEXT (jerry_flags) = jerry_check_flags (flags);
 
   jerry_make_api_available ();
 
+  JERRY_CONTEXT (jerry_memory_pressure_callback) = NULL;
+  JERRY_CONTEXT (jerry_memory_budget) = 0;
+  JERRY_CONTEXT (jerry_execution_budget) = 0;
+  JERRY_CONTEXT (jerry_run_depth) = 0;
+
   mem_init ();
+
+#ifdef MEM_ALLOC_PROFILER
+  mem_alloc_profiler_init ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_ALLOC_PROFILE) != 0);
+#endif /* MEM_ALLOC_PROFILER */
+
   serializer_init ();
   ecma_init ();
+
+#ifdef VM_OPCODE_PROFILER
+  vm_profiler_init ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_OPCODE_PROFILE) != 0);
+#endif /* VM_OPCODE_PROFILER */
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  vm_sampling_profiler_init ();
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
 } /* jerry_init */
 
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+/**
+ * Jerry engine initialization with heap of the specified size
+ *
+ * Note:
+ *      address space for the whole heap is reserved upon initialization,
+ *      while physical memory is committed by the system upon actual usage of the heap.
+ *
+ * Note:
+ *      the size is limited to 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG bytes.
+ */
+void
+jerry_init_with_heap_size (jerry_flag_t flags, /**< combination of Jerry flags */
+                           size_t heap_size) /**< size of heap, in bytes */
+{
+  JERRY_CONTEXT (jerry_flags) = jerry_check_flags (flags);
+
+  jerry_make_api_available ();
+
+  JERRY_CONTEXT (jerry_memory_pressure_callback) = NULL;
+  JERRY_CONTEXT (jerry_memory_budget) = 0;
+  JERRY_CONTEXT (jerry_execution_budget) = 0;
+  JERRY_CONTEXT (jerry_run_depth) = 0;
+
+  mem_init_with_heap_size (heap_size);
+
+#ifdef MEM_ALLOC_PROFILER
+  mem_alloc_profiler_init ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_ALLOC_PROFILE) != 0);
+#endif /* MEM_ALLOC_PROFILER */
+
+  serializer_init ();
+  ecma_init ();
+
+#ifdef VM_OPCODE_PROFILER
+  vm_profiler_init ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_OPCODE_PROFILE) != 0);
+#endif /* VM_OPCODE_PROFILER */
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  vm_sampling_profiler_init ();
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
+} /* jerry_init_with_heap_size */
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
+
 /**
  * Terminate Jerry engine
  */
@@ -1274,14 +2090,54 @@ jerry_cleanup (void)
 {
   jerry_assert_api_available ();
 
-  bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
+  bool is_show_mem_stats = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS) != 0);
+
+  if (JERRY_CONTEXT (jerry_memory_pressure_callback) != NULL)
+  {
+    jerry_api_unregister_memory_pressure_callback (JERRY_CONTEXT (jerry_memory_pressure_callback));
+  }
+
+#ifdef VM_OPCODE_PROFILER
+  vm_profiler_dump ();
+#endif /* VM_OPCODE_PROFILER */
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  vm_sampling_profiler_stop ();
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
 
   ecma_finalize ();
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  if (is_show_mem_stats)
+  {
+    ecma_gc_log_print ();
+  }
+#endif /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+
   serializer_free ();
   mem_finalize (is_show_mem_stats);
   vm_finalize ();
 } /* jerry_cleanup */
 
+/**
+ * Get the engine context, that is active in the calling thread
+ *
+ * The context can be passed to the routines, that are called asynchronously (from a signal handler
+ * or another thread), to specify the context they are addressed to (see also: jerry_request_interrupt,
+ * jerry_sampling_profiler_request_sample).
+ *
+ * @return pointer to the active context
+ */
+jerry_ctx_t *
+jerry_get_active_ctx (void)
+{
+#ifdef CONFIG_JERRY_ENABLE_CONTEXTS
+  return jerry_ctx_p;
+#else /* CONFIG_JERRY_ENABLE_CONTEXTS */
+  return &jerry_default_ctx;
+#endif /* !CONFIG_JERRY_ENABLE_CONTEXTS */
+} /* jerry_get_active_ctx */
+
 /**
  * Get Jerry configured memory limits
  */
@@ -1294,6 +2150,205 @@ jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, /**< out: Jerry's max
   *out_stack_limit_p = CONFIG_MEM_STACK_LIMIT;
 } /* jerry_get_memory_limits */
 
+/**
+ * Get memory usage statistics
+ *
+ * Note:
+ *      peak values are counted since engine's initialization or since last call of jerry_reset_memory_stats_peak
+ *
+ * @return true - if statistics are collected in current build configuration (MEM_STATS),
+ *         false - otherwise (the output structure is not changed).
+ */
+bool
+jerry_get_memory_stats (jerry_memory_stats_t *out_stats_p) /**< out: memory usage statistics */
+{
+  jerry_assert_api_available ();
+
+#ifdef MEM_STATS
+  mem_heap_stats_t heap_stats;
+  mem_heap_get_stats (&heap_stats);
+
+  mem_pools_stats_t pools_stats;
+  mem_pools_get_stats (&pools_stats);
+
+  out_stats_p->heap_size = heap_stats.size;
+  out_stats_p->heap_allocated_bytes = heap_stats.allocated_bytes;
+  out_stats_p->heap_peak_allocated_bytes = heap_stats.peak_allocated_bytes;
+  out_stats_p->heap_peak_waste_bytes = heap_stats.peak_waste_bytes;
+  out_stats_p->pools_allocated_bytes = pools_stats.allocated_chunks * MEM_POOL_CHUNK_SIZE;
+  out_stats_p->pools_peak_allocated_bytes = pools_stats.peak_allocated_chunks * MEM_POOL_CHUNK_SIZE;
+  out_stats_p->pools_peak_allocated_chunks = pools_stats.peak_allocated_chunks;
+  out_stats_p->literals_bytes = JERRY_CONTEXT (lit_storage).get_allocated_size ();
+  out_stats_p->literals_node_size = rcs_chunked_list_t::get_node_size ();
+
+  return true;
+#else /* MEM_STATS */
+  (void) out_stats_p;
+
+  return false;
+#endif /* !MEM_STATS */
+} /* jerry_get_memory_stats */
+
+/**
+ * Reset peak values of memory usage statistics
+ */
+void
+jerry_reset_memory_stats_peak (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef MEM_STATS
+  mem_stats_reset_peak ();
+#endif /* MEM_STATS */
+} /* jerry_reset_memory_stats_peak */
+
+/**
+ * Get descriptions of the most recent garbage collections
+ *
+ * The engine keeps descriptions of the last CONFIG_ECMA_GC_LOG_SIZE collections (cause, duration,
+ * numbers of objects and memory usage before and after the collection), so latency of the
+ * host's operations can be correlated with the collections.
+ *
+ * @return number of descriptions, copied to the output array (in order of the collections, i.e. the last
+ *         description is of the most recent collection); zero - if there were no collections, or the log
+ *         is disabled in current build configuration (CONFIG_ECMA_GC_LOG_SIZE is zero).
+ */
+uint32_t
+jerry_get_gc_events (jerry_gc_event_t *out_events_p, /**< out: descriptions of the collections */
+                     uint32_t max_events_number) /**< size of the output array */
+{
+  jerry_assert_api_available ();
+
+#if CONFIG_ECMA_GC_LOG_SIZE != 0
+  JERRY_STATIC_ASSERT ((int) JERRY_GC_CAUSE_LOW_MEMORY == (int) ECMA_GC_CAUSE_LOW_MEMORY
+                       && (int) JERRY_GC_CAUSE_CRITICAL_MEMORY == (int) ECMA_GC_CAUSE_CRITICAL_MEMORY
+                       && (int) JERRY_GC_CAUSE_STRING_REFS_OVERFLOW == (int) ECMA_GC_CAUSE_STRING_REFS_OVERFLOW
+                       && (int) JERRY_GC_CAUSE_EACH_OPCODE == (int) ECMA_GC_CAUSE_EACH_OPCODE
+                       && (int) JERRY_GC_CAUSE_HEAP_SNAPSHOT == (int) ECMA_GC_CAUSE_HEAP_SNAPSHOT
+                       && (int) JERRY_GC_CAUSE_ENGINE_CLEANUP == (int) ECMA_GC_CAUSE_ENGINE_CLEANUP);
+
+  ecma_gc_log_entry_t entries[CONFIG_ECMA_GC_LOG_SIZE];
+  uint32_t events_number = ecma_gc_log_get_entries (entries, JERRY_MIN (max_events_number,
+                                                                        (uint32_t) CONFIG_ECMA_GC_LOG_SIZE));
+
+  for (uint32_t i = 0; i < events_number; i++)
+  {
+    out_events_p[i].sequence_number = entries[i].sequence_number;
+    out_events_p[i].cause = (jerry_gc_cause_t) entries[i].cause;
+    out_events_p[i].duration_cycles = entries[i].duration_cycles;
+    out_events_p[i].objects_before = entries[i].objects_before;
+    out_events_p[i].objects_after = entries[i].objects_after;
+    out_events_p[i].bytes_before = entries[i].bytes_before;
+    out_events_p[i].bytes_after = entries[i].bytes_after;
+  }
+
+  return events_number;
+#else /* CONFIG_ECMA_GC_LOG_SIZE != 0 */
+  (void) out_events_p;
+  (void) max_events_number;
+
+  return 0;
+#endif /* CONFIG_ECMA_GC_LOG_SIZE == 0 */
+} /* jerry_get_gc_events */
+
+/**
+ * Print sites of allocation, holding most of currently allocated memory (see also: JERRY_FLAG_ALLOC_PROFILE)
+ *
+ * For each site, the report lists currently allocated (live) bytes, peak live bytes, number of live blocks
+ * and number of allocations, and describes the site with name of the JavaScript function and source line,
+ * executed upon the allocations, and the address of the engine's routine, that called the allocator.
+ *
+ * Note:
+ *      the report is also printed upon out-of-memory, before the engine is terminated with ERR_OUT_OF_MEMORY
+ *
+ * @return true - if the report was printed,
+ *         false - if the profiler is not enabled, or is not supported in current build configuration
+ *                 (!MEM_ALLOC_PROFILER).
+ */
+bool
+jerry_alloc_profiler_dump (uint32_t max_sites_number) /**< maximum number of sites to print */
+{
+  jerry_assert_api_available ();
+
+#ifdef MEM_ALLOC_PROFILER
+  return mem_alloc_profiler_dump (max_sites_number);
+#else /* MEM_ALLOC_PROFILER */
+  (void) max_sites_number;
+
+  return false;
+#endif /* !MEM_ALLOC_PROFILER */
+} /* jerry_alloc_profiler_dump */
+
+/**
+ * Start sampling profiler of JavaScript functions
+ *
+ * Upon each request (see also: jerry_sampling_profiler_request_sample), call stack of the executed
+ * JavaScript code is sampled and written to the specified file in the folded stacks format
+ * (a line per sample: frames, from the bottom-most to the top-most one, separated with semicolons, and number
+ * of samples), that can be converted to a flame graph with flamegraph.pl.
+ *
+ * If the profiler is already started, the previous output file is closed.
+ *
+ * @return true - if the output file was opened successfully,
+ *         false - if the file could not be opened, or the profiler is not supported
+ *                 in current build configuration (!JERRY_ENABLE_SAMPLING_PROFILER, i.e. not a '-sampling_prof'
+ *                 build target).
+ */
+bool
+jerry_sampling_profiler_start (const char *output_file_name_p) /**< name of the output file */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  return vm_sampling_profiler_start (output_file_name_p);
+#else /* JERRY_ENABLE_SAMPLING_PROFILER */
+  (void) output_file_name_p;
+
+  JERRY_WARNING_MSG ("Ignoring sampling profiler start because of '!JERRY_ENABLE_SAMPLING_PROFILER' "
+                     "build configuration.\n");
+
+  return false;
+#endif /* !JERRY_ENABLE_SAMPLING_PROFILER */
+} /* jerry_sampling_profiler_start */
+
+/**
+ * Stop sampling profiler and close its output file
+ *
+ * @return number of samples, written since start of the profiler
+ */
+uint32_t
+jerry_sampling_profiler_stop (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  return vm_sampling_profiler_stop ();
+#else /* JERRY_ENABLE_SAMPLING_PROFILER */
+  return 0;
+#endif /* !JERRY_ENABLE_SAMPLING_PROFILER */
+} /* jerry_sampling_profiler_stop */
+
+/**
+ * Request a sample of JavaScript call stack, executed in the specified context
+ *
+ * The sample is taken before execution of the next byte-code instruction in the context, so time,
+ * spent in native code, is attributed to the JavaScript code, executed after the native code.
+ *
+ * Note:
+ *      the routine is async-signal-safe, and is intended to be called from a profiling timer's
+ *      signal handler (SIGPROF), or from another thread; runs in other contexts are not affected
+ */
+void
+jerry_sampling_profiler_request_sample (jerry_ctx_t *ctx_p) /**< context to sample
+                                                             *   (see also: jerry_get_active_ctx) */
+{
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+  vm_sampling_profiler_request_sample (ctx_p);
+#else /* JERRY_ENABLE_SAMPLING_PROFILER */
+  (void) ctx_p;
+#endif /* !JERRY_ENABLE_SAMPLING_PROFILER */
+} /* jerry_sampling_profiler_request_sample */
+
 /**
  * Check whether 'abort' should be called instead of 'exit' upon exiting with non-zero exit code.
  *
@@ -1303,7 +2358,7 @@ jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, /**< out: Jerry's max
 bool
 jerry_is_abort_on_fail (void)
 {
-  return ((jerry_flags & JERRY_FLAG_ABORT_ON_FAIL) != 0);
+  return ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_ABORT_ON_FAIL) != 0);
 } /* jerry_is_abort_on_fail */
 
 /**
@@ -1320,6 +2375,11 @@ jerry_reg_err_callback (jerry_error_callback_t callback) /**< pointer to callbac
 /**
  * Parse script for specified context
  *
+ * Note:
+ *      if JERRY_FLAG_LAZY_FUNCTIONS is set, bodies of the script's functions are compiled upon first call,
+ *      so the source buffer should not be modified or released till jerry_cleanup (syntax of the bodies
+ *      is still checked during the parse).
+ *
  * @return true - if script was parsed successfully,
  *         false - otherwise (SyntaxError was raised).
  */
@@ -1329,9 +2389,11 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
 {
   jerry_assert_api_available ();
 
-  bool is_show_opcodes = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+  bool is_show_opcodes = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_SHOW_OPCODES) != 0);
+  bool is_lazy_functions = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_LAZY_FUNCTIONS) != 0);
 
   parser_set_show_opcodes (is_show_opcodes);
+  parser_set_lazy_functions (is_lazy_functions);
 
   const opcode_t *opcodes_p;
   bool is_syntax_correct;
@@ -1346,20 +2408,52 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
   }
 
 #ifdef MEM_STATS
-  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  if (JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_SEPARATE)
   {
     mem_stats_print ();
     mem_stats_reset_peak ();
   }
 #endif /* MEM_STATS */
 
-  bool is_show_mem_stats_per_opcode = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+  bool is_show_mem_stats_per_opcode = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
 
   vm_init (opcodes_p, is_show_mem_stats_per_opcode);
 
   return true;
 } /* jerry_parse */
 
+/**
+ * Parse script, which source code is read incrementally, during the parse
+ *
+ * The reader is invoked each time the parser reaches end of the source code's part, that was read before,
+ * so parse of a script can be started before the whole script is available (e.g. is read from a pipe),
+ * and the script's size is limited only by the source buffer, that is managed by the reader.
+ *
+ * Note:
+ *      the buffer's beginning should not be moved by the reader, and the buffer should not be modified
+ *      or released till the parse is finished (or, if JERRY_FLAG_LAZY_FUNCTIONS is set, till jerry_cleanup).
+ *
+ * @return true - if script was parsed successfully,
+ *         false - otherwise (SyntaxError was raised).
+ */
+bool
+jerry_parse_from_reader (const jerry_api_char_t *source_buffer_p, /**< buffer, to which the source is read */
+                         jerry_source_reader_t reader_p, /**< reader of the source */
+                         void *reader_user_p) /**< user data, passed to the reader */
+{
+  jerry_assert_api_available ();
+
+  JERRY_ASSERT (source_buffer_p != NULL && reader_p != NULL);
+
+  parser_set_source_reader (reader_p, reader_user_p);
+
+  bool is_syntax_correct = jerry_parse (source_buffer_p, 0);
+
+  parser_set_source_reader (NULL, NULL);
+
+  return is_syntax_correct;
+} /* jerry_parse_from_reader */
+
 /**
  * Run Jerry in specified run context
  *
@@ -1370,8 +2464,94 @@ jerry_run (void)
 {
   jerry_assert_api_available ();
 
-  return vm_run_global ();
+  jerry_start_run ();
+  jerry_completion_code_t ret_code = vm_run_global ();
+
+  if (jerry_finish_run ())
+  {
+    ret_code = JERRY_COMPLETION_CODE_INTERRUPTED;
+  }
+
+  return ret_code;
 } /* jerry_run */
+
+/**
+ * Parse script and save the generated byte-code, together with the literals it refers to, to a snapshot
+ *
+ * Note:
+ *      the byte-code is not run, so the function can be called in a context,
+ *      that is used only for generation of snapshots.
+ *
+ * @return size of the snapshot - if it was generated successfully,
+ *         0 - otherwise (SyntaxError was raised or the buffer is too small).
+ */
+size_t
+jerry_parse_and_save_snapshot (const jerry_api_char_t* source_p, /**< script source */
+                               size_t source_size, /**< script source size */
+                               uint8_t *buffer_p, /**< buffer to save snapshot to */
+                               size_t buffer_size) /**< the buffer's size */
+{
+  jerry_assert_api_available ();
+
+  bool is_show_opcodes = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_SHOW_OPCODES) != 0);
+
+  parser_set_show_opcodes (is_show_opcodes);
+
+  /* snapshot should contain byte-code of all the functions */
+  parser_set_lazy_functions (false);
+
+  const opcode_t *opcodes_p;
+
+  if (!parser_parse_script (source_p, source_size, &opcodes_p))
+  {
+    return 0;
+  }
+
+  return serializer_save_snapshot (opcodes_p, buffer_p, buffer_size);
+} /* jerry_parse_and_save_snapshot */
+
+/**
+ * Load byte-code from snapshot and run it in the active context
+ *
+ * Note:
+ *      if is_copy is true, the snapshot is copied to the engine's heap, so the buffer can be released
+ *      right after the call. Otherwise, the byte-code is executed in place (for example, from a read-only
+ *      memory-mapped file), so the buffer should be aligned to sizeof (uint32_t) and should not be modified
+ *      or released till jerry_cleanup.
+ *
+ * @return completion status (JERRY_COMPLETION_CODE_INVALID_SNAPSHOT - if the snapshot is corrupted,
+ *                            was generated by incompatible version or build configuration of the engine,
+ *                            or is not aligned)
+ */
+jerry_completion_code_t
+jerry_exec_snapshot (const void *snapshot_p, /**< snapshot */
+                     size_t snapshot_size, /**< size of the snapshot */
+                     bool is_copy) /**< copy the snapshot to the heap (true),
+                                    *   or execute it in place (false) */
+{
+  jerry_assert_api_available ();
+
+  const opcode_t *opcodes_p = serializer_load_snapshot ((const uint8_t *) snapshot_p, snapshot_size, is_copy);
+
+  if (opcodes_p == NULL)
+  {
+    return JERRY_COMPLETION_CODE_INVALID_SNAPSHOT;
+  }
+
+  bool is_show_mem_stats_per_opcode = ((JERRY_CONTEXT (jerry_flags) & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+
+  vm_init (opcodes_p, is_show_mem_stats_per_opcode);
+
+  jerry_start_run ();
+  jerry_completion_code_t ret_code = vm_run_global ();
+
+  if (jerry_finish_run ())
+  {
+    ret_code = JERRY_COMPLETION_CODE_INTERRUPTED;
+  }
+
+  return ret_code;
+} /* jerry_exec_snapshot */
 /**
  * Simple jerry runner
  *
@@ -1406,38 +2586,104 @@ jerry_run_simple (const jerry_api_char_t *script_source, /**< script source */
 
 #ifdef CONFIG_JERRY_ENABLE_CONTEXTS
 /**
- * Allocate new run context
+ * Create new run context, i.e. an independent engine instance, in the specified memory area
  *
- * @return run context
+ * Note:
+ *      the area is used for the context's descriptor and the context's heap,
+ *      so the heap size is determined by size of the area; the area should not be
+ *      accessed by the caller until the context is cleaned up with jerry_cleanup_ctx.
+ *
+ * Note:
+ *      the context is not activated upon creation (see also: jerry_push_ctx).
+ *
+ * Note:
+ *      with CONFIG_JERRY_ENABLE_THREADS, stack of active contexts is maintained per thread,
+ *      so several threads can run their contexts simultaneously; however, a context
+ *      should not be used by more than one thread at the same time.
+ *
+ * @return pointer to the context - if the context was created successfully,
+ *         NULL - otherwise (the area is too small).
  */
 jerry_ctx_t*
-jerry_new_ctx (void)
+jerry_new_ctx (jerry_flag_t flags, /**< combination of Jerry flags for the context */
+               void *area_p, /**< memory area for the context */
+               size_t area_size) /**< size of the area */
 {
-  jerry_assert_api_available ();
+  const uintptr_t area_start = (uintptr_t) area_p;
+  const uintptr_t area_end = area_start + area_size;
+
+  const uintptr_t ctx_start = JERRY_ALIGNUP (area_start, MEM_ALIGNMENT);
+  const uintptr_t heap_start = JERRY_ALIGNUP (ctx_start + sizeof (jerry_ctx_t), MEM_HEAP_CHUNK_SIZE);
+
+  if (area_p == NULL
+      || heap_start + MEM_HEAP_CHUNK_SIZE > area_end)
+  {
+    return NULL;
+  }
 
-  JERRY_UNIMPLEMENTED ("Run contexts are not implemented");
+  size_t heap_size = JERRY_MIN ((size_t) (area_end - heap_start), ((size_t) 1u << MEM_HEAP_OFFSET_LOG));
+  heap_size = JERRY_ALIGNDOWN (heap_size, MEM_HEAP_CHUNK_SIZE);
+
+  jerry_ctx_t *ctx_p = (jerry_ctx_t *) ctx_start;
+  memset ((void *) ctx_p, 0, sizeof (jerry_ctx_t));
+
+  jerry_ctx_t *saved_ctx_p = jerry_ctx_p;
+  jerry_ctx_p = ctx_p;
+
+  JERRY_CONTEXT (jerry_flags) = jerry_check_flags (flags);
+
+  jerry_make_api_available ();
+
+  mem_init_with_heap_area ((uint8_t *) heap_start, heap_size);
+  serializer_init ();
+  ecma_init ();
+
+  jerry_ctx_p = saved_ctx_p;
+
+  return ctx_p;
 } /* jerry_new_ctx */
 
 /**
  * Cleanup resources associated with specified run context
+ *
+ * Note:
+ *      the context should not be on the contexts' stack.
  */
 void
 jerry_cleanup_ctx (jerry_ctx_t* ctx_p) /**< run context */
 {
-  jerry_assert_api_available ();
+  JERRY_ASSERT (ctx_p != NULL && ctx_p != &jerry_default_ctx);
+
+#ifndef JERRY_NDEBUG
+  for (jerry_ctx_t *iter_p = jerry_ctx_p; iter_p != NULL; iter_p = iter_p->prev_ctx_p)
+  {
+    JERRY_ASSERT (iter_p != ctx_p);
+  }
+#endif /* !JERRY_NDEBUG */
+
+  jerry_ctx_t *saved_ctx_p = jerry_ctx_p;
+  jerry_ctx_p = ctx_p;
 
-  JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Run contexts are not implemented", ctx_p);
+  jerry_cleanup ();
+
+  jerry_ctx_p = saved_ctx_p;
 } /* jerry_cleanup_ctx */
 
 /**
  * Activate context and push it to contexts' stack
+ *
+ * Note:
+ *      all engine's interfaces operate on the active context,
+ *      until it is popped from the stack (see also: jerry_pop_ctx).
  */
 void
 jerry_push_ctx (jerry_ctx_t *ctx_p) /**< run context */
 {
-  jerry_assert_api_available ();
+  JERRY_ASSERT (ctx_p != NULL && ctx_p != &jerry_default_ctx);
+  JERRY_ASSERT (ctx_p->prev_ctx_p == NULL);
 
-  JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Run contexts are not implemented", ctx_p);
+  ctx_p->prev_ctx_p = jerry_ctx_p;
+  jerry_ctx_p = ctx_p;
 } /* jerry_push_ctx */
 
 /**
@@ -1451,7 +2697,11 @@ jerry_pop_ctx (void)
 {
   jerry_assert_api_available ();
 
-  JERRY_UNIMPLEMENTED ("Run contexts are not implemented");
+  jerry_ctx_t *ctx_p = jerry_ctx_p;
+  JERRY_ASSERT (ctx_p->prev_ctx_p != NULL);
+
+  jerry_ctx_p = ctx_p->prev_ctx_p;
+  ctx_p->prev_ctx_p = NULL;
 } /* jerry_pop_ctx */
 #endif /* CONFIG_JERRY_ENABLE_CONTEXTS */
 
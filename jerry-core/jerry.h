@@ -40,6 +40,13 @@ typedef uint32_t jerry_flag_t;
                                                      *   FIXME: Remove. */
 #define JERRY_FLAG_ENABLE_LOG             (1u << 5) /**< enable logging */
 #define JERRY_FLAG_ABORT_ON_FAIL          (1u << 6) /**< abort instead of exit in case of failure */
+#define JERRY_FLAG_LAZY_FUNCTIONS         (1u << 7) /**< compile bodies of functions upon first call
+                                                     *   (source buffers, passed to jerry_parse, should not be
+                                                     *   modified or released till jerry_cleanup) */
+#define JERRY_FLAG_OPCODE_PROFILE         (1u << 8) /**< count executions and cycles per opcode, instruction and pair
+                                                     *   of successive opcodes, and dump the profile upon cleanup */
+#define JERRY_FLAG_ALLOC_PROFILE          (1u << 9) /**< attribute allocated memory to sites of allocation
+                                                     *   (see also: jerry_alloc_profiler_dump) */
 
 /**
  * Error codes
@@ -48,6 +55,7 @@ typedef enum
 {
   ERR_OUT_OF_MEMORY = 10,
   ERR_SYSCALL = 11,
+  ERR_REF_COUNT_LIMIT = 12,
   ERR_UNIMPLEMENTED_CASE = 118,
   ERR_FAILED_INTERNAL_ASSERTION = 120
 } jerry_fatal_code_t;
@@ -77,14 +85,95 @@ extern FILE *jerry_log_file;
  */
 typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 
+/**
+ * Reader of a script's source code (see also: jerry_parse_from_reader)
+ *
+ * The reader appends next part of the source code to the source buffer, right after the part that was read before.
+ *
+ * @return size of the source code, read so far (the same size, as returned by the previous call, indicates
+ *         that the whole source code was read)
+ */
+typedef size_t (*jerry_source_reader_t) (void *user_p);
+
+/**
+ * Memory usage statistics of the engine (see also: jerry_get_memory_stats)
+ */
+typedef struct
+{
+  size_t heap_size; /**< size of the heap */
+  size_t heap_allocated_bytes; /**< currently allocated bytes of the heap */
+  size_t heap_peak_allocated_bytes; /**< peak allocated bytes of the heap */
+  size_t heap_peak_waste_bytes; /**< peak bytes of the heap, wasted due to block headers and partially filled blocks */
+  size_t pools_allocated_bytes; /**< currently allocated bytes of pools' chunks */
+  size_t pools_peak_allocated_bytes; /**< peak allocated bytes of pools' chunks */
+  size_t pools_peak_allocated_chunks; /**< peak number of allocated pools' chunks */
+  size_t literals_bytes; /**< size of the literal storage (it is allocated on the heap) */
+  size_t literals_node_size; /**< size of a node of the literal storage (the storage's size changes by whole nodes) */
+} jerry_memory_stats_t;
+
+/**
+ * Cause of a garbage collection
+ */
+typedef enum
+{
+  JERRY_GC_CAUSE_LOW_MEMORY, /**< the heap's usage limit was reached */
+  JERRY_GC_CAUSE_CRITICAL_MEMORY, /**< an allocation failed, and as much memory as possible is being freed */
+  JERRY_GC_CAUSE_STRING_REFS_OVERFLOW, /**< a string's reference counter overflowed */
+  JERRY_GC_CAUSE_EACH_OPCODE, /**< collection after each opcode (CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE) */
+  JERRY_GC_CAUSE_HEAP_SNAPSHOT, /**< snapshot of the heap (see also: jerry_api_dump_heap_snapshot) */
+  JERRY_GC_CAUSE_ENGINE_CLEANUP /**< finalization of the engine */
+} jerry_gc_cause_t;
+
+/**
+ * Description of a garbage collection (see also: jerry_get_gc_events)
+ */
+typedef struct
+{
+  uint32_t sequence_number; /**< number of the collection since the engine's initialization (starting from 1) */
+  jerry_gc_cause_t cause; /**< cause of the collection */
+  uint64_t duration_cycles; /**< duration of the collection in processor cycles (zero - if the cycle counter
+                             *   is not supported on the architecture) */
+  uint32_t objects_before; /**< number of objects and lexical environments before the collection */
+  uint32_t objects_after; /**< number of objects and lexical environments after the collection */
+  size_t bytes_before; /**< allocated bytes (excluding free chunks of the pools) before the collection */
+  size_t bytes_after; /**< allocated bytes (excluding free chunks of the pools) after the collection */
+} jerry_gc_event_t;
+
+/**
+ * Jerry run context descriptor (see also: jerry_get_active_ctx)
+ */
+typedef struct jerry_ctx_t jerry_ctx_t;
+
 extern EXTERN_C void jerry_init (jerry_flag_t flags);
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+extern EXTERN_C void jerry_init_with_heap_size (jerry_flag_t flags, size_t heap_size);
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
 extern EXTERN_C void jerry_cleanup (void);
+extern EXTERN_C jerry_ctx_t *jerry_get_active_ctx (void);
 
 extern EXTERN_C void jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, size_t *out_stack_limit_p);
+extern EXTERN_C bool jerry_get_memory_stats (jerry_memory_stats_t *out_stats_p);
+extern EXTERN_C void jerry_reset_memory_stats_peak (void);
+extern EXTERN_C uint32_t jerry_get_gc_events (jerry_gc_event_t *out_events_p, uint32_t max_events_number);
+extern EXTERN_C bool jerry_alloc_profiler_dump (uint32_t max_sites_number);
+extern EXTERN_C bool jerry_sampling_profiler_start (const char *output_file_name_p);
+extern EXTERN_C uint32_t jerry_sampling_profiler_stop (void);
+extern EXTERN_C void jerry_sampling_profiler_request_sample (jerry_ctx_t *ctx_p);
 extern EXTERN_C void jerry_reg_err_callback (jerry_error_callback_t callback);
 
 extern EXTERN_C bool jerry_parse (const jerry_api_char_t * source_p, size_t source_size);
+extern EXTERN_C bool jerry_parse_from_reader (const jerry_api_char_t *source_buffer_p,
+                                              jerry_source_reader_t reader_p,
+                                              void *reader_user_p);
 extern EXTERN_C jerry_completion_code_t jerry_run (void);
+extern EXTERN_C void jerry_set_memory_budget (size_t budget);
+extern EXTERN_C void jerry_set_execution_budget (uint32_t budget);
+extern EXTERN_C void jerry_request_interrupt (jerry_ctx_t *ctx_p);
+
+extern EXTERN_C size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *source_p, size_t source_size,
+                                                      uint8_t *buffer_p, size_t buffer_size);
+extern EXTERN_C jerry_completion_code_t jerry_exec_snapshot (const void *snapshot_p, size_t snapshot_size,
+                                                             bool is_copy);
 
 extern EXTERN_C jerry_completion_code_t
 jerry_run_simple (const jerry_api_char_t *script_source,
@@ -96,12 +185,7 @@ jerry_run_simple (const jerry_api_char_t *script_source,
  * @{
  */
 
-/**
- * Jerry run context descriptor
- */
-typedef struct jerry_ctx_t jerry_ctx_t;
-
-extern EXTERN_C jerry_ctx_t* jerry_new_ctx (void);
+extern EXTERN_C jerry_ctx_t* jerry_new_ctx (jerry_flag_t flags, void *area_p, size_t area_size);
 extern EXTERN_C void jerry_cleanup_ctx (jerry_ctx_t* ctx_p);
 
 extern EXTERN_C void jerry_push_ctx (jerry_ctx_t *ctx_p);
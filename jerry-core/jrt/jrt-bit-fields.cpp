@@ -60,3 +60,87 @@ jrt_set_bit_field_value (uint64_t container, /**< container to insert bit-field
 
   return (container & ~shifted_bit_field_mask) | shifted_new_bit_field_value;
 } /* jrt_set_bit_field_value */
+
+/**
+ * Number of bits in a half of the wide bit-field container
+ */
+#define JRT_WIDE_CONTAINER_HALF_WIDTH ((uint32_t) (JERRY_BITSINBYTE * sizeof (uint64_t)))
+
+/**
+ * Extract a bit-field from the wide container.
+ *
+ * @return bit-field's value
+ */
+uint64_t __attr_const___
+jrt_extract_bit_field (jrt_wide_bit_field_container_t container, /**< container to extract bit-field from */
+                       uint32_t lsb, /**< least significant bit of the value
+                                      *   to be extracted */
+                       uint32_t width) /**< width of the bit-field to be extracted */
+{
+  JERRY_ASSERT (width < JRT_WIDE_CONTAINER_HALF_WIDTH);
+  JERRY_ASSERT ((lsb + width) <= JERRY_BITSINBYTE * sizeof (jrt_wide_bit_field_container_t));
+
+  if (lsb >= JRT_WIDE_CONTAINER_HALF_WIDTH)
+  {
+    return jrt_extract_bit_field (container.high, lsb - JRT_WIDE_CONTAINER_HALF_WIDTH, width);
+  }
+  else if (lsb + width <= JRT_WIDE_CONTAINER_HALF_WIDTH)
+  {
+    return jrt_extract_bit_field (container.low, lsb, width);
+  }
+  else
+  {
+    /* the bit-field crosses the halves' boundary */
+    const uint32_t low_width = JRT_WIDE_CONTAINER_HALF_WIDTH - lsb;
+
+    uint64_t low_part = jrt_extract_bit_field (container.low, lsb, low_width);
+    uint64_t high_part = jrt_extract_bit_field (container.high, 0, width - low_width);
+
+    return (high_part << low_width) | low_part;
+  }
+} /* jrt_extract_bit_field */
+
+/**
+ * Insert a bit-field to the wide container.
+ *
+ * @return updated container
+ */
+jrt_wide_bit_field_container_t __attr_const___
+jrt_set_bit_field_value (jrt_wide_bit_field_container_t container, /**< container to insert bit-field to */
+                         uint64_t new_bit_field_value, /**< value of bit-field to insert */
+                         uint32_t lsb, /**< least significant bit of the value
+                                        *   to be extracted */
+                         uint32_t width) /**< width of the bit-field to be extracted */
+{
+  JERRY_ASSERT (width < JRT_WIDE_CONTAINER_HALF_WIDTH);
+  JERRY_ASSERT ((lsb + width) <= JERRY_BITSINBYTE * sizeof (jrt_wide_bit_field_container_t));
+  JERRY_ASSERT (new_bit_field_value < (1ull << width));
+
+  if (lsb >= JRT_WIDE_CONTAINER_HALF_WIDTH)
+  {
+    container.high = jrt_set_bit_field_value (container.high,
+                                              new_bit_field_value,
+                                              lsb - JRT_WIDE_CONTAINER_HALF_WIDTH,
+                                              width);
+  }
+  else if (lsb + width <= JRT_WIDE_CONTAINER_HALF_WIDTH)
+  {
+    container.low = jrt_set_bit_field_value (container.low, new_bit_field_value, lsb, width);
+  }
+  else
+  {
+    /* the bit-field crosses the halves' boundary */
+    const uint32_t low_width = JRT_WIDE_CONTAINER_HALF_WIDTH - lsb;
+
+    container.low = jrt_set_bit_field_value (container.low,
+                                             new_bit_field_value & ((1ull << low_width) - 1),
+                                             lsb,
+                                             low_width);
+    container.high = jrt_set_bit_field_value (container.high,
+                                              new_bit_field_value >> low_width,
+                                              0,
+                                              width - low_width);
+  }
+
+  return container;
+} /* jrt_set_bit_field_value */
@@ -21,4 +21,19 @@ extern uint64_t __attr_const___ jrt_extract_bit_field (uint64_t value, uint32_t
 extern uint64_t __attr_const___ jrt_set_bit_field_value (uint64_t value, uint64_t bit_field_value,
                                                              uint32_t lsb, uint32_t width);
 
+/**
+ * Container for bit-fields, that don't fit into 64-bit integer
+ */
+typedef struct
+{
+  uint64_t low; /**< bits 0 - 63 */
+  uint64_t high; /**< bits 64 - 127 */
+} jrt_wide_bit_field_container_t;
+
+extern uint64_t __attr_const___ jrt_extract_bit_field (jrt_wide_bit_field_container_t container, uint32_t lsb,
+                                                       uint32_t width);
+extern jrt_wide_bit_field_container_t __attr_const___
+jrt_set_bit_field_value (jrt_wide_bit_field_container_t container, uint64_t bit_field_value,
+                         uint32_t lsb, uint32_t width);
+
 #endif /* !JERRY_BIT_FIELDS_H */
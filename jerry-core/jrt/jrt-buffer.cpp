@@ -0,0 +1,105 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+
+/**
+ * Read data from a specified buffer.
+ *
+ * Note:
+ *      Offset is in-out and is incremented if the read operation completes successfully.
+ *
+ * @return true, if read was successful, i.e. offset + data_size doesn't exceed buffer size,
+ *         false - otherwise.
+ */
+bool
+jrt_read_from_buffer_by_offset (const uint8_t *buffer_p, /**< buffer */
+                                size_t buffer_size, /**< size of buffer */
+                                size_t *in_out_buffer_offset_p, /**< in: offset to read from,
+                                                                 *   out: offset, incremented on out_data_size */
+                                void *out_data_p, /**< out: data */
+                                size_t out_data_size) /**< size of the readable data */
+{
+  if (*in_out_buffer_offset_p > buffer_size
+      || out_data_size > buffer_size - *in_out_buffer_offset_p)
+  {
+    return false;
+  }
+
+  memcpy (out_data_p, buffer_p + *in_out_buffer_offset_p, out_data_size);
+  *in_out_buffer_offset_p += out_data_size;
+
+  return true;
+} /* jrt_read_from_buffer_by_offset */
+
+/**
+ * Write data to a specified buffer.
+ *
+ * Note:
+ *      Offset is in-out and is incremented if the write operation completes successfully.
+ *
+ * @return true, if write was successful, i.e. offset + data_size doesn't exceed buffer size,
+ *         false - otherwise.
+ */
+bool
+jrt_write_to_buffer_by_offset (uint8_t *buffer_p, /**< buffer */
+                               size_t buffer_size, /**< size of buffer */
+                               size_t *in_out_buffer_offset_p, /**< in: offset to write to,
+                                                                *   out: offset, incremented on data_size */
+                               const void *data_p, /**< data */
+                               size_t data_size) /**< size of the writable data */
+{
+  if (*in_out_buffer_offset_p > buffer_size
+      || data_size > buffer_size - *in_out_buffer_offset_p)
+  {
+    return false;
+  }
+
+  memcpy (buffer_p + *in_out_buffer_offset_p, data_p, data_size);
+  *in_out_buffer_offset_p += data_size;
+
+  return true;
+} /* jrt_write_to_buffer_by_offset */
+
+/**
+ * Align the offset of a buffer to the specified alignment, filling the gap with zero bytes.
+ *
+ * @return true, if the aligned offset doesn't exceed buffer size,
+ *         false - otherwise.
+ */
+bool
+jrt_align_buffer_offset (uint8_t *buffer_p, /**< buffer (or NULL, if the gap should not be filled) */
+                         size_t buffer_size, /**< size of buffer */
+                         size_t *in_out_buffer_offset_p, /**< in: offset to align,
+                                                          *   out: aligned offset */
+                         size_t alignment) /**< alignment */
+{
+  const size_t aligned_offset = JERRY_ALIGNUP (*in_out_buffer_offset_p, alignment);
+
+  if (aligned_offset > buffer_size)
+  {
+    return false;
+  }
+
+  if (buffer_p != NULL)
+  {
+    memset (buffer_p + *in_out_buffer_offset_p, 0, aligned_offset - *in_out_buffer_offset_p);
+  }
+
+  *in_out_buffer_offset_p = aligned_offset;
+
+  return true;
+} /* jrt_align_buffer_offset */
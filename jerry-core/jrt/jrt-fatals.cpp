@@ -47,6 +47,11 @@ jerry_fatal (jerry_fatal_code_t code) /**< status code */
       /* print nothing as it may invoke syscall recursively */
       break;
     }
+    case ERR_REF_COUNT_LIMIT:
+    {
+      printf ("ERR_REF_COUNT_LIMIT\n");
+      break;
+    }
     case ERR_UNIMPLEMENTED_CASE:
     {
       printf ("ERR_UNIMPLEMENTED_CASE\n");
@@ -39,6 +39,26 @@
 # define __attr_pure___ __attribute__((pure))
 #endif /* !__attr_pure___ */
 
+/**
+ * Storage class of the engine's global variables, that are not part of an engine context
+ * (i.e. state of the parser, pointer to the active context)
+ *
+ * With CONFIG_JERRY_ENABLE_THREADS the variables are thread-local, so that each thread
+ * can run independent engine instance (see also: jerry_new_ctx, jerry_push_ctx).
+ *
+ * Note:
+ *      Jerry's libc doesn't set up thread-local storage, so the option
+ *      is supported only for builds with external libc.
+ */
+#ifdef CONFIG_JERRY_ENABLE_THREADS
+# ifndef CONFIG_JERRY_ENABLE_CONTEXTS
+#  error "CONFIG_JERRY_ENABLE_THREADS requires CONFIG_JERRY_ENABLE_CONTEXTS"
+# endif /* !CONFIG_JERRY_ENABLE_CONTEXTS */
+# define JERRY_THREAD_LOCAL __thread
+#else /* CONFIG_JERRY_ENABLE_THREADS */
+# define JERRY_THREAD_LOCAL
+#endif /* !CONFIG_JERRY_ENABLE_THREADS */
+
 /**
  * Constants
  */
@@ -185,6 +205,13 @@ template<typename... values> extern void jerry_ref_unused_variables (const value
  */
 extern void __noreturn jerry_fatal (jerry_fatal_code_t code);
 
+/**
+ * Serialization helpers
+ */
+extern bool jrt_read_from_buffer_by_offset (const uint8_t *, size_t, size_t *, void *, size_t);
+extern bool jrt_write_to_buffer_by_offset (uint8_t *, size_t, size_t *, const void *, size_t);
+extern bool jrt_align_buffer_offset (uint8_t *, size_t, size_t *, size_t);
+
 /**
  * sizeof, offsetof, ...
  */
@@ -214,6 +241,32 @@ extern void __noreturn jerry_fatal (jerry_fatal_code_t code);
 #define JERRY_MIN(v1, v2) ((v1 < v2) ? v1 : v2)
 #define JERRY_MAX(v1, v2) ((v1 < v2) ? v2 : v1)
 
+/**
+ * Get current value of the processor's cycle counter
+ *
+ * Note:
+ *      on architectures without supported cycle counter zero is returned
+ *
+ * @return the counter's value
+ */
+static inline uint64_t __attr_always_inline___
+jrt_get_cycles (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+  uint32_t low, high;
+  __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+
+  return (((uint64_t) high) << 32) | low;
+#elif defined (__aarch64__)
+  uint64_t value;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+
+  return value;
+#else /* !__x86_64__ && !__i386__ && !__aarch64__ */
+  return 0;
+#endif /* !__x86_64__ && !__i386__ && !__aarch64__ */
+} /* jrt_get_cycles */
+
 /**
  * Placement new operator (constructs an object on a pre-allocated buffer)
  *
@@ -15,16 +15,10 @@
 
 #include "lit-literal-storage.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
 
-/**
- * Literal storage
- * As our libc library doesn't call constructors of static variables, lit_storage is initialized
- * in lit_init function by placement new operator.
- */
-lit_literal_storage_t lit_storage;
-
 /**
  * Get pointer to the previous record inside the literal storage
  *
@@ -33,13 +27,17 @@ lit_literal_storage_t lit_storage;
 rcs_record_t *
 lit_charset_record_t::get_prev () const
 {
-  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+#if MEM_CP_WIDTH <= 16
+  rcs_record_iterator_t it ((rcs_recordset_t *)&JERRY_CONTEXT (lit_storage), (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
   cpointer_t cpointer;
   cpointer.packed_value = it.read<uint16_t> ();
 
   return cpointer_t::decompress (cpointer);
+#else /* MEM_CP_WIDTH > 16 */
+  return get_pointer (_prev_field_pos, _prev_field_width);
+#endif /* MEM_CP_WIDTH > 16 */
 } /* lit_charset_record_t::get_prev */
 
 /**
@@ -48,10 +46,14 @@ lit_charset_record_t::get_prev () const
 void
 lit_charset_record_t::set_prev (rcs_record_t *prev_rec_p) /**< pointer to the record to set as previous */
 {
-  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+#if MEM_CP_WIDTH <= 16
+  rcs_record_iterator_t it ((rcs_recordset_t *)&JERRY_CONTEXT (lit_storage), (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
   it.write<uint16_t> (cpointer_t::compress (prev_rec_p).packed_value);
+#else /* MEM_CP_WIDTH > 16 */
+  set_pointer (_prev_field_pos, _prev_field_width, prev_rec_p);
+#endif /* MEM_CP_WIDTH > 16 */
 } /* lit_charset_record_t::set_prev */
 
 /**
@@ -63,7 +65,7 @@ lit_charset_record_t::set_charset (const lit_utf8_byte_t *str, /**< buffer conta
 {
   JERRY_ASSERT (header_size () + size == get_size () - get_alignment_bytes_count ());
 
-  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  rcs_record_iterator_t it ((rcs_recordset_t *)&JERRY_CONTEXT (lit_storage), (rcs_record_t *)this);
   it.skip (header_size ());
 
   for (lit_utf8_size_t i = 0; i < get_length (); ++i)
@@ -84,7 +86,7 @@ lit_charset_record_t::get_charset (lit_utf8_byte_t *buff, /**< output buffer */
 {
   JERRY_ASSERT (buff && size >= sizeof (lit_utf8_byte_t));
 
-  rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
+  rcs_record_iterator_t it ((rcs_recordset_t *)&JERRY_CONTEXT (lit_storage), (rcs_record_t *)this);
   it.skip (header_size ());
   lit_utf8_size_t len = get_length ();
   lit_utf8_size_t i;
@@ -130,7 +132,7 @@ lit_charset_record_t::compare_utf8 (const lit_utf8_byte_t *str_to_compare_with,
     return 1;
   }
 
-  rcs_record_iterator_t it_this (&lit_storage, this);
+  rcs_record_iterator_t it_this (&JERRY_CONTEXT (lit_storage), this);
 
   it_this.skip (header_size ());
 
@@ -172,8 +174,8 @@ lit_charset_record_t::is_equal (lit_charset_record_t *rec) /**< charset record t
     return false;
   }
 
-  rcs_record_iterator_t it_this (&lit_storage, this);
-  rcs_record_iterator_t it_record (&lit_storage, rec);
+  rcs_record_iterator_t it_this (&JERRY_CONTEXT (lit_storage), this);
+  rcs_record_iterator_t it_record (&JERRY_CONTEXT (lit_storage), rec);
 
   it_this.skip (header_size ());
   it_record.skip (rec->header_size ());
@@ -202,7 +204,7 @@ bool
 lit_charset_record_t::is_equal_utf8_string (const lit_utf8_byte_t *str, /**< string to compare with */
                                             lit_utf8_size_t str_size)   /**< length of the string */
 {
-  rcs_record_iterator_t it_this (&lit_storage, this);
+  rcs_record_iterator_t it_this (&JERRY_CONTEXT (lit_storage), this);
 
   it_this.skip (header_size ());
 
@@ -219,6 +221,21 @@ lit_charset_record_t::is_equal_utf8_string (const lit_utf8_byte_t *str, /**< str
   return get_length () == str_size;
 } /* lit_charset_record_t::equal_non_zt */
 
+/**
+ * Get the number which is held by the record
+ *
+ * @return number
+ */
+ecma_number_t
+lit_number_record_t::get_number () const
+{
+  rcs_record_iterator_t it ((rcs_recordset_t *)&JERRY_CONTEXT (lit_storage),
+                            (rcs_record_t *)this);
+  it.skip (header_size ());
+
+  return it.read<ecma_number_t> ();
+} /* lit_number_record_t::get_number */
+
 /**
  * Create charset record in the literal storage
  *
@@ -293,7 +310,9 @@ lit_literal_storage_t::dump ()
 {
   printf ("LITERALS:\n");
 
-  for (rcs_record_t *rec_p = lit_storage.get_first (); rec_p != NULL; rec_p = lit_storage.get_next (rec_p))
+  for (rcs_record_t *rec_p = JERRY_CONTEXT (lit_storage).get_first ();
+       rec_p != NULL;
+       rec_p = JERRY_CONTEXT (lit_storage).get_next (rec_p))
   {
     printf ("%p ", rec_p);
     printf ("[%3zu] ", get_record_size (rec_p));
@@ -19,9 +19,6 @@
 #include "ecma-globals.h"
 #include "rcs-recordset.h"
 
-class lit_literal_storage_t;
-extern lit_literal_storage_t lit_storage;
-
 /**
  * Charset record
  *
@@ -34,6 +31,9 @@ extern lit_literal_storage_t lit_storage;
  * length (16 bits)
  * pointer to prev (16 bits)
  * ------- characters -------------------
+ *
+ * With compressed pointers wider than 16 bits, the header is one 64-bit unit,
+ * and 'alignment' field is 3 bits wide.
  * ...
  * chars
  * ....
@@ -162,7 +162,7 @@ private:
    * Offset and length of 'alignment' field, in bits
    */
   static const uint32_t _alignment_field_pos = _fields_offset_begin;
-  static const uint32_t _alignment_field_width = 2u;
+  static const uint32_t _alignment_field_width = RCS_DYN_STORAGE_ALIGNMENT_LOG;
 
   /**
    * Offset and length of 'hash' field, in bits
@@ -182,7 +182,11 @@ private:
   static const uint32_t _prev_field_pos = _length_field_pos + _length_field_width;
   static const uint32_t _prev_field_width = rcs_cpointer_t::bit_field_width;
 
+#if MEM_CP_WIDTH <= 16
   static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+#else /* MEM_CP_WIDTH > 16 */
+  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT;
+#endif /* MEM_CP_WIDTH > 16 */
 }; /* lit_charset_record_t */
 
 /**
@@ -367,15 +371,7 @@ public:
    *
    * @return number
    */
-  ecma_number_t
-  get_number () const
-  {
-    rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage,
-                              (rcs_record_t *)this);
-    it.skip (header_size ());
-
-    return it.read<ecma_number_t> ();
-  } /* get_number */
+  ecma_number_t get_number () const;
 
 private:
   /**
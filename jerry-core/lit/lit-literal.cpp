@@ -16,6 +16,7 @@
 #include "lit-literal.h"
 
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "lit-magic-strings.h"
 
 /**
@@ -24,8 +25,8 @@
 void
 lit_init ()
 {
-  new (&lit_storage) lit_literal_storage_t ();
-  lit_storage.init ();
+  new (&JERRY_CONTEXT (lit_storage)) lit_literal_storage_t ();
+  JERRY_CONTEXT (lit_storage).init ();
   lit_magic_strings_init ();
   lit_magic_strings_ex_init ();
 } /* lit_init */
@@ -36,8 +37,8 @@ lit_init ()
 void
 lit_finalize ()
 {
-  lit_storage.cleanup ();
-  lit_storage.finalize ();
+  JERRY_CONTEXT (lit_storage).cleanup ();
+  JERRY_CONTEXT (lit_storage).finalize ();
 } /* lit_finalize */
 
 /**
@@ -46,7 +47,7 @@ lit_finalize ()
 void
 lit_dump_literals ()
 {
-  lit_storage.dump ();
+  JERRY_CONTEXT (lit_storage).dump ();
 } /* lit_dump_literals */
 
 /**
@@ -72,7 +73,7 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
 
     if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_utf8 (msi), str_size))
     {
-      return lit_storage.create_magic_record (msi);
+      return JERRY_CONTEXT (lit_storage).create_magic_record (msi);
     }
   }
 
@@ -87,11 +88,11 @@ lit_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**< string t
 
     if (!strncmp ((const char *) str_p, (const char *) lit_get_magic_string_ex_utf8 (msi), str_size))
     {
-      return lit_storage.create_magic_record_ex (msi);
+      return JERRY_CONTEXT (lit_storage).create_magic_record_ex (msi);
     }
   }
 
-  return lit_storage.create_charset_record (str_p, str_size);
+  return JERRY_CONTEXT (lit_storage).create_charset_record (str_p, str_size);
 } /* lit_create_literal_from_utf8_string */
 
 /**
@@ -105,7 +106,9 @@ lit_find_literal_by_utf8_string (const lit_utf8_byte_t *str_p, /**< a string to
                                  lit_utf8_size_t str_size)        /**< length of the string */
 {
   JERRY_ASSERT (str_p || !str_size);
-  for (literal_t lit = lit_storage.get_first (); lit != NULL; lit = lit_storage.get_next (lit))
+  for (literal_t lit = JERRY_CONTEXT (lit_storage).get_first ();
+       lit != NULL;
+       lit = JERRY_CONTEXT (lit_storage).get_next (lit))
   {
     rcs_record_t::type_t type = lit->get_type ();
 
@@ -185,7 +188,7 @@ lit_find_or_create_literal_from_utf8_string (const lit_utf8_byte_t *str_p, /**<
 literal_t
 lit_create_literal_from_num (ecma_number_t num) /**< number to initialize a new number literal */
 {
-  return lit_storage.create_number_record (num);
+  return JERRY_CONTEXT (lit_storage).create_number_record (num);
 } /* lit_create_literal_from_num */
 
 /**
@@ -214,7 +217,9 @@ lit_find_or_create_literal_from_num (ecma_number_t num) /**< number which a lite
 literal_t
 lit_find_literal_by_num (ecma_number_t num) /**< a number to search for */
 {
-  for (literal_t lit = lit_storage.get_first (); lit != NULL; lit = lit_storage.get_next (lit))
+  for (literal_t lit = JERRY_CONTEXT (lit_storage).get_first ();
+       lit != NULL;
+       lit = JERRY_CONTEXT (lit_storage).get_next (lit))
   {
     rcs_record_t::type_t type = lit->get_type ();
 
@@ -505,7 +510,7 @@ lit_literal_to_utf8_string (literal_t lit, /**< literal to be processed */
 const char *
 lit_literal_to_str_internal_buf (literal_t lit) /**< literal */
 {
-  static lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
+  static JERRY_THREAD_LOCAL lit_utf8_byte_t buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER + 1];
   memset (buff, 0, sizeof (buff));
 
   return (const char *) lit_literal_to_utf8_string (lit, buff, sizeof (buff) - 1);
@@ -521,7 +526,7 @@ lit_literal_to_str_internal_buf (literal_t lit) /**< literal */
 static bool
 lit_literal_exists (literal_t lit) /**< literal to check for existence */
 {
-  for (literal_t l = lit_storage.get_first (); l != NULL; l = lit_storage.get_next (l))
+  for (literal_t l = JERRY_CONTEXT (lit_storage).get_first (); l != NULL; l = JERRY_CONTEXT (lit_storage).get_next (l))
   {
     if (l == lit)
     {
@@ -582,7 +587,7 @@ lit_charset_record_get_length (literal_t lit) /**< literal */
   TODO ("Add special case for literals which doesn't contain long characters");
 
   lit_charset_record_t *charset_record_p = static_cast<lit_charset_record_t *> (lit);
-  rcs_record_iterator_t lit_iter (&lit_storage, lit);
+  rcs_record_iterator_t lit_iter (&JERRY_CONTEXT (lit_storage), lit);
   lit_iter.skip (lit_charset_record_t::header_size ());
 
   lit_utf8_size_t lit_utf8_str_size = charset_record_p->get_length ();
@@ -610,3 +615,304 @@ lit_charset_literal_get_number (literal_t lit) /**< literal */
 {
   return static_cast<lit_number_record_t *> (lit)->get_number ();;
 } /* lit_charset_literal_get_number */
+
+/**
+ * Check whether the record of the literal storage is a literal (and not a free record)
+ *
+ * @return true - if the record is a literal,
+ *         false - otherwise.
+ */
+static bool
+lit_is_literal_record (literal_t lit) /**< record of the literal storage */
+{
+  rcs_record_t::type_t type = lit->get_type ();
+
+  return (type == LIT_STR_T
+          || type == LIT_MAGIC_STR_T
+          || type == LIT_MAGIC_STR_EX_T
+          || type == LIT_NUMBER_T);
+} /* lit_is_literal_record */
+
+/**
+ * Sift an element of the max-heap of compressed pointers down to its place
+ */
+static void
+lit_snapshot_cpointers_sift_down (lit_cpointer_t *lit_cps_p, /**< heap */
+                                  uint32_t root, /**< index of the element to sift down */
+                                  uint32_t heap_size) /**< number of elements in the heap */
+{
+  while (2 * root + 1 < heap_size)
+  {
+    uint32_t child = 2 * root + 1;
+
+    if (child + 1 < heap_size && lit_cps_p[child].packed_value < lit_cps_p[child + 1].packed_value)
+    {
+      child++;
+    }
+
+    if (lit_cps_p[root].packed_value >= lit_cps_p[child].packed_value)
+    {
+      break;
+    }
+
+    lit_cpointer_t tmp = lit_cps_p[root];
+    lit_cps_p[root] = lit_cps_p[child];
+    lit_cps_p[child] = tmp;
+
+    root = child;
+  }
+} /* lit_snapshot_cpointers_sift_down */
+
+/**
+ * Sort compressed pointers to literals in ascending order
+ */
+static void
+lit_snapshot_sort_cpointers (lit_cpointer_t *lit_cps_p, /**< array of compressed pointers */
+                             uint32_t lits_number) /**< number of elements in the array */
+{
+  for (uint32_t i = lits_number / 2; i-- > 0;)
+  {
+    lit_snapshot_cpointers_sift_down (lit_cps_p, i, lits_number);
+  }
+
+  for (uint32_t end = lits_number; end > 1; end--)
+  {
+    lit_cpointer_t tmp = lit_cps_p[0];
+    lit_cps_p[0] = lit_cps_p[end - 1];
+    lit_cps_p[end - 1] = tmp;
+
+    lit_snapshot_cpointers_sift_down (lit_cps_p, 0, end - 1);
+  }
+} /* lit_snapshot_sort_cpointers */
+
+/**
+ * Dump the literal storage to the literal table section of a snapshot
+ *
+ * Literals are dumped in order of their compressed pointers, so the index of a literal
+ * in the table can be found with lit_snapshot_get_literal_index.
+ *
+ * Table's record layout:
+ *  - type (uint8_t: LIT_STR_T or LIT_NUMBER_T);
+ *  - for strings: size (lit_utf8_size_t) and the string's bytes (magic strings are dumped as plain strings);
+ *  - for numbers: the number's value (ecma_number_t).
+ *
+ * @return true, if the table was dumped successfully (in this case *out_lit_cps_p should be released
+ *               with mem_heap_free_block by the caller, if it is not NULL),
+ *         false - if the buffer is too small.
+ */
+bool
+lit_dump_literals_for_snapshot (uint8_t *buffer_p, /**< buffer to dump to */
+                                size_t buffer_size, /**< buffer size */
+                                size_t *in_out_buffer_offset_p, /**< in-out: write position in the buffer */
+                                lit_cpointer_t **out_lit_cps_p, /**< out: sorted array of the literals'
+                                                                 *        compressed pointers */
+                                uint32_t *out_lits_number_p) /**< out: number of dumped literals */
+{
+  uint32_t lits_number = 0;
+
+  for (literal_t lit = JERRY_CONTEXT (lit_storage).get_first ();
+       lit != NULL;
+       lit = JERRY_CONTEXT (lit_storage).get_next (lit))
+  {
+    if (lit_is_literal_record (lit))
+    {
+      lits_number++;
+    }
+  }
+
+  *out_lit_cps_p = NULL;
+  *out_lits_number_p = 0;
+
+  if (lits_number == 0)
+  {
+    return true;
+  }
+
+  lit_cpointer_t *lit_cps_p = (lit_cpointer_t *) mem_heap_alloc_block (lits_number * sizeof (lit_cpointer_t),
+                                                                       MEM_HEAP_ALLOC_SHORT_TERM);
+
+  uint32_t lit_index = 0;
+
+  for (literal_t lit = JERRY_CONTEXT (lit_storage).get_first ();
+       lit != NULL;
+       lit = JERRY_CONTEXT (lit_storage).get_next (lit))
+  {
+    if (lit_is_literal_record (lit))
+    {
+      lit_cps_p[lit_index++] = lit_cpointer_t::compress (lit);
+    }
+  }
+
+  lit_snapshot_sort_cpointers (lit_cps_p, lits_number);
+
+  bool is_ok = true;
+
+  for (lit_index = 0; is_ok && lit_index < lits_number; lit_index++)
+  {
+    literal_t lit = lit_cpointer_t::decompress (lit_cps_p[lit_index]);
+    rcs_record_t::type_t type = lit->get_type ();
+
+    uint8_t dumped_type = (uint8_t) (type == LIT_NUMBER_T ? LIT_NUMBER_T : LIT_STR_T);
+    is_ok = jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p,
+                                           &dumped_type, sizeof (dumped_type));
+
+    if (!is_ok)
+    {
+      break;
+    }
+
+    if (type == LIT_NUMBER_T)
+    {
+      ecma_number_t num = static_cast<lit_number_record_t *> (lit)->get_number ();
+
+      is_ok = jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, &num, sizeof (num));
+    }
+    else if (type == LIT_STR_T)
+    {
+      lit_charset_record_t *charset_record_p = static_cast<lit_charset_record_t *> (lit);
+      lit_utf8_size_t size = charset_record_p->get_length ();
+
+      is_ok = (jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, &size, sizeof (size))
+               && size <= buffer_size - *in_out_buffer_offset_p);
+
+      if (is_ok && size != 0)
+      {
+        charset_record_p->get_charset (buffer_p + *in_out_buffer_offset_p, size);
+        *in_out_buffer_offset_p += size;
+      }
+    }
+    else
+    {
+      JERRY_ASSERT (type == LIT_MAGIC_STR_T || type == LIT_MAGIC_STR_EX_T);
+
+      const lit_utf8_byte_t *str_p;
+      lit_utf8_size_t size;
+
+      if (type == LIT_MAGIC_STR_T)
+      {
+        lit_magic_string_id_t id = lit_magic_record_get_magic_str_id (lit);
+
+        str_p = lit_get_magic_string_utf8 (id);
+        size = lit_get_magic_string_size (id);
+      }
+      else
+      {
+        lit_magic_string_ex_id_t id = lit_magic_record_ex_get_magic_str_id (lit);
+
+        str_p = lit_get_magic_string_ex_utf8 (id);
+        size = lit_get_magic_string_ex_size (id);
+      }
+
+      is_ok = (jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, &size, sizeof (size))
+               && jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, str_p, size));
+    }
+  }
+
+  if (!is_ok)
+  {
+    mem_heap_free_block (lit_cps_p);
+
+    return false;
+  }
+
+  *out_lit_cps_p = lit_cps_p;
+  *out_lits_number_p = lits_number;
+
+  return true;
+} /* lit_dump_literals_for_snapshot */
+
+/**
+ * Get index of a literal in the literal table of a snapshot
+ *
+ * @return index of the literal in the sorted array of compressed pointers
+ *         (see also: lit_dump_literals_for_snapshot)
+ */
+uint32_t
+lit_snapshot_get_literal_index (const lit_cpointer_t *lit_cps_p, /**< sorted array of compressed pointers */
+                                uint32_t lits_number, /**< number of elements in the array */
+                                lit_cpointer_t lit_cp) /**< compressed pointer to look up */
+{
+  uint32_t low = 0;
+  uint32_t high = lits_number;
+
+  while (low < high)
+  {
+    const uint32_t middle = low + (high - low) / 2;
+
+    if (lit_cps_p[middle].packed_value < lit_cp.packed_value)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  JERRY_ASSERT (low < lits_number && lit_cps_p[low].packed_value == lit_cp.packed_value);
+
+  return low;
+} /* lit_snapshot_get_literal_index */
+
+/**
+ * Load the literal table section of a snapshot to the literal storage
+ *
+ * Each of the literals is looked up in the storage and is created only if it is not registered yet.
+ *
+ * @return true, if the table was loaded successfully,
+ *         false - if the table is corrupted.
+ */
+bool
+lit_load_literals_from_snapshot (const uint8_t *lit_table_p, /**< literal table section */
+                                 size_t lit_table_size, /**< size of the section */
+                                 uint32_t lits_number, /**< number of literals in the table */
+                                 lit_cpointer_t *out_lit_cps_p) /**< out: compressed pointers to the literals,
+                                                                 *        in order of the table */
+{
+  size_t offset = 0;
+
+  for (uint32_t lit_index = 0; lit_index < lits_number; lit_index++)
+  {
+    uint8_t type;
+
+    if (!jrt_read_from_buffer_by_offset (lit_table_p, lit_table_size, &offset, &type, sizeof (type)))
+    {
+      return false;
+    }
+
+    literal_t lit;
+
+    if (type == LIT_NUMBER_T)
+    {
+      ecma_number_t num;
+
+      if (!jrt_read_from_buffer_by_offset (lit_table_p, lit_table_size, &offset, &num, sizeof (num)))
+      {
+        return false;
+      }
+
+      lit = lit_find_or_create_literal_from_num (num);
+    }
+    else if (type == LIT_STR_T)
+    {
+      lit_utf8_size_t size;
+
+      if (!jrt_read_from_buffer_by_offset (lit_table_p, lit_table_size, &offset, &size, sizeof (size))
+          || size > lit_table_size - offset)
+      {
+        return false;
+      }
+
+      lit = lit_find_or_create_literal_from_utf8_string (lit_table_p + offset, size);
+      offset += size;
+    }
+    else
+    {
+      return false;
+    }
+
+    out_lit_cps_p[lit_index] = lit_cpointer_t::compress (lit);
+  }
+
+  return (offset == lit_table_size);
+} /* lit_load_literals_from_snapshot */
@@ -56,4 +56,8 @@ ecma_length_t lit_charset_record_get_length (literal_t);
 lit_magic_string_id_t lit_magic_record_get_magic_str_id (literal_t);
 lit_magic_string_ex_id_t lit_magic_record_ex_get_magic_str_id (literal_t);
 
+bool lit_dump_literals_for_snapshot (uint8_t *, size_t, size_t *, lit_cpointer_t **, uint32_t *);
+uint32_t lit_snapshot_get_literal_index (const lit_cpointer_t *, uint32_t, lit_cpointer_t);
+bool lit_load_literals_from_snapshot (const uint8_t *, size_t, uint32_t, lit_cpointer_t *);
+
 #endif /* LIT_LITERAL_H */
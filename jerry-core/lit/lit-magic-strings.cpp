@@ -15,26 +15,21 @@
 
 #include "lit-magic-strings.h"
 
+#include "jcontext.h"
 #include "lit-strings.h"
 
 /**
- * Lengths of magic strings
+ * Sizes of magic strings
  */
-static lit_utf8_size_t lit_magic_string_sizes[LIT_MAGIC_STRING__COUNT];
-
-/**
- * External magic strings data array, count and lengths
- */
-static const lit_utf8_byte_t **lit_magic_string_ex_array = NULL;
-static uint32_t lit_magic_string_ex_count = 0;
-static const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
+static const lit_utf8_size_t lit_magic_string_sizes[] =
+{
+#define LIT_MAGIC_STRING_DEF(id, utf8_string) \
+  (lit_utf8_size_t) (sizeof (utf8_string) - 1),
+#include "lit-magic-strings.inc.h"
+#undef LIT_MAGIC_STRING_DEF
+};
 
-#ifndef JERRY_NDEBUG
-/**
- * Maximum length among lengths of magic strings
- */
-static ecma_length_t ecma_magic_string_max_length;
-#endif /* JERRY_NDEBUG */
+JERRY_STATIC_ASSERT (sizeof (lit_magic_string_sizes) / sizeof (lit_magic_string_sizes[0]) == LIT_MAGIC_STRING__COUNT);
 
 /**
  * Initialize data for string helpers
@@ -42,24 +37,15 @@ static ecma_length_t ecma_magic_string_max_length;
 void
 lit_magic_strings_init (void)
 {
-  /* Initializing magic strings information */
-
 #ifndef JERRY_NDEBUG
-  ecma_magic_string_max_length = 0;
-#endif /* !JERRY_NDEBUG */
-
   for (lit_magic_string_id_t id = (lit_magic_string_id_t) 0;
        id < LIT_MAGIC_STRING__COUNT;
        id = (lit_magic_string_id_t) (id + 1))
   {
-    lit_magic_string_sizes[id] = lit_zt_utf8_string_size (lit_get_magic_string_utf8 (id));
-
-#ifndef JERRY_NDEBUG
-    ecma_magic_string_max_length = JERRY_MAX (ecma_magic_string_max_length, lit_magic_string_sizes[id]);
-
-    JERRY_ASSERT (ecma_magic_string_max_length <= LIT_MAGIC_STRING_LENGTH_LIMIT);
-#endif /* !JERRY_NDEBUG */
+    JERRY_ASSERT (lit_magic_string_sizes[id] == lit_zt_utf8_string_size (lit_get_magic_string_utf8 (id)));
+    JERRY_ASSERT (lit_magic_string_sizes[id] <= LIT_MAGIC_STRING_LENGTH_LIMIT);
   }
+#endif /* !JERRY_NDEBUG */
 } /* lit_magic_strings_init */
 
 /**
@@ -68,9 +54,9 @@ lit_magic_strings_init (void)
 void
 lit_magic_strings_ex_init (void)
 {
-  lit_magic_string_ex_array = NULL;
-  lit_magic_string_ex_count = 0;
-  lit_magic_string_ex_sizes = NULL;
+  JERRY_CONTEXT (lit_magic_string_ex_array) = NULL;
+  JERRY_CONTEXT (lit_magic_string_ex_count) = 0;
+  JERRY_CONTEXT (lit_magic_string_ex_sizes) = NULL;
 } /* lit_magic_strings_ex_init */
 
 /**
@@ -82,7 +68,7 @@ lit_magic_strings_ex_init (void)
 uint32_t
 lit_get_magic_string_ex_count (void)
 {
-  return lit_magic_string_ex_count;
+  return JERRY_CONTEXT (lit_magic_string_ex_count);
 } /* lit_get_magic_string_ex_count */
 
 /**
@@ -125,9 +111,9 @@ lit_get_magic_string_size (lit_magic_string_id_t id) /**< magic string id */
 const lit_utf8_byte_t *
 lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic string id */
 {
-  if (lit_magic_string_ex_array && id < lit_magic_string_ex_count)
+  if (JERRY_CONTEXT (lit_magic_string_ex_array) && id < JERRY_CONTEXT (lit_magic_string_ex_count))
   {
-    return lit_magic_string_ex_array[id];
+    return JERRY_CONTEXT (lit_magic_string_ex_array)[id];
   }
 
   JERRY_UNREACHABLE ();
@@ -141,7 +127,7 @@ lit_get_magic_string_ex_utf8 (lit_magic_string_ex_id_t id) /**< extern magic str
 lit_utf8_size_t
 lit_get_magic_string_ex_size (lit_magic_string_ex_id_t id) /**< external magic string id */
 {
-  return lit_magic_string_ex_sizes[id];
+  return JERRY_CONTEXT (lit_magic_string_ex_sizes)[id];
 } /* lit_get_magic_string_ex_size */
 
 /**
@@ -157,25 +143,23 @@ lit_magic_strings_ex_set (const lit_utf8_byte_t **ex_str_items, /**< character a
   JERRY_ASSERT (count > 0);
   JERRY_ASSERT (ex_str_sizes != NULL);
 
-  JERRY_ASSERT (lit_magic_string_ex_array == NULL);
-  JERRY_ASSERT (lit_magic_string_ex_count == 0);
-  JERRY_ASSERT (lit_magic_string_ex_sizes == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_array) == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_count) == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes) == NULL);
 
   /* Set external magic strings information */
-  lit_magic_string_ex_array = ex_str_items;
-  lit_magic_string_ex_count = count;
-  lit_magic_string_ex_sizes = ex_str_sizes;
+  JERRY_CONTEXT (lit_magic_string_ex_array) = ex_str_items;
+  JERRY_CONTEXT (lit_magic_string_ex_count) = count;
+  JERRY_CONTEXT (lit_magic_string_ex_sizes) = ex_str_sizes;
 
 #ifndef JERRY_NDEBUG
   for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
-       id < lit_magic_string_ex_count;
+       id < JERRY_CONTEXT (lit_magic_string_ex_count);
        id = (lit_magic_string_ex_id_t) (id + 1))
   {
-    JERRY_ASSERT (lit_magic_string_ex_sizes[id] == lit_zt_utf8_string_size (lit_get_magic_string_ex_utf8 (id)));
-
-    ecma_magic_string_max_length = JERRY_MAX (ecma_magic_string_max_length, lit_magic_string_ex_sizes[id]);
-
-    JERRY_ASSERT (ecma_magic_string_max_length <= LIT_MAGIC_STRING_LENGTH_LIMIT);
+    JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes)[id]
+                  == lit_zt_utf8_string_size (lit_get_magic_string_ex_utf8 (id)));
+    JERRY_ASSERT (JERRY_CONTEXT (lit_magic_string_ex_sizes)[id] <= LIT_MAGIC_STRING_LENGTH_LIMIT);
   }
 #endif /* !JERRY_NDEBUG */
 } /* lit_magic_strings_ex_set */
@@ -226,7 +210,7 @@ bool lit_is_ex_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 st
   TODO (Improve performance of search);
 
   for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
-       id < lit_magic_string_ex_count;
+       id < JERRY_CONTEXT (lit_magic_string_ex_count);
        id = (lit_magic_string_ex_id_t) (id + 1))
   {
     if (lit_compare_utf8_string_and_magic_string_ex (string_p, string_size, id))
@@ -237,7 +221,7 @@ bool lit_is_ex_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 st
     }
   }
 
-  *out_id_p = lit_magic_string_ex_count;
+  *out_id_p = JERRY_CONTEXT (lit_magic_string_ex_count);
 
   return false;
 } /* lit_is_ex_utf8_string_magic */
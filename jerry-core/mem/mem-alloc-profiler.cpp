@@ -0,0 +1,352 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "mem-alloc-profiler.h"
+#include "serializer.h"
+#include "vm.h"
+
+#ifdef MEM_ALLOC_PROFILER
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup memallocprofiler Allocation-site profiler
+ * @{
+ *
+ * The profiler attributes each block of the heap and each chunk of the pools to the site of its allocation,
+ * and keeps per-site counters of currently allocated (live) bytes, so the sites, that hold most of the memory,
+ * can be listed on demand (see also: jerry_alloc_profiler_dump) or upon out-of-memory.
+ */
+
+/**
+ * Index of the site, allocations are accounted to, when the sites' table is full
+ */
+#define MEM_ALLOC_PROFILER_OTHER_SITES_IDX (MEM_ALLOC_PROFILER_SITES_NUMBER - 1u)
+
+JERRY_STATIC_ASSERT (MEM_ALLOC_PROFILER_SITES_NUMBER <= (1u << (sizeof (mem_alloc_profiler_site_idx_t)
+                                                               * JERRY_BITSINBYTE)));
+JERRY_STATIC_ASSERT ((MEM_ALLOC_PROFILER_SITES_HASH_SIZE & (MEM_ALLOC_PROFILER_SITES_HASH_SIZE - 1u)) == 0);
+JERRY_STATIC_ASSERT (MEM_ALLOC_PROFILER_SITES_HASH_SIZE > MEM_ALLOC_PROFILER_SITES_NUMBER);
+
+/**
+ * Initialize the profiler
+ */
+void
+mem_alloc_profiler_init (bool is_enabled) /**< should profiling be enabled */
+{
+  memset (&JERRY_CONTEXT (mem_alloc_profiler), 0, sizeof (JERRY_CONTEXT (mem_alloc_profiler)));
+
+  if (is_enabled
+      && JERRY_CONTEXT (mem_heap).heap_size > MEM_ALLOC_PROFILER_HEAP_UNITS_NUMBER * MEM_ALIGNMENT)
+  {
+    JERRY_WARNING_MSG ("Ignoring allocation profile option, as the heap is larger than MEM_HEAP_AREA_SIZE.\n");
+
+    is_enabled = false;
+  }
+
+  JERRY_CONTEXT (mem_alloc_profiler).is_enabled = is_enabled;
+
+  /* site 0 is reserved for not tracked allocations */
+  JERRY_CONTEXT (mem_alloc_profiler).sites_number = 1;
+
+  strncpy (JERRY_CONTEXT (mem_alloc_profiler).sites[MEM_ALLOC_PROFILER_OTHER_SITES_IDX].name,
+           "(other sites)",
+           MEM_ALLOC_PROFILER_MAX_NAME_SIZE - 1);
+} /* mem_alloc_profiler_init */
+
+/**
+ * Get index of the aligned unit of the heap, a block's or chunk's data starts at
+ *
+ * @return unit index
+ */
+static size_t
+mem_alloc_profiler_get_unit_idx (const void *p) /**< pointer to the block's or chunk's data */
+{
+  const uint8_t *uint8_p = (const uint8_t *) p;
+
+  JERRY_ASSERT (uint8_p >= JERRY_CONTEXT (mem_heap).heap_start
+                && uint8_p < JERRY_CONTEXT (mem_heap).heap_start + JERRY_CONTEXT (mem_heap).heap_size);
+  JERRY_ASSERT ((uintptr_t) uint8_p % MEM_ALIGNMENT == 0);
+
+  return (size_t) (uint8_p - JERRY_CONTEXT (mem_heap).heap_start) >> MEM_ALIGNMENT_LOG;
+} /* mem_alloc_profiler_get_unit_idx */
+
+/**
+ * Calculate hash of an allocation site
+ *
+ * @return index in the sites' hash table
+ */
+static uint32_t
+mem_alloc_profiler_get_site_hash (const void *code_p, /**< executed byte-code */
+                                  uint32_t pos, /**< position of the executed instruction */
+                                  const void *native_caller_p) /**< allocator's caller */
+{
+  uintptr_t hash = (uintptr_t) code_p ^ ((uintptr_t) native_caller_p * 31u) ^ ((uintptr_t) pos * 2654435761u);
+
+  hash ^= hash >> 16;
+
+  return (uint32_t) hash & (MEM_ALLOC_PROFILER_SITES_HASH_SIZE - 1u);
+} /* mem_alloc_profiler_get_site_hash */
+
+/**
+ * Describe a newly registered site with name of the executed function and source line of the executed instruction
+ */
+static void
+mem_alloc_profiler_describe_site (mem_alloc_profiler_site_t *site_p, /**< the site */
+                                  const int_data_t *frame_p) /**< interpreter context, executed upon the allocation
+                                                              *   (NULL - if no JavaScript code is executed) */
+{
+  if (frame_p == NULL)
+  {
+    strncpy (site_p->name, "(native)", MEM_ALLOC_PROFILER_MAX_NAME_SIZE - 1);
+    site_p->line = 0;
+
+    return;
+  }
+
+  lit_utf8_byte_t name_buffer[MEM_ALLOC_PROFILER_MAX_NAME_SIZE];
+
+  strncpy (site_p->name,
+           vm_get_function_name (frame_p, name_buffer, sizeof (name_buffer)),
+           MEM_ALLOC_PROFILER_MAX_NAME_SIZE - 1);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  site_p->line = serializer_get_line (frame_p->opcodes_p, frame_p->pos);
+#else /* JERRY_ENABLE_LINE_INFO */
+  site_p->line = 0;
+#endif /* !JERRY_ENABLE_LINE_INFO */
+} /* mem_alloc_profiler_describe_site */
+
+/**
+ * Find the site of current allocation, registering it, if it was not registered yet
+ *
+ * @return index of the site
+ */
+static mem_alloc_profiler_site_idx_t
+mem_alloc_profiler_get_site (const void *native_caller_p) /**< allocator's caller */
+{
+  const int_data_t *frame_p = JERRY_CONTEXT (vm_top_context_p);
+  const void *code_p = (frame_p != NULL) ? frame_p->opcodes_p : NULL;
+  const uint32_t pos = (frame_p != NULL) ? frame_p->pos : 0;
+
+  mem_alloc_profiler_state_t *state_p = &JERRY_CONTEXT (mem_alloc_profiler);
+  uint32_t hash = mem_alloc_profiler_get_site_hash (code_p, pos, native_caller_p);
+
+  while (state_p->sites_hash[hash] != 0)
+  {
+    const mem_alloc_profiler_site_t *site_p = &state_p->sites[state_p->sites_hash[hash]];
+
+    if (site_p->code_p == code_p
+        && site_p->pos == pos
+        && site_p->native_caller_p == native_caller_p)
+    {
+      return state_p->sites_hash[hash];
+    }
+
+    hash = (hash + 1u) & (MEM_ALLOC_PROFILER_SITES_HASH_SIZE - 1u);
+  }
+
+  if (state_p->sites_number == MEM_ALLOC_PROFILER_OTHER_SITES_IDX)
+  {
+    return MEM_ALLOC_PROFILER_OTHER_SITES_IDX;
+  }
+
+  mem_alloc_profiler_site_idx_t site_idx = (mem_alloc_profiler_site_idx_t) state_p->sites_number++;
+  mem_alloc_profiler_site_t *site_p = &state_p->sites[site_idx];
+
+  site_p->code_p = code_p;
+  site_p->pos = pos;
+  site_p->native_caller_p = native_caller_p;
+  mem_alloc_profiler_describe_site (site_p, frame_p);
+
+  state_p->sites_hash[hash] = site_idx;
+
+  return site_idx;
+} /* mem_alloc_profiler_get_site */
+
+/**
+ * Register allocation of a heap block or a pool chunk
+ */
+void
+mem_alloc_profiler_register_alloc (void *p, /**< pointer to the block's or chunk's data */
+                                   size_t size, /**< size of the block or chunk */
+                                   const void *native_caller_p) /**< allocator's caller */
+{
+  if (!JERRY_CONTEXT (mem_alloc_profiler).is_enabled
+      || p == NULL)
+  {
+    return;
+  }
+
+  mem_alloc_profiler_site_idx_t site_idx = mem_alloc_profiler_get_site (native_caller_p);
+  mem_alloc_profiler_site_t *site_p = &JERRY_CONTEXT (mem_alloc_profiler).sites[site_idx];
+
+  site_p->live_bytes += size;
+  site_p->live_blocks_number++;
+  site_p->allocs_number++;
+
+  if (site_p->live_bytes > site_p->peak_live_bytes)
+  {
+    site_p->peak_live_bytes = site_p->live_bytes;
+  }
+
+  JERRY_CONTEXT (mem_alloc_profiler).units_sites[mem_alloc_profiler_get_unit_idx (p)] = site_idx;
+} /* mem_alloc_profiler_register_alloc */
+
+/**
+ * Register release of a heap block or a pool chunk
+ *
+ * Note:
+ *      release of a block or chunk, allocated before the profiler was enabled, is ignored
+ */
+void
+mem_alloc_profiler_register_free (void *p, /**< pointer to the block's or chunk's data */
+                                  size_t size) /**< size of the block or chunk */
+{
+  if (!JERRY_CONTEXT (mem_alloc_profiler).is_enabled)
+  {
+    return;
+  }
+
+  const size_t unit_idx = mem_alloc_profiler_get_unit_idx (p);
+  const mem_alloc_profiler_site_idx_t site_idx = JERRY_CONTEXT (mem_alloc_profiler).units_sites[unit_idx];
+
+  if (site_idx == 0)
+  {
+    return;
+  }
+
+  mem_alloc_profiler_site_t *site_p = &JERRY_CONTEXT (mem_alloc_profiler).sites[site_idx];
+
+  JERRY_ASSERT (site_p->live_bytes >= size && site_p->live_blocks_number > 0);
+
+  site_p->live_bytes -= size;
+  site_p->live_blocks_number--;
+
+  JERRY_CONTEXT (mem_alloc_profiler).units_sites[unit_idx] = 0;
+} /* mem_alloc_profiler_register_free */
+
+/**
+ * Check whether a site should be listed before another site in the report
+ *
+ * @return true - if the first site holds more live bytes (or holds the same amount and was registered earlier),
+ *         false - otherwise.
+ */
+static bool
+mem_alloc_profiler_is_site_before (mem_alloc_profiler_site_idx_t site1_idx, /**< first site */
+                                   mem_alloc_profiler_site_idx_t site2_idx) /**< second site */
+{
+  const size_t live_bytes1 = JERRY_CONTEXT (mem_alloc_profiler).sites[site1_idx].live_bytes;
+  const size_t live_bytes2 = JERRY_CONTEXT (mem_alloc_profiler).sites[site2_idx].live_bytes;
+
+  return (live_bytes1 > live_bytes2
+          || (live_bytes1 == live_bytes2 && site1_idx < site2_idx));
+} /* mem_alloc_profiler_is_site_before */
+
+/**
+ * Print the sites, holding most of currently allocated memory
+ *
+ * @return true - if the profiler is enabled,
+ *         false - otherwise (nothing is printed).
+ */
+bool
+mem_alloc_profiler_dump (uint32_t max_sites_number) /**< maximum number of sites to print */
+{
+  if (!JERRY_CONTEXT (mem_alloc_profiler).is_enabled)
+  {
+    return false;
+  }
+
+  const mem_alloc_profiler_state_t *state_p = &JERRY_CONTEXT (mem_alloc_profiler);
+
+  size_t total_live_bytes = 0;
+
+  for (uint32_t site_idx = 1; site_idx < MEM_ALLOC_PROFILER_SITES_NUMBER; site_idx++)
+  {
+    total_live_bytes += state_p->sites[site_idx].live_bytes;
+  }
+
+  printf ("\n----- Allocation sites (top %u by live bytes; %zu live bytes at %u sites) -----\n\n",
+          (unsigned int) max_sites_number,
+          total_live_bytes,
+          (unsigned int) (state_p->sites_number - 1u));
+  printf ("%12s %12s %8s %10s  %s\n",
+          "Live bytes",
+          "Peak bytes",
+          "Blocks",
+          "Allocs",
+          "Site (function:line @instruction) [allocator's caller]");
+
+  /* the sites are selected in order of decreasing live bytes, without sorting of the table */
+  mem_alloc_profiler_site_idx_t prev_site_idx = 0;
+
+  for (uint32_t printed_sites_number = 0; printed_sites_number < max_sites_number; printed_sites_number++)
+  {
+    mem_alloc_profiler_site_idx_t next_site_idx = 0;
+
+    for (uint32_t site_idx = 1; site_idx < MEM_ALLOC_PROFILER_SITES_NUMBER; site_idx++)
+    {
+      const mem_alloc_profiler_site_idx_t idx = (mem_alloc_profiler_site_idx_t) site_idx;
+
+      if (state_p->sites[idx].allocs_number != 0
+          && (prev_site_idx == 0 || mem_alloc_profiler_is_site_before (prev_site_idx, idx))
+          && (next_site_idx == 0 || mem_alloc_profiler_is_site_before (idx, next_site_idx)))
+      {
+        next_site_idx = idx;
+      }
+    }
+
+    if (next_site_idx == 0)
+    {
+      break;
+    }
+
+    const mem_alloc_profiler_site_t *site_p = &state_p->sites[next_site_idx];
+
+    printf ("%12zu %12zu %8zu %10zu  %s",
+            site_p->live_bytes,
+            site_p->peak_live_bytes,
+            site_p->live_blocks_number,
+            site_p->allocs_number,
+            site_p->name);
+
+    if (site_p->code_p != NULL)
+    {
+      printf (":%u @%u", (unsigned int) site_p->line, (unsigned int) site_p->pos);
+    }
+
+    if (next_site_idx != MEM_ALLOC_PROFILER_OTHER_SITES_IDX)
+    {
+      printf (" [%p]", site_p->native_caller_p);
+    }
+
+    printf ("\n");
+
+    prev_site_idx = next_site_idx;
+  }
+
+  printf ("\n");
+
+  return true;
+} /* mem_alloc_profiler_dump */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* MEM_ALLOC_PROFILER */
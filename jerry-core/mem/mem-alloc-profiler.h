@@ -0,0 +1,129 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MEM_ALLOC_PROFILER_H
+#define MEM_ALLOC_PROFILER_H
+
+#ifdef MEM_ALLOC_PROFILER
+
+#include "jrt.h"
+#include "mem-allocator.h"
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup memallocprofiler Allocation-site profiler
+ * @{
+ */
+
+/**
+ * Maximum number of distinct allocation sites (allocations at further sites are accounted to the last site)
+ */
+#define MEM_ALLOC_PROFILER_SITES_NUMBER (1024u)
+
+/**
+ * Size of the allocation sites' hash table (should be a power of 2)
+ */
+#define MEM_ALLOC_PROFILER_SITES_HASH_SIZE (2 * MEM_ALLOC_PROFILER_SITES_NUMBER)
+
+/**
+ * Maximum size of a function's name in a site's description (longer names are truncated)
+ */
+#define MEM_ALLOC_PROFILER_MAX_NAME_SIZE (32u)
+
+/**
+ * Number of sites, listed in the report upon out-of-memory
+ */
+#define MEM_ALLOC_PROFILER_OUT_OF_MEMORY_REPORT_SITES_NUMBER (20u)
+
+/**
+ * Number of aligned units of the heap, the profiler can track allocations in
+ */
+#define MEM_ALLOC_PROFILER_HEAP_UNITS_NUMBER (MEM_HEAP_AREA_SIZE / MEM_ALIGNMENT)
+
+/**
+ * Index of an allocation site (0 - allocation is not tracked)
+ */
+typedef uint16_t mem_alloc_profiler_site_idx_t;
+
+/**
+ * Allocation site
+ *
+ * The site is identified with the JavaScript instruction, executed upon the allocation (if any),
+ * and the engine's routine that called the allocator.
+ *
+ * Note:
+ *      name of the function is resolved with the interpreter context (start of the function's block
+ *      and the eval code flag), that exists only while the code is executed, so the name and the line
+ *      are resolved upon the site's first allocation, instead of upon the report.
+ */
+typedef struct
+{
+  const void *code_p; /**< byte-code, executed upon the allocations (NULL - if no JavaScript code was executed) */
+  const void *native_caller_p; /**< return address of the allocator's call */
+  uint32_t pos; /**< position of the executed instruction in the byte-code */
+  uint32_t line; /**< source line of the instruction (0 - if unknown) */
+  size_t live_bytes; /**< currently allocated bytes */
+  size_t peak_live_bytes; /**< peak allocated bytes */
+  size_t live_blocks_number; /**< number of currently allocated blocks and chunks */
+  size_t allocs_number; /**< number of allocations */
+  char name[MEM_ALLOC_PROFILER_MAX_NAME_SIZE]; /**< name of the function, executed upon the allocations */
+} mem_alloc_profiler_site_t;
+
+/**
+ * State of the allocation-site profiler
+ */
+typedef struct
+{
+  bool is_enabled; /**< is profiling enabled (see also: JERRY_FLAG_ALLOC_PROFILE) */
+  uint32_t sites_number; /**< number of registered sites (including the reserved site 0) */
+  mem_alloc_profiler_site_t sites[MEM_ALLOC_PROFILER_SITES_NUMBER]; /**< allocation sites */
+  mem_alloc_profiler_site_idx_t sites_hash[MEM_ALLOC_PROFILER_SITES_HASH_SIZE]; /**< hash table of sites' indexes */
+  mem_alloc_profiler_site_idx_t units_sites[MEM_ALLOC_PROFILER_HEAP_UNITS_NUMBER]; /**< site of an allocated block
+                                                                                      *   or chunk for each aligned
+                                                                                      *   unit of the heap, the
+                                                                                      *   block's or chunk's data
+                                                                                      *   starts at */
+} mem_alloc_profiler_state_t;
+
+extern void mem_alloc_profiler_init (bool);
+extern void mem_alloc_profiler_register_alloc (void *, size_t, const void *);
+extern void mem_alloc_profiler_register_free (void *, size_t);
+extern bool mem_alloc_profiler_dump (uint32_t);
+
+/**
+ * Register allocation of a block or chunk, attributing it to the calling routine
+ */
+#define MEM_ALLOC_PROFILER_REGISTER_ALLOC(p, size) \
+  mem_alloc_profiler_register_alloc ((p), (size), __builtin_return_address (0))
+
+/**
+ * Register release of a block or chunk
+ */
+#define MEM_ALLOC_PROFILER_REGISTER_FREE(p, size) mem_alloc_profiler_register_free ((p), (size))
+
+/**
+ * @}
+ * @}
+ */
+
+#else /* MEM_ALLOC_PROFILER */
+
+#  define MEM_ALLOC_PROFILER_REGISTER_ALLOC(p, size)
+#  define MEM_ALLOC_PROFILER_REGISTER_FREE(p, size)
+
+#endif /* !MEM_ALLOC_PROFILER */
+
+#endif /* !MEM_ALLOC_PROFILER_H */
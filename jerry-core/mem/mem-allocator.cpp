@@ -17,6 +17,7 @@
  * Allocator implementation
  */
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
@@ -27,26 +28,78 @@
 
 #include "mem-allocator-internal.h"
 
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+# include <sys/mman.h>
+#else /* CONFIG_JERRY_SERVER_PROFILE */
 /**
  * Area for heap
  */
 static uint8_t mem_heap_area[ MEM_HEAP_AREA_SIZE ] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT,
                                                                                        MEM_HEAP_CHUNK_SIZE))));
+#endif /* !CONFIG_JERRY_SERVER_PROFILE */
 
 /**
- * The 'try to give memory back' callback
+ * Initialize memory allocators.
  */
-static mem_try_give_memory_back_callback_t mem_try_give_memory_back_callback = NULL;
+void
+mem_init (void)
+{
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  mem_init_with_heap_size (MEM_HEAP_AREA_SIZE);
+#else /* CONFIG_JERRY_SERVER_PROFILE */
+  mem_init_with_heap_area (mem_heap_area, sizeof (mem_heap_area));
+#endif /* !CONFIG_JERRY_SERVER_PROFILE */
+} /* mem_init */
 
 /**
- * Initialize memory allocators.
+ * Initialize memory allocators, placing heap in the specified area.
  */
 void
-mem_init (void)
+mem_init_with_heap_area (uint8_t *heap_area_p, /**< area for heap, aligned to MEM_HEAP_CHUNK_SIZE */
+                         size_t heap_area_size) /**< size of the area */
 {
-  mem_heap_init (mem_heap_area, sizeof (mem_heap_area));
+  JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number) = 0;
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  JERRY_CONTEXT (mem_is_heap_area_mapped) = false;
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
+
+  mem_heap_init (heap_area_p, heap_area_size);
   mem_pools_init ();
-} /* mem_init */
+} /* mem_init_with_heap_area */
+
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+/**
+ * Initialize memory allocators, placing heap in a newly mapped area of the specified size.
+ *
+ * Note:
+ *      the area is only reserved in the address space, and its pages are committed
+ *      by the kernel upon first access, so the engine consumes physical memory
+ *      in accordance with actual usage of the heap.
+ */
+void
+mem_init_with_heap_size (size_t heap_size) /**< size of heap (is aligned up to MEM_HEAP_CHUNK_SIZE,
+                                            *   and is limited to 2 ^ MEM_HEAP_OFFSET_LOG) */
+{
+  heap_size = JERRY_MIN (JERRY_ALIGNUP (heap_size, MEM_HEAP_CHUNK_SIZE), ((size_t) 1u << MEM_HEAP_OFFSET_LOG));
+  heap_size = JERRY_MAX (heap_size, MEM_HEAP_CHUNK_SIZE);
+
+  void *area_p = mmap (NULL,
+                       heap_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                       -1,
+                       0);
+
+  if (area_p == MAP_FAILED)
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+
+  mem_init_with_heap_area ((uint8_t *) area_p, heap_size);
+
+  JERRY_CONTEXT (mem_is_heap_area_mapped) = true;
+} /* mem_init_with_heap_size */
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
 
 /**
  * Finalize memory allocators.
@@ -81,7 +134,21 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
 #endif /* MEM_STATS */
   }
 
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  uint8_t *heap_area_p = JERRY_CONTEXT (mem_heap).heap_start;
+  size_t heap_area_size = JERRY_CONTEXT (mem_heap).heap_size;
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
+
   mem_heap_finalize ();
+
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  if (JERRY_CONTEXT (mem_is_heap_area_mapped))
+  {
+    munmap (heap_area_p, heap_area_size);
+
+    JERRY_CONTEXT (mem_is_heap_area_mapped) = false;
+  }
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
 } /* mem_finalize */
 
 /**
@@ -90,7 +157,11 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
 static uintptr_t
 mem_get_base_pointer (void)
 {
+#if defined (CONFIG_JERRY_ENABLE_CONTEXTS) || defined (CONFIG_JERRY_SERVER_PROFILE)
+  return (uintptr_t) JERRY_CONTEXT (mem_heap).heap_start;
+#else /* !CONFIG_JERRY_ENABLE_CONTEXTS && !CONFIG_JERRY_SERVER_PROFILE */
   return (uintptr_t) mem_heap_area;
+#endif /* !CONFIG_JERRY_ENABLE_CONTEXTS && !CONFIG_JERRY_SERVER_PROFILE */
 } /* mem_get_base_pointer */
 
 /**
@@ -108,7 +179,7 @@ mem_compress_pointer (const void *pointer) /**< pointer to compress */
   int_ptr -= mem_get_base_pointer ();
   int_ptr >>= MEM_ALIGNMENT_LOG;
 
-  JERRY_ASSERT ((int_ptr & ~((1u << MEM_HEAP_OFFSET_LOG) - 1)) == 0);
+  JERRY_ASSERT ((int_ptr & ~MEM_HEAP_OFFSET_MASK) == 0);
 
   JERRY_ASSERT (int_ptr != MEM_CP_NULL);
 
@@ -137,10 +208,12 @@ mem_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decompress
 void
 mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
-  /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == NULL);
+  const uint32_t callbacks_number = JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number);
+
+  JERRY_ASSERT (callbacks_number < MEM_TRY_GIVE_MEMORY_BACK_CALLBACKS_NUMBER);
 
-  mem_try_give_memory_back_callback = callback;
+  JERRY_CONTEXT (mem_try_give_memory_back_callbacks)[callbacks_number] = callback;
+  JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number) = callbacks_number + 1;
 } /* mem_register_a_try_give_memory_back_callback */
 
 /**
@@ -149,43 +222,58 @@ mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_
 void
 mem_unregister_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback) /* callback routine */
 {
-  /* Currently only one callback is supported */
-  JERRY_ASSERT (mem_try_give_memory_back_callback == callback);
+  mem_try_give_memory_back_callback_t *callbacks_p = JERRY_CONTEXT (mem_try_give_memory_back_callbacks);
+  const uint32_t callbacks_number = JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number);
+
+  uint32_t index = 0;
+
+  while (index < callbacks_number && callbacks_p[index] != callback)
+  {
+    index++;
+  }
+
+  JERRY_ASSERT (index < callbacks_number);
+
+  for (; index + 1 < callbacks_number; index++)
+  {
+    callbacks_p[index] = callbacks_p[index + 1];
+  }
 
-  mem_try_give_memory_back_callback = NULL;
+  JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number) = callbacks_number - 1;
 } /* mem_unregister_a_try_give_memory_back_callback */
 
 /**
  * Run 'try to give memory back' callbacks with specified severity
+ *
+ * Note:
+ *      the callbacks are run in reverse order of registration, so that an embedder's callback,
+ *      registered after initialization of the engine, releases its references to objects
+ *      before the engine's garbage collection is performed.
  */
 void
 mem_run_try_to_give_memory_back_callbacks (mem_try_give_memory_back_severity_t severity) /**< severity of
                                                                                               the request */
 {
-  if (mem_try_give_memory_back_callback != NULL)
+  for (uint32_t index = JERRY_CONTEXT (mem_try_give_memory_back_callbacks_number); index != 0; index--)
   {
-    mem_try_give_memory_back_callback (severity);
+    JERRY_CONTEXT (mem_try_give_memory_back_callbacks)[index - 1] (severity);
   }
 } /* mem_run_try_to_give_memory_back_callbacks */
 
-#ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
  *
- * Note:
- *      the routine should be used only for assertion checks
- *
  * @return true - if pointer points to the heap,
  *         false - otherwise
  */
 bool
-mem_is_heap_pointer (void *pointer) /**< pointer */
+mem_is_heap_pointer (const void *pointer) /**< pointer */
 {
-  uint8_t *uint8_pointer = (uint8_t*) pointer;
+  const uint8_t *uint8_pointer = (const uint8_t *) pointer;
+  const uint8_t *heap_start_p = JERRY_CONTEXT (mem_heap).heap_start;
 
-  return (uint8_pointer >= mem_heap_area && uint8_pointer <= (mem_heap_area + MEM_HEAP_AREA_SIZE));
+  return (uint8_pointer >= heap_start_p && uint8_pointer <= (heap_start_p + JERRY_CONTEXT (mem_heap).heap_size));
 } /* mem_is_heap_pointer */
-#endif /* !JERRY_NDEBUG */
 
 #ifdef MEM_STATS
 /**
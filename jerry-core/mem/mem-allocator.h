@@ -31,7 +31,11 @@
 /**
  * Compressed pointer
  */
+#if MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG <= 16
 typedef uint16_t mem_cpointer_t;
+#else /* MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG > 16 */
+typedef uint32_t mem_cpointer_t;
+#endif /* MEM_HEAP_OFFSET_LOG - MEM_ALIGNMENT_LOG > 16 */
 
 /**
  * Representation of NULL value for compressed pointers
@@ -80,6 +84,12 @@ typedef enum
  */
 typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_severity_t);
 
+/**
+ * Maximum number of registered 'try give memory back' callbacks
+ * (the engine's one and the embedder's one, see also: jerry_api_register_memory_pressure_callback)
+ */
+#define MEM_TRY_GIVE_MEMORY_BACK_CALLBACKS_NUMBER (2)
+
 /**
  * Get value of pointer from specified non-null compressed pointer value
  */
@@ -120,6 +130,10 @@ typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_se
   }
 
 extern void mem_init (void);
+extern void mem_init_with_heap_area (uint8_t *heap_area_p, size_t heap_area_size);
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+extern void mem_init_with_heap_size (size_t heap_size);
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
 extern void mem_finalize (bool is_show_mem_stats);
 
 extern uintptr_t mem_compress_pointer (const void *pointer);
@@ -128,9 +142,7 @@ extern void* mem_decompress_pointer (uintptr_t compressed_pointer);
 extern void mem_register_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback);
 extern void mem_unregister_a_try_give_memory_back_callback (mem_try_give_memory_back_callback_t callback);
 
-#ifndef JERRY_NDEBUG
-extern bool mem_is_heap_pointer (void *pointer);
-#endif /* !JERRY_NDEBUG */
+extern bool mem_is_heap_pointer (const void *pointer);
 
 #ifdef MEM_STATS
 extern void mem_stats_reset_peak (void);
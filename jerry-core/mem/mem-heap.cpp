@@ -24,8 +24,10 @@
  * Heap implementation
  */
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
+#include "mem-alloc-profiler.h"
 #include "mem-allocator.h"
 #include "mem-config.h"
 #include "mem-heap.h"
@@ -130,25 +132,6 @@ JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE >= sizeof (mem_block_header_t));
  */
 JERRY_STATIC_ASSERT (MEM_HEAP_CHUNK_SIZE % MEM_ALIGNMENT == 0);
 
-/**
- * Description of heap state
- */
-typedef struct
-{
-  uint8_t* heap_start; /**< first address of heap space */
-  size_t heap_size; /**< heap space size */
-  mem_block_header_t* first_block_p; /**< first block of the heap */
-  mem_block_header_t* last_block_p;  /**< last block of the heap */
-  size_t allocated_bytes; /**< total size of allocated heap space */
-  size_t limit; /**< current limit of heap usage, that is upon being reached,
-                 *   causes call of "try give memory back" callbacks */
-} mem_heap_state_t;
-
-/**
- * Heap state
- */
-mem_heap_state_t mem_heap;
-
 static size_t mem_get_block_chunks_count (const mem_block_header_t *block_header_p);
 static size_t mem_get_block_data_space_size (const mem_block_header_t *block_header_p);
 static size_t mem_get_block_chunks_count_from_data_size (size_t block_allocated_size);
@@ -163,11 +146,6 @@ static void mem_init_block_header (uint8_t *first_chunk_p,
 static void mem_check_heap (void);
 
 #ifdef MEM_STATS
-/**
- * Heap's memory usage statistics
- */
-static mem_heap_stats_t mem_heap_stats;
-
 static void mem_heap_stat_init (void);
 static void mem_heap_stat_alloc_block (mem_block_header_t *block_header_p);
 static void mem_heap_stat_free_block (mem_block_header_t *block_header_p);
@@ -347,14 +325,16 @@ mem_get_block_chunks_count (const mem_block_header_t *block_header_p) /**< block
 
   if (next_block_p == NULL)
   {
-    dist_till_block_end = (size_t) (mem_heap.heap_start + mem_heap.heap_size - (uint8_t*) block_header_p);
+    dist_till_block_end = (size_t) (JERRY_CONTEXT (mem_heap).heap_start
+                                    + JERRY_CONTEXT (mem_heap).heap_size
+                                    - (uint8_t*) block_header_p);
   }
   else
   {
     dist_till_block_end = (size_t) ((uint8_t*) next_block_p - (uint8_t*) block_header_p);
   }
 
-  JERRY_ASSERT (dist_till_block_end <= mem_heap.heap_size);
+  JERRY_ASSERT (dist_till_block_end <= JERRY_CONTEXT (mem_heap).heap_size);
   JERRY_ASSERT (dist_till_block_end % MEM_HEAP_CHUNK_SIZE == 0);
 
   return dist_till_block_end / MEM_HEAP_CHUNK_SIZE;
@@ -412,23 +392,28 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
   JERRY_ASSERT ((uintptr_t) heap_start % MEM_HEAP_CHUNK_SIZE == 0);
   JERRY_ASSERT (heap_size % MEM_HEAP_CHUNK_SIZE == 0);
 
-  JERRY_ASSERT (heap_size <= (1u << MEM_HEAP_OFFSET_LOG));
+  JERRY_ASSERT (heap_size <= ((size_t) 1u << MEM_HEAP_OFFSET_LOG));
 
-  mem_heap.heap_start = heap_start;
-  mem_heap.heap_size = heap_size;
-  mem_heap.limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  JERRY_CONTEXT (mem_heap).heap_start = heap_start;
+  JERRY_CONTEXT (mem_heap).heap_size = heap_size;
+  JERRY_CONTEXT (mem_heap).limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  JERRY_CONTEXT (mem_heap).soft_limit = heap_size;
+  JERRY_CONTEXT (mem_heap).hard_limit = heap_size;
+  JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded = false;
+  JERRY_CONTEXT (mem_heap).budget_limit = heap_size;
+  JERRY_CONTEXT (mem_heap).is_budget_exceeded = false;
 
   VALGRIND_NOACCESS_SPACE (heap_start, heap_size);
 
-  mem_init_block_header (mem_heap.heap_start,
+  mem_init_block_header (JERRY_CONTEXT (mem_heap).heap_start,
                          0,
                          MEM_BLOCK_FREE,
                          mem_block_length_type_t::GENERAL,
                          NULL,
                          NULL);
 
-  mem_heap.first_block_p = (mem_block_header_t*) mem_heap.heap_start;
-  mem_heap.last_block_p = mem_heap.first_block_p;
+  JERRY_CONTEXT (mem_heap).first_block_p = (mem_block_header_t*) JERRY_CONTEXT (mem_heap).heap_start;
+  JERRY_CONTEXT (mem_heap).last_block_p = JERRY_CONTEXT (mem_heap).first_block_p;
 
   MEM_HEAP_STAT_INIT ();
 } /* mem_heap_init */
@@ -439,14 +424,14 @@ mem_heap_init (uint8_t *heap_start, /**< first address of heap space */
 void
 mem_heap_finalize (void)
 {
-  VALGRIND_DEFINED_SPACE (mem_heap.heap_start, mem_heap.heap_size);
+  VALGRIND_DEFINED_SPACE (JERRY_CONTEXT (mem_heap).heap_start, JERRY_CONTEXT (mem_heap).heap_size);
 
-  JERRY_ASSERT (mem_heap.first_block_p == mem_heap.last_block_p);
-  JERRY_ASSERT (mem_is_block_free (mem_heap.first_block_p));
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).first_block_p == JERRY_CONTEXT (mem_heap).last_block_p);
+  JERRY_ASSERT (mem_is_block_free (JERRY_CONTEXT (mem_heap).first_block_p));
 
-  VALGRIND_NOACCESS_SPACE (mem_heap.heap_start, mem_heap.heap_size);
+  VALGRIND_NOACCESS_SPACE (JERRY_CONTEXT (mem_heap).heap_start, JERRY_CONTEXT (mem_heap).heap_size);
 
-  memset (&mem_heap, 0, sizeof (mem_heap));
+  memset (&JERRY_CONTEXT (mem_heap), 0, sizeof (JERRY_CONTEXT (mem_heap)));
 } /* mem_heap_finalize */
 
 /**
@@ -510,16 +495,22 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
   mem_check_heap ();
 
+  if (JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes > JERRY_CONTEXT (mem_heap).hard_limit)
+  {
+    /* the hard limit of heap usage would be exceeded */
+    return NULL;
+  }
+
   if (alloc_term == MEM_HEAP_ALLOC_LONG_TERM)
   {
-    block_p = mem_heap.first_block_p;
+    block_p = JERRY_CONTEXT (mem_heap).first_block_p;
     direction = MEM_DIRECTION_NEXT;
   }
   else
   {
     JERRY_ASSERT (alloc_term == MEM_HEAP_ALLOC_SHORT_TERM);
 
-    block_p = mem_heap.last_block_p;
+    block_p = JERRY_CONTEXT (mem_heap).last_block_p;
     direction = MEM_DIRECTION_PREV;
   }
 
@@ -553,16 +544,16 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
     return NULL;
   }
 
-  mem_heap.allocated_bytes += size_in_bytes;
+  JERRY_CONTEXT (mem_heap).allocated_bytes += size_in_bytes;
 
-  JERRY_ASSERT (mem_heap.allocated_bytes <= mem_heap.heap_size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).allocated_bytes <= JERRY_CONTEXT (mem_heap).heap_size);
 
-  if (mem_heap.allocated_bytes >= mem_heap.limit)
+  if (JERRY_CONTEXT (mem_heap).allocated_bytes >= JERRY_CONTEXT (mem_heap).limit)
   {
-    mem_heap.limit = JERRY_MIN (mem_heap.heap_size,
-                                JERRY_MAX (mem_heap.limit + CONFIG_MEM_HEAP_DESIRED_LIMIT,
-                                           mem_heap.allocated_bytes));
-    JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+    JERRY_CONTEXT (mem_heap).limit = JERRY_MIN (JERRY_CONTEXT (mem_heap).heap_size,
+                                JERRY_MAX (JERRY_CONTEXT (mem_heap).limit + CONFIG_MEM_HEAP_DESIRED_LIMIT,
+                                           JERRY_CONTEXT (mem_heap).allocated_bytes));
+    JERRY_ASSERT (JERRY_CONTEXT (mem_heap).limit >= JERRY_CONTEXT (mem_heap).allocated_bytes);
   }
 
   /* appropriate block found, allocating space */
@@ -592,7 +583,7 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
       if (next_block_p == NULL)
       {
-        mem_heap.last_block_p = block_p;
+        JERRY_CONTEXT (mem_heap).last_block_p = block_p;
       }
       else
       {
@@ -617,7 +608,7 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
 
       if (next_block_p == NULL)
       {
-        mem_heap.last_block_p = new_free_block_p;
+        JERRY_CONTEXT (mem_heap).last_block_p = new_free_block_p;
       }
       else
       {
@@ -659,6 +650,22 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
   return data_space_p;
 } /* mem_heap_alloc_block_internal */
 
+/**
+ * Mark budget of current run as exceeded, if heap usage, including the just allocated block, is above the budget
+ *
+ * Note:
+ *      the check is performed after the allocation, as callbacks with critical severity, run upon
+ *      a failed allocation, can return heap usage under the budget.
+ */
+static void
+mem_heap_check_budget (void)
+{
+  if (unlikely (JERRY_CONTEXT (mem_heap).allocated_bytes > JERRY_CONTEXT (mem_heap).budget_limit))
+  {
+    JERRY_CONTEXT (mem_heap).is_budget_exceeded = true;
+  }
+} /* mem_heap_check_budget */
+
 /**
  * Allocation of memory region, running 'try to give memory back' callbacks, if there is not enough memory.
  *
@@ -666,6 +673,15 @@ void* mem_heap_alloc_block_internal (size_t size_in_bytes, /**< size of region t
  *      if after running the callbacks, there is still not enough memory, engine is terminated with ERR_OUT_OF_MEMORY.
  *
  * Note:
+ *      if the allocation exceeds the soft limit of heap usage, the callbacks are run with severity increasing
+ *      from low to high, until the usage returns under the limit (critical severity is used only
+ *      if the allocation fails, i.e. the heap is exhausted, or the hard limit would be exceeded).
+ *
+ * Note:
+ *      if the allocation exceeds the budget of current run, and the callbacks can't return heap usage
+ *      under the budget, the allocation is performed, and the budget is marked as exceeded.
+ *
+ * Note:
  *      To reduce heap fragmentation there are two allocation modes - short-term and long-term.
  *
  *      If allocation is short-term then the beginning of the heap is preferred, else - the end of the heap.
@@ -681,15 +697,48 @@ mem_heap_alloc_block_try_give_memory_back (size_t size_in_bytes, /**< size of re
                                                                                  *   (one-chunked or general) */
                                            mem_heap_alloc_term_t alloc_term) /**< expected allocation term */
 {
-  if (mem_heap.allocated_bytes + size_in_bytes >= mem_heap.limit)
+  if (unlikely (JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes > JERRY_CONTEXT (mem_heap).soft_limit)
+      && !JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded)
+  {
+    JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded = true;
+
+    for (mem_try_give_memory_back_severity_t severity = MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW;
+         severity <= MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH
+         && JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes > JERRY_CONTEXT (mem_heap).soft_limit;
+         severity = (mem_try_give_memory_back_severity_t) (severity + 1))
+    {
+      mem_run_try_to_give_memory_back_callbacks (severity);
+    }
+
+    /* the flag could be reset upon freeing memory by the callbacks */
+    JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded = (JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes
+                                                       > JERRY_CONTEXT (mem_heap).soft_limit);
+  }
+  else if (JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes >= JERRY_CONTEXT (mem_heap).limit)
   {
     mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW);
   }
 
+  /* without a budget, the budget's limit is equal to the heap's size, so the budget can't be exceeded */
+  if (unlikely (JERRY_CONTEXT (mem_heap).budget_limit < JERRY_CONTEXT (mem_heap).heap_size)
+      && !JERRY_CONTEXT (mem_heap).is_budget_exceeded
+      && JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes > JERRY_CONTEXT (mem_heap).budget_limit)
+  {
+    for (mem_try_give_memory_back_severity_t severity = MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW;
+         severity <= MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH
+         && JERRY_CONTEXT (mem_heap).allocated_bytes + size_in_bytes > JERRY_CONTEXT (mem_heap).budget_limit;
+         severity = (mem_try_give_memory_back_severity_t) (severity + 1))
+    {
+      mem_run_try_to_give_memory_back_callbacks (severity);
+    }
+  }
+
   void *data_space_p = mem_heap_alloc_block_internal (size_in_bytes, length_type, alloc_term);
 
   if (likely (data_space_p != NULL))
   {
+    mem_heap_check_budget ();
+
     return data_space_p;
   }
 
@@ -703,12 +752,18 @@ mem_heap_alloc_block_try_give_memory_back (size_t size_in_bytes, /**< size of re
 
     if (data_space_p != NULL)
     {
+      mem_heap_check_budget ();
+
       return data_space_p;
     }
   }
 
   JERRY_ASSERT (data_space_p == NULL);
 
+#ifdef MEM_ALLOC_PROFILER
+  mem_alloc_profiler_dump (MEM_ALLOC_PROFILER_OUT_OF_MEMORY_REPORT_SITES_NUMBER);
+#endif /* MEM_ALLOC_PROFILER */
+
   jerry_fatal (ERR_OUT_OF_MEMORY);
 } /* mem_heap_alloc_block_try_give_memory_back */
 
@@ -732,9 +787,13 @@ mem_heap_alloc_block (size_t size_in_bytes,             /**< size of region to a
   }
   else
   {
-    return mem_heap_alloc_block_try_give_memory_back (size_in_bytes,
-                                                      mem_block_length_type_t::GENERAL,
-                                                      alloc_term);
+    void *data_space_p = mem_heap_alloc_block_try_give_memory_back (size_in_bytes,
+                                                                    mem_block_length_type_t::GENERAL,
+                                                                    alloc_term);
+
+    MEM_ALLOC_PROFILER_REGISTER_ALLOC (data_space_p, size_in_bytes);
+
+    return data_space_p;
   }
 } /* mem_heap_alloc_block */
 
@@ -756,9 +815,13 @@ mem_heap_alloc_block (size_t size_in_bytes,             /**< size of region to a
 void*
 mem_heap_alloc_chunked_block (mem_heap_alloc_term_t alloc_term) /**< expected allocation term */
 {
-  return mem_heap_alloc_block_try_give_memory_back (mem_heap_get_chunked_block_data_size (),
-                                                    mem_block_length_type_t::ONE_CHUNKED,
-                                                    alloc_term);
+  void *data_space_p = mem_heap_alloc_block_try_give_memory_back (mem_heap_get_chunked_block_data_size (),
+                                                                  mem_block_length_type_t::ONE_CHUNKED,
+                                                                  alloc_term);
+
+  MEM_ALLOC_PROFILER_REGISTER_ALLOC (data_space_p, mem_heap_get_chunked_block_data_size ());
+
+  return data_space_p;
 } /* mem_heap_alloc_chunked_block */
 
 /**
@@ -770,8 +833,8 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   uint8_t *uint8_ptr = (uint8_t*) ptr;
 
   /* checking that uint8_ptr points to the heap */
-  JERRY_ASSERT (uint8_ptr >= mem_heap.heap_start
-                && uint8_ptr <= mem_heap.heap_start + mem_heap.heap_size);
+  JERRY_ASSERT (uint8_ptr >= JERRY_CONTEXT (mem_heap).heap_start
+                && uint8_ptr <= JERRY_CONTEXT (mem_heap).heap_start + JERRY_CONTEXT (mem_heap).heap_size);
 
   mem_check_heap ();
 
@@ -782,24 +845,30 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
   mem_block_header_t *prev_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_PREV);
   mem_block_header_t *next_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_NEXT);
 
-  JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).limit >= JERRY_CONTEXT (mem_heap).allocated_bytes);
 
   size_t bytes = block_p->allocated_bytes;
-  JERRY_ASSERT (mem_heap.allocated_bytes >= bytes);
-  mem_heap.allocated_bytes -= bytes;
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).allocated_bytes >= bytes);
+  JERRY_CONTEXT (mem_heap).allocated_bytes -= bytes;
 
-  if (mem_heap.allocated_bytes * 3 <= mem_heap.limit)
+  if (JERRY_CONTEXT (mem_heap).allocated_bytes * 3 <= JERRY_CONTEXT (mem_heap).limit)
   {
-    mem_heap.limit /= 2;
+    JERRY_CONTEXT (mem_heap).limit /= 2;
   }
-  else if (mem_heap.allocated_bytes + CONFIG_MEM_HEAP_DESIRED_LIMIT <= mem_heap.limit)
+  else if (JERRY_CONTEXT (mem_heap).allocated_bytes + CONFIG_MEM_HEAP_DESIRED_LIMIT <= JERRY_CONTEXT (mem_heap).limit)
   {
-    mem_heap.limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
+    JERRY_CONTEXT (mem_heap).limit -= CONFIG_MEM_HEAP_DESIRED_LIMIT;
   }
 
-  JERRY_ASSERT (mem_heap.limit >= mem_heap.allocated_bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).limit >= JERRY_CONTEXT (mem_heap).allocated_bytes);
+
+  if (JERRY_CONTEXT (mem_heap).allocated_bytes < JERRY_CONTEXT (mem_heap).soft_limit)
+  {
+    JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded = false;
+  }
 
   MEM_HEAP_STAT_FREE_BLOCK (block_p);
+  MEM_ALLOC_PROFILER_REGISTER_FREE (ptr, bytes);
 
   VALGRIND_NOACCESS_SPACE (uint8_ptr, block_p->allocated_bytes);
 
@@ -833,7 +902,7 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       }
       else
       {
-        mem_heap.last_block_p = block_p;
+        JERRY_CONTEXT (mem_heap).last_block_p = block_p;
       }
     }
 
@@ -861,7 +930,7 @@ mem_heap_free_block (void *ptr) /**< pointer to beginning of data space of the b
       }
       else
       {
-        mem_heap.last_block_p = prev_block_p;
+        JERRY_CONTEXT (mem_heap).last_block_p = prev_block_p;
       }
     }
 
@@ -891,10 +960,10 @@ void*
 mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
 {
   JERRY_STATIC_ASSERT ((MEM_HEAP_CHUNK_SIZE & (MEM_HEAP_CHUNK_SIZE - 1u)) == 0);
-  JERRY_ASSERT (((uintptr_t) mem_heap.heap_start % MEM_HEAP_CHUNK_SIZE) == 0);
+  JERRY_ASSERT (((uintptr_t) JERRY_CONTEXT (mem_heap).heap_start % MEM_HEAP_CHUNK_SIZE) == 0);
 
-  JERRY_ASSERT (mem_heap.heap_start <= ptr
-                && ptr < mem_heap.heap_start + mem_heap.heap_size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).heap_start <= ptr
+                && ptr < JERRY_CONTEXT (mem_heap).heap_start + JERRY_CONTEXT (mem_heap).heap_size);
 
   uintptr_t uintptr = (uintptr_t) ptr;
   uintptr_t uintptr_chunk_aligned = JERRY_ALIGNDOWN (uintptr, MEM_HEAP_CHUNK_SIZE);
@@ -908,7 +977,7 @@ mem_heap_get_chunked_block_start (void *ptr) /**< pointer into a block */
   JERRY_ASSERT (block_p->length_type == mem_block_length_type_t::ONE_CHUNKED);
   VALGRIND_NOACCESS_STRUCT (block_p);
 
-  const mem_block_header_t *block_iter_p = mem_heap.first_block_p;
+  const mem_block_header_t *block_iter_p = JERRY_CONTEXT (mem_heap).first_block_p;
   bool is_found = false;
 
   /* searching for corresponding block */
@@ -969,6 +1038,91 @@ mem_heap_recommend_allocation_size (size_t minimum_allocation_size) /**< minimum
   return heap_chunk_aligned_allocation_size - sizeof (mem_block_header_t);
 } /* mem_heap_recommend_allocation_size */
 
+/**
+ * Set soft and hard limits of heap usage
+ *
+ * Upon exceeding the soft limit, 'try give memory back' callbacks are run with increasing severity
+ * (from low to high), until heap usage returns under the limit. The callbacks are run again only after
+ * heap usage returns under the soft limit and exceeds it once more.
+ *
+ * An allocation, that would exceed the hard limit, is handled in the same way as an allocation
+ * in an exhausted heap.
+ *
+ * Note:
+ *      zero value of the hard limit means that the limit is equal to heap size,
+ *      and zero value of the soft limit means that the limit is equal to the hard limit.
+ *
+ * @return true - if the limits were set,
+ *         false - if the soft limit is greater than the hard limit (the limits are left unchanged).
+ */
+bool
+mem_heap_set_limits (size_t soft_limit, /**< soft limit of heap usage, in bytes */
+                     size_t hard_limit) /**< hard limit of heap usage, in bytes */
+{
+  const size_t heap_size = JERRY_CONTEXT (mem_heap).heap_size;
+
+  hard_limit = (hard_limit == 0) ? heap_size : JERRY_MIN (hard_limit, heap_size);
+  soft_limit = (soft_limit == 0) ? hard_limit : soft_limit;
+
+  if (soft_limit > hard_limit)
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (mem_heap).soft_limit = soft_limit;
+  JERRY_CONTEXT (mem_heap).hard_limit = hard_limit;
+  JERRY_CONTEXT (mem_heap).is_soft_limit_exceeded = false;
+
+  return true;
+} /* mem_heap_set_limits */
+
+/**
+ * Start budget of heap usage for a run of code
+ *
+ * Upon exceeding the budget (if garbage collection can't return heap usage under the budget),
+ * the budget is marked as exceeded, and the interpreter raises an error at the nearest opcode boundary.
+ */
+void
+mem_heap_start_budget (size_t budget) /**< number of bytes, that can be allocated in addition to
+                                       *   current heap usage (0 - if heap usage should not be limited) */
+{
+  const size_t heap_size = JERRY_CONTEXT (mem_heap).heap_size;
+  const size_t allocated_bytes = JERRY_CONTEXT (mem_heap).allocated_bytes;
+
+  if (budget == 0 || budget >= heap_size - allocated_bytes)
+  {
+    JERRY_CONTEXT (mem_heap).budget_limit = heap_size;
+  }
+  else
+  {
+    JERRY_CONTEXT (mem_heap).budget_limit = allocated_bytes + budget;
+  }
+
+  JERRY_CONTEXT (mem_heap).is_budget_exceeded = false;
+} /* mem_heap_start_budget */
+
+/**
+ * Stop budget of heap usage, started with mem_heap_start_budget
+ */
+void
+mem_heap_stop_budget (void)
+{
+  JERRY_CONTEXT (mem_heap).budget_limit = JERRY_CONTEXT (mem_heap).heap_size;
+  JERRY_CONTEXT (mem_heap).is_budget_exceeded = false;
+} /* mem_heap_stop_budget */
+
+/**
+ * Clear the flag of exceeded budget, after the error was raised
+ *
+ * Note:
+ *      while heap usage is above the budget, next allocation would mark the budget as exceeded again.
+ */
+void
+mem_heap_clear_budget_exceeded (void)
+{
+  JERRY_CONTEXT (mem_heap).is_budget_exceeded = false;
+} /* mem_heap_clear_budget_exceeded */
+
 /**
  * Print heap
  */
@@ -985,12 +1139,12 @@ mem_heap_print (bool dump_block_headers, /**< print block headers */
   if (dump_block_headers)
   {
     printf ("Heap: start=%p size=%lu, first block->%p, last block->%p\n",
-            mem_heap.heap_start,
-            (unsigned long) mem_heap.heap_size,
-            (void*) mem_heap.first_block_p,
-            (void*) mem_heap.last_block_p);
+            JERRY_CONTEXT (mem_heap).heap_start,
+            (unsigned long) JERRY_CONTEXT (mem_heap).heap_size,
+            (void*) JERRY_CONTEXT (mem_heap).first_block_p,
+            (void*) JERRY_CONTEXT (mem_heap).last_block_p);
 
-    for (mem_block_header_t *block_p = mem_heap.first_block_p, *next_block_p;
+    for (mem_block_header_t *block_p = JERRY_CONTEXT (mem_heap).first_block_p, *next_block_p;
          block_p != NULL;
          block_p = next_block_p)
     {
@@ -1036,17 +1190,17 @@ mem_heap_print (bool dump_block_headers, /**< print block headers */
             "  Peak allocated chunks count = %zu\n"
             "  Peak allocated= %zu bytes\n"
             "  Peak waste = %zu bytes\n",
-            mem_heap_stats.size,
+            JERRY_CONTEXT (mem_heap_stats).size,
             MEM_HEAP_CHUNK_SIZE,
-            mem_heap_stats.blocks,
-            mem_heap_stats.allocated_blocks,
-            mem_heap_stats.allocated_chunks,
-            mem_heap_stats.allocated_bytes,
-            mem_heap_stats.waste_bytes,
-            mem_heap_stats.peak_allocated_blocks,
-            mem_heap_stats.peak_allocated_chunks,
-            mem_heap_stats.peak_allocated_bytes,
-            mem_heap_stats.peak_waste_bytes);
+            JERRY_CONTEXT (mem_heap_stats).blocks,
+            JERRY_CONTEXT (mem_heap_stats).allocated_blocks,
+            JERRY_CONTEXT (mem_heap_stats).allocated_chunks,
+            JERRY_CONTEXT (mem_heap_stats).allocated_bytes,
+            JERRY_CONTEXT (mem_heap_stats).waste_bytes,
+            JERRY_CONTEXT (mem_heap_stats).peak_allocated_blocks,
+            JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks,
+            JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes,
+            JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes);
   }
 #else /* MEM_STATS */
   (void) dump_stats;
@@ -1062,14 +1216,14 @@ static void
 mem_check_heap (void)
 {
 #ifndef JERRY_DISABLE_HEAVY_DEBUG
-  JERRY_ASSERT ((uint8_t*) mem_heap.first_block_p == mem_heap.heap_start);
-  JERRY_ASSERT (mem_heap.heap_size % MEM_HEAP_CHUNK_SIZE == 0);
+  JERRY_ASSERT ((uint8_t*) JERRY_CONTEXT (mem_heap).first_block_p == JERRY_CONTEXT (mem_heap).heap_start);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap).heap_size % MEM_HEAP_CHUNK_SIZE == 0);
 
   bool is_last_block_was_met = false;
   size_t chunk_sizes_sum = 0;
   size_t allocated_sum = 0;
 
-  for (mem_block_header_t *block_p = mem_heap.first_block_p, *next_block_p;
+  for (mem_block_header_t *block_p = JERRY_CONTEXT (mem_heap).first_block_p, *next_block_p;
        block_p != NULL;
        block_p = next_block_p)
   {
@@ -1087,7 +1241,7 @@ mem_check_heap (void)
 
     next_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_NEXT);
 
-    if (block_p == mem_heap.last_block_p)
+    if (block_p == JERRY_CONTEXT (mem_heap).last_block_p)
     {
       is_last_block_was_met = true;
 
@@ -1101,14 +1255,14 @@ mem_check_heap (void)
     VALGRIND_NOACCESS_STRUCT (block_p);
   }
 
-  JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == mem_heap.heap_size);
-  JERRY_ASSERT (allocated_sum == mem_heap.allocated_bytes);
+  JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == JERRY_CONTEXT (mem_heap).heap_size);
+  JERRY_ASSERT (allocated_sum == JERRY_CONTEXT (mem_heap).allocated_bytes);
   JERRY_ASSERT (is_last_block_was_met);
 
   bool is_first_block_was_met = false;
   chunk_sizes_sum = 0;
 
-  for (mem_block_header_t *block_p = mem_heap.last_block_p, *prev_block_p;
+  for (mem_block_header_t *block_p = JERRY_CONTEXT (mem_heap).last_block_p, *prev_block_p;
        block_p != NULL;
        block_p = prev_block_p)
   {
@@ -1118,7 +1272,7 @@ mem_check_heap (void)
 
     prev_block_p = mem_get_next_block_by_direction (block_p, MEM_DIRECTION_PREV);
 
-    if (block_p == mem_heap.first_block_p)
+    if (block_p == JERRY_CONTEXT (mem_heap).first_block_p)
     {
       is_first_block_was_met = true;
 
@@ -1132,7 +1286,7 @@ mem_check_heap (void)
     VALGRIND_NOACCESS_STRUCT (block_p);
   }
 
-  JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == mem_heap.heap_size);
+  JERRY_ASSERT (chunk_sizes_sum * MEM_HEAP_CHUNK_SIZE == JERRY_CONTEXT (mem_heap).heap_size);
   JERRY_ASSERT (is_first_block_was_met);
 #endif /* !JERRY_DISABLE_HEAVY_DEBUG */
 } /* mem_check_heap */
@@ -1144,7 +1298,7 @@ mem_check_heap (void)
 void
 mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< out: heap stats */
 {
-  *out_heap_stats_p = mem_heap_stats;
+  *out_heap_stats_p = JERRY_CONTEXT (mem_heap_stats);
 } /* mem_heap_get_stats */
 
 /**
@@ -1153,10 +1307,10 @@ mem_heap_get_stats (mem_heap_stats_t *out_heap_stats_p) /**< out: heap stats */
 void
 mem_heap_stats_reset_peak (void)
 {
-  mem_heap_stats.peak_allocated_chunks = mem_heap_stats.allocated_chunks;
-  mem_heap_stats.peak_allocated_blocks = mem_heap_stats.allocated_blocks;
-  mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
-  mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_blocks = JERRY_CONTEXT (mem_heap_stats).allocated_blocks;
+  JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
+  JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
 } /* mem_heap_stats_reset_peak */
 
 /**
@@ -1165,10 +1319,10 @@ mem_heap_stats_reset_peak (void)
 static void
 mem_heap_stat_init ()
 {
-  memset (&mem_heap_stats, 0, sizeof (mem_heap_stats));
+  memset (&JERRY_CONTEXT (mem_heap_stats), 0, sizeof (JERRY_CONTEXT (mem_heap_stats)));
 
-  mem_heap_stats.size = mem_heap.heap_size;
-  mem_heap_stats.blocks = 1;
+  JERRY_CONTEXT (mem_heap_stats).size = JERRY_CONTEXT (mem_heap).heap_size;
+  JERRY_CONTEXT (mem_heap_stats).blocks = 1;
 } /* mem_heap_stat_init */
 
 /**
@@ -1183,50 +1337,51 @@ mem_heap_stat_alloc_block (mem_block_header_t *block_header_p) /**< allocated bl
   const size_t bytes = block_header_p->allocated_bytes;
   const size_t waste_bytes = chunks * MEM_HEAP_CHUNK_SIZE - bytes;
 
-  mem_heap_stats.allocated_blocks++;
-  mem_heap_stats.allocated_chunks += chunks;
-  mem_heap_stats.allocated_bytes += bytes;
-  mem_heap_stats.waste_bytes += waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).allocated_blocks++;
+  JERRY_CONTEXT (mem_heap_stats).allocated_chunks += chunks;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes += bytes;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes += waste_bytes;
 
-  if (mem_heap_stats.allocated_blocks > mem_heap_stats.peak_allocated_blocks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_blocks > JERRY_CONTEXT (mem_heap_stats).peak_allocated_blocks)
   {
-    mem_heap_stats.peak_allocated_blocks = mem_heap_stats.allocated_blocks;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_blocks = JERRY_CONTEXT (mem_heap_stats).allocated_blocks;
   }
-  if (mem_heap_stats.allocated_blocks > mem_heap_stats.global_peak_allocated_blocks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_blocks > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_blocks)
   {
-    mem_heap_stats.global_peak_allocated_blocks = mem_heap_stats.allocated_blocks;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_blocks = JERRY_CONTEXT (mem_heap_stats).allocated_blocks;
   }
 
-  if (mem_heap_stats.allocated_chunks > mem_heap_stats.peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_chunks > JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks)
   {
-    mem_heap_stats.peak_allocated_chunks = mem_heap_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
   }
-  if (mem_heap_stats.allocated_chunks > mem_heap_stats.global_peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_chunks > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_chunks)
   {
-    mem_heap_stats.global_peak_allocated_chunks = mem_heap_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_chunks = JERRY_CONTEXT (mem_heap_stats).allocated_chunks;
   }
 
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes)
   {
-    mem_heap_stats.peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
-  if (mem_heap_stats.allocated_bytes > mem_heap_stats.global_peak_allocated_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).allocated_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes)
   {
-    mem_heap_stats.global_peak_allocated_bytes = mem_heap_stats.allocated_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_allocated_bytes = JERRY_CONTEXT (mem_heap_stats).allocated_bytes;
   }
 
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes)
   {
-    mem_heap_stats.peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
-  if (mem_heap_stats.waste_bytes > mem_heap_stats.global_peak_waste_bytes)
+  if (JERRY_CONTEXT (mem_heap_stats).waste_bytes > JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes)
   {
-    mem_heap_stats.global_peak_waste_bytes = mem_heap_stats.waste_bytes;
+    JERRY_CONTEXT (mem_heap_stats).global_peak_waste_bytes = JERRY_CONTEXT (mem_heap_stats).waste_bytes;
   }
 
-  JERRY_ASSERT (mem_heap_stats.allocated_blocks <= mem_heap_stats.blocks);
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes <= mem_heap_stats.size);
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks <= mem_heap_stats.size / MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_blocks <= JERRY_CONTEXT (mem_heap_stats).blocks);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes <= JERRY_CONTEXT (mem_heap_stats).size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks
+                <= JERRY_CONTEXT (mem_heap_stats).size / MEM_HEAP_CHUNK_SIZE);
 } /* mem_heap_stat_alloc_block */
 
 /**
@@ -1241,19 +1396,20 @@ mem_heap_stat_free_block (mem_block_header_t *block_header_p) /**< block to be f
   const size_t bytes = block_header_p->allocated_bytes;
   const size_t waste_bytes = chunks * MEM_HEAP_CHUNK_SIZE - bytes;
 
-  JERRY_ASSERT (mem_heap_stats.allocated_blocks <= mem_heap_stats.blocks);
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes <= mem_heap_stats.size);
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks <= mem_heap_stats.size / MEM_HEAP_CHUNK_SIZE);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_blocks <= JERRY_CONTEXT (mem_heap_stats).blocks);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes <= JERRY_CONTEXT (mem_heap_stats).size);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks
+                <= JERRY_CONTEXT (mem_heap_stats).size / MEM_HEAP_CHUNK_SIZE);
 
-  JERRY_ASSERT (mem_heap_stats.allocated_blocks >= 1);
-  JERRY_ASSERT (mem_heap_stats.allocated_chunks >= chunks);
-  JERRY_ASSERT (mem_heap_stats.allocated_bytes >= bytes);
-  JERRY_ASSERT (mem_heap_stats.waste_bytes >= waste_bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_blocks >= 1);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_chunks >= chunks);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).allocated_bytes >= bytes);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_heap_stats).waste_bytes >= waste_bytes);
 
-  mem_heap_stats.allocated_blocks--;
-  mem_heap_stats.allocated_chunks -= chunks;
-  mem_heap_stats.allocated_bytes -= bytes;
-  mem_heap_stats.waste_bytes -= waste_bytes;
+  JERRY_CONTEXT (mem_heap_stats).allocated_blocks--;
+  JERRY_CONTEXT (mem_heap_stats).allocated_chunks -= chunks;
+  JERRY_CONTEXT (mem_heap_stats).allocated_bytes -= bytes;
+  JERRY_CONTEXT (mem_heap_stats).waste_bytes -= waste_bytes;
 } /* mem_heap_stat_free_block */
 
 /**
@@ -1262,7 +1418,7 @@ mem_heap_stat_free_block (mem_block_header_t *block_header_p) /**< block to be f
 static void
 mem_heap_stat_free_block_split (void)
 {
-  mem_heap_stats.blocks++;
+  JERRY_CONTEXT (mem_heap_stats).blocks++;
 } /* mem_heap_stat_free_block_split */
 
 /**
@@ -1271,7 +1427,7 @@ mem_heap_stat_free_block_split (void)
 static void
 mem_heap_stat_free_block_merge (void)
 {
-  mem_heap_stats.blocks--;
+  JERRY_CONTEXT (mem_heap_stats).blocks--;
 } /* mem_heap_stat_free_block_merge */
 #endif /* MEM_STATS */
 
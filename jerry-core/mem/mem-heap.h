@@ -39,6 +39,28 @@ typedef enum
   MEM_HEAP_ALLOC_LONG_TERM /**< allocated region most likely will not be freed soon */
 } mem_heap_alloc_term_t;
 
+/**
+ * Description of heap state
+ */
+typedef struct
+{
+  uint8_t* heap_start; /**< first address of heap space */
+  size_t heap_size; /**< heap space size */
+  struct mem_block_header_t* first_block_p; /**< first block of the heap */
+  struct mem_block_header_t* last_block_p;  /**< last block of the heap */
+  size_t allocated_bytes; /**< total size of allocated heap space */
+  size_t limit; /**< current limit of heap usage, that is upon being reached,
+                 *   causes call of "try give memory back" callbacks */
+  size_t soft_limit; /**< limit of heap usage, that is upon being exceeded, causes call of "try give memory back"
+                      *   callbacks with increasing severity (see also: mem_heap_set_limits) */
+  size_t hard_limit; /**< maximum heap usage (allocations exceeding the limit are handled as failed) */
+  bool is_soft_limit_exceeded; /**< is heap usage above the soft limit (the callbacks are run only upon exceeding
+                                *   the soft limit, and not for each allocation while the usage is above it) */
+  size_t budget_limit; /**< limit of heap usage during current run (see also: mem_heap_start_budget) */
+  bool is_budget_exceeded; /**< was the limit of heap usage during current run exceeded (the interpreter
+                            *   raises an error upon the flag, see also: mem_heap_clear_budget_exceeded) */
+} mem_heap_state_t;
+
 extern void mem_heap_init (uint8_t *heap_start, size_t heap_size);
 extern void mem_heap_finalize (void);
 extern void* mem_heap_alloc_block (size_t size_in_bytes, mem_heap_alloc_term_t alloc_term);
@@ -48,6 +70,10 @@ extern void* mem_heap_get_chunked_block_start (void *ptr);
 extern size_t mem_heap_get_chunked_block_data_size (void);
 extern size_t __attr_pure___ mem_heap_recommend_allocation_size (size_t minimum_allocation_size);
 extern void mem_heap_print (bool dump_block_headers, bool dump_block_data, bool dump_stats);
+extern bool mem_heap_set_limits (size_t soft_limit, size_t hard_limit);
+extern void mem_heap_start_budget (size_t budget);
+extern void mem_heap_stop_budget (void);
+extern void mem_heap_clear_budget_exceeded (void);
 
 #ifdef MEM_STATS
 /**
@@ -26,29 +26,16 @@
 
 #define JERRY_MEM_POOL_INTERNAL
 
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
+#include "mem-alloc-profiler.h"
 #include "mem-allocator.h"
 #include "mem-heap.h"
 #include "mem-pool.h"
 #include "mem-poolman.h"
 
-/**
- * Lists of pools
- */
-mem_pool_state_t *mem_pools;
-
-/**
- * Number of free chunks
- */
-size_t mem_free_chunks_number;
-
 #ifdef MEM_STATS
-/**
- * Pools' memory usage statistics
- */
-mem_pools_stats_t mem_pools_stats;
-
 static void mem_pools_stat_init (void);
 static void mem_pools_stat_alloc_pool (void);
 static void mem_pools_stat_free_pool (void);
@@ -74,8 +61,8 @@ static void mem_pools_stat_free_chunk (void);
 void
 mem_pools_init (void)
 {
-  mem_pools = NULL;
-  mem_free_chunks_number = 0;
+  JERRY_CONTEXT (mem_pools) = NULL;
+  JERRY_CONTEXT (mem_free_chunks_number) = 0;
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -86,8 +73,8 @@ mem_pools_init (void)
 void
 mem_pools_finalize (void)
 {
-  JERRY_ASSERT (mem_pools == NULL);
-  JERRY_ASSERT (mem_free_chunks_number == 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools) == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_free_chunks_number) == 0);
 } /* mem_pools_finalize */
 
 /**
@@ -102,19 +89,22 @@ mem_pools_alloc_longpath (void)
   /**
    * If there are no free chunks, allocate new pool.
    */
-  if (mem_free_chunks_number == 0)
+  if (JERRY_CONTEXT (mem_free_chunks_number) == 0)
   {
     mem_pool_state_t *pool_state = (mem_pool_state_t*) mem_heap_alloc_block (MEM_POOL_SIZE, MEM_HEAP_ALLOC_LONG_TERM);
 
     JERRY_ASSERT (pool_state != NULL);
 
+    /* the pool's block is accounted by the allocation profiler through the pool's chunks */
+    MEM_ALLOC_PROFILER_REGISTER_FREE (pool_state, MEM_POOL_SIZE);
+
     mem_pool_init (pool_state, MEM_POOL_SIZE);
 
-    MEM_CP_SET_POINTER (pool_state->next_pool_cp, mem_pools);
+    MEM_CP_SET_POINTER (pool_state->next_pool_cp, JERRY_CONTEXT (mem_pools));
 
-    mem_pools = pool_state;
+    JERRY_CONTEXT (mem_pools) = pool_state;
 
-    mem_free_chunks_number += MEM_POOL_CHUNKS_NUMBER;
+    JERRY_CONTEXT (mem_free_chunks_number) += MEM_POOL_CHUNKS_NUMBER;
 
     MEM_POOLS_STAT_ALLOC_POOL ();
   }
@@ -125,7 +115,7 @@ mem_pools_alloc_longpath (void)
      *
      * Search for the pool.
      */
-    mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
+    mem_pool_state_t *pool_state = JERRY_CONTEXT (mem_pools), *prev_pool_state_p = NULL;
 
     while (pool_state->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
     {
@@ -133,11 +123,11 @@ mem_pools_alloc_longpath (void)
       pool_state = MEM_CP_GET_NON_NULL_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
     }
 
-    JERRY_ASSERT (prev_pool_state_p != NULL && pool_state != mem_pools);
+    JERRY_ASSERT (prev_pool_state_p != NULL && pool_state != JERRY_CONTEXT (mem_pools));
 
     prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
+    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, JERRY_CONTEXT (mem_pools));
+    JERRY_CONTEXT (mem_pools) = pool_state;
   }
 
   return true;
@@ -152,7 +142,7 @@ mem_pools_alloc_longpath (void)
 uint8_t*
 mem_pools_alloc (void)
 {
-  if (mem_pools == NULL || mem_pools->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
+  if (JERRY_CONTEXT (mem_pools) == NULL || JERRY_CONTEXT (mem_pools)->first_free_chunk == MEM_POOL_CHUNKS_NUMBER)
   {
     if (!mem_pools_alloc_longpath ())
     {
@@ -160,16 +150,21 @@ mem_pools_alloc (void)
     }
   }
 
-  JERRY_ASSERT (mem_pools != NULL && mem_pools->first_free_chunk != MEM_POOL_CHUNKS_NUMBER);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools) != NULL
+                && JERRY_CONTEXT (mem_pools)->first_free_chunk != MEM_POOL_CHUNKS_NUMBER);
 
   /**
    * And allocate chunk within it.
    */
-  mem_free_chunks_number--;
+  JERRY_CONTEXT (mem_free_chunks_number)--;
 
   MEM_POOLS_STAT_ALLOC_CHUNK ();
 
-  return mem_pool_alloc_chunk (mem_pools);
+  uint8_t *chunk_p = mem_pool_alloc_chunk (JERRY_CONTEXT (mem_pools));
+
+  MEM_ALLOC_PROFILER_REGISTER_ALLOC (chunk_p, MEM_POOL_CHUNK_SIZE);
+
+  return chunk_p;
 } /* mem_pools_alloc */
 
 /**
@@ -178,7 +173,7 @@ mem_pools_alloc (void)
 void
 mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
 {
-  mem_pool_state_t *pool_state = mem_pools, *prev_pool_state_p = NULL;
+  mem_pool_state_t *pool_state = JERRY_CONTEXT (mem_pools), *prev_pool_state_p = NULL;
 
   /**
    * Search for the pool containing specified chunk.
@@ -192,8 +187,10 @@ mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
   /**
    * Free the chunk
    */
+  MEM_ALLOC_PROFILER_REGISTER_FREE (chunk_p, MEM_POOL_CHUNK_SIZE);
+
   mem_pool_free_chunk (pool_state, chunk_p);
-  mem_free_chunks_number++;
+  JERRY_CONTEXT (mem_free_chunks_number)++;
 
   MEM_POOLS_STAT_FREE_CHUNK ();
 
@@ -208,22 +205,22 @@ mem_pools_free (uint8_t *chunk_p) /**< pointer to the chunk */
     }
     else
     {
-      mem_pools = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
+      JERRY_CONTEXT (mem_pools) = MEM_CP_GET_POINTER (mem_pool_state_t, pool_state->next_pool_cp);
     }
 
-    mem_free_chunks_number -= MEM_POOL_CHUNKS_NUMBER;
+    JERRY_CONTEXT (mem_free_chunks_number) -= MEM_POOL_CHUNKS_NUMBER;
 
     mem_heap_free_block ((uint8_t*) pool_state);
 
     MEM_POOLS_STAT_FREE_POOL ();
   }
-  else if (mem_pools != pool_state)
+  else if (JERRY_CONTEXT (mem_pools) != pool_state)
   {
     JERRY_ASSERT (prev_pool_state_p != NULL);
 
     prev_pool_state_p->next_pool_cp = pool_state->next_pool_cp;
-    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, mem_pools);
-    mem_pools = pool_state;
+    MEM_CP_SET_NON_NULL_POINTER (pool_state->next_pool_cp, JERRY_CONTEXT (mem_pools));
+    JERRY_CONTEXT (mem_pools) = pool_state;
   }
 } /* mem_pools_free */
 
@@ -236,7 +233,7 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< out: pools' stat
 {
   JERRY_ASSERT (out_pools_stats_p != NULL);
 
-  *out_pools_stats_p = mem_pools_stats;
+  *out_pools_stats_p = JERRY_CONTEXT (mem_pools_stats);
 } /* mem_pools_get_stats */
 
 /**
@@ -245,8 +242,8 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< out: pools' stat
 void
 mem_pools_stats_reset_peak (void)
 {
-  mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
-  mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+  JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
+  JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
 } /* mem_pools_stats_reset_peak */
 
 /**
@@ -255,7 +252,7 @@ mem_pools_stats_reset_peak (void)
 static void
 mem_pools_stat_init (void)
 {
-  memset (&mem_pools_stats, 0, sizeof (mem_pools_stats));
+  memset (&JERRY_CONTEXT (mem_pools_stats), 0, sizeof (JERRY_CONTEXT (mem_pools_stats)));
 } /* mem_pools_stat_init */
 
 /**
@@ -264,16 +261,16 @@ mem_pools_stat_init (void)
 static void
 mem_pools_stat_alloc_pool (void)
 {
-  mem_pools_stats.pools_count++;
-  mem_pools_stats.free_chunks = mem_free_chunks_number;
+  JERRY_CONTEXT (mem_pools_stats).pools_count++;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks = JERRY_CONTEXT (mem_free_chunks_number);
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (JERRY_CONTEXT (mem_pools_stats).pools_count > JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_pools_count = JERRY_CONTEXT (mem_pools_stats).pools_count;
   }
 } /* mem_pools_stat_alloc_pool */
 
@@ -283,10 +280,10 @@ mem_pools_stat_alloc_pool (void)
 static void
 mem_pools_stat_free_pool (void)
 {
-  JERRY_ASSERT (mem_pools_stats.pools_count > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).pools_count > 0);
 
-  mem_pools_stats.pools_count--;
-  mem_pools_stats.free_chunks = mem_free_chunks_number;
+  JERRY_CONTEXT (mem_pools_stats).pools_count--;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks = JERRY_CONTEXT (mem_free_chunks_number);
 } /* mem_pools_stat_free_pool */
 
 /**
@@ -295,18 +292,18 @@ mem_pools_stat_free_pool (void)
 static void
 mem_pools_stat_alloc_chunk (void)
 {
-  JERRY_ASSERT (mem_pools_stats.free_chunks > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).free_chunks > 0);
 
-  mem_pools_stats.allocated_chunks++;
-  mem_pools_stats.free_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).allocated_chunks++;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks--;
 
-  if (mem_pools_stats.allocated_chunks > mem_pools_stats.peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks)
   {
-    mem_pools_stats.peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_pools_stats).peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
   }
-  if (mem_pools_stats.allocated_chunks > mem_pools_stats.global_peak_allocated_chunks)
+  if (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > JERRY_CONTEXT (mem_pools_stats).global_peak_allocated_chunks)
   {
-    mem_pools_stats.global_peak_allocated_chunks = mem_pools_stats.allocated_chunks;
+    JERRY_CONTEXT (mem_pools_stats).global_peak_allocated_chunks = JERRY_CONTEXT (mem_pools_stats).allocated_chunks;
   }
 } /* mem_pools_stat_alloc_chunk */
 
@@ -316,10 +313,10 @@ mem_pools_stat_alloc_chunk (void)
 static void
 mem_pools_stat_free_chunk (void)
 {
-  JERRY_ASSERT (mem_pools_stats.allocated_chunks > 0);
+  JERRY_ASSERT (JERRY_CONTEXT (mem_pools_stats).allocated_chunks > 0);
 
-  mem_pools_stats.allocated_chunks--;
-  mem_pools_stats.free_chunks++;
+  JERRY_CONTEXT (mem_pools_stats).allocated_chunks--;
+  JERRY_CONTEXT (mem_pools_stats).free_chunks++;
 } /* mem_pools_stat_free_chunk */
 #endif /* MEM_STATS */
 
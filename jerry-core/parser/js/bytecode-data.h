@@ -29,12 +29,40 @@
  *
  * Bytecode, which is kept in the 'opcodes' field, is divided into blocks
  * of 'BLOCK_SIZE' operands. Every block has its own numbering of literals.
- * Literal uid could be in range [0, 127] in every block.
+ * Literal uid could be in range [0, 127] in every block (uids, starting from 128, are stored
+ * in the wide operands table, see also: OPCODE_WIDE_OPERAND_FIRST).
  *
  * To map uid to literal id 'lit_id_hash' table is used.
  */
 #define BLOCK_SIZE 64
 
+/**
+ * Entry of wide operands table
+ *
+ * The table contains entries for instructions, which operands don't fit into idx_t
+ * (see also: OPCODE_WIDE_OPERAND_FIRST), and is sorted by opcode counters of the instructions.
+ */
+typedef struct
+{
+  opcode_counter_t oc; /**< opcode counter of the instruction */
+  wide_idx_t operands[3]; /**< values of the instruction's operands, replaced with OPCODE_WIDE_OPERAND_FIRST + i
+                           *   (values of other operands are not used) */
+} wide_operands_t;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+/**
+ * Entry of byte-code's line table
+ *
+ * The table contains entries for instructions, which source code line differs from line of the preceding
+ * instruction, and is sorted by opcode counters of the instructions (see also: scopes_tree_line_table).
+ */
+typedef struct
+{
+  opcode_counter_t oc; /**< opcode counter of the instruction */
+  uint32_t line; /**< line of the instruction and of the following instructions up to the next entry */
+} line_table_entry_t;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Header of byte-code memory region, containing byte-code array and literal identifiers hash table
  */
@@ -43,14 +71,59 @@ typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
   mem_cpointer_t lit_id_hash_cp; /**< pointer to literal identifiers hash table
                                   *   See also: lit_id_hash_table_init */
   mem_cpointer_t next_opcodes_cp; /**< pointer to next byte-code memory region */
+  mem_cpointer_t wide_operands_cp; /**< pointer to wide operands table (see also: wide_operands_t) */
   opcode_counter_t instructions_number; /**< number of instructions in the byte-code array */
+  uint32_t wide_operands_number; /**< number of entries in the wide operands table */
+#ifdef JERRY_ENABLE_LINE_INFO
+  mem_cpointer_t line_table_cp; /**< pointer to line table (see also: line_table_entry_t) */
+  uint32_t line_table_entries_number; /**< number of entries in the line table */
+#endif /* JERRY_ENABLE_LINE_INFO */
 } opcodes_header_t;
 
+/**
+ * Header of byte-code, executed in place from a snapshot (i.e. located outside of the engine's heap)
+ *
+ * The header is allocated on the heap and is followed by array of compressed pointers to the snapshot's literals
+ * (in order of the snapshot's literal table).
+ */
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
+{
+  const opcode_t *opcodes_p; /**< byte-code array in the snapshot */
+  const uint8_t *lit_id_hash_table_p; /**< literal identifiers hash table section of the snapshot */
+  const wide_operands_t *wide_operands_p; /**< wide operands table section of the snapshot */
+  uint32_t lits_number; /**< number of literals in the snapshot */
+  opcode_counter_t instructions_number; /**< number of instructions in the byte-code array */
+  uint32_t wide_operands_number; /**< number of entries in the wide operands table */
+  mem_cpointer_t next_external_opcodes_cp; /**< pointer to next header of byte-code, executed in place */
+} external_opcodes_header_t;
+
+/**
+ * Descriptor of a function, which body is compiled upon first call of the function
+ * (see also: JERRY_FLAG_LAZY_FUNCTIONS)
+ *
+ * In byte-code, produced by the parser, body of such function is replaced with a stub:
+ * the scope code flags 'meta', followed by the OPCODE_META_TYPE_LAZY_FUNCTION 'meta',
+ * that holds index of the function's descriptor.
+ */
+typedef struct
+{
+  const jerry_api_char_t *body_p; /**< source code of the function's body (between the braces) */
+  size_t body_size; /**< size of the body's source code */
+  const opcode_t *opcodes_p; /**< byte-code, compiled from the body (NULL - if the body was not compiled yet) */
+  uint32_t first_line; /**< number of the source code line, containing the body's opening brace */
+  lit_cpointer_t name_lit_cp; /**< literal with the function's name (NOT_A_LITERAL - for anonymous functions) */
+  bool is_strict; /**< is the function's code strict mode code */
+} lazy_function_t;
+
 typedef struct
 {
   const ecma_char_t *strings_buffer;
   const opcode_t *opcodes;
   opcode_counter_t opcodes_count;
+  mem_cpointer_t external_opcodes_cp; /**< list of byte-code arrays, executed in place from snapshots */
+  mem_cpointer_t lazy_functions_cp; /**< array of lazily compiled functions' descriptors */
+  uint32_t lazy_functions_number; /**< number of descriptors in the array */
+  uint32_t lazy_functions_capacity; /**< number of descriptors, the array can hold without reallocation */
 } bytecode_data_t;
 
 /**
@@ -64,5 +137,45 @@ typedef struct
 #define GET_HASH_TABLE_FOR_BYTECODE(opcodes) (MEM_CP_GET_POINTER (lit_id_hash_table, \
                                                                   GET_BYTECODE_HEADER (opcodes)->lit_id_hash_cp))
 
+/**
+ * Version of byte-code snapshot format
+ *
+ * Note:
+ *      should be increased upon any change of the snapshot's layout or of the byte-code format
+ */
+#define SNAPSHOT_VERSION (5u)
+
+/**
+ * Build configuration, the snapshot's byte-code and literals depend on
+ *
+ * The word contains size of ecma_number_t (byte 0), width of compressed pointers (byte 1)
+ * and log2 of heap alignment (byte 2). Snapshots, produced by an engine with another configuration,
+ * are rejected upon loading.
+ */
+#define SNAPSHOT_CONFIG ((uint32_t) (sizeof (ecma_number_t) \
+                                     | ((uint32_t) MEM_CP_WIDTH << JERRY_BITSINBYTE) \
+                                     | ((uint32_t) MEM_ALIGNMENT_LOG << (2 * JERRY_BITSINBYTE))))
+
+/**
+ * Header of byte-code snapshot
+ *
+ * The header is followed by the sections (each section starts at offset, aligned to MEM_ALIGNMENT,
+ * so the byte-code and the hash table can be used in place, if the snapshot itself is aligned):
+ *  - literal table (see also: lit_dump_literals_for_snapshot);
+ *  - byte-code array;
+ *  - wide operands table (array of wide_operands_t);
+ *  - literal identifiers hash table (see also: lit_id_hash_table_dump_for_snapshot).
+ */
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
+{
+  uint32_t version; /**< version of snapshot format (SNAPSHOT_VERSION) */
+  uint32_t config; /**< build configuration of the engine, that produced the snapshot (SNAPSHOT_CONFIG) */
+  uint32_t lits_number; /**< number of literals in the literal table */
+  uint32_t lit_table_size; /**< size of the literal table section, in bytes */
+  uint32_t instructions_number; /**< number of instructions in the byte-code array */
+  uint32_t wide_operands_number; /**< number of entries in the wide operands table */
+  uint32_t lit_id_hash_table_size; /**< size of the literal identifiers hash table section, in bytes */
+} snapshot_header_t;
+
 
 #endif // BYTECODE_DATA_H
@@ -44,7 +44,9 @@ array_list_append (array_list al, void *element)
   array_list_header *h = extract_header (al);
   if ((h->len + 1) * h->element_size + sizeof (array_list_header) > h->size)
   {
-    size_t size = jsp_mm_recommend_size (h->size + h->element_size);
+    /* the storage is grown geometrically, as space of the old block is not returned to the heap until
+     * the parse is finished, but is only reused by the parser's subsequent allocations (see also: jsp_mm_alloc) */
+    size_t size = jsp_mm_recommend_size (JERRY_MAX (2 * h->size, h->size + h->element_size));
     JERRY_ASSERT (size > h->size);
 
     uint8_t *new_block_p = (uint8_t *) jsp_mm_alloc (size);
@@ -87,7 +87,7 @@ lit_id_hash_table_free (lit_id_hash_table *table_p) /**< table's header */
  */
 void
 lit_id_hash_table_insert (lit_id_hash_table *table_p, /**< table's header */
-                          idx_t uid, /**< value of byte-code instruction's argument */
+                          wide_idx_t uid, /**< literal identifier in the block */
                           opcode_counter_t oc, /**< opcode counter of the instruction */
                           lit_cpointer_t lit_cp) /**< literal identifier */
 {
@@ -111,7 +111,7 @@ lit_id_hash_table_insert (lit_id_hash_table *table_p, /**< table's header */
  */
 lit_cpointer_t
 lit_id_hash_table_lookup (lit_id_hash_table *table_p, /**< table's header */
-                          idx_t uid, /**< value of byte-code instruction's argument */
+                          wide_idx_t uid, /**< literal identifier in the block */
                           opcode_counter_t oc) /**< opcode counter of the instruction */
 {
   JERRY_ASSERT (table_p != NULL);
@@ -122,6 +122,325 @@ lit_id_hash_table_lookup (lit_id_hash_table *table_p, /**< table's header */
   return table_p->buckets[block_id][uid];
 } /* lit_id_hash_table_lookup */
 
+/**
+ * Value of block's bucket offset in snapshot, indicating that the block doesn't contain literals
+ */
+#define LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET (UINT32_MAX)
+
+/**
+ * Dump literal identifiers hash table to a snapshot
+ *
+ * Section's layout:
+ *  - number of buckets (uint32_t);
+ *  - for each of the blocks: offset of the block's first bucket (uint32_t, LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET
+ *    if the block doesn't contain literals);
+ *  - for each of the buckets: index of the literal in the snapshot's literal table (uint32_t).
+ *
+ * @return true, if the table was dumped successfully,
+ *         false - if the buffer is too small.
+ */
+bool
+lit_id_hash_table_dump_for_snapshot (uint8_t *buffer_p, /**< buffer to dump to */
+                                     size_t buffer_size, /**< buffer size */
+                                     size_t *in_out_buffer_offset_p, /**< in-out: write position in the buffer */
+                                     lit_id_hash_table *table_p, /**< table's header */
+                                     size_t blocks_count, /**< number of opcode blocks */
+                                     const lit_cpointer_t *lit_cps_p, /**< sorted compressed pointers to
+                                                                       *   the snapshot's literals */
+                                     uint32_t lits_number) /**< number of literals in the snapshot */
+{
+  JERRY_ASSERT (table_p != NULL);
+
+  uint32_t buckets_number = (uint32_t) table_p->current_bucket_pos;
+
+  if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p,
+                                      &buckets_number, sizeof (buckets_number)))
+  {
+    return false;
+  }
+
+  for (size_t block_id = 0; block_id < blocks_count; block_id++)
+  {
+    uint32_t offset = LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET;
+
+    if (table_p->buckets[block_id] != NULL)
+    {
+      offset = (uint32_t) (table_p->buckets[block_id] - table_p->raw_buckets);
+      JERRY_ASSERT (offset < buckets_number);
+    }
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p, &offset, sizeof (offset)))
+    {
+      return false;
+    }
+  }
+
+  for (uint32_t bucket_id = 0; bucket_id < buckets_number; bucket_id++)
+  {
+    uint32_t lit_index = lit_snapshot_get_literal_index (lit_cps_p, lits_number, table_p->raw_buckets[bucket_id]);
+
+    if (!jrt_write_to_buffer_by_offset (buffer_p, buffer_size, in_out_buffer_offset_p,
+                                        &lit_index, sizeof (lit_index)))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* lit_id_hash_table_dump_for_snapshot */
+
+/**
+ * Get size of buffer, necessary to hold hash table, dumped to the specified snapshot section
+ *
+ * @return size of buffer,
+ *         or 0 - if the section is corrupted.
+ */
+size_t
+lit_id_hash_table_get_size_for_snapshot_table (const uint8_t *section_p, /**< hash table's snapshot section */
+                                               size_t section_size, /**< size of the section */
+                                               size_t blocks_count) /**< number of opcode blocks */
+{
+  size_t offset = 0;
+  uint32_t buckets_number;
+
+  if (!jrt_read_from_buffer_by_offset (section_p, section_size, &offset, &buckets_number, sizeof (buckets_number))
+      || section_size != sizeof (uint32_t) * (1 + blocks_count + buckets_number))
+  {
+    return 0;
+  }
+
+  return lit_id_hash_table_get_size_for_table (buckets_number, blocks_count);
+} /* lit_id_hash_table_get_size_for_snapshot_table */
+
+/**
+ * Load literal identifiers hash table from a snapshot
+ *
+ * @return pointer to header of the table,
+ *         or NULL - if the section is corrupted.
+ */
+lit_id_hash_table *
+lit_id_hash_table_load_from_snapshot (const uint8_t *section_p, /**< hash table's snapshot section */
+                                      size_t section_size, /**< size of the section */
+                                      size_t blocks_count, /**< number of opcode blocks */
+                                      const lit_cpointer_t *lit_cps_p, /**< compressed pointers to the snapshot's
+                                                                        *   literals, in order of the literal table */
+                                      uint32_t lits_number, /**< number of literals in the snapshot */
+                                      uint8_t *table_buffer_p, /**< buffer to initialize hash table in */
+                                      size_t table_buffer_size) /**< size of the buffer
+                                                                 *   (see also:
+                                                                 *    lit_id_hash_table_get_size_for_snapshot_table) */
+{
+  size_t offset = 0;
+  uint32_t buckets_number;
+
+  if (!jrt_read_from_buffer_by_offset (section_p, section_size, &offset, &buckets_number, sizeof (buckets_number)))
+  {
+    return NULL;
+  }
+
+  lit_id_hash_table *table_p = lit_id_hash_table_init (table_buffer_p, table_buffer_size,
+                                                       buckets_number, blocks_count);
+
+  uint32_t prev_bucket_offset = LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET;
+
+  for (size_t block_id = 0; block_id < blocks_count; block_id++)
+  {
+    uint32_t bucket_offset;
+
+    if (!jrt_read_from_buffer_by_offset (section_p, section_size, &offset, &bucket_offset, sizeof (bucket_offset)))
+    {
+      return NULL;
+    }
+
+    if (bucket_offset != LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET)
+    {
+      /* buckets of the blocks are allocated in order of the blocks */
+      if (bucket_offset >= buckets_number
+          || (prev_bucket_offset != LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET && bucket_offset <= prev_bucket_offset))
+      {
+        return NULL;
+      }
+
+      prev_bucket_offset = bucket_offset;
+
+      table_p->buckets[block_id] = table_p->raw_buckets + bucket_offset;
+    }
+  }
+
+  for (uint32_t bucket_id = 0; bucket_id < buckets_number; bucket_id++)
+  {
+    uint32_t lit_index;
+
+    if (!jrt_read_from_buffer_by_offset (section_p, section_size, &offset, &lit_index, sizeof (lit_index))
+        || lit_index >= lits_number)
+    {
+      return NULL;
+    }
+
+    table_p->raw_buckets[bucket_id] = lit_cps_p[lit_index];
+  }
+
+  table_p->current_bucket_pos = buckets_number;
+
+  return table_p;
+} /* lit_id_hash_table_load_from_snapshot */
+
+/**
+ * Check that literal identifiers hash table, dumped to the specified snapshot section, can be used in place
+ *
+ * @return true - if the section is correct,
+ *         false - otherwise.
+ */
+bool
+lit_id_hash_table_check_snapshot_table (const uint8_t *section_p, /**< hash table's snapshot section
+                                                                   *   (aligned to sizeof (uint32_t)) */
+                                        size_t section_size, /**< size of the section */
+                                        size_t blocks_count, /**< number of opcode blocks */
+                                        uint32_t lits_number) /**< number of literals in the snapshot */
+{
+  JERRY_ASSERT (((uintptr_t) section_p) % sizeof (uint32_t) == 0);
+
+  const uint32_t *words_p = (const uint32_t *) section_p;
+
+  if (section_size < sizeof (uint32_t)
+      || section_size != sizeof (uint32_t) * (1 + blocks_count + words_p[0]))
+  {
+    return false;
+  }
+
+  const uint32_t buckets_number = words_p[0];
+  const uint32_t *bucket_offsets_p = words_p + 1;
+  const uint32_t *lit_indexes_p = bucket_offsets_p + blocks_count;
+
+  uint32_t prev_bucket_offset = LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET;
+
+  for (size_t block_id = 0; block_id < blocks_count; block_id++)
+  {
+    const uint32_t bucket_offset = bucket_offsets_p[block_id];
+
+    if (bucket_offset == LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET)
+    {
+      continue;
+    }
+
+    /* buckets of the blocks are allocated in order of the blocks */
+    if (bucket_offset >= buckets_number
+        || (prev_bucket_offset != LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET && bucket_offset <= prev_bucket_offset))
+    {
+      return false;
+    }
+
+    prev_bucket_offset = bucket_offset;
+  }
+
+  for (uint32_t bucket_id = 0; bucket_id < buckets_number; bucket_id++)
+  {
+    if (lit_indexes_p[bucket_id] >= lits_number)
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* lit_id_hash_table_check_snapshot_table */
+
+/**
+ * Lookup literal identifier in literal identifiers hash table, dumped to a snapshot section
+ *
+ * See also:
+ *          lit_id_hash_table_check_snapshot_table
+ *
+ * @return index of the literal in the snapshot's literal table
+ */
+uint32_t
+lit_id_hash_table_lookup_in_snapshot (const uint8_t *section_p, /**< hash table's snapshot section */
+                                      size_t blocks_count, /**< number of opcode blocks */
+                                      wide_idx_t uid, /**< literal identifier in the block */
+                                      opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  const uint32_t *words_p = (const uint32_t *) section_p;
+
+  const size_t block_id = oc / BLOCK_SIZE;
+  JERRY_ASSERT (block_id < blocks_count);
+
+  const uint32_t bucket_offset = words_p[1 + block_id];
+  JERRY_ASSERT (bucket_offset != LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET
+                && bucket_offset + uid < words_p[0]);
+
+  return words_p[1 + blocks_count + bucket_offset + uid];
+} /* lit_id_hash_table_lookup_in_snapshot */
+
+/**
+ * Get number of literal identifiers in the specified block of the hash table
+ *
+ * Note:
+ *      buckets of the blocks are supposed to be allocated in order of the blocks
+ *      (see also: lit_id_hash_table_insert, lit_id_hash_table_load_from_snapshot)
+ *
+ * @return number of identifiers, that can be looked up in the block
+ */
+size_t
+lit_id_hash_table_get_block_ids_number (lit_id_hash_table *table_p, /**< table's header */
+                                        size_t blocks_count, /**< number of opcode blocks */
+                                        size_t block_id) /**< index of the block */
+{
+  JERRY_ASSERT (table_p != NULL);
+  JERRY_ASSERT (block_id < blocks_count);
+
+  if (table_p->buckets[block_id] == NULL)
+  {
+    return 0;
+  }
+
+  for (size_t next_block_id = block_id + 1; next_block_id < blocks_count; next_block_id++)
+  {
+    if (table_p->buckets[next_block_id] != NULL)
+    {
+      JERRY_ASSERT (table_p->buckets[next_block_id] > table_p->buckets[block_id]);
+
+      return (size_t) (table_p->buckets[next_block_id] - table_p->buckets[block_id]);
+    }
+  }
+
+  return (size_t) (table_p->raw_buckets + table_p->current_bucket_pos - table_p->buckets[block_id]);
+} /* lit_id_hash_table_get_block_ids_number */
+
+/**
+ * Get number of literal identifiers in the specified block of the hash table, dumped to a snapshot section
+ *
+ * See also:
+ *          lit_id_hash_table_check_snapshot_table
+ *
+ * @return number of identifiers, that can be looked up in the block
+ */
+size_t
+lit_id_hash_table_get_block_ids_number_in_snapshot (const uint8_t *section_p, /**< hash table's snapshot section */
+                                                    size_t blocks_count, /**< number of opcode blocks */
+                                                    size_t block_id) /**< index of the block */
+{
+  JERRY_ASSERT (block_id < blocks_count);
+
+  const uint32_t *words_p = (const uint32_t *) section_p;
+  const uint32_t *bucket_offsets_p = words_p + 1;
+
+  if (bucket_offsets_p[block_id] == LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET)
+  {
+    return 0;
+  }
+
+  for (size_t next_block_id = block_id + 1; next_block_id < blocks_count; next_block_id++)
+  {
+    if (bucket_offsets_p[next_block_id] != LIT_ID_HASH_TABLE_SNAPSHOT_NO_BUCKET)
+    {
+      JERRY_ASSERT (bucket_offsets_p[next_block_id] > bucket_offsets_p[block_id]);
+
+      return bucket_offsets_p[next_block_id] - bucket_offsets_p[block_id];
+    }
+  }
+
+  return words_p[0] - bucket_offsets_p[block_id];
+} /* lit_id_hash_table_get_block_ids_number_in_snapshot */
+
 /**
  * @}
  * @}
@@ -31,7 +31,16 @@ typedef struct
 lit_id_hash_table *lit_id_hash_table_init (uint8_t*, size_t, size_t, size_t);
 size_t lit_id_hash_table_get_size_for_table (size_t, size_t);
 void lit_id_hash_table_free (lit_id_hash_table *);
-void lit_id_hash_table_insert (lit_id_hash_table *, idx_t, opcode_counter_t, lit_cpointer_t);
-lit_cpointer_t lit_id_hash_table_lookup (lit_id_hash_table *, idx_t, opcode_counter_t);
+void lit_id_hash_table_insert (lit_id_hash_table *, wide_idx_t, opcode_counter_t, lit_cpointer_t);
+lit_cpointer_t lit_id_hash_table_lookup (lit_id_hash_table *, wide_idx_t, opcode_counter_t);
+bool lit_id_hash_table_dump_for_snapshot (uint8_t *, size_t, size_t *, lit_id_hash_table *, size_t,
+                                          const lit_cpointer_t *, uint32_t);
+size_t lit_id_hash_table_get_size_for_snapshot_table (const uint8_t *, size_t, size_t);
+lit_id_hash_table *lit_id_hash_table_load_from_snapshot (const uint8_t *, size_t, size_t, const lit_cpointer_t *,
+                                                         uint32_t, uint8_t *, size_t);
+bool lit_id_hash_table_check_snapshot_table (const uint8_t *, size_t, size_t, uint32_t);
+uint32_t lit_id_hash_table_lookup_in_snapshot (const uint8_t *, size_t, wide_idx_t, opcode_counter_t);
+size_t lit_id_hash_table_get_block_ids_number (lit_id_hash_table *, size_t, size_t);
+size_t lit_id_hash_table_get_block_ids_number_in_snapshot (const uint8_t *, size_t, size_t);
 
 #endif /* LIT_ID_HASH_TABLE */
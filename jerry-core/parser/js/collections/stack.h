@@ -185,7 +185,7 @@ do { for (size_t i = FROM; i < array_list_len (NAME.data); i++) { \
 
 #define STACK(NAME, TYPE) \
 DEFINE_STACK_TYPE (NAME, TYPE) \
-NAME##_stack NAME; \
+JERRY_THREAD_LOCAL NAME##_stack NAME; \
 DEFINE_STACK_ELEMENT (NAME, TYPE) \
 DEFINE_SET_STACK_ELEMENT (NAME, TYPE) \
 DEFINE_STACK_HEAD (NAME, TYPE) \
@@ -194,7 +194,7 @@ DEFINE_STACK_PUSH (NAME, TYPE)
 
 #define STATIC_STACK(NAME, TYPE) \
 DEFINE_STACK_TYPE (NAME, TYPE) \
-static NAME##_stack NAME; \
+static JERRY_THREAD_LOCAL NAME##_stack NAME; \
 DEFINE_STACK_ELEMENT (NAME, TYPE) \
 DEFINE_SET_STACK_ELEMENT (NAME, TYPE) \
 DEFINE_STACK_HEAD (NAME, TYPE) \
@@ -27,7 +27,7 @@
 /**
  * Stack, containing current label set
  */
-jsp_label_t *label_set_p = NULL;
+JERRY_THREAD_LOCAL jsp_label_t *label_set_p = NULL;
 
 /**
  * Initialize jumps labels mechanism
@@ -26,18 +26,69 @@
  */
 
 /**
- * Header of a managed block, allocated by parser
+ * Size of an arena chunk
+ *
+ * Parser's data is placed in chunks of the size, allocated from the engine's heap as short-term blocks
+ * (i.e. at the heap's end, opposite to the long-lived objects); all chunks are released at once,
+ * when the parse is finished.
+ *
+ * Pieces, greater than half of a chunk, are placed in dedicated chunks, that are returned to the heap
+ * as soon as the pieces are freed (see also: jsp_mm_free).
+ */
+#define JSP_MM_ARENA_CHUNK_SIZE (2048)
+
+/**
+ * Number of lists of freed pieces
+ *
+ * All lists, except the last one, contain pieces of the same size (list index multiplied by MEM_ALIGNMENT),
+ * the last list contains pieces of all greater sizes.
+ */
+#define JSP_MM_FREE_LISTS_NUMBER (32)
+
+/**
+ * Header of an arena chunk
  */
-typedef struct __attribute__ ((alignment (MEM_ALIGNMENT)))
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
 {
-  mem_cpointer_t prev_block_cp; /**< previous managed block */
-  mem_cpointer_t next_block_cp; /**< next managed block */
-} jsp_mm_header_t;
+  mem_cpointer_t next_chunk_cp; /**< next chunk of the arena */
+  mem_cpointer_t prev_chunk_cp; /**< previous chunk of the arena (used only for dedicated chunks) */
+} jsp_mm_chunk_header_t;
+
+/**
+ * Header of a piece of arena, allocated by parser
+ */
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
+{
+  uint32_t size; /**< size of the piece's data space */
+  mem_cpointer_t next_free_cp; /**< next piece in the list of freed pieces (if the piece is free) */
+} jsp_mm_piece_header_t;
+
+/**
+ * List of the arena's chunks
+ *
+ * The first chunk is the one, space of which is currently allocated by bumping jsp_mm_arena_free_p.
+ */
+JERRY_THREAD_LOCAL jsp_mm_chunk_header_t *jsp_mm_chunks_p = NULL;
+
+/**
+ * List of the arena's chunks, dedicated to single pieces
+ */
+JERRY_THREAD_LOCAL jsp_mm_chunk_header_t *jsp_mm_dedicated_chunks_p = NULL;
+
+/**
+ * Beginning of free space in the current chunk
+ */
+JERRY_THREAD_LOCAL uint8_t *jsp_mm_arena_free_p = NULL;
 
 /**
- * List used for tracking memory blocks
+ * End of the current chunk
  */
-jsp_mm_header_t *jsp_mm_blocks_p = NULL;
+JERRY_THREAD_LOCAL uint8_t *jsp_mm_arena_end_p = NULL;
+
+/**
+ * Lists of freed pieces, available for reuse
+ */
+JERRY_THREAD_LOCAL jsp_mm_piece_header_t *jsp_mm_free_lists[JSP_MM_FREE_LISTS_NUMBER];
 
 /**
  * Initialize managed memory allocator
@@ -45,16 +96,28 @@ jsp_mm_header_t *jsp_mm_blocks_p = NULL;
 void
 jsp_mm_init (void)
 {
-  JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  JERRY_ASSERT (jsp_mm_chunks_p == NULL);
+  JERRY_ASSERT (jsp_mm_dedicated_chunks_p == NULL);
+
+  jsp_mm_arena_free_p = NULL;
+  jsp_mm_arena_end_p = NULL;
+
+  for (uint32_t i = 0; i < JSP_MM_FREE_LISTS_NUMBER; i++)
+  {
+    jsp_mm_free_lists[i] = NULL;
+  }
 } /* jsp_mm_init */
 
 /**
  * Finalize managed memory allocator
+ *
+ * Note:
+ *      memory of all blocks that were not freed yet is released
  */
 void
 jsp_mm_finalize (void)
 {
-  JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  jsp_mm_free_all ();
 } /* jsp_mm_finalize */
 
 /**
@@ -80,80 +143,260 @@ jsp_mm_finalize (void)
 size_t
 jsp_mm_recommend_size (size_t minimum_size) /**< minimum required size */
 {
-  size_t block_and_header_size = mem_heap_recommend_allocation_size (minimum_size + sizeof (jsp_mm_header_t));
-  return block_and_header_size - sizeof (jsp_mm_header_t);
+  size_t block_and_header_size = mem_heap_recommend_allocation_size (minimum_size + sizeof (jsp_mm_piece_header_t));
+  return block_and_header_size - sizeof (jsp_mm_piece_header_t);
 } /* jsp_mm_recommend_size */
 
+/**
+ * Get index of the list of freed pieces, corresponding to the specified piece size
+ *
+ * @return list index
+ */
+static uint32_t
+jsp_mm_get_free_list_index (size_t size) /**< size of piece's data space (aligned to MEM_ALIGNMENT) */
+{
+  JERRY_ASSERT (size % MEM_ALIGNMENT == 0);
+
+  return (uint32_t) JERRY_MIN (size / MEM_ALIGNMENT, JSP_MM_FREE_LISTS_NUMBER - 1);
+} /* jsp_mm_get_free_list_index */
+
+/**
+ * Put a piece to corresponding list of freed pieces
+ */
+static void
+jsp_mm_put_to_free_list (jsp_mm_piece_header_t *piece_p) /**< piece */
+{
+  uint32_t list_index = jsp_mm_get_free_list_index (piece_p->size);
+
+  MEM_CP_SET_POINTER (piece_p->next_free_cp, jsp_mm_free_lists[list_index]);
+  jsp_mm_free_lists[list_index] = piece_p;
+} /* jsp_mm_put_to_free_list */
+
+/**
+ * Take a piece of sufficient size from lists of freed pieces
+ *
+ * @return pointer to the piece - if there is an appropriate freed piece,
+ *         NULL - otherwise.
+ */
+static jsp_mm_piece_header_t *
+jsp_mm_take_from_free_list (size_t size) /**< required size of piece's data space (aligned to MEM_ALIGNMENT) */
+{
+  uint32_t list_index = jsp_mm_get_free_list_index (size);
+
+  jsp_mm_piece_header_t *prev_piece_p = NULL;
+  jsp_mm_piece_header_t *piece_p = jsp_mm_free_lists[list_index];
+
+  while (piece_p != NULL
+         && piece_p->size < size)
+  {
+    JERRY_ASSERT (list_index == JSP_MM_FREE_LISTS_NUMBER - 1);
+
+    prev_piece_p = piece_p;
+    piece_p = MEM_CP_GET_POINTER (jsp_mm_piece_header_t, piece_p->next_free_cp);
+  }
+
+  if (piece_p != NULL)
+  {
+    jsp_mm_piece_header_t *next_piece_p = MEM_CP_GET_POINTER (jsp_mm_piece_header_t, piece_p->next_free_cp);
+
+    if (prev_piece_p == NULL)
+    {
+      jsp_mm_free_lists[list_index] = next_piece_p;
+    }
+    else
+    {
+      prev_piece_p->next_free_cp = piece_p->next_free_cp;
+    }
+  }
+
+  return piece_p;
+} /* jsp_mm_take_from_free_list */
+
+/**
+ * Check whether pieces of the specified size are placed in dedicated chunks
+ *
+ * @return true / false
+ */
+static bool
+jsp_mm_is_dedicated_piece_size (size_t size) /**< size of piece's data space (aligned to MEM_ALIGNMENT) */
+{
+  const size_t chunk_data_size = JSP_MM_ARENA_CHUNK_SIZE - sizeof (jsp_mm_chunk_header_t);
+
+  return sizeof (jsp_mm_piece_header_t) + size > chunk_data_size / 2;
+} /* jsp_mm_is_dedicated_piece_size */
+
+/**
+ * Allocate a new arena chunk
+ *
+ * @return pointer to data space of the chunk
+ */
+static uint8_t *
+jsp_mm_alloc_chunk (size_t size, /**< size of the chunk's data space */
+                    bool is_current) /**< true - if free space of the chunk would be used for further allocations
+                                      *          (i.e. the chunk becomes the current chunk),
+                                      *   false - if the chunk is dedicated to a single piece */
+{
+  jsp_mm_chunk_header_t *chunk_p;
+  chunk_p = (jsp_mm_chunk_header_t *) mem_heap_alloc_block (sizeof (jsp_mm_chunk_header_t) + size,
+                                                            MEM_HEAP_ALLOC_SHORT_TERM);
+
+  jsp_mm_chunk_header_t **list_p = is_current ? &jsp_mm_chunks_p : &jsp_mm_dedicated_chunks_p;
+
+  chunk_p->prev_chunk_cp = MEM_CP_NULL;
+  MEM_CP_SET_POINTER (chunk_p->next_chunk_cp, *list_p);
+
+  if (*list_p != NULL)
+  {
+    MEM_CP_SET_NON_NULL_POINTER ((*list_p)->prev_chunk_cp, chunk_p);
+  }
+
+  *list_p = chunk_p;
+
+  return (uint8_t *) (chunk_p + 1);
+} /* jsp_mm_alloc_chunk */
+
 /**
  * Allocate a managed memory block of specified size
  *
+ * Note:
+ *      the block is allocated in the parser's arena, and is released, at latest, upon jsp_mm_finalize
+ *
  * @return pointer to data space of allocated block
  */
 void*
 jsp_mm_alloc (size_t size) /**< size of block to allocate */
 {
-  void *ptr_p = mem_heap_alloc_block (size + sizeof (jsp_mm_header_t), MEM_HEAP_ALLOC_SHORT_TERM);
+  const size_t aligned_size = JERRY_ALIGNUP (size, MEM_ALIGNMENT);
+  const size_t piece_size = sizeof (jsp_mm_piece_header_t) + aligned_size;
+  const size_t chunk_data_size = JSP_MM_ARENA_CHUNK_SIZE - sizeof (jsp_mm_chunk_header_t);
+
+  jsp_mm_piece_header_t *piece_p;
+
+  if (jsp_mm_is_dedicated_piece_size (aligned_size))
+  {
+    piece_p = (jsp_mm_piece_header_t *) jsp_mm_alloc_chunk (piece_size, false);
+    piece_p->size = (uint32_t) aligned_size;
+
+    return (void *) (piece_p + 1);
+  }
 
-  jsp_mm_header_t *tmem_header_p = (jsp_mm_header_t*) ptr_p;
+  piece_p = jsp_mm_take_from_free_list (aligned_size);
 
-  tmem_header_p->prev_block_cp = MEM_CP_NULL;
-  MEM_CP_SET_POINTER (tmem_header_p->next_block_cp, jsp_mm_blocks_p);
+  if (piece_p != NULL)
+  {
+    return (void *) (piece_p + 1);
+  }
 
-  if (jsp_mm_blocks_p != NULL)
+  if (piece_size > (size_t) (jsp_mm_arena_end_p - jsp_mm_arena_free_p))
   {
-    MEM_CP_SET_POINTER (jsp_mm_blocks_p->prev_block_cp, tmem_header_p);
+    size_t remaining_size = (size_t) (jsp_mm_arena_end_p - jsp_mm_arena_free_p);
+
+    if (remaining_size >= sizeof (jsp_mm_piece_header_t))
+    {
+      /* tail of the current chunk is kept for reuse */
+      jsp_mm_piece_header_t *tail_piece_p = (jsp_mm_piece_header_t *) jsp_mm_arena_free_p;
+      tail_piece_p->size = (uint32_t) (remaining_size - sizeof (jsp_mm_piece_header_t));
+
+      jsp_mm_put_to_free_list (tail_piece_p);
+    }
+
+    jsp_mm_arena_free_p = jsp_mm_alloc_chunk (chunk_data_size, true);
+    jsp_mm_arena_end_p = jsp_mm_arena_free_p + chunk_data_size;
   }
 
-  jsp_mm_blocks_p = tmem_header_p;
+  piece_p = (jsp_mm_piece_header_t *) jsp_mm_arena_free_p;
+  piece_p->size = (uint32_t) aligned_size;
+
+  jsp_mm_arena_free_p += piece_size;
+  JERRY_ASSERT (jsp_mm_arena_free_p <= jsp_mm_arena_end_p);
 
-  return (void *) (tmem_header_p + 1);
+  return (void *) (piece_p + 1);
 } /* jsp_mm_alloc */
 
 /**
  * Free a managed memory block
+ *
+ * Note:
+ *      the block's space is returned to the arena and is reused by following allocations,
+ *      or, if the block is placed in a dedicated chunk, the chunk is returned to the heap
  */
 void
 jsp_mm_free (void *ptr) /**< pointer to data space of allocated block */
 {
-  jsp_mm_header_t *tmem_header_p = ((jsp_mm_header_t *) ptr) - 1;
+  jsp_mm_piece_header_t *piece_p = ((jsp_mm_piece_header_t *) ptr) - 1;
 
-  jsp_mm_header_t *prev_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->prev_block_cp);
-  jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->next_block_cp);
+  uint8_t *piece_end_p = (uint8_t *) ptr + piece_p->size;
 
-  if (prev_block_p != NULL)
+  if (jsp_mm_is_dedicated_piece_size (piece_p->size))
   {
-    prev_block_p->next_block_cp = tmem_header_p->next_block_cp;
+    jsp_mm_chunk_header_t *chunk_p = ((jsp_mm_chunk_header_t *) piece_p) - 1;
+    jsp_mm_chunk_header_t *prev_chunk_p = MEM_CP_GET_POINTER (jsp_mm_chunk_header_t, chunk_p->prev_chunk_cp);
+    jsp_mm_chunk_header_t *next_chunk_p = MEM_CP_GET_POINTER (jsp_mm_chunk_header_t, chunk_p->next_chunk_cp);
+
+    if (prev_chunk_p == NULL)
+    {
+      JERRY_ASSERT (jsp_mm_dedicated_chunks_p == chunk_p);
+      jsp_mm_dedicated_chunks_p = next_chunk_p;
+    }
+    else
+    {
+      prev_chunk_p->next_chunk_cp = chunk_p->next_chunk_cp;
+    }
+
+    if (next_chunk_p != NULL)
+    {
+      next_chunk_p->prev_chunk_cp = chunk_p->prev_chunk_cp;
+    }
+
+    mem_heap_free_block (chunk_p);
   }
-  else
+  else if (piece_end_p == jsp_mm_arena_free_p)
   {
-    JERRY_ASSERT (jsp_mm_blocks_p == tmem_header_p);
-    jsp_mm_blocks_p = next_block_p;
+    /* the last allocated piece of the current chunk */
+    jsp_mm_arena_free_p = (uint8_t *) piece_p;
   }
-
-  if (next_block_p != NULL)
+  else
   {
-    next_block_p->prev_block_cp = tmem_header_p->prev_block_cp;
+    jsp_mm_put_to_free_list (piece_p);
   }
-
-  mem_heap_free_block (tmem_header_p);
 } /* jsp_mm_free */
 
 /**
  * Free all currently allocated managed memory blocks
+ *
+ * Note:
+ *      the arena's chunks are released to the heap, so the operation takes time, proportional
+ *      to number of the chunks, and not to number of the allocated blocks
  */
 void
 jsp_mm_free_all (void)
 {
-  while (jsp_mm_blocks_p != NULL)
+  while (jsp_mm_chunks_p != NULL)
   {
-    jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                        jsp_mm_blocks_p->next_block_cp);
+    jsp_mm_chunk_header_t *next_chunk_p = MEM_CP_GET_POINTER (jsp_mm_chunk_header_t,
+                                                              jsp_mm_chunks_p->next_chunk_cp);
 
-    mem_heap_free_block (jsp_mm_blocks_p);
+    mem_heap_free_block (jsp_mm_chunks_p);
 
-    jsp_mm_blocks_p = next_block_p;
+    jsp_mm_chunks_p = next_chunk_p;
+  }
+
+  while (jsp_mm_dedicated_chunks_p != NULL)
+  {
+    jsp_mm_chunk_header_t *next_chunk_p = MEM_CP_GET_POINTER (jsp_mm_chunk_header_t,
+                                                              jsp_mm_dedicated_chunks_p->next_chunk_cp);
+
+    mem_heap_free_block (jsp_mm_dedicated_chunks_p);
+
+    jsp_mm_dedicated_chunks_p = next_chunk_p;
+  }
+
+  jsp_mm_arena_free_p = NULL;
+  jsp_mm_arena_end_p = NULL;
+
+  for (uint32_t i = 0; i < JSP_MM_FREE_LISTS_NUMBER; i++)
+  {
+    jsp_mm_free_lists[i] = NULL;
   }
 } /* jsp_mm_free_all */
 
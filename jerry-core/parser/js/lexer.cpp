@@ -23,15 +23,42 @@
 #include "lit-strings.h"
 #include "syntax-errors.h"
 
-static token saved_token, prev_token, sent_token, empty_token;
+static JERRY_THREAD_LOCAL token saved_token, prev_token, sent_token, empty_token;
 
-static bool allow_dump_lines = false, strict_mode;
-static size_t buffer_size = 0;
+static JERRY_THREAD_LOCAL bool allow_dump_lines = false, strict_mode;
+static JERRY_THREAD_LOCAL size_t buffer_size = 0;
 
 /* Represents the contents of a script.  */
-static const jerry_api_char_t *buffer_start = NULL;
-static const jerry_api_char_t *buffer = NULL;
-static const jerry_api_char_t *token_start;
+static JERRY_THREAD_LOCAL const jerry_api_char_t *buffer_start = NULL;
+static JERRY_THREAD_LOCAL const jerry_api_char_t *buffer = NULL;
+static JERRY_THREAD_LOCAL const jerry_api_char_t *token_start;
+
+/**
+ * Reader of the source code's part, that is not in the buffer yet
+ * (NULL - if the whole source code is in the buffer; see also: lexer_set_source_reader)
+ */
+static JERRY_THREAD_LOCAL jerry_source_reader_t source_reader_p = NULL;
+static JERRY_THREAD_LOCAL void *source_reader_user_p = NULL;
+
+/**
+ * Number of the source code's first line (see also: lexer_init)
+ */
+static JERRY_THREAD_LOCAL uint32_t first_line = 1;
+
+/**
+ * Position in the source code and number of line, containing the position,
+ * cached by the last lexer_get_current_line call (lines are counted incrementally, as the parse goes forward)
+ */
+static JERRY_THREAD_LOCAL locus line_cache_locus = 0;
+static JERRY_THREAD_LOCAL uint32_t line_cache_line = 1;
+
+/**
+ * Positions of the last and of the previous tokens, other than new line, returned by lexer_next_token
+ * (the parser looks ahead through new lines, so instructions of a statement are usually dumped
+ *  after the next statement's first token is read and saved back with lexer_save_token)
+ */
+static JERRY_THREAD_LOCAL locus last_token_locus = 0;
+static JERRY_THREAD_LOCAL locus prev_token_locus = 0;
 
 #define LA(I)       (get_char (I))
 
@@ -54,12 +81,45 @@ current_locus (void)
   }
 }
 
+/**
+ * Extend the buffer with next part of the source code, if the source code is read through a reader
+ *
+ * @return true - if the buffer was extended,
+ *         false - otherwise (the whole source code is in the buffer).
+ */
+static bool
+read_source (void)
+{
+  if (source_reader_p == NULL)
+  {
+    return false;
+  }
+
+  size_t new_buffer_size = source_reader_p (source_reader_user_p);
+
+  if (new_buffer_size <= buffer_size)
+  {
+    /* end of the source code */
+    source_reader_p = NULL;
+    source_reader_user_p = NULL;
+
+    return false;
+  }
+
+  buffer_size = new_buffer_size;
+
+  return true;
+} /* read_source */
+
 static ecma_char_t
 get_char (size_t i)
 {
-  if ((buffer + i) >= (buffer_start + buffer_size))
+  while ((buffer + i) >= (buffer_start + buffer_size))
   {
-    return '\0';
+    if (!read_source ())
+    {
+      return '\0';
+    }
   }
   return *(buffer + i);
 }
@@ -77,7 +137,7 @@ dump_current_line (void)
   printf ("// ");
 
   FIXME ("Unicode: properly process non-ascii characters.");
-  for (i = buffer; *i != '\n' && *i != 0; i++)
+  for (i = buffer; i < buffer_start + buffer_size && *i != '\n' && *i != 0; i++)
   {
     putchar (*i);
   }
@@ -103,7 +163,7 @@ create_token_from_lit (token_type type, literal_t lit)
  */
 static token
 create_token (token_type type,  /**< type of token */
-              uint16_t uid)     /**< uid of token */
+              mem_cpointer_t uid) /**< uid of token */
 {
   token ret;
 
@@ -140,6 +200,137 @@ convert_string_to_token (token_type tt, /**< token type */
   return create_token_from_lit (tt, lit);
 }
 
+/**
+ * Descriptor of a reserved word (keyword, future reserved word, null or boolean literal)
+ */
+typedef struct
+{
+  const char *word_p; /**< the word */
+  uint8_t size; /**< size of the word */
+  uint8_t type; /**< type of the word's token (token_type) */
+  uint8_t value; /**< keyword (for TOK_KEYWORD) or value (for TOK_BOOL) */
+} reserved_word_t;
+
+/**
+ * Reserved words
+ */
+static const reserved_word_t reserved_words[] =
+{
+#define RESERVED_WORD(word, type, value) { word, (uint8_t) (sizeof (word) - 1u), (uint8_t) type, (uint8_t) value }
+  RESERVED_WORD ("break", TOK_KEYWORD, KW_BREAK),
+  RESERVED_WORD ("case", TOK_KEYWORD, KW_CASE),
+  RESERVED_WORD ("catch", TOK_KEYWORD, KW_CATCH),
+  RESERVED_WORD ("class", TOK_KEYWORD, KW_CLASS),
+  RESERVED_WORD ("const", TOK_KEYWORD, KW_CONST),
+  RESERVED_WORD ("continue", TOK_KEYWORD, KW_CONTINUE),
+  RESERVED_WORD ("debugger", TOK_KEYWORD, KW_DEBUGGER),
+  RESERVED_WORD ("default", TOK_KEYWORD, KW_DEFAULT),
+  RESERVED_WORD ("delete", TOK_KEYWORD, KW_DELETE),
+  RESERVED_WORD ("do", TOK_KEYWORD, KW_DO),
+  RESERVED_WORD ("else", TOK_KEYWORD, KW_ELSE),
+  RESERVED_WORD ("enum", TOK_KEYWORD, KW_ENUM),
+  RESERVED_WORD ("export", TOK_KEYWORD, KW_EXPORT),
+  RESERVED_WORD ("extends", TOK_KEYWORD, KW_EXTENDS),
+  RESERVED_WORD ("finally", TOK_KEYWORD, KW_FINALLY),
+  RESERVED_WORD ("for", TOK_KEYWORD, KW_FOR),
+  RESERVED_WORD ("function", TOK_KEYWORD, KW_FUNCTION),
+  RESERVED_WORD ("if", TOK_KEYWORD, KW_IF),
+  RESERVED_WORD ("in", TOK_KEYWORD, KW_IN),
+  RESERVED_WORD ("instanceof", TOK_KEYWORD, KW_INSTANCEOF),
+  RESERVED_WORD ("interface", TOK_KEYWORD, KW_INTERFACE),
+  RESERVED_WORD ("import", TOK_KEYWORD, KW_IMPORT),
+  RESERVED_WORD ("implements", TOK_KEYWORD, KW_IMPLEMENTS),
+  RESERVED_WORD ("let", TOK_KEYWORD, KW_LET),
+  RESERVED_WORD ("new", TOK_KEYWORD, KW_NEW),
+  RESERVED_WORD ("package", TOK_KEYWORD, KW_PACKAGE),
+  RESERVED_WORD ("private", TOK_KEYWORD, KW_PRIVATE),
+  RESERVED_WORD ("protected", TOK_KEYWORD, KW_PROTECTED),
+  RESERVED_WORD ("public", TOK_KEYWORD, KW_PUBLIC),
+  RESERVED_WORD ("return", TOK_KEYWORD, KW_RETURN),
+  RESERVED_WORD ("static", TOK_KEYWORD, KW_STATIC),
+  RESERVED_WORD ("super", TOK_KEYWORD, KW_SUPER),
+  RESERVED_WORD ("switch", TOK_KEYWORD, KW_SWITCH),
+  RESERVED_WORD ("this", TOK_KEYWORD, KW_THIS),
+  RESERVED_WORD ("throw", TOK_KEYWORD, KW_THROW),
+  RESERVED_WORD ("try", TOK_KEYWORD, KW_TRY),
+  RESERVED_WORD ("typeof", TOK_KEYWORD, KW_TYPEOF),
+  RESERVED_WORD ("var", TOK_KEYWORD, KW_VAR),
+  RESERVED_WORD ("void", TOK_KEYWORD, KW_VOID),
+  RESERVED_WORD ("while", TOK_KEYWORD, KW_WHILE),
+  RESERVED_WORD ("with", TOK_KEYWORD, KW_WITH),
+  RESERVED_WORD ("yield", TOK_KEYWORD, KW_YIELD),
+  RESERVED_WORD ("true", TOK_BOOL, true),
+  RESERVED_WORD ("false", TOK_BOOL, false),
+  RESERVED_WORD ("null", TOK_NULL, 0)
+#undef RESERVED_WORD
+};
+
+/**
+ * Minimum and maximum sizes of reserved words
+ */
+#define RESERVED_WORD_MIN_SIZE (2u)
+#define RESERVED_WORD_MAX_SIZE (10u)
+
+/**
+ * Number of entries in the reserved words' hash table
+ */
+#define RESERVED_WORDS_HASH_TABLE_SIZE (128u)
+
+/**
+ * Perfect hash function of reserved words
+ *
+ * The function maps each of the reserved words to a distinct entry of reserved_words_hash_table,
+ * so a string is looked up with one comparison.
+ *
+ * @return hash value, that is less than RESERVED_WORDS_HASH_TABLE_SIZE
+ */
+static uint32_t
+reserved_word_hash (const lit_utf8_byte_t *str_p, /**< characters buffer */
+                    lit_utf8_size_t str_size) /**< string's size (RESERVED_WORD_MIN_SIZE or more) */
+{
+  JERRY_ASSERT (str_size >= RESERVED_WORD_MIN_SIZE);
+
+  return ((str_p[0] * 8u + str_p[1] + str_p[str_size - 1] * 52u + str_size * 11u)
+          & (RESERVED_WORDS_HASH_TABLE_SIZE - 1u));
+} /* reserved_word_hash */
+
+/**
+ * Hash table of reserved words: indices in reserved_words array (0xff marks empty entry)
+ *
+ * Note:
+ *      the table should be regenerated upon any change of reserved_words array
+ *      (see also: lexer_check_reserved_words_hash_table)
+ */
+static const uint8_t reserved_words_hash_table[RESERVED_WORDS_HASH_TABLE_SIZE] =
+{
+  0xff, 0x2c, 0xff, 0xff, 0xff, 0x06, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d,
+  0x21, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x26, 0xff, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0x18, 0xff, 0x12, 0x1b, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x09, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x2a, 0x1a, 0x0a, 0xff, 0xff, 0x23, 0xff, 0x0d, 0xff, 0x08, 0x2b, 0xff, 0x04, 0xff,
+  0x02, 0xff, 0xff, 0x1c, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x25, 0x27, 0x13, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x07, 0x05, 0xff, 0xff, 0x0b, 0xff, 0x0f, 0xff, 0x1e, 0x22, 0x1f, 0x28, 0xff, 0xff,
+  0xff, 0x20, 0x0c, 0xff, 0xff, 0x00, 0x17, 0xff, 0xff, 0xff, 0x0e, 0xff, 0x11, 0xff, 0xff, 0x16
+};
+
+#ifndef JERRY_NDEBUG
+/**
+ * Check that each reserved word is found through the hash table
+ */
+static void
+lexer_check_reserved_words_hash_table (void)
+{
+  for (uint32_t i = 0; i < sizeof (reserved_words) / sizeof (reserved_words[0]); i++)
+  {
+    const reserved_word_t *word_p = &reserved_words[i];
+
+    JERRY_ASSERT (word_p->size >= RESERVED_WORD_MIN_SIZE && word_p->size <= RESERVED_WORD_MAX_SIZE);
+    JERRY_ASSERT (reserved_words_hash_table[reserved_word_hash ((const lit_utf8_byte_t *) word_p->word_p,
+                                                                word_p->size)] == i);
+  }
+} /* lexer_check_reserved_words_hash_table */
+#endif /* !JERRY_NDEBUG */
+
 /**
  * Try to decode specified string as keyword
  *
@@ -152,74 +343,35 @@ static token
 decode_keyword (const lit_utf8_byte_t *str_p, /**< characters buffer */
                 lit_utf8_size_t str_size) /**< string's length */
 {
-  typedef struct
-  {
-    const char *keyword_p;
-    keyword keyword_id;
-  } kw_descr_t;
-
-  const kw_descr_t keywords[] =
-  {
-#define KW_DESCR(literal, keyword_id) { literal, keyword_id }
-    KW_DESCR ("break", KW_BREAK),
-    KW_DESCR ("case", KW_CASE),
-    KW_DESCR ("catch", KW_CATCH),
-    KW_DESCR ("class", KW_CLASS),
-    KW_DESCR ("const", KW_CONST),
-    KW_DESCR ("continue", KW_CONTINUE),
-    KW_DESCR ("debugger", KW_DEBUGGER),
-    KW_DESCR ("default", KW_DEFAULT),
-    KW_DESCR ("delete", KW_DELETE),
-    KW_DESCR ("do", KW_DO),
-    KW_DESCR ("else", KW_ELSE),
-    KW_DESCR ("enum", KW_ENUM),
-    KW_DESCR ("export", KW_EXPORT),
-    KW_DESCR ("extends", KW_EXTENDS),
-    KW_DESCR ("finally", KW_FINALLY),
-    KW_DESCR ("for", KW_FOR),
-    KW_DESCR ("function", KW_FUNCTION),
-    KW_DESCR ("if", KW_IF),
-    KW_DESCR ("in", KW_IN),
-    KW_DESCR ("instanceof", KW_INSTANCEOF),
-    KW_DESCR ("interface", KW_INTERFACE),
-    KW_DESCR ("import", KW_IMPORT),
-    KW_DESCR ("implements", KW_IMPLEMENTS),
-    KW_DESCR ("let", KW_LET),
-    KW_DESCR ("new", KW_NEW),
-    KW_DESCR ("package", KW_PACKAGE),
-    KW_DESCR ("private", KW_PRIVATE),
-    KW_DESCR ("protected", KW_PROTECTED),
-    KW_DESCR ("public", KW_PUBLIC),
-    KW_DESCR ("return", KW_RETURN),
-    KW_DESCR ("static", KW_STATIC),
-    KW_DESCR ("super", KW_SUPER),
-    KW_DESCR ("switch", KW_SWITCH),
-    KW_DESCR ("this", KW_THIS),
-    KW_DESCR ("throw", KW_THROW),
-    KW_DESCR ("try", KW_TRY),
-    KW_DESCR ("typeof", KW_TYPEOF),
-    KW_DESCR ("var", KW_VAR),
-    KW_DESCR ("void", KW_VOID),
-    KW_DESCR ("while", KW_WHILE),
-    KW_DESCR ("with", KW_WITH),
-    KW_DESCR ("yield", KW_YIELD)
-#undef KW_DESCR
-  };
-
-  keyword kw = KW_NONE;
-
-  for (uint32_t i = 0; i < sizeof (keywords) / sizeof (kw_descr_t); i++)
-  {
-    if (lit_compare_utf8_strings (str_p,
-                                  str_size,
-                                  (lit_utf8_byte_t *) keywords[i].keyword_p,
-                                  (lit_utf8_size_t) strlen (keywords[i].keyword_p)))
-    {
-      kw = keywords[i].keyword_id;
-      break;
-    }
+  if (str_size < RESERVED_WORD_MIN_SIZE || str_size > RESERVED_WORD_MAX_SIZE)
+  {
+    return empty_token;
+  }
+
+  uint8_t word_index = reserved_words_hash_table[reserved_word_hash (str_p, str_size)];
+
+  if (word_index == 0xff)
+  {
+    return empty_token;
+  }
+
+  const reserved_word_t *word_p = &reserved_words[word_index];
+
+  if (word_p->size != str_size
+      || memcmp (word_p->word_p, str_p, str_size) != 0)
+  {
+    return empty_token;
+  }
+
+  if (word_p->type != TOK_KEYWORD)
+  {
+    JERRY_ASSERT (word_p->type == TOK_BOOL || word_p->type == TOK_NULL);
+
+    return create_token ((token_type) word_p->type, word_p->value);
   }
 
+  keyword kw = (keyword) word_p->value;
+
   if (!strict_mode)
   {
     switch (kw)
@@ -244,29 +396,7 @@ decode_keyword (const lit_utf8_byte_t *str_p, /**< characters buffer */
     }
   }
 
-  if (kw != KW_NONE)
-  {
-    return create_token (TOK_KEYWORD, kw);
-  }
-  else
-  {
-    if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_FALSE))
-    {
-      return create_token (TOK_BOOL, false);
-    }
-    else if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_TRUE))
-    {
-      return create_token (TOK_BOOL, true);
-    }
-    else if (lit_compare_utf8_string_and_magic_string (str_p, str_size, LIT_MAGIC_STRING_NULL))
-    {
-      return create_token (TOK_NULL, 0);
-    }
-    else
-    {
-      return empty_token;
-    }
-  }
+  return create_token (TOK_KEYWORD, kw);
 } /* decode_keyword */
 
 static token
@@ -295,6 +425,230 @@ consume_char (void)
   buffer++;
 }
 
+/**
+ * Classes of characters (see also: char_classes)
+ */
+#define CHAR_CLASS_IDENTIFIER (1u << 0) /**< character of identifier, except escape sequences ([A-Za-z0-9$_]) */
+#define CHAR_CLASS_WHITESPACE (1u << 1) /**< whitespace character, except line feed */
+
+/**
+ * Classes of source code's bytes
+ */
+static const uint8_t char_classes[256] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#ifdef __SSE2__
+/**
+ * Vector of 16 bytes
+ *
+ * Operations on the vectors are compiled to SSE2 instructions (see also: GCC's vector extensions),
+ * so no intrinsics' headers are required (they are not compatible with Jerry's libc).
+ */
+typedef uint8_t sse2_bytes_t __attribute__ ((vector_size (16)));
+
+/**
+ * Per-byte results of comparisons of vectors of 16 bytes (0xff - true, 0x00 - false)
+ */
+typedef char sse2_mask_t __attribute__ ((vector_size (16)));
+
+/**
+ * Load 16 bytes
+ *
+ * @return vector of the bytes
+ */
+static sse2_bytes_t
+sse2_load_bytes (const jerry_api_char_t *bytes_p) /**< bytes (not necessarily aligned) */
+{
+  sse2_bytes_t bytes;
+  __builtin_memcpy (&bytes, bytes_p, sizeof (bytes));
+
+  return bytes;
+} /* sse2_load_bytes */
+
+/**
+ * Check which of the bytes are in the specified range
+ *
+ * @return per-byte results
+ */
+static sse2_mask_t
+sse2_bytes_in_range (sse2_bytes_t bytes, /**< bytes to check */
+                     uint8_t low, /**< lower bound of the range */
+                     uint8_t high) /**< upper bound of the range */
+{
+  return (sse2_mask_t) ((sse2_bytes_t) (bytes - low) <= (uint8_t) (high - low));
+} /* sse2_bytes_in_range */
+
+/**
+ * Get index of the first byte, for which the comparison result is false
+ *
+ * @return index of the byte (16 - if there is no such byte)
+ */
+static uint32_t
+sse2_first_mismatch (sse2_mask_t matches) /**< per-byte results */
+{
+  uint32_t mismatches = (uint32_t) ~__builtin_ia32_pmovmskb128 (matches) & 0xffffu;
+
+  return (mismatches == 0) ? 16u : (uint32_t) __builtin_ctz (mismatches);
+} /* sse2_first_mismatch */
+#endif /* __SSE2__ */
+
+/*
+ * Scanners of characters' runs
+ *
+ * The scanners skip characters, that don't require special processing, in the part of source code
+ * that is already in the buffer (processing 16 bytes at a time, if SSE2 is available),
+ * so that the lexer's per-character logic is invoked only for the characters that terminate the runs.
+ */
+
+/**
+ * Skip identifier's characters (except escape sequences)
+ *
+ * @return pointer to the first character after the run
+ */
+static const jerry_api_char_t *
+skip_identifier_chars (const jerry_api_char_t *iter_p, /**< first character to check */
+                       const jerry_api_char_t *end_p) /**< end of the source code's part, that is in the buffer */
+{
+#ifdef __SSE2__
+  while (end_p - iter_p >= 16)
+  {
+    sse2_bytes_t chars = sse2_load_bytes (iter_p);
+
+    /* setting of 0x20 bit converts upper case letters to lower case, and doesn't map other characters to letters */
+    sse2_mask_t is_letter = sse2_bytes_in_range ((sse2_bytes_t) (chars | 0x20), 'a', 'z');
+    sse2_mask_t is_digit = sse2_bytes_in_range (chars, '0', '9');
+    sse2_mask_t is_dollar_or_underscore = (sse2_mask_t) ((chars == '$') | (chars == '_'));
+
+    uint32_t index = sse2_first_mismatch (is_letter | is_digit | is_dollar_or_underscore);
+
+    if (index < 16)
+    {
+      return iter_p + index;
+    }
+
+    iter_p += 16;
+  }
+#endif /* __SSE2__ */
+
+  while (iter_p < end_p && (char_classes[*iter_p] & CHAR_CLASS_IDENTIFIER))
+  {
+    iter_p++;
+  }
+
+  return iter_p;
+} /* skip_identifier_chars */
+
+/**
+ * Skip whitespace characters, except line feed
+ *
+ * @return pointer to the first character after the run
+ */
+static const jerry_api_char_t *
+skip_whitespace_chars (const jerry_api_char_t *iter_p, /**< first character to check */
+                       const jerry_api_char_t *end_p) /**< end of the source code's part, that is in the buffer */
+{
+#ifdef __SSE2__
+  while (end_p - iter_p >= 16)
+  {
+    sse2_bytes_t chars = sse2_load_bytes (iter_p);
+
+    /* '\t', '\v', '\f', '\r' and ' ', but not '\n' */
+    sse2_mask_t is_space = ((sse2_bytes_in_range (chars, '\t', '\r') & (sse2_mask_t) (chars != '\n'))
+                            | (sse2_mask_t) (chars == ' '));
+
+    uint32_t index = sse2_first_mismatch (is_space);
+
+    if (index < 16)
+    {
+      return iter_p + index;
+    }
+
+    iter_p += 16;
+  }
+#endif /* __SSE2__ */
+
+  while (iter_p < end_p && (char_classes[*iter_p] & CHAR_CLASS_WHITESPACE))
+  {
+    iter_p++;
+  }
+
+  return iter_p;
+} /* skip_whitespace_chars */
+
+/**
+ * Skip ASCII characters, other than the specified ones and zero character
+ *
+ * @return pointer to the first of the specified characters (or zero character, or non-ASCII byte) after the run,
+ *         or end_p - if there is no such character in the buffer.
+ */
+static const jerry_api_char_t *
+skip_chars_until (const jerry_api_char_t *iter_p, /**< first character to check */
+                  const jerry_api_char_t *end_p, /**< end of the source code's part, that is in the buffer */
+                  char stop_char1, /**< first character to stop at */
+                  char stop_char2, /**< second character to stop at */
+                  char stop_char3, /**< third character to stop at */
+                  char stop_char4) /**< fourth character to stop at */
+{
+#ifdef __SSE2__
+  while (end_p - iter_p >= 16)
+  {
+    sse2_bytes_t chars = sse2_load_bytes (iter_p);
+
+    sse2_mask_t is_stop_char = (sse2_mask_t) ((chars == (uint8_t) stop_char1)
+                                              | (chars == (uint8_t) stop_char2)
+                                              | (chars == (uint8_t) stop_char3)
+                                              | (chars == (uint8_t) stop_char4)
+                                              | (chars == 0)
+                                              | (chars >= 0x80));
+
+    uint32_t index = sse2_first_mismatch (~is_stop_char);
+
+    if (index < 16)
+    {
+      return iter_p + index;
+    }
+
+    iter_p += 16;
+  }
+#endif /* __SSE2__ */
+
+  while (iter_p < end_p)
+  {
+    const char c = (char) *iter_p;
+
+    if (c == stop_char1
+        || c == stop_char2
+        || c == stop_char3
+        || c == stop_char4
+        || c == '\0'
+        || *iter_p >= 0x80)
+    {
+      break;
+    }
+
+    iter_p++;
+  }
+
+  return iter_p;
+} /* skip_chars_until */
+
 #define RETURN_PUNC_EX(TOK, NUM) \
   do \
   { \
@@ -619,8 +973,12 @@ parse_name (void)
 
   new_token ();
 
+  bool is_escape_sequence_met = false;
+
   while (true)
   {
+    buffer = skip_identifier_chars (buffer, buffer_start + buffer_size);
+
     c = (ecma_char_t) LA (0);
 
     if (!isalpha (c)
@@ -637,6 +995,8 @@ parse_name (void)
 
       if (c == '\\')
       {
+        is_escape_sequence_met = true;
+
         bool is_correct_sequence = (LA (0) == 'u');
         if (is_correct_sequence)
         {
@@ -664,9 +1024,24 @@ parse_name (void)
     }
   }
 
-  known_token = convert_string_to_token_transform_escape_seq (TOK_NAME,
-                                                              token_start,
-                                                              (size_t) (buffer - token_start));
+  if (is_escape_sequence_met)
+  {
+    known_token = convert_string_to_token_transform_escape_seq (TOK_NAME,
+                                                                token_start,
+                                                                (size_t) (buffer - token_start));
+  }
+  else
+  {
+    /* the name is taken from the source buffer as is */
+    const lit_utf8_size_t size = (lit_utf8_size_t) (buffer - token_start);
+
+    known_token = decode_keyword (token_start, size);
+
+    if (is_empty (known_token))
+    {
+      known_token = convert_string_to_token (TOK_NAME, token_start, size);
+    }
+  }
 
   token_start = NULL;
 
@@ -909,12 +1284,21 @@ parse_string (void)
   const bool is_double_quoted = (c == '"');
   const char end_char = (is_double_quoted ? '"' : '\'');
 
+  /* the string doesn't contain escape sequences and non-ASCII characters, so it is the same in the source buffer */
+  bool is_plain = true;
+
   do
   {
+    buffer = skip_chars_until (buffer, buffer_start + buffer_size, end_char, '\\', '\n', '\r');
+
     c = (ecma_char_t) LA (0);
     consume_char ();
 
-    if (c == '\0')
+    if (c >= 0x80)
+    {
+      is_plain = false;
+    }
+    else if (c == '\0')
     {
       PARSE_ERROR ("Unclosed string", token_start - buffer_start);
     }
@@ -924,6 +1308,8 @@ parse_string (void)
     }
     else if (c == '\\')
     {
+      is_plain = false;
+
       ecma_char_t nc = (ecma_char_t) LA (0);
 
       if (convert_single_escape_character (nc, NULL))
@@ -948,9 +1334,17 @@ parse_string (void)
   }
   while (c != end_char);
 
-  token ret = convert_string_to_token_transform_escape_seq (TOK_STRING,
-                                                            token_start,
-                                                            (size_t) (buffer - token_start) - 1u);
+  const size_t size = (size_t) (buffer - token_start) - 1u;
+  token ret;
+
+  if (is_plain && size != 0)
+  {
+    ret = convert_string_to_token (TOK_STRING, token_start, (lit_utf8_size_t) size);
+  }
+  else
+  {
+    ret = convert_string_to_token_transform_escape_seq (TOK_STRING, token_start, size);
+  }
 
   token_start = NULL;
 
@@ -1030,12 +1424,18 @@ parse_regexp (void)
 static void
 grobble_whitespaces (void)
 {
-  ecma_char_t c = LA (0);
-
-  while ((isspace (c) && c != '\n'))
+  while (true)
   {
+    buffer = skip_whitespace_chars (buffer, buffer_start + buffer_size);
+
+    ecma_char_t c = LA (0);
+
+    if (!isspace (c) || c == '\n')
+    {
+      break;
+    }
+
     consume_char ();
-    c = LA (0);
   }
 }
 
@@ -1063,6 +1463,8 @@ replace_comment_by_newline (void)
 
   while (true)
   {
+    buffer = skip_chars_until (buffer, buffer_start + buffer_size, (multiline ? '*' : '\n'), '\n', '\n', '\n');
+
     c = LA (0);
     if (!multiline && (c == '\n' || c == '\0'))
     {
@@ -1291,6 +1693,11 @@ lexer_next_token (void)
   {
     dump_current_line ();
   }
+  else
+  {
+    prev_token_locus = last_token_locus;
+    last_token_locus = sent_token.loc;
+  }
 
 end:
   return sent_token;
@@ -1319,6 +1726,40 @@ lexer_seek (size_t locus)
   saved_token = empty_token;
 }
 
+/**
+ * Get number of source code line, containing the last token, consumed by the parser
+ *
+ * Note:
+ *      new lines and a token, saved back with lexer_save_token, are not considered as consumed
+ *
+ * @return line number (lines are numbered starting from the first line, passed to lexer_init)
+ */
+uint32_t
+lexer_get_current_line (void)
+{
+  const bool is_token_saved = (!is_empty (saved_token) && saved_token.type != TOK_NEWLINE);
+  const locus loc = is_token_saved ? prev_token_locus : last_token_locus;
+
+  if (loc < line_cache_locus)
+  {
+    /* the lexer was moved backward (see also: lexer_seek) */
+    line_cache_locus = 0;
+    line_cache_line = first_line;
+  }
+
+  JERRY_ASSERT (loc <= buffer_size);
+
+  for (; line_cache_locus < loc; line_cache_locus++)
+  {
+    if (buffer_start[line_cache_locus] == '\n')
+    {
+      line_cache_line++;
+    }
+  }
+
+  return line_cache_line;
+} /* lexer_get_current_line */
+
 void
 lexer_locus_to_line_and_column (size_t locus, size_t *line, size_t *column)
 {
@@ -1350,11 +1791,13 @@ void
 lexer_dump_line (size_t line)
 {
   size_t l = 0;
-  for (const lit_utf8_byte_t *buf = buffer_start; *buf != '\0'; buf++)
+  const lit_utf8_byte_t *buffer_end = buffer_start + buffer_size;
+
+  for (const lit_utf8_byte_t *buf = buffer_start; buf < buffer_end && *buf != '\0'; buf++)
   {
     if (l == line)
     {
-      for (; *buf != '\n' && *buf != '\0'; buf++)
+      for (; buf < buffer_end && *buf != '\n' && *buf != '\0'; buf++)
       {
         putchar (*buf);
       }
@@ -1535,6 +1978,8 @@ lexer_are_tokens_with_same_identifier (token id1, /**< identifier token (TOK_NAM
 void
 lexer_init (const jerry_api_char_t *source, /**< script source */
             size_t source_size, /**< script source size in bytes */
+            uint32_t source_first_line, /**< number of the source's first line (1 - for a script,
+                                         *   line of the opening brace - for a lazily compiled function's body) */
             bool show_opcodes) /**< flag indicating if to dump opcodes */
 {
   empty_token.type = TOK_EMPTY;
@@ -1543,14 +1988,42 @@ lexer_init (const jerry_api_char_t *source, /**< script source */
 
   saved_token = prev_token = sent_token = empty_token;
 
+  /* previous parse could be stopped by a lexical error in the middle of a token */
+  token_start = NULL;
+
   buffer_size = source_size;
   lexer_set_source (source);
   lexer_set_strict_mode (false);
 
+  source_reader_p = NULL;
+  source_reader_user_p = NULL;
+
+  first_line = source_first_line;
+  line_cache_locus = 0;
+  line_cache_line = source_first_line;
+  last_token_locus = prev_token_locus = 0;
+
 #ifndef JERRY_NDEBUG
+  lexer_check_reserved_words_hash_table ();
+
   allow_dump_lines = show_opcodes;
 #else /* JERRY_NDEBUG */
   (void) show_opcodes;
   allow_dump_lines = false;
 #endif /* JERRY_NDEBUG */
 } /* lexer_init */
+
+/**
+ * Set reader of the source code's part, that follows the part, passed to lexer_init
+ *
+ * The reader is invoked each time the lexer reaches end of the part, read before,
+ * so the source code is read incrementally, while it is being parsed.
+ */
+void
+lexer_set_source_reader (jerry_source_reader_t reader_p, /**< reader (NULL - the whole source code
+                                                          *   is in the buffer) */
+                         void *reader_user_p) /**< user data, passed to the reader */
+{
+  source_reader_p = reader_p;
+  source_reader_user_p = reader_user_p;
+} /* lexer_set_source_reader */
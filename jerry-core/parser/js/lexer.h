@@ -162,7 +162,7 @@ typedef struct
 {
   locus loc;
   token_type type;
-  uint16_t uid;
+  mem_cpointer_t uid;
 } token;
 
 /**
@@ -170,7 +170,8 @@ typedef struct
  */
 #define TOKEN_EMPTY_INITIALIZER {0, TOK_EMPTY, 0}
 
-void lexer_init (const jerry_api_char_t *, size_t, bool);
+void lexer_init (const jerry_api_char_t *, size_t, uint32_t, bool);
+void lexer_set_source_reader (jerry_source_reader_t, void *);
 
 token lexer_next_token (void);
 void lexer_save_token (token);
@@ -178,6 +179,7 @@ token lexer_prev_token (void);
 
 void lexer_seek (locus);
 void lexer_locus_to_line_and_column (locus, size_t *, size_t *);
+uint32_t lexer_get_current_line (void);
 void lexer_dump_line (size_t);
 const char *lexer_keyword_to_string (keyword);
 const char *lexer_token_type_to_string (token_type);
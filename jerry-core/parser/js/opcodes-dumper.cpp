@@ -15,20 +15,24 @@
 
 #include "opcodes-dumper.h"
 
+#include "ecma-alloc.h"
+#include "ecma-conversion.h"
+#include "ecma-helpers.h"
+#include "ecma-number-arithmetic.h"
 #include "serializer.h"
 #include "stack.h"
 #include "syntax-errors.h"
 #include "opcodes-native-call.h"
 
-static idx_t temp_name, max_temp_name;
+static JERRY_THREAD_LOCAL wide_idx_t temp_name, max_temp_name;
 
 #define OPCODE(name) (__op__idx_##name)
 
 enum
 {
-  U8_global_size
+  U32_global_size
 };
-STATIC_STACK (U8, uint8_t)
+STATIC_STACK (U32, uint32_t)
 
 enum
 {
@@ -106,7 +110,7 @@ enum
 {
   temp_names_global_size
 };
-STATIC_STACK (temp_names, idx_t)
+STATIC_STACK (temp_names, wide_idx_t)
 
 enum
 {
@@ -114,6 +118,57 @@ enum
 };
 STATIC_STACK (reg_var_decls, opcode_counter_t)
 
+/**
+ * Description of a block of unreachable code (see also: start_dumping_unreachable_code)
+ */
+typedef struct
+{
+  opcode_counter_t jmp_oc; /**< position of the jump over the block */
+  uint32_t jumps_for_rewrite_num; /**< number of 'break' and 'continue' jumps, dumped before the block */
+} unreachable_block_t;
+
+enum
+{
+  unreachable_blocks_global_size
+};
+STATIC_STACK (unreachable_blocks, unreachable_block_t)
+
+/**
+ * Number of dumped templates of 'break' and 'continue' jumps (see also: dump_simple_or_nested_jump_for_rewrite)
+ */
+static JERRY_THREAD_LOCAL uint32_t jumps_for_rewrite_num;
+
+/**
+ * Maximum size of a string, produced by concatenation of string constants at compile-time
+ *
+ * Note:
+ *      the operands' literals are not removed from literal storage, so folding of long strings
+ *      would only increase size of the storage
+ */
+#define DUMPER_FOLDED_STRING_MAX_SIZE (64u)
+
+/**
+ * Result of a folded operation, which value requires a literal (see also: dump_constant_assignment)
+ *
+ * Assignment of the result is dumped as assignment of zero small integer, and the literal is created only when
+ * the assignment is not replaced by folding of a following operation (see also: dumper_flush_folded_constant),
+ * so intermediate results of constant expressions are not registered in literal storage.
+ */
+typedef struct
+{
+  bool is_pending; /**< is there an assignment, waiting for the literal */
+  bool is_string; /**< is the value a string (or a number) */
+  opcode_counter_t oc; /**< position of the assignment in the current scope */
+  ecma_number_t num; /**< value (if it is a number) */
+  lit_utf8_size_t str_size; /**< size of the value (if it is a string) */
+  lit_utf8_byte_t str_buffer[DUMPER_FOLDED_STRING_MAX_SIZE]; /**< value (if it is a string) */
+} folded_constant_t;
+
+/**
+ * Folded constant, which literal is not created yet
+ */
+static JERRY_THREAD_LOCAL folded_constant_t folded_constant;
+
 /**
  * Reset counter of register variables allocator
  * to identifier of first general register
@@ -129,12 +184,18 @@ reset_temp_name (void)
  *
  * @return identifier of the allocated variable
  */
-static idx_t
+static wide_idx_t
 next_temp_name (void)
 {
-  idx_t next_reg = temp_name++;
+  if (temp_name == OPCODE_REG_GENERAL_LAST + 1u)
+  {
+    /* registers, that don't fit into idx_t, are encoded as wide operands */
+    temp_name = OPCODE_REG_WIDE_FIRST;
+  }
 
-  if (next_reg > OPCODE_REG_GENERAL_LAST)
+  wide_idx_t next_reg = temp_name++;
+
+  if (next_reg > OPCODE_REG_WIDE_LAST)
   {
     /*
      * FIXME:
@@ -182,36 +243,12 @@ create_op_meta_010 (opcode_t op, lit_cpointer_t lit_id)
   return create_op_meta (op, NOT_A_LITERAL, lit_id, NOT_A_LITERAL);
 }
 
-static op_meta
-create_op_meta_011 (opcode_t op, lit_cpointer_t lit_id2, lit_cpointer_t lit_id3)
-{
-  return create_op_meta (op, NOT_A_LITERAL, lit_id2, lit_id3);
-}
-
 static op_meta
 create_op_meta_100 (opcode_t op, lit_cpointer_t lit_id)
 {
   return create_op_meta (op, lit_id, NOT_A_LITERAL, NOT_A_LITERAL);
 }
 
-static op_meta
-create_op_meta_101 (opcode_t op, lit_cpointer_t lit_id1, lit_cpointer_t lit_id3)
-{
-  return create_op_meta (op, lit_id1, NOT_A_LITERAL, lit_id3);
-}
-
-static op_meta
-create_op_meta_110 (opcode_t op, lit_cpointer_t lit_id1, lit_cpointer_t lit_id2)
-{
-  return create_op_meta (op, lit_id1, lit_id2, NOT_A_LITERAL);
-}
-
-static op_meta
-create_op_meta_111 (opcode_t op, lit_cpointer_t lit_id1, lit_cpointer_t lit_id2, lit_cpointer_t lit_id3)
-{
-  return create_op_meta (op, lit_id1, lit_id2, lit_id3);
-}
-
 static operand
 tmp_operand (void)
 {
@@ -263,53 +300,181 @@ is_native_call (operand obj)
   return name_to_native_call_id (obj) < OPCODE_NATIVE_CALL__COUNT;
 }
 
+/**
+ * Set value of instruction's operand, storing the value in the op_meta's literal identifier field
+ * of the operand, if the value doesn't fit into idx_t (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * Note:
+ *      the value is moved to the wide operands table upon generation of byte-code
+ *      (see also: scopes_tree_get_wide_operands_mask)
+ */
+static void
+set_op_meta_wide_value (op_meta *om_p, /**< instruction */
+                        uint8_t operand_index, /**< index of the operand */
+                        wide_idx_t value) /**< value */
+{
+  JERRY_ASSERT (operand_index < 3);
+
+  raw_opcode *raw_p = (raw_opcode *) &om_p->op;
+
+  if (value <= UINT8_MAX && !OPCODE_IS_WIDE_OPERAND (value))
+  {
+    raw_p->uids[operand_index + 1] = (idx_t) value;
+    om_p->lit_id[operand_index] = NOT_A_LITERAL;
+  }
+  else
+  {
+    raw_p->uids[operand_index + 1] = (idx_t) (OPCODE_WIDE_OPERAND_FIRST + operand_index);
+    om_p->lit_id[operand_index].packed_value = value;
+  }
+} /* set_op_meta_wide_value */
+
+/**
+ * Get value of instruction's operand, set with set_op_meta_wide_value
+ *
+ * @return value of the operand
+ */
+static wide_idx_t
+get_op_meta_wide_value (op_meta om, /**< instruction */
+                        uint8_t operand_index) /**< index of the operand */
+{
+  JERRY_ASSERT (operand_index < 3);
+
+  const raw_opcode *raw_p = (const raw_opcode *) &om.op;
+  const idx_t operand = raw_p->uids[operand_index + 1];
+
+  if (OPCODE_IS_WIDE_OPERAND (operand))
+  {
+    return (wide_idx_t) om.lit_id[operand_index].packed_value;
+  }
+  else
+  {
+    return operand;
+  }
+} /* get_op_meta_wide_value */
+
+/**
+ * Set instruction's operand, that refers to a literal or to a register
+ */
+static void
+set_op_meta_operand (op_meta *om_p, /**< instruction */
+                     uint8_t operand_index, /**< index of the operand */
+                     operand op) /**< operand */
+{
+  if (op.type == OPERAND_LITERAL)
+  {
+    raw_opcode *raw_p = (raw_opcode *) &om_p->op;
+
+    raw_p->uids[operand_index + 1] = LITERAL_TO_REWRITE;
+    om_p->lit_id[operand_index] = op.data.lit_id;
+  }
+  else
+  {
+    JERRY_ASSERT (op.type == OPERAND_TMP);
+
+    set_op_meta_wide_value (om_p, operand_index, op.data.uid);
+  }
+} /* set_op_meta_operand */
+
+/**
+ * Get instruction's operand, that refers to a literal or to a register
+ *
+ * @return operand
+ */
+static operand
+get_op_meta_operand (op_meta om, /**< instruction */
+                     uint8_t operand_index) /**< index of the operand */
+{
+  const raw_opcode *raw_p = (const raw_opcode *) &om.op;
+
+  operand ret;
+
+  if (raw_p->uids[operand_index + 1] == LITERAL_TO_REWRITE)
+  {
+    JERRY_ASSERT (om.lit_id[operand_index].packed_value != MEM_CP_NULL);
+
+    ret.type = OPERAND_LITERAL;
+    ret.data.lit_id = om.lit_id[operand_index];
+  }
+  else
+  {
+    ret.type = OPERAND_TMP;
+    ret.data.uid = get_op_meta_wide_value (om, operand_index);
+  }
+
+  return ret;
+} /* get_op_meta_operand */
+
+/**
+ * Set pair of instruction's operands, representing an opcode counter (see also: calc_opcode_counter_from_idx_idx)
+ */
+static void
+set_op_meta_counter (op_meta *om_p, /**< instruction */
+                     uint8_t operand_index, /**< index of the pair's first operand */
+                     opcode_counter_t oc) /**< opcode counter */
+{
+  JERRY_ASSERT (operand_index < 2);
+  JERRY_ASSERT (oc <= MAX_OPCODES);
+
+  raw_opcode *raw_p = (raw_opcode *) &om_p->op;
+
+  const idx_t high_idx = (idx_t) (oc >> JERRY_BITSINBYTE);
+
+  if ((oc >> JERRY_BITSINBYTE) < OPCODE_WIDE_OPERAND_FIRST)
+  {
+    raw_p->uids[operand_index + 1] = high_idx;
+    raw_p->uids[operand_index + 2] = (idx_t) (oc & ((1u << JERRY_BITSINBYTE) - 1u));
+    om_p->lit_id[operand_index] = NOT_A_LITERAL;
+    om_p->lit_id[operand_index + 1] = NOT_A_LITERAL;
+
+    JERRY_ASSERT (oc == calc_opcode_counter_from_idx_idx (raw_p->uids[operand_index + 1],
+                                                          raw_p->uids[operand_index + 2]));
+  }
+  else
+  {
+    const uint32_t wide_idx_width = sizeof (wide_idx_t) * JERRY_BITSINBYTE;
+
+    raw_p->uids[operand_index + 1] = (idx_t) (OPCODE_WIDE_OPERAND_FIRST + operand_index);
+    raw_p->uids[operand_index + 2] = (idx_t) (OPCODE_WIDE_OPERAND_FIRST + operand_index + 1);
+    om_p->lit_id[operand_index].packed_value = (wide_idx_t) (oc >> wide_idx_width);
+    om_p->lit_id[operand_index + 1].packed_value = (wide_idx_t) (oc & ((1u << wide_idx_width) - 1u));
+  }
+} /* set_op_meta_counter */
+
+/**
+ * Get opcode counter, set with set_op_meta_counter
+ *
+ * @return opcode counter
+ */
+static opcode_counter_t
+get_op_meta_counter (op_meta om, /**< instruction */
+                     uint8_t operand_index) /**< index of the pair's first operand */
+{
+  JERRY_ASSERT (operand_index < 2);
+
+  const raw_opcode *raw_p = (const raw_opcode *) &om.op;
+
+  if (OPCODE_IS_WIDE_OPERAND (raw_p->uids[operand_index + 1]))
+  {
+    const uint32_t wide_idx_width = sizeof (wide_idx_t) * JERRY_BITSINBYTE;
+
+    return (opcode_counter_t) (((uint32_t) om.lit_id[operand_index].packed_value << wide_idx_width)
+                               | om.lit_id[operand_index + 1].packed_value);
+  }
+  else
+  {
+    return calc_opcode_counter_from_idx_idx (raw_p->uids[operand_index + 1], raw_p->uids[operand_index + 2]);
+  }
+} /* get_op_meta_counter */
+
 static op_meta
 create_op_meta_for_res_and_obj (opcode_t (*getop) (idx_t, idx_t, idx_t), operand *res, operand *obj)
 {
   JERRY_ASSERT (obj != NULL);
   JERRY_ASSERT (res != NULL);
-  op_meta ret;
-  switch (obj->type)
-  {
-    case OPERAND_TMP:
-    {
-      switch (res->type)
-      {
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop (res->data.uid, obj->data.uid, INVALID_VALUE);
-          ret = create_op_meta_000 (opcode);
-          break;
-        }
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop (LITERAL_TO_REWRITE, obj->data.uid, INVALID_VALUE);
-          ret = create_op_meta_100 (opcode, res->data.lit_id);
-          break;
-        }
-      }
-      break;
-    }
-    case OPERAND_LITERAL:
-    {
-      switch (res->type)
-      {
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop (res->data.uid, LITERAL_TO_REWRITE, INVALID_VALUE);
-          ret = create_op_meta_010 (opcode, obj->data.lit_id);
-          break;
-        }
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE, INVALID_VALUE);
-          ret = create_op_meta_110 (opcode, res->data.lit_id, obj->data.lit_id);
-          break;
-        }
-      }
-      break;
-    }
-  }
+  op_meta ret = create_op_meta_000 (getop (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&ret, 0, *res);
+  set_op_meta_operand (&ret, 1, *obj);
   return ret;
 }
 
@@ -317,22 +482,8 @@ static op_meta
 create_op_meta_for_obj (opcode_t (*getop) (idx_t, idx_t), operand *obj)
 {
   JERRY_ASSERT (obj != NULL);
-  op_meta res;
-  switch (obj->type)
-  {
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop (obj->data.uid, INVALID_VALUE);
-      res = create_op_meta_000 (opcode);
-      break;
-    }
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop (LITERAL_TO_REWRITE, INVALID_VALUE);
-      res = create_op_meta_100 (opcode, obj->data.lit_id);
-      break;
-    }
-  }
+  op_meta res = create_op_meta_000 (getop (INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&res, 0, *obj);
   return res;
 }
 
@@ -340,22 +491,8 @@ static op_meta
 create_op_meta_for_native_call (operand res, operand obj)
 {
   JERRY_ASSERT (is_native_call (obj));
-  op_meta ret;
-  switch (res.type)
-  {
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_native_call (res.data.uid, name_to_native_call_id (obj), INVALID_VALUE);
-      ret = create_op_meta_000 (opcode);
-      break;
-    }
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_native_call (LITERAL_TO_REWRITE, name_to_native_call_id (obj), INVALID_VALUE);
-      ret = create_op_meta_100 (opcode, res.data.lit_id);
-      break;
-    }
-  }
+  op_meta ret = create_op_meta_000 (getop_native_call (INVALID_VALUE, name_to_native_call_id (obj), INVALID_VALUE));
+  set_op_meta_operand (&ret, 0, res);
   return ret;
 }
 
@@ -402,16 +539,6 @@ create_op_meta_for_vlt (varg_list_type vlt, operand *res, operand *obj)
   return ret;
 }
 
-static void
-split_opcode_counter (opcode_counter_t oc, idx_t *id1, idx_t *id2)
-{
-  JERRY_ASSERT (id1 != NULL);
-  JERRY_ASSERT (id2 != NULL);
-  *id1 = (idx_t) (oc >> JERRY_BITSINBYTE);
-  *id2 = (idx_t) (oc & ((1 << JERRY_BITSINBYTE) - 1));
-  JERRY_ASSERT (oc == calc_opcode_counter_from_idx_idx (*id1, *id2));
-}
-
 static op_meta
 last_dumped_op_meta (void)
 {
@@ -421,217 +548,35 @@ last_dumped_op_meta (void)
 static void
 dump_single_address (opcode_t (*getop) (idx_t), operand op)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop (LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop (op.data.uid);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop (INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 static void
 dump_double_address (opcode_t (*getop) (idx_t, idx_t), operand res, operand obj)
 {
-  switch (res.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      switch (obj.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE);
-          serializer_dump_op_meta (create_op_meta_110 (opcode, res.data.lit_id, obj.data.lit_id));
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop (LITERAL_TO_REWRITE, obj.data.uid);
-          serializer_dump_op_meta (create_op_meta_100 (opcode, res.data.lit_id));
-          break;
-        }
-      }
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      switch (obj.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop (res.data.uid, LITERAL_TO_REWRITE);
-          serializer_dump_op_meta (create_op_meta_010 (opcode, obj.data.lit_id));
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop (res.data.uid, obj.data.uid);
-          serializer_dump_op_meta (create_op_meta_000 (opcode));
-          break;
-        }
-      }
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop (INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, res);
+  set_op_meta_operand (&om, 1, obj);
+  serializer_dump_op_meta (om);
 }
 
 static void
 dump_triple_address (opcode_t (*getop) (idx_t, idx_t, idx_t), operand res, operand lhs, operand rhs)
 {
-  switch (res.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      switch (lhs.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          switch (rhs.type)
-          {
-            case OPERAND_LITERAL:
-            {
-              const opcode_t opcode = getop (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE, LITERAL_TO_REWRITE);
-              serializer_dump_op_meta (create_op_meta_111 (opcode, res.data.lit_id, lhs.data.lit_id, rhs.data.lit_id));
-              break;
-            }
-            case OPERAND_TMP:
-            {
-              const opcode_t opcode = getop (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE, rhs.data.uid);
-              serializer_dump_op_meta (create_op_meta_110 (opcode, res.data.lit_id, lhs.data.lit_id));
-              break;
-            }
-          }
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          switch (rhs.type)
-          {
-            case OPERAND_LITERAL:
-            {
-              const opcode_t opcode = getop (LITERAL_TO_REWRITE, lhs.data.uid, LITERAL_TO_REWRITE);
-              serializer_dump_op_meta (create_op_meta_101 (opcode, res.data.lit_id, rhs.data.lit_id));
-              break;
-            }
-            case OPERAND_TMP:
-            {
-              const opcode_t opcode = getop (LITERAL_TO_REWRITE, lhs.data.uid, rhs.data.uid);
-              serializer_dump_op_meta (create_op_meta_100 (opcode, res.data.lit_id));
-              break;
-            }
-          }
-          break;
-        }
-      }
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      switch (lhs.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          switch (rhs.type)
-          {
-            case OPERAND_LITERAL:
-            {
-              const opcode_t opcode = getop (res.data.uid, LITERAL_TO_REWRITE, LITERAL_TO_REWRITE);
-              serializer_dump_op_meta (create_op_meta_011 (opcode, lhs.data.lit_id, rhs.data.lit_id));
-              break;
-            }
-            case OPERAND_TMP:
-            {
-              const opcode_t opcode = getop (res.data.uid, LITERAL_TO_REWRITE, rhs.data.uid);
-              serializer_dump_op_meta (create_op_meta_010 (opcode, lhs.data.lit_id));
-              break;
-            }
-          }
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          switch (rhs.type)
-          {
-            case OPERAND_LITERAL:
-            {
-              const opcode_t opcode = getop (res.data.uid, lhs.data.uid, LITERAL_TO_REWRITE);
-              serializer_dump_op_meta (create_op_meta_001 (opcode, rhs.data.lit_id));
-              break;
-            }
-            case OPERAND_TMP:
-            {
-              const opcode_t opcode = getop (res.data.uid, lhs.data.uid, rhs.data.uid);
-              serializer_dump_op_meta (create_op_meta_000 (opcode));
-              break;
-            }
-          }
-          break;
-        }
-      }
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, res);
+  set_op_meta_operand (&om, 1, lhs);
+  set_op_meta_operand (&om, 2, rhs);
+  serializer_dump_op_meta (om);
 }
 
 static void
 dump_prop_setter_op_meta (op_meta last, operand op)
 {
   JERRY_ASSERT (last.op.op_idx == OPCODE (prop_getter));
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_prop_setter (last.op.data.prop_getter.obj,
-                                                 last.op.data.prop_getter.prop,
-                                                 LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_111 (opcode, last.lit_id[1], last.lit_id[2], op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_prop_setter (last.op.data.prop_getter.obj,
-                                                 last.op.data.prop_getter.prop,
-                                                 op.data.uid);
-      serializer_dump_op_meta (create_op_meta_110 (opcode, last.lit_id[1], last.lit_id[2]));
-      break;
-    }
-  }
-}
-
-static operand
-create_operand_from_tmp_and_lit (idx_t tmp, lit_cpointer_t lit_id)
-{
-  if (tmp != LITERAL_TO_REWRITE)
-  {
-    JERRY_ASSERT (lit_id.packed_value == MEM_CP_NULL);
-
-    operand ret;
-
-    ret.type = OPERAND_TMP;
-    ret.data.uid = tmp;
-
-    return ret;
-  }
-  else
-  {
-    JERRY_ASSERT (lit_id.packed_value != MEM_CP_NULL);
-
-    operand ret;
-
-    ret.type = OPERAND_LITERAL;
-    ret.data.lit_id = lit_id;
-
-    return ret;
-  }
+  dump_triple_address (getop_prop_setter, get_op_meta_operand (last, 1), get_op_meta_operand (last, 2), op);
 }
 
 static operand
@@ -639,8 +584,8 @@ dump_triple_address_and_prop_setter_res (void (*dumper) (operand, operand, opera
                                          op_meta last, operand op)
 {
   JERRY_ASSERT (last.op.op_idx == OPCODE (prop_getter));
-  const operand obj = create_operand_from_tmp_and_lit (last.op.data.prop_getter.obj, last.lit_id[1]);
-  const operand prop = create_operand_from_tmp_and_lit (last.op.data.prop_getter.prop, last.lit_id[2]);
+  const operand obj = get_op_meta_operand (last, 1);
+  const operand prop = get_op_meta_operand (last, 2);
   const operand tmp = dump_prop_getter_res (obj, prop);
   dumper (tmp, tmp, op);
   dump_prop_setter (obj, prop, tmp);
@@ -812,27 +757,11 @@ dumper_is_eval_literal (operand obj) /**< byte-code operand */
 void
 dump_boolean_assignment (operand op, bool is_true)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE,
-                                                OPCODE_ARG_TYPE_SIMPLE,
-                                                is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
-      const op_meta om = create_op_meta_100 (opcode, op.data.lit_id);
-      serializer_dump_op_meta (om);
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid,
-                                                OPCODE_ARG_TYPE_SIMPLE,
-                                                is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
-      const op_meta om = create_op_meta_000 (opcode);
-      serializer_dump_op_meta (om);
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE,
+                                                     OPCODE_ARG_TYPE_SIMPLE,
+                                                     is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -846,21 +775,10 @@ dump_boolean_assignment_res (bool is_true)
 void
 dump_string_assignment (operand op, lit_cpointer_t lit_id)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE, OPCODE_ARG_TYPE_STRING, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_101 (opcode, op.data.lit_id, lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid, OPCODE_ARG_TYPE_STRING, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_001 (opcode, lit_id));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_001 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_STRING, LITERAL_TO_REWRITE),
+                                   lit_id);
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -874,21 +792,10 @@ dump_string_assignment_res (lit_cpointer_t lit_id)
 void
 dump_number_assignment (operand op, lit_cpointer_t lit_id)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE, OPCODE_ARG_TYPE_NUMBER, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_101 (opcode, op.data.lit_id, lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid, OPCODE_ARG_TYPE_NUMBER, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_001 (opcode, lit_id));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_001 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_NUMBER, LITERAL_TO_REWRITE),
+                                   lit_id);
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -902,21 +809,10 @@ dump_number_assignment_res (lit_cpointer_t lit_id)
 void
 dump_regexp_assignment (operand op, lit_cpointer_t lit_id)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE, OPCODE_ARG_TYPE_REGEXP, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_101 (opcode, op.data.lit_id, lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid, OPCODE_ARG_TYPE_REGEXP, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_001 (opcode, lit_id));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_001 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_REGEXP, LITERAL_TO_REWRITE),
+                                   lit_id);
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -930,21 +826,9 @@ dump_regexp_assignment_res (lit_cpointer_t lit_id)
 void
 dump_smallint_assignment (operand op, idx_t uid)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE, OPCODE_ARG_TYPE_SMALLINT, uid);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid, OPCODE_ARG_TYPE_SMALLINT, uid);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_SMALLINT, uid));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -958,23 +842,11 @@ dump_smallint_assignment_res (idx_t uid)
 void
 dump_undefined_assignment (operand op)
 {
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE,
-                                                OPCODE_ARG_TYPE_SIMPLE,
-                                                ECMA_SIMPLE_VALUE_UNDEFINED);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_assignment (op.data.uid, OPCODE_ARG_TYPE_SIMPLE, ECMA_SIMPLE_VALUE_UNDEFINED);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE,
+                                                     OPCODE_ARG_TYPE_SIMPLE,
+                                                     ECMA_SIMPLE_VALUE_UNDEFINED));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 operand
@@ -988,96 +860,576 @@ dump_undefined_assignment_res (void)
 void
 dump_null_assignment (operand op)
 {
-  switch (op.type)
+  op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_SIMPLE, ECMA_SIMPLE_VALUE_NULL));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
+}
+
+operand
+dump_null_assignment_res (void)
+{
+  operand op = tmp_operand ();
+  dump_null_assignment (op);
+  return op;
+}
+
+void
+dump_variable_assignment (operand res, operand var)
+{
+  op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_VARIABLE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, res);
+  set_op_meta_operand (&om, 2, var);
+  serializer_dump_op_meta (om);
+}
+
+operand
+dump_variable_assignment_res (operand var)
+{
+  operand op = tmp_operand ();
+  dump_variable_assignment (op, var);
+  return op;
+}
+
+/**
+ * Get constant value, assigned to the specified temporary register by the instruction at the specified position
+ *
+ * @return true - if the instruction is an assignment of a number, a string or a simple value to the register
+ *                (the value is returned through value_p and should be freed with ecma_free_value),
+ *         false - otherwise.
+ */
+static bool
+get_constant_assignment_value (opcode_counter_t oc, /**< position of the instruction */
+                               operand op, /**< register */
+                               ecma_value_t *value_p) /**< out: the assigned value */
+{
+  if (op.type != OPERAND_TMP
+      || op.data.uid < OPCODE_REG_GENERAL_FIRST)
   {
-    case OPERAND_LITERAL:
+    return false;
+  }
+
+  const op_meta om = serializer_get_op_meta (oc);
+
+  if (om.op.op_idx != OPCODE (assignment))
+  {
+    return false;
+  }
+
+  const operand dst = get_op_meta_operand (om, 0);
+  if (dst.type != OPERAND_TMP
+      || dst.data.uid != op.data.uid)
+  {
+    return false;
+  }
+
+  if (folded_constant.is_pending && folded_constant.oc == oc)
+  {
+    if (folded_constant.is_string)
+    {
+      *value_p = ecma_make_string_value (ecma_new_ecma_string_from_utf8 (folded_constant.str_buffer,
+                                                                         folded_constant.str_size));
+    }
+    else
+    {
+      ecma_number_t *num_p = ecma_alloc_number ();
+      *num_p = folded_constant.num;
+
+      *value_p = ecma_make_number_value (num_p);
+    }
+
+    return true;
+  }
+
+  const opcode_arg_type_operand type = (opcode_arg_type_operand) om.op.data.assignment.type_value_right;
+  const idx_t value = om.op.data.assignment.value_right;
+
+  switch (type)
+  {
+    case OPCODE_ARG_TYPE_SIMPLE:
+    {
+      *value_p = ecma_make_simple_value ((ecma_simple_value_t) value);
+      return true;
+    }
+    case OPCODE_ARG_TYPE_SMALLINT:
+    case OPCODE_ARG_TYPE_SMALLINT_NEGATE:
+    case OPCODE_ARG_TYPE_NUMBER:
+    case OPCODE_ARG_TYPE_NUMBER_NEGATE:
+    {
+      ecma_number_t *num_p = ecma_alloc_number ();
+
+      if (type == OPCODE_ARG_TYPE_SMALLINT
+          || type == OPCODE_ARG_TYPE_SMALLINT_NEGATE)
+      {
+        *num_p = (ecma_number_t) value;
+      }
+      else
+      {
+        *num_p = lit_charset_literal_get_number (lit_get_literal_by_cp (om.lit_id[2]));
+      }
+
+      if (type == OPCODE_ARG_TYPE_SMALLINT_NEGATE
+          || type == OPCODE_ARG_TYPE_NUMBER_NEGATE)
+      {
+        *num_p = ecma_number_negate (*num_p);
+      }
+
+      *value_p = ecma_make_number_value (num_p);
+      return true;
+    }
+    case OPCODE_ARG_TYPE_STRING:
+    {
+      *value_p = ecma_make_string_value (ecma_new_ecma_string_from_lit_cp (om.lit_id[2]));
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* get_constant_assignment_value */
+
+/**
+ * Convert primitive constant value to number (ECMA-262 v5, 9.3)
+ *
+ * @return number
+ */
+static ecma_number_t
+get_constant_number (ecma_value_t value) /**< primitive value */
+{
+  ecma_completion_value_t num_completion = ecma_op_to_number (value);
+  JERRY_ASSERT (ecma_is_completion_value_normal (num_completion));
+
+  const ecma_number_t num = *ecma_get_number_from_value (ecma_get_completion_value_value (num_completion));
+
+  ecma_free_completion_value (num_completion);
+
+  return num;
+} /* get_constant_number */
+
+/**
+ * Dump assignment of a constant value
+ */
+static void
+dump_constant_assignment (operand res, /**< destination */
+                          ecma_value_t value) /**< number, string or boolean value */
+{
+  if (ecma_is_value_number (value))
+  {
+    const ecma_number_t num = *ecma_get_number_from_value (value);
+
+    if (!ecma_number_is_nan (num))
     {
-      const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE,
-                                                OPCODE_ARG_TYPE_SIMPLE,
-                                                ECMA_SIMPLE_VALUE_NULL);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
+      const bool is_negative = ecma_number_is_negative (num);
+      const ecma_number_t abs_num = is_negative ? ecma_number_negate (num) : num;
+
+      if (abs_num <= UINT8_MAX
+          && abs_num == (ecma_number_t) (idx_t) abs_num)
+      {
+        if (!is_negative)
+        {
+          dump_smallint_assignment (res, (idx_t) abs_num);
+          return;
+        }
+
+        /* negative zero is represented in the same way as other negative small integers,
+         * because lookup of number literal, equal to zero, matches both zeros */
+        op_meta om = create_op_meta_000 (getop_assignment (INVALID_VALUE,
+                                                           OPCODE_ARG_TYPE_SMALLINT_NEGATE,
+                                                           (idx_t) abs_num));
+        set_op_meta_operand (&om, 0, res);
+        serializer_dump_op_meta (om);
+        return;
+      }
+    }
+
+    dumper_flush_folded_constant ();
+
+    folded_constant.is_string = false;
+    folded_constant.num = num;
+  }
+  else if (ecma_is_value_string (value))
+  {
+    dumper_flush_folded_constant ();
+
+    ecma_string_t *str_p = ecma_get_string_from_value (value);
+
+    const lit_utf8_size_t size = ecma_string_get_size (str_p);
+    JERRY_ASSERT (size <= sizeof (folded_constant.str_buffer));
+
+    ssize_t sz = ecma_string_to_utf8_string (str_p,
+                                             folded_constant.str_buffer,
+                                             (ssize_t) sizeof (folded_constant.str_buffer));
+    JERRY_ASSERT (sz == (ssize_t) size);
+
+    folded_constant.is_string = true;
+    folded_constant.str_size = size;
+  }
+  else
+  {
+    dump_boolean_assignment (res, ecma_is_value_true (value));
+    return;
+  }
+
+  folded_constant.is_pending = true;
+  folded_constant.oc = serializer_get_current_opcode_counter ();
+
+  dump_smallint_assignment (res, 0);
+} /* dump_constant_assignment */
+
+/**
+ * Change writing position of the current scope, dropping the folded constant's assignment,
+ * if it is removed (see also: folded_constant_t)
+ */
+static void
+dumper_set_writing_position (opcode_counter_t oc) /**< new writing position */
+{
+  if (folded_constant.is_pending && folded_constant.oc >= oc)
+  {
+    folded_constant.is_pending = false;
+  }
+
+  serializer_set_writing_position (oc);
+} /* dumper_set_writing_position */
+
+/**
+ * Create literal for the folded constant, which assignment was dumped to the current scope,
+ * and change the assignment to refer to the literal (see also: folded_constant_t)
+ *
+ * Note:
+ *      should be called before the current scope is changed, or its byte-code is finished
+ */
+void
+dumper_flush_folded_constant (void)
+{
+  if (!folded_constant.is_pending)
+  {
+    return;
+  }
+
+  folded_constant.is_pending = false;
+
+  const operand res = get_op_meta_operand (serializer_get_op_meta (folded_constant.oc), 0);
+  op_meta om;
+
+  if (folded_constant.is_string)
+  {
+    literal_t lit = lit_find_or_create_literal_from_utf8_string (folded_constant.str_buffer,
+                                                                 folded_constant.str_size);
+    om = create_op_meta_001 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_STRING, LITERAL_TO_REWRITE),
+                             lit_cpointer_t::compress (lit));
+  }
+  else
+  {
+    literal_t lit = lit_find_or_create_literal_from_num (folded_constant.num);
+    om = create_op_meta_001 (getop_assignment (INVALID_VALUE, OPCODE_ARG_TYPE_NUMBER, LITERAL_TO_REWRITE),
+                             lit_cpointer_t::compress (lit));
+  }
+
+  set_op_meta_operand (&om, 0, res);
+  serializer_rewrite_op_meta (folded_constant.oc, om);
+} /* dumper_flush_folded_constant */
+
+/**
+ * Concatenate string representations of two primitive constant values (ECMA-262 v5, 11.6.1, step 7)
+ *
+ * @return true - if the concatenation was performed (the result is returned through res_value_p,
+ *                and should be freed with ecma_free_value),
+ *         false - if the result is too long to be stored as a literal (see also: DUMPER_FOLDED_STRING_MAX_SIZE).
+ */
+static bool
+fold_string_concatenation (ecma_value_t left_value, /**< left primitive value */
+                           ecma_value_t right_value, /**< right primitive value */
+                           ecma_value_t *res_value_p) /**< out: result */
+{
+  ecma_completion_value_t left_str_completion = ecma_op_to_string (left_value);
+  ecma_completion_value_t right_str_completion = ecma_op_to_string (right_value);
+  JERRY_ASSERT (ecma_is_completion_value_normal (left_str_completion)
+                && ecma_is_completion_value_normal (right_str_completion));
+
+  ecma_string_t *left_str_p = ecma_get_string_from_value (ecma_get_completion_value_value (left_str_completion));
+  ecma_string_t *right_str_p = ecma_get_string_from_value (ecma_get_completion_value_value (right_str_completion));
+
+  bool is_folded = false;
+
+  if (ecma_string_get_size (left_str_p) + ecma_string_get_size (right_str_p) <= DUMPER_FOLDED_STRING_MAX_SIZE)
+  {
+    *res_value_p = ecma_make_string_value (ecma_concat_ecma_strings (left_str_p, right_str_p));
+    is_folded = true;
+  }
+
+  ecma_free_completion_value (right_str_completion);
+  ecma_free_completion_value (left_str_completion);
+
+  return is_folded;
+} /* fold_string_concatenation */
+
+/**
+ * Perform arithmetic, bitwise or string concatenation operation on primitive constant values
+ *
+ * Note:
+ *      the same routines are used as upon the operation's execution (see also: opfunc_addition,
+ *      do_number_arithmetic, do_number_bitwise_logic), so results of folded operations are the same
+ *      as results of the corresponding non-folded operations.
+ *
+ * @return true - if the operation was performed (the result is returned through res_value_p,
+ *                and should be freed with ecma_free_value),
+ *         false - otherwise.
+ */
+static bool
+fold_binary_operation (idx_t op_idx, /**< opcode of the operation */
+                       ecma_value_t left_value, /**< left primitive value */
+                       ecma_value_t right_value, /**< right primitive value */
+                       ecma_value_t *res_value_p) /**< out: result */
+{
+  if (op_idx == OPCODE (addition)
+      && (ecma_is_value_string (left_value) || ecma_is_value_string (right_value)))
+  {
+    return fold_string_concatenation (left_value, right_value, res_value_p);
+  }
+
+  const ecma_number_t num_left = get_constant_number (left_value);
+  const ecma_number_t num_right = get_constant_number (right_value);
+
+  const int32_t left_int32 = ecma_number_to_int32 (num_left);
+  const uint32_t left_uint32 = ecma_number_to_uint32 (num_left);
+  const uint32_t right_uint32 = ecma_number_to_uint32 (num_right);
+
+  ecma_number_t *res_p = ecma_alloc_number ();
+
+  switch (op_idx)
+  {
+    case OPCODE (addition):
+    {
+      *res_p = ecma_number_add (num_left, num_right);
       break;
     }
-    case OPERAND_TMP:
+    case OPCODE (substraction):
+    {
+      *res_p = ecma_number_substract (num_left, num_right);
+      break;
+    }
+    case OPCODE (multiplication):
+    {
+      *res_p = ecma_number_multiply (num_left, num_right);
+      break;
+    }
+    case OPCODE (division):
+    {
+      *res_p = ecma_number_divide (num_left, num_right);
+      break;
+    }
+    case OPCODE (remainder):
+    {
+      *res_p = ecma_op_number_remainder (num_left, num_right);
+      break;
+    }
+    case OPCODE (b_and):
+    {
+      *res_p = ecma_int32_to_number ((int32_t) (left_uint32 & right_uint32));
+      break;
+    }
+    case OPCODE (b_or):
+    {
+      *res_p = ecma_int32_to_number ((int32_t) (left_uint32 | right_uint32));
+      break;
+    }
+    case OPCODE (b_xor):
+    {
+      *res_p = ecma_int32_to_number ((int32_t) (left_uint32 ^ right_uint32));
+      break;
+    }
+    case OPCODE (b_shift_left):
+    {
+      *res_p = ecma_int32_to_number (left_int32 << (right_uint32 & 0x1F));
+      break;
+    }
+    case OPCODE (b_shift_right):
+    {
+      *res_p = ecma_int32_to_number (left_int32 >> (right_uint32 & 0x1F));
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (op_idx == OPCODE (b_shift_uright));
+
+      *res_p = ecma_uint32_to_number (left_uint32 >> (right_uint32 & 0x1F));
+      break;
+    }
+  }
+
+  *res_value_p = ecma_make_number_value (res_p);
+
+  return true;
+} /* fold_binary_operation */
+
+/**
+ * Perform unary operation on primitive constant value
+ *
+ * @return the result (should be freed with ecma_free_value)
+ */
+static ecma_value_t
+fold_unary_operation (idx_t op_idx, /**< opcode of the operation */
+                      ecma_value_t value) /**< primitive value */
+{
+  if (op_idx == OPCODE (logical_not))
+  {
+    ecma_completion_value_t to_bool_completion = ecma_op_to_boolean (value);
+    const bool is_true = ecma_is_value_true (ecma_get_completion_value_value (to_bool_completion));
+    ecma_free_completion_value (to_bool_completion);
+
+    return ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_FALSE : ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  const ecma_number_t num = get_constant_number (value);
+
+  ecma_number_t *res_p = ecma_alloc_number ();
+
+  switch (op_idx)
+  {
+    case OPCODE (unary_plus):
+    {
+      *res_p = num;
+      break;
+    }
+    case OPCODE (unary_minus):
+    {
+      *res_p = ecma_number_negate (num);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (op_idx == OPCODE (b_not));
+
+      *res_p = ecma_int32_to_number ((int32_t) ~ecma_number_to_uint32 (num));
+      break;
+    }
+  }
+
+  return ecma_make_number_value (res_p);
+} /* fold_unary_operation */
+
+/**
+ * Try to evaluate binary operation at compile-time.
+ *
+ * The operation is folded if both of its operands are temporary registers, assigned with constant values
+ * by the two last dumped instructions. In the case, the instructions are replaced with assignment
+ * of the operation's result to the left operand's register.
+ *
+ * @return true - if the operation was folded (the result's register is returned through res_p),
+ *         false - otherwise.
+ */
+static bool
+dumper_try_fold_binary_operation (idx_t op_idx, /**< opcode of the operation */
+                                  operand lhs, /**< left operand */
+                                  operand rhs, /**< right operand */
+                                  operand *res_p) /**< out: register, containing the result */
+{
+  const opcode_counter_t oc = serializer_get_current_opcode_counter ();
+
+  if (oc < 2)
+  {
+    return false;
+  }
+
+  ecma_value_t left_value, right_value, res_value;
+
+  if (!get_constant_assignment_value ((opcode_counter_t) (oc - 2), lhs, &left_value))
+  {
+    return false;
+  }
+
+  bool is_folded = false;
+
+  if (get_constant_assignment_value ((opcode_counter_t) (oc - 1), rhs, &right_value))
+  {
+    if (fold_binary_operation (op_idx, left_value, right_value, &res_value))
     {
-      const opcode_t opcode = getop_assignment (op.data.uid,
-                                                OPCODE_ARG_TYPE_SIMPLE,
-                                                ECMA_SIMPLE_VALUE_NULL);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
+      dumper_set_writing_position ((opcode_counter_t) (oc - 2));
+      dump_constant_assignment (lhs, res_value);
+      *res_p = lhs;
+
+      ecma_free_value (res_value, true);
+      is_folded = true;
     }
+
+    ecma_free_value (right_value, true);
   }
-}
 
-operand
-dump_null_assignment_res (void)
-{
-  operand op = tmp_operand ();
-  dump_null_assignment (op);
-  return op;
-}
+  ecma_free_value (left_value, true);
 
-void
-dump_variable_assignment (operand res, operand var)
+  return is_folded;
+} /* dumper_try_fold_binary_operation */
+
+/**
+ * Try to evaluate unary operation at compile-time.
+ *
+ * The operation is folded if its operand is a temporary register, assigned with constant value
+ * by the last dumped instruction. In the case, the instruction is replaced with assignment
+ * of the operation's result to the same register.
+ *
+ * @return true - if the operation was folded (the result's register is returned through res_p),
+ *         false - otherwise.
+ */
+static bool
+dumper_try_fold_unary_operation (idx_t op_idx, /**< opcode of the operation */
+                                 operand op, /**< operand */
+                                 operand *res_p) /**< out: register, containing the result */
 {
-  switch (res.type)
+  const opcode_counter_t oc = serializer_get_current_opcode_counter ();
+
+  ecma_value_t value;
+
+  if (oc < 1
+      || !get_constant_assignment_value ((opcode_counter_t) (oc - 1), op, &value))
   {
-    case OPERAND_LITERAL:
-    {
-      switch (var.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE,
-                                                    OPCODE_ARG_TYPE_VARIABLE,
-                                                    LITERAL_TO_REWRITE);
-          serializer_dump_op_meta (create_op_meta_101 (opcode, res.data.lit_id, var.data.lit_id));
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop_assignment (LITERAL_TO_REWRITE,
-                                                    OPCODE_ARG_TYPE_VARIABLE,
-                                                    var.data.uid);
-          serializer_dump_op_meta (create_op_meta_100 (opcode, res.data.lit_id));
-          break;
-        }
-      }
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      switch (var.type)
-      {
-        case OPERAND_LITERAL:
-        {
-          const opcode_t opcode = getop_assignment (res.data.uid,
-                                                    OPCODE_ARG_TYPE_VARIABLE,
-                                                    LITERAL_TO_REWRITE);
-          serializer_dump_op_meta (create_op_meta_001 (opcode, var.data.lit_id));
-          break;
-        }
-        case OPERAND_TMP:
-        {
-          const opcode_t opcode = getop_assignment (res.data.uid,
-                                                    OPCODE_ARG_TYPE_VARIABLE,
-                                                    var.data.uid);
-          serializer_dump_op_meta (create_op_meta_000 (opcode));
-          break;
-        }
-      }
-      break;
-    }
+    return false;
   }
-}
 
-operand
-dump_variable_assignment_res (operand var)
+  ecma_value_t res_value = fold_unary_operation (op_idx, value);
+
+  dumper_set_writing_position ((opcode_counter_t) (oc - 1));
+  dump_constant_assignment (op, res_value);
+  *res_p = op;
+
+  ecma_free_value (res_value, true);
+  ecma_free_value (value, true);
+
+  return true;
+} /* dumper_try_fold_unary_operation */
+
+/**
+ * Try to evaluate condition at compile-time
+ *
+ * If the condition is a temporary register, assigned with constant value by the last dumped instruction,
+ * the instruction is removed, and the value, converted to boolean, is returned.
+ *
+ * @return true - if the condition was evaluated (the value is returned through is_true_p),
+ *         false - otherwise.
+ */
+bool
+dumper_try_fold_condition (operand cond, /**< condition */
+                           bool *is_true_p) /**< out: value of the condition */
 {
-  operand op = tmp_operand ();
-  dump_variable_assignment (op, var);
-  return op;
-}
+  const opcode_counter_t oc = serializer_get_current_opcode_counter ();
+
+  ecma_value_t value;
+
+  if (oc < 1
+      || !get_constant_assignment_value ((opcode_counter_t) (oc - 1), cond, &value))
+  {
+    return false;
+  }
+
+  ecma_completion_value_t to_bool_completion = ecma_op_to_boolean (value);
+  *is_true_p = ecma_is_value_true (ecma_get_completion_value_value (to_bool_completion));
+  ecma_free_completion_value (to_bool_completion);
+
+  ecma_free_value (value, true);
+
+  dumper_set_writing_position ((opcode_counter_t) (oc - 1));
+
+  return true;
+} /* dumper_try_fold_condition */
 
 void
 dump_varg_header_for_rewrite (varg_list_type vlt, operand obj)
@@ -1109,7 +1461,7 @@ dump_varg_header_for_rewrite (varg_list_type vlt, operand obj)
 }
 
 operand
-rewrite_varg_header_set_args_count (uint8_t args_count)
+rewrite_varg_header_set_args_count (wide_idx_t args_count)
 {
   op_meta om = serializer_get_op_meta (STACK_TOP (varg_headers));
   switch (om.op.op_idx)
@@ -1120,15 +1472,15 @@ rewrite_varg_header_set_args_count (uint8_t args_count)
     case OPCODE (native_call):
     {
       const operand res = tmp_operand ();
-      om.op.data.func_expr_n.arg_list = args_count;
-      om.op.data.func_expr_n.lhs = res.data.uid;
+      set_op_meta_wide_value (&om, 2, args_count);
+      set_op_meta_operand (&om, 0, res);
       serializer_rewrite_op_meta (STACK_TOP (varg_headers), om);
       STACK_DROP (varg_headers, 1);
       return res;
     }
     case OPCODE (func_decl_n):
     {
-      om.op.data.func_decl_n.arg_list = args_count;
+      set_op_meta_wide_value (&om, 1, args_count);
       serializer_rewrite_op_meta (STACK_TOP (varg_headers), om);
       STACK_DROP (varg_headers, 1);
       return empty_operand ();
@@ -1137,8 +1489,8 @@ rewrite_varg_header_set_args_count (uint8_t args_count)
     case OPCODE (obj_decl):
     {
       const operand res = tmp_operand ();
-      om.op.data.obj_decl.list = args_count;
-      om.op.data.obj_decl.lhs = res.data.uid;
+      set_op_meta_wide_value (&om, 1, args_count);
+      set_op_meta_operand (&om, 0, res);
       serializer_rewrite_op_meta (STACK_TOP (varg_headers), om);
       STACK_DROP (varg_headers, 1);
       return res;
@@ -1169,33 +1521,22 @@ dump_call_additional_info (opcode_call_flags_t flags, /**< call flags */
     JERRY_ASSERT (operand_is_empty (this_arg));
   }
 
-  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_CALL_SITE_INFO,
-                                      flags,
-                                      (idx_t) (flags & OPCODE_CALL_FLAGS_HAVE_THIS_ARG
-                                               ? this_arg.data.uid
-                                               : INVALID_VALUE));
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_CALL_SITE_INFO, flags, INVALID_VALUE));
 
-  serializer_dump_op_meta (create_op_meta_000 (opcode));
+  if (flags & OPCODE_CALL_FLAGS_HAVE_THIS_ARG)
+  {
+    set_op_meta_operand (&om, 2, this_arg);
+  }
+
+  serializer_dump_op_meta (om);
 } /* dump_call_additional_info */
 
 void
 dump_varg (operand op)
 {
-  switch (op.type)
-  {
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG, op.data.uid, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      return;
-    }
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG, LITERAL_TO_REWRITE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_010 (opcode, op.data.lit_id));
-      return;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_VARG, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 1, op);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -1215,21 +1556,10 @@ dump_prop_name_and_value (operand name, operand value)
     JERRY_ASSERT (lit->get_type () == LIT_NUMBER_T);
     tmp = dump_number_assignment_res (name.data.lit_id);
   }
-  switch (value.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG_PROP_DATA, tmp.data.uid, LITERAL_TO_REWRITE);
-      serializer_dump_op_meta (create_op_meta_001 (opcode, value.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG_PROP_DATA, tmp.data.uid, value.data.uid);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_VARG_PROP_DATA, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 1, tmp);
+  set_op_meta_operand (&om, 2, value);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -1250,8 +1580,10 @@ dump_prop_getter_decl (operand name, operand func)
     JERRY_ASSERT (lit->get_type () == LIT_NUMBER_T);
     tmp = dump_number_assignment_res (name.data.lit_id);
   }
-  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG_PROP_GETTER, tmp.data.uid, func.data.uid);
-  serializer_dump_op_meta (create_op_meta_000 (opcode));
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_VARG_PROP_GETTER, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 1, tmp);
+  set_op_meta_operand (&om, 2, func);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -1272,8 +1604,10 @@ dump_prop_setter_decl (operand name, operand func)
     JERRY_ASSERT (lit->get_type () == LIT_NUMBER_T);
     tmp = dump_number_assignment_res (name.data.lit_id);
   }
-  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_VARG_PROP_SETTER, tmp.data.uid, func.data.uid);
-  serializer_dump_op_meta (create_op_meta_000 (opcode));
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_VARG_PROP_SETTER, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 1, tmp);
+  set_op_meta_operand (&om, 2, func);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -1318,10 +1652,9 @@ rewrite_function_end (varg_list_type vlt)
     JERRY_ASSERT (vlt == VARG_FUNC_EXPR);
     oc = (opcode_counter_t) (get_diff_from (STACK_TOP (function_ends)));
   }
-  idx_t id1, id2;
-  split_opcode_counter (oc, &id1, &id2);
-  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_FUNCTION_END, id1, id2);
-  serializer_rewrite_op_meta (STACK_TOP (function_ends), create_op_meta_000 (opcode));
+  op_meta om = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_FUNCTION_END, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_counter (&om, 1, oc);
+  serializer_rewrite_op_meta (STACK_TOP (function_ends), om);
   STACK_DROP (function_ends, 1);
 }
 
@@ -1404,8 +1737,12 @@ dump_unary_plus (operand res, operand obj)
 operand
 dump_unary_plus_res (operand op)
 {
-  const operand res = tmp_operand ();
-  dump_unary_plus (res, op);
+  operand res;
+  if (!dumper_try_fold_unary_operation (OPCODE (unary_plus), op, &res))
+  {
+    res = tmp_operand ();
+    dump_unary_plus (res, op);
+  }
   return res;
 }
 
@@ -1418,8 +1755,12 @@ dump_unary_minus (operand res, operand obj)
 operand
 dump_unary_minus_res (operand op)
 {
-  const operand res = tmp_operand ();
-  dump_unary_minus (res, op);
+  operand res;
+  if (!dumper_try_fold_unary_operation (OPCODE (unary_minus), op, &res))
+  {
+    res = tmp_operand ();
+    dump_unary_minus (res, op);
+  }
   return res;
 }
 
@@ -1432,8 +1773,12 @@ dump_bitwise_not (operand res, operand obj)
 operand
 dump_bitwise_not_res (operand op)
 {
-  const operand res = tmp_operand ();
-  dump_bitwise_not (res, op);
+  operand res;
+  if (!dumper_try_fold_unary_operation (OPCODE (b_not), op, &res))
+  {
+    res = tmp_operand ();
+    dump_bitwise_not (res, op);
+  }
   return res;
 }
 
@@ -1446,8 +1791,12 @@ dump_logical_not (operand res, operand obj)
 operand
 dump_logical_not_res (operand op)
 {
-  const operand res = tmp_operand ();
-  dump_logical_not (res, op);
+  operand res;
+  if (!dumper_try_fold_unary_operation (OPCODE (logical_not), op, &res))
+  {
+    res = tmp_operand ();
+    dump_logical_not (res, op);
+  }
   return res;
 }
 
@@ -1464,21 +1813,7 @@ dump_delete (operand res, operand op, bool is_strict, locus loc)
           || lit->get_type () == LIT_MAGIC_STR_EX_T)
       {
         syntax_check_delete (is_strict, loc);
-        switch (res.type)
-        {
-          case OPERAND_LITERAL:
-          {
-            const opcode_t opcode = getop_delete_var (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE);
-            serializer_dump_op_meta (create_op_meta_110 (opcode, res.data.lit_id, op.data.lit_id));
-            break;
-          }
-          case OPERAND_TMP:
-          {
-            const opcode_t opcode = getop_delete_var (res.data.uid, LITERAL_TO_REWRITE);
-            serializer_dump_op_meta (create_op_meta_010 (opcode, op.data.lit_id));
-            break;
-          }
-        }
+        dump_double_address (getop_delete_var, res, op);
         break;
       }
       else if (lit->get_type ()  == LIT_NUMBER_T)
@@ -1494,25 +1829,12 @@ dump_delete (operand res, operand op, bool is_strict, locus loc)
       {
         case OPCODE (assignment):
         {
-          if (last_op_meta.op.data.assignment.value_right == LITERAL_TO_REWRITE)
+          if (last_op_meta.op.data.assignment.type_value_right == OPCODE_ARG_TYPE_VARIABLE
+              && last_op_meta.op.data.assignment.value_right == LITERAL_TO_REWRITE)
           {
             const operand var_op = literal_operand (last_op_meta.lit_id[2]);
             syntax_check_delete (is_strict, loc);
-            switch (res.type)
-            {
-              case OPERAND_LITERAL:
-              {
-                const opcode_t opcode = getop_delete_var (LITERAL_TO_REWRITE, LITERAL_TO_REWRITE);
-                serializer_dump_op_meta (create_op_meta_110 (opcode, res.data.lit_id, var_op.data.lit_id));
-                break;
-              }
-              case OPERAND_TMP:
-              {
-                const opcode_t opcode = getop_delete_var (res.data.uid, LITERAL_TO_REWRITE);
-                serializer_dump_op_meta (create_op_meta_010 (opcode, var_op.data.lit_id));
-                break;
-              }
-            }
+            dump_double_address (getop_delete_var, res, var_op);
           }
           else
           {
@@ -1523,91 +1845,11 @@ dump_delete (operand res, operand op, bool is_strict, locus loc)
         case OPCODE (prop_getter):
         {
           const opcode_counter_t oc = (opcode_counter_t) (serializer_get_current_opcode_counter () - 1);
-          serializer_set_writing_position (oc);
-          switch (res.type)
-          {
-            case OPERAND_LITERAL:
-            {
-              if (last_op_meta.op.data.prop_getter.obj == LITERAL_TO_REWRITE)
-              {
-                if (last_op_meta.op.data.prop_getter.prop == LITERAL_TO_REWRITE)
-                {
-                  const opcode_t opcode = getop_delete_prop (LITERAL_TO_REWRITE,
-                                                             LITERAL_TO_REWRITE,
-                                                             LITERAL_TO_REWRITE);
-                  serializer_dump_op_meta (create_op_meta_111 (opcode, res.data.lit_id,
-                                                               last_op_meta.lit_id[1],
-                                                               last_op_meta.lit_id[2]));
-                }
-                else
-                {
-                  const opcode_t opcode = getop_delete_prop (LITERAL_TO_REWRITE,
-                                                             LITERAL_TO_REWRITE,
-                                                             last_op_meta.op.data.prop_getter.prop);
-                  serializer_dump_op_meta (create_op_meta_110 (opcode, res.data.lit_id,
-                                                               last_op_meta.lit_id[1]));
-                }
-              }
-              else
-              {
-                if (last_op_meta.op.data.prop_getter.prop == LITERAL_TO_REWRITE)
-                {
-                  const opcode_t opcode = getop_delete_prop (LITERAL_TO_REWRITE,
-                                                             last_op_meta.op.data.prop_getter.obj,
-                                                             LITERAL_TO_REWRITE);
-                  serializer_dump_op_meta (create_op_meta_101 (opcode, res.data.lit_id,
-                                                               last_op_meta.lit_id[2]));
-                }
-                else
-                {
-                  const opcode_t opcode = getop_delete_prop (LITERAL_TO_REWRITE,
-                                                             last_op_meta.op.data.prop_getter.obj,
-                                                             last_op_meta.op.data.prop_getter.prop);
-                  serializer_dump_op_meta (create_op_meta_100 (opcode, res.data.lit_id));
-                }
-              }
-              break;
-            }
-            case OPERAND_TMP:
-            {
-              if (last_op_meta.op.data.prop_getter.obj == LITERAL_TO_REWRITE)
-              {
-                if (last_op_meta.op.data.prop_getter.prop == LITERAL_TO_REWRITE)
-                {
-                  const opcode_t opcode = getop_delete_prop (res.data.uid,
-                                                             LITERAL_TO_REWRITE,
-                                                             LITERAL_TO_REWRITE);
-                  serializer_dump_op_meta (create_op_meta_011 (opcode, last_op_meta.lit_id[1],
-                                                               last_op_meta.lit_id[2]));
-                }
-                else
-                {
-                  const opcode_t opcode = getop_delete_prop (res.data.uid,
-                                                             LITERAL_TO_REWRITE,
-                                                             last_op_meta.op.data.prop_getter.prop);
-                  serializer_dump_op_meta (create_op_meta_010 (opcode, last_op_meta.lit_id[1]));
-                }
-              }
-              else
-              {
-                if (last_op_meta.op.data.prop_getter.prop == LITERAL_TO_REWRITE)
-                {
-                  const opcode_t opcode = getop_delete_prop (res.data.uid,
-                                                             last_op_meta.op.data.prop_getter.obj,
-                                                             LITERAL_TO_REWRITE);
-                  serializer_dump_op_meta (create_op_meta_001 (opcode, last_op_meta.lit_id[2]));
-                }
-                else
-                {
-                  const opcode_t opcode = getop_delete_prop (res.data.uid,
-                                                             last_op_meta.op.data.prop_getter.obj,
-                                                             last_op_meta.op.data.prop_getter.prop);
-                  serializer_dump_op_meta (create_op_meta_000 (opcode));
-                }
-              }
-              break;
-            }
-          }
+          dumper_set_writing_position (oc);
+          dump_triple_address (getop_delete_prop,
+                               res,
+                               get_op_meta_operand (last_op_meta, 1),
+                               get_op_meta_operand (last_op_meta, 2));
           break;
         }
       }
@@ -1647,8 +1889,12 @@ dump_multiplication (operand res, operand lhs, operand rhs)
 operand
 dump_multiplication_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_multiplication (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (multiplication), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_multiplication (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1661,8 +1907,12 @@ dump_division (operand res, operand lhs, operand rhs)
 operand
 dump_division_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_division (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (division), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_division (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1675,8 +1925,12 @@ dump_remainder (operand res, operand lhs, operand rhs)
 operand
 dump_remainder_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_remainder (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (remainder), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_remainder (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1689,8 +1943,12 @@ dump_addition (operand res, operand lhs, operand rhs)
 operand
 dump_addition_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_addition (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (addition), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_addition (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1703,8 +1961,12 @@ dump_substraction (operand res, operand lhs, operand rhs)
 operand
 dump_substraction_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_substraction (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (substraction), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_substraction (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1717,8 +1979,12 @@ dump_left_shift (operand res, operand lhs, operand rhs)
 operand
 dump_left_shift_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_left_shift (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_shift_left), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_left_shift (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1731,8 +1997,12 @@ dump_right_shift (operand res, operand lhs, operand rhs)
 operand
 dump_right_shift_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_right_shift (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_shift_right), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_right_shift (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1745,8 +2015,12 @@ dump_right_shift_ex (operand res, operand lhs, operand rhs)
 operand
 dump_right_shift_ex_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_right_shift_ex (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_shift_uright), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_right_shift_ex (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1899,8 +2173,12 @@ dump_bitwise_and (operand res, operand lhs, operand rhs)
 operand
 dump_bitwise_and_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_bitwise_and (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_and), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_bitwise_and (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1913,8 +2191,12 @@ dump_bitwise_xor (operand res, operand lhs, operand rhs)
 operand
 dump_bitwise_xor_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_bitwise_xor (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_xor), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_bitwise_xor (res, lhs, rhs);
+  }
   return res;
 }
 
@@ -1927,118 +2209,80 @@ dump_bitwise_or (operand res, operand lhs, operand rhs)
 operand
 dump_bitwise_or_res (operand lhs, operand rhs)
 {
-  const operand res = tmp_operand ();
-  dump_bitwise_or (res, lhs, rhs);
+  operand res;
+  if (!dumper_try_fold_binary_operation (OPCODE (b_or), lhs, rhs, &res))
+  {
+    res = tmp_operand ();
+    dump_bitwise_or (res, lhs, rhs);
+  }
   return res;
 }
 
 void
 start_dumping_logical_and_checks (void)
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (logical_and_checks));
+  STACK_PUSH (U32, (uint32_t) STACK_SIZE (logical_and_checks));
 }
 
 void
 dump_logical_and_check_for_rewrite (operand op)
 {
   STACK_PUSH (logical_and_checks, serializer_get_current_opcode_counter ());
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_is_false_jmp_down (LITERAL_TO_REWRITE, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_is_false_jmp_down (op.data.uid, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_is_false_jmp_down (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 void
 rewrite_logical_and_checks (void)
 {
-  for (uint8_t i = STACK_TOP (U8); i < STACK_SIZE (logical_and_checks); i++)
+  for (uint32_t i = STACK_TOP (U32); i < STACK_SIZE (logical_and_checks); i++)
   {
     op_meta jmp_op_meta = serializer_get_op_meta (STACK_ELEMENT (logical_and_checks, i));
     JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_false_jmp_down));
-    idx_t id1, id2;
-    split_opcode_counter (get_diff_from (STACK_ELEMENT (logical_and_checks, i)), &id1, &id2);
-    jmp_op_meta.op.data.is_false_jmp_down.opcode_1 = id1;
-    jmp_op_meta.op.data.is_false_jmp_down.opcode_2 = id2;
+    set_op_meta_counter (&jmp_op_meta, 1, get_diff_from (STACK_ELEMENT (logical_and_checks, i)));
     serializer_rewrite_op_meta (STACK_ELEMENT (logical_and_checks, i), jmp_op_meta);
   }
-  STACK_DROP (logical_and_checks, STACK_SIZE (logical_and_checks) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
+  STACK_DROP (logical_and_checks, STACK_SIZE (logical_and_checks) - STACK_TOP (U32));
+  STACK_DROP (U32, 1);
 }
 
 void
 start_dumping_logical_or_checks (void)
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (logical_or_checks));
+  STACK_PUSH (U32, (uint32_t) STACK_SIZE (logical_or_checks));
 }
 
 void
 dump_logical_or_check_for_rewrite (operand op)
 {
   STACK_PUSH (logical_or_checks, serializer_get_current_opcode_counter ());
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_is_true_jmp_down (LITERAL_TO_REWRITE, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_is_true_jmp_down (op.data.uid, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_is_true_jmp_down (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 void
 rewrite_logical_or_checks (void)
 {
-  for (uint8_t i = STACK_TOP (U8); i < STACK_SIZE (logical_or_checks); i++)
+  for (uint32_t i = STACK_TOP (U32); i < STACK_SIZE (logical_or_checks); i++)
   {
     op_meta jmp_op_meta = serializer_get_op_meta (STACK_ELEMENT (logical_or_checks, i));
     JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_true_jmp_down));
-    idx_t id1, id2;
-    split_opcode_counter (get_diff_from (STACK_ELEMENT (logical_or_checks, i)), &id1, &id2);
-    jmp_op_meta.op.data.is_true_jmp_down.opcode_1 = id1;
-    jmp_op_meta.op.data.is_true_jmp_down.opcode_2 = id2;
+    set_op_meta_counter (&jmp_op_meta, 1, get_diff_from (STACK_ELEMENT (logical_or_checks, i)));
     serializer_rewrite_op_meta (STACK_ELEMENT (logical_or_checks, i), jmp_op_meta);
   }
-  STACK_DROP (logical_or_checks, STACK_SIZE (logical_or_checks) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
+  STACK_DROP (logical_or_checks, STACK_SIZE (logical_or_checks) - STACK_TOP (U32));
+  STACK_DROP (U32, 1);
 }
 
 void
 dump_conditional_check_for_rewrite (operand op)
 {
   STACK_PUSH (conditional_checks, serializer_get_current_opcode_counter ());
-  switch (op.type)
-  {
-    case OPERAND_LITERAL:
-    {
-      const opcode_t opcode = getop_is_false_jmp_down (LITERAL_TO_REWRITE, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-      break;
-    }
-    case OPERAND_TMP:
-    {
-      const opcode_t opcode = getop_is_false_jmp_down (op.data.uid, INVALID_VALUE, INVALID_VALUE);
-      serializer_dump_op_meta (create_op_meta_000 (opcode));
-      break;
-    }
-  }
+  op_meta om = create_op_meta_000 (getop_is_false_jmp_down (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -2046,10 +2290,7 @@ rewrite_conditional_check (void)
 {
   op_meta jmp_op_meta = serializer_get_op_meta (STACK_TOP (conditional_checks));
   JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_false_jmp_down));
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (STACK_TOP (conditional_checks)), &id1, &id2);
-  jmp_op_meta.op.data.is_false_jmp_down.opcode_1 = id1;
-  jmp_op_meta.op.data.is_false_jmp_down.opcode_2 = id2;
+  set_op_meta_counter (&jmp_op_meta, 1, get_diff_from (STACK_TOP (conditional_checks)));
   serializer_rewrite_op_meta (STACK_TOP (conditional_checks), jmp_op_meta);
   STACK_DROP (conditional_checks, 1);
 }
@@ -2067,21 +2308,64 @@ rewrite_jump_to_end (void)
 {
   op_meta jmp_op_meta = serializer_get_op_meta (STACK_TOP (jumps_to_end));
   JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (jmp_down));
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (STACK_TOP (jumps_to_end)), &id1, &id2);
-  jmp_op_meta.op.data.jmp_down.opcode_1 = id1;
-  jmp_op_meta.op.data.jmp_down.opcode_2 = id2;
+  set_op_meta_counter (&jmp_op_meta, 0, get_diff_from (STACK_TOP (jumps_to_end)));
   serializer_rewrite_op_meta (STACK_TOP (jumps_to_end), jmp_op_meta);
   STACK_DROP (jumps_to_end, 1);
 }
 
+/**
+ * Start dumping of a block of code, that is unreachable (for example, a branch
+ * of 'if' statement with condition, that was evaluated at compile-time).
+ *
+ * See also:
+ *          finish_dumping_unreachable_code
+ */
+void
+start_dumping_unreachable_code (void)
+{
+  unreachable_block_t block;
+  block.jmp_oc = serializer_get_current_opcode_counter ();
+  block.jumps_for_rewrite_num = jumps_for_rewrite_num;
+
+  STACK_PUSH (unreachable_blocks, block);
+
+  serializer_dump_op_meta (create_op_meta_000 (getop_jmp_down (INVALID_VALUE, INVALID_VALUE)));
+} /* start_dumping_unreachable_code */
+
+/**
+ * Finish dumping of a block of unreachable code
+ *
+ * The block is removed from byte-code, unless 'break' or 'continue' jumps were dumped in the block,
+ * as the jumps are linked into per-label lists (see also: jsp_label_add_jump); in the case,
+ * a jump over the block is dumped instead.
+ */
+void
+finish_dumping_unreachable_code (void)
+{
+  const unreachable_block_t block = STACK_TOP (unreachable_blocks);
+
+  if (block.jumps_for_rewrite_num == jumps_for_rewrite_num)
+  {
+    dumper_set_writing_position (block.jmp_oc);
+  }
+  else
+  {
+    op_meta jmp_op_meta = serializer_get_op_meta (block.jmp_oc);
+    JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (jmp_down));
+    set_op_meta_counter (&jmp_op_meta, 0, get_diff_from (block.jmp_oc));
+    serializer_rewrite_op_meta (block.jmp_oc, jmp_op_meta);
+  }
+
+  STACK_DROP (unreachable_blocks, 1);
+} /* finish_dumping_unreachable_code */
+
 void
 start_dumping_assignment_expression (void)
 {
   const op_meta last = last_dumped_op_meta ();
   if (last.op.op_idx == OPCODE (prop_getter))
   {
-    serializer_set_writing_position ((opcode_counter_t) (serializer_get_current_opcode_counter () - 1));
+    dumper_set_writing_position ((opcode_counter_t) (serializer_get_current_opcode_counter () - 1));
   }
   STACK_PUSH (prop_getters, last);
 }
@@ -2179,30 +2463,18 @@ dump_continue_iterations_check (operand op)
 {
   const opcode_counter_t next_iteration_target_diff = (opcode_counter_t) (serializer_get_current_opcode_counter ()
                                                                           - STACK_TOP (next_iterations));
-  idx_t id1, id2;
-  split_opcode_counter (next_iteration_target_diff, &id1, &id2);
   if (operand_is_empty (op))
   {
-    const opcode_t opcode = getop_jmp_up (id1, id2);
-    serializer_dump_op_meta (create_op_meta_000 (opcode));
+    op_meta om = create_op_meta_000 (getop_jmp_up (INVALID_VALUE, INVALID_VALUE));
+    set_op_meta_counter (&om, 0, next_iteration_target_diff);
+    serializer_dump_op_meta (om);
   }
   else
   {
-    switch (op.type)
-    {
-      case OPERAND_LITERAL:
-      {
-        const opcode_t opcode = getop_is_true_jmp_up (LITERAL_TO_REWRITE, id1, id2);
-        serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-        break;
-      }
-      case OPERAND_TMP:
-      {
-        const opcode_t opcode = getop_is_true_jmp_up (op.data.uid, id1, id2);
-        serializer_dump_op_meta (create_op_meta_000 (opcode));
-        break;
-      }
-    }
+    op_meta om = create_op_meta_000 (getop_is_true_jmp_up (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+    set_op_meta_operand (&om, 0, op);
+    set_op_meta_counter (&om, 1, next_iteration_target_diff);
+    serializer_dump_op_meta (om);
   }
   STACK_DROP (next_iterations, 1);
 }
@@ -2223,22 +2495,24 @@ dump_simple_or_nested_jump_for_rewrite (bool is_simple_jump, /**< flag indicatin
                                                                                 *   the same target - if any,
                                                                                 *   or MAX_OPCODES - otherwise */
 {
-  idx_t id1, id2;
-  split_opcode_counter (next_jump_for_tgt_oc, &id1, &id2);
-
   opcode_t opcode;
   if (is_simple_jump)
   {
-    opcode = getop_jmp_down (id1, id2);
+    opcode = getop_jmp_down (INVALID_VALUE, INVALID_VALUE);
   }
   else
   {
-    opcode = getop_jmp_break_continue (id1, id2);
+    opcode = getop_jmp_break_continue (INVALID_VALUE, INVALID_VALUE);
   }
 
+  op_meta om = create_op_meta_000 (opcode);
+  set_op_meta_counter (&om, 0, next_jump_for_tgt_oc);
+
   opcode_counter_t ret = serializer_get_current_opcode_counter ();
 
-  serializer_dump_op_meta (create_op_meta_000 (opcode));
+  serializer_dump_op_meta (om);
+
+  jumps_for_rewrite_num++;
 
   return ret;
 } /* dump_simple_or_nested_jump_for_rewrite */
@@ -2259,38 +2533,20 @@ rewrite_simple_or_nested_jump_and_get_next (opcode_counter_t jump_oc, /**< posit
   JERRY_ASSERT (is_simple_jump
                 || (jump_op_meta.op.op_idx == OPCODE (jmp_break_continue)));
 
-  idx_t id1, id2, id1_prev, id2_prev;
-  split_opcode_counter ((opcode_counter_t) (target_oc - jump_oc), &id1, &id2);
-
-  if (is_simple_jump)
-  {
-    id1_prev = jump_op_meta.op.data.jmp_down.opcode_1;
-    id2_prev = jump_op_meta.op.data.jmp_down.opcode_2;
-
-    jump_op_meta.op.data.jmp_down.opcode_1 = id1;
-    jump_op_meta.op.data.jmp_down.opcode_2 = id2;
-  }
-  else
-  {
-    JERRY_ASSERT (jump_op_meta.op.op_idx == OPCODE (jmp_break_continue));
-
-    id1_prev = jump_op_meta.op.data.jmp_break_continue.opcode_1;
-    id2_prev = jump_op_meta.op.data.jmp_break_continue.opcode_2;
+  const opcode_counter_t prev_oc = get_op_meta_counter (jump_op_meta, 0);
 
-    jump_op_meta.op.data.jmp_break_continue.opcode_1 = id1;
-    jump_op_meta.op.data.jmp_break_continue.opcode_2 = id2;
-  }
+  set_op_meta_counter (&jump_op_meta, 0, (opcode_counter_t) (target_oc - jump_oc));
 
   serializer_rewrite_op_meta (jump_oc, jump_op_meta);
 
-  return calc_opcode_counter_from_idx_idx (id1_prev, id2_prev);
+  return prev_oc;
 } /* rewrite_simple_or_nested_jump_get_next */
 
 void
 start_dumping_case_clauses (void)
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (case_clauses));
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (case_clauses));
+  STACK_PUSH (U32, (uint32_t) STACK_SIZE (case_clauses));
+  STACK_PUSH (U32, (uint32_t) STACK_SIZE (case_clauses));
 }
 
 void
@@ -2299,8 +2555,9 @@ dump_case_clause_check_for_rewrite (operand switch_expr, operand case_expr)
   const operand res = tmp_operand ();
   dump_triple_address (getop_equal_value_type, res, switch_expr, case_expr);
   STACK_PUSH (case_clauses, serializer_get_current_opcode_counter ());
-  const opcode_t opcode = getop_is_true_jmp_down (res.data.uid, INVALID_VALUE, INVALID_VALUE);
-  serializer_dump_op_meta (create_op_meta_000 (opcode));
+  op_meta om = create_op_meta_000 (getop_is_true_jmp_down (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, res);
+  serializer_dump_op_meta (om);
 }
 
 void
@@ -2314,36 +2571,30 @@ dump_default_clause_check_for_rewrite (void)
 void
 rewrite_case_clause (void)
 {
-  const opcode_counter_t jmp_oc = STACK_ELEMENT (case_clauses, STACK_HEAD (U8, 2));
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (jmp_oc), &id1, &id2);
+  const opcode_counter_t jmp_oc = STACK_ELEMENT (case_clauses, STACK_HEAD (U32, 2));
   op_meta jmp_op_meta = serializer_get_op_meta (jmp_oc);
   JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_true_jmp_down));
-  jmp_op_meta.op.data.is_true_jmp_down.opcode_1 = id1;
-  jmp_op_meta.op.data.is_true_jmp_down.opcode_2 = id2;
+  set_op_meta_counter (&jmp_op_meta, 1, get_diff_from (jmp_oc));
   serializer_rewrite_op_meta (jmp_oc, jmp_op_meta);
-  STACK_INCR_HEAD (U8, 2);
+  STACK_INCR_HEAD (U32, 2);
 }
 
 void
 rewrite_default_clause (void)
 {
   const opcode_counter_t jmp_oc = STACK_TOP (case_clauses);
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (jmp_oc), &id1, &id2);
   op_meta jmp_op_meta = serializer_get_op_meta (jmp_oc);
   JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (jmp_down));
-  jmp_op_meta.op.data.jmp_down.opcode_1 = id1;
-  jmp_op_meta.op.data.jmp_down.opcode_2 = id2;
+  set_op_meta_counter (&jmp_op_meta, 0, get_diff_from (jmp_oc));
   serializer_rewrite_op_meta (jmp_oc, jmp_op_meta);
 }
 
 void
 finish_dumping_case_clauses (void)
 {
-  STACK_DROP (case_clauses, STACK_SIZE (case_clauses) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
-  STACK_DROP (U8, 1);
+  STACK_DROP (case_clauses, STACK_SIZE (case_clauses) - STACK_TOP (U32));
+  STACK_DROP (U32, 1);
+  STACK_DROP (U32, 1);
 }
 
 /**
@@ -2360,18 +2611,9 @@ dump_with_for_rewrite (operand op) /**< operand - result of evaluating Expressio
 {
   opcode_counter_t oc = serializer_get_current_opcode_counter ();
 
-  if (op.type == OPERAND_LITERAL)
-  {
-    const opcode_t opcode = getop_with (LITERAL_TO_REWRITE, INVALID_VALUE, INVALID_VALUE);
-    serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-  }
-  else
-  {
-    JERRY_ASSERT (op.type == OPERAND_TMP);
-
-    const opcode_t opcode = getop_with (op.data.uid, INVALID_VALUE, INVALID_VALUE);
-    serializer_dump_op_meta (create_op_meta_000 (opcode));
-  }
+  op_meta om = create_op_meta_000 (getop_with (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 
   return oc;
 } /* dump_with_for_rewrite */
@@ -2385,10 +2627,7 @@ rewrite_with (opcode_counter_t oc) /**< opcode counter of the instruction templa
 {
   op_meta with_op_meta = serializer_get_op_meta (oc);
 
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (oc), &id1, &id2);
-  with_op_meta.op.data.with.oc_idx_1 = id1;
-  with_op_meta.op.data.with.oc_idx_2 = id2;
+  set_op_meta_counter (&with_op_meta, 1, get_diff_from (oc));
   serializer_rewrite_op_meta (oc, with_op_meta);
 } /* rewrite_with */
 
@@ -2416,18 +2655,9 @@ dump_for_in_for_rewrite (operand op) /**< operand - result of evaluating Express
 {
   opcode_counter_t oc = serializer_get_current_opcode_counter ();
 
-  if (op.type == OPERAND_LITERAL)
-  {
-    const opcode_t opcode = getop_for_in (LITERAL_TO_REWRITE, INVALID_VALUE, INVALID_VALUE);
-    serializer_dump_op_meta (create_op_meta_100 (opcode, op.data.lit_id));
-  }
-  else
-  {
-    JERRY_ASSERT (op.type == OPERAND_TMP);
-
-    const opcode_t opcode = getop_for_in (op.data.uid, INVALID_VALUE, INVALID_VALUE);
-    serializer_dump_op_meta (create_op_meta_000 (opcode));
-  }
+  op_meta om = create_op_meta_000 (getop_for_in (INVALID_VALUE, INVALID_VALUE, INVALID_VALUE));
+  set_op_meta_operand (&om, 0, op);
+  serializer_dump_op_meta (om);
 
   return oc;
 } /* dump_for_in_for_rewrite */
@@ -2441,10 +2671,7 @@ rewrite_for_in (opcode_counter_t oc) /**< opcode counter of the instruction temp
 {
   op_meta for_in_op_meta = serializer_get_op_meta (oc);
 
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (oc), &id1, &id2);
-  for_in_op_meta.op.data.for_in.oc_idx_1 = id1;
-  for_in_op_meta.op.data.for_in.oc_idx_2 = id2;
+  set_op_meta_counter (&for_in_op_meta, 1, get_diff_from (oc));
   serializer_rewrite_op_meta (oc, for_in_op_meta);
 } /* rewrite_for_in */
 
@@ -2471,10 +2698,7 @@ rewrite_try (void)
 {
   op_meta try_op_meta = serializer_get_op_meta (STACK_TOP (tries));
   JERRY_ASSERT (try_op_meta.op.op_idx == OPCODE (try_block));
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (STACK_TOP (tries)), &id1, &id2);
-  try_op_meta.op.data.try_block.oc_idx_1 = id1;
-  try_op_meta.op.data.try_block.oc_idx_2 = id2;
+  set_op_meta_counter (&try_op_meta, 0, get_diff_from (STACK_TOP (tries)));
   serializer_rewrite_op_meta (STACK_TOP (tries), try_op_meta);
   STACK_DROP (tries, 1);
 }
@@ -2496,10 +2720,7 @@ rewrite_catch (void)
   op_meta catch_op_meta = serializer_get_op_meta (STACK_TOP (catches));
   JERRY_ASSERT (catch_op_meta.op.op_idx == OPCODE (meta)
                 && catch_op_meta.op.data.meta.type == OPCODE_META_TYPE_CATCH);
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (STACK_TOP (catches)), &id1, &id2);
-  catch_op_meta.op.data.meta.data_1 = id1;
-  catch_op_meta.op.data.meta.data_2 = id2;
+  set_op_meta_counter (&catch_op_meta, 1, get_diff_from (STACK_TOP (catches)));
   serializer_rewrite_op_meta (STACK_TOP (catches), catch_op_meta);
   STACK_DROP (catches, 1);
 }
@@ -2518,10 +2739,7 @@ rewrite_finally (void)
   op_meta finally_op_meta = serializer_get_op_meta (STACK_TOP (finallies));
   JERRY_ASSERT (finally_op_meta.op.op_idx == OPCODE (meta)
                 && finally_op_meta.op.data.meta.type == OPCODE_META_TYPE_FINALLY);
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (STACK_TOP (finallies)), &id1, &id2);
-  finally_op_meta.op.data.meta.data_1 = id1;
-  finally_op_meta.op.data.meta.data_2 = id2;
+  set_op_meta_counter (&finally_op_meta, 1, get_diff_from (STACK_TOP (finallies)));
   serializer_rewrite_op_meta (STACK_TOP (finallies), finally_op_meta);
   STACK_DROP (finallies, 1);
 }
@@ -2605,6 +2823,29 @@ rewrite_scope_code_flags (opcode_counter_t scope_code_flags_oc, /**< position of
   serializer_rewrite_op_meta (scope_code_flags_oc, opm);
 } /* rewrite_scope_code_flags */
 
+/**
+ * Dump stub of a function's body, that would be compiled upon first call of the function
+ *
+ * The stub consists of the body's scope code flags, followed by the index of the function's descriptor
+ * (see also: lazy_function_t).
+ */
+void
+dump_lazy_function_stub (opcode_scope_code_flags_t scope_flags, /**< scope's code properties flags set */
+                         uint32_t lazy_function_idx) /**< index of the lazy function's descriptor */
+{
+  JERRY_ASSERT ((idx_t) scope_flags == scope_flags);
+  JERRY_ASSERT (lazy_function_idx <= MAX_OPCODES);
+
+  const opcode_t flags_opcode = getop_meta (OPCODE_META_TYPE_SCOPE_CODE_FLAGS, (idx_t) scope_flags, INVALID_VALUE);
+  serializer_dump_op_meta (create_op_meta_000 (flags_opcode));
+
+  op_meta stub_op_meta = create_op_meta_000 (getop_meta (OPCODE_META_TYPE_LAZY_FUNCTION,
+                                                         INVALID_VALUE,
+                                                         INVALID_VALUE));
+  set_op_meta_counter (&stub_op_meta, 1, (opcode_counter_t) lazy_function_idx);
+  serializer_dump_op_meta (stub_op_meta);
+} /* dump_lazy_function_stub */
+
 void
 dump_ret (void)
 {
@@ -2624,7 +2865,7 @@ rewrite_reg_var_decl (void)
   opcode_counter_t reg_var_decl_oc = STACK_TOP (reg_var_decls);
   op_meta opm = serializer_get_op_meta (reg_var_decl_oc);
   JERRY_ASSERT (opm.op.op_idx == OPCODE (reg_var_decl));
-  opm.op.data.reg_var_decl.max = max_temp_name;
+  set_op_meta_wide_value (&opm, 1, max_temp_name);
   serializer_rewrite_op_meta (reg_var_decl_oc, opm);
   STACK_DROP (reg_var_decls, 1);
 }
@@ -2640,7 +2881,7 @@ dumper_init (void)
 {
   max_temp_name = 0;
   reset_temp_name ();
-  STACK_INIT (U8);
+  STACK_INIT (U32);
   STACK_INIT (varg_headers);
   STACK_INIT (function_ends);
   STACK_INIT (logical_and_checks);
@@ -2655,12 +2896,16 @@ dumper_init (void)
   STACK_INIT (tries);
   STACK_INIT (temp_names);
   STACK_INIT (reg_var_decls);
+  STACK_INIT (unreachable_blocks);
+
+  jumps_for_rewrite_num = 0;
+  folded_constant.is_pending = false;
 }
 
 void
 dumper_free (void)
 {
-  STACK_FREE (U8);
+  STACK_FREE (U32);
   STACK_FREE (varg_headers);
   STACK_FREE (function_ends);
   STACK_FREE (logical_and_checks);
@@ -2675,4 +2920,5 @@ dumper_free (void)
   STACK_FREE (tries);
   STACK_FREE (temp_names);
   STACK_FREE (reg_var_decls);
+  STACK_FREE (unreachable_blocks);
 }
@@ -31,7 +31,7 @@ typedef struct
   operand_type type;
   union
   {
-    idx_t uid;
+    wide_idx_t uid;
     lit_cpointer_t lit_id;
   } data;
 } operand;
@@ -81,7 +81,7 @@ void dump_variable_assignment (operand, operand);
 operand dump_variable_assignment_res (operand);
 
 void dump_varg_header_for_rewrite (varg_list_type, operand);
-operand rewrite_varg_header_set_args_count (uint8_t);
+operand rewrite_varg_header_set_args_count (wide_idx_t);
 void dump_call_additional_info (opcode_call_flags_t, operand);
 void dump_varg (operand);
 
@@ -168,6 +168,10 @@ void dump_conditional_check_for_rewrite (operand);
 void rewrite_conditional_check (void);
 void dump_jump_to_end_for_rewrite (void);
 void rewrite_jump_to_end (void);
+void start_dumping_unreachable_code (void);
+void finish_dumping_unreachable_code (void);
+bool dumper_try_fold_condition (operand, bool *);
+void dumper_flush_folded_constant (void);
 
 void start_dumping_assignment_expression (void);
 operand dump_prop_setter_or_variable_assignment_res (operand, operand);
@@ -230,6 +234,7 @@ void dump_variable_declaration (lit_cpointer_t);
 opcode_counter_t dump_scope_code_flags_for_rewrite (void);
 void rewrite_scope_code_flags (opcode_counter_t scope_code_flags_oc,
                                opcode_scope_code_flags_t scope_flags);
+void dump_lazy_function_stub (opcode_scope_code_flags_t, uint32_t);
 
 void dump_reg_var_decl_for_rewrite (void);
 void rewrite_reg_var_decl (void);
@@ -47,10 +47,26 @@ typedef enum
   JSP_EVAL_RET_STORE_DUMP, /**< dump */
 } jsp_eval_ret_store_t;
 
-static token tok;
-static bool inside_eval = false;
-static bool inside_function = false;
-static bool parser_show_opcodes = false;
+static JERRY_THREAD_LOCAL token tok;
+static JERRY_THREAD_LOCAL bool inside_eval = false;
+static JERRY_THREAD_LOCAL bool inside_function = false;
+static JERRY_THREAD_LOCAL bool parser_show_opcodes = false;
+static JERRY_THREAD_LOCAL bool parser_lazy_functions = false;
+
+/**
+ * Reader of scripts' source code (see also: parser_set_source_reader)
+ */
+static JERRY_THREAD_LOCAL jerry_source_reader_t parser_source_reader_p = NULL;
+static JERRY_THREAD_LOCAL void *parser_source_reader_user_p = NULL;
+
+/**
+ * Source buffer of the code that is being parsed, if bodies of functions, declared in the code,
+ * are compiled upon first call of the functions, or NULL - if the bodies are compiled during the parse
+ *
+ * See also:
+ *          jsp_skip_lazy_function_body
+ */
+static JERRY_THREAD_LOCAL const jerry_api_char_t *parser_lazy_source_p = NULL;
 
 enum
 {
@@ -68,7 +84,7 @@ static operand parse_expression (bool, jsp_eval_ret_store_t);
 static void parse_statement (jsp_label_t *outermost_stmt_label_p);
 static operand parse_assignment_expression (bool);
 static void parse_source_element_list (bool);
-static operand parse_argument_list (varg_list_type, operand, uint8_t *, operand *);
+static operand parse_argument_list (varg_list_type, operand, wide_idx_t *, operand *);
 
 static bool
 token_is (token_type tt)
@@ -76,7 +92,7 @@ token_is (token_type tt)
   return tok.type == tt;
 }
 
-static uint16_t
+static mem_cpointer_t
 token_data (void)
 {
   return tok.uid;
@@ -429,10 +445,10 @@ parse_property_assignment (void)
     For each ALT dumps appropriate bytecode. Uses OBJ during dump if neccesary.
     Result tmp. */
 static operand
-parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, operand *this_arg_p)
+parse_argument_list (varg_list_type vlt, operand obj, wide_idx_t *args_count, operand *this_arg_p)
 {
   token_type close_tt = TOK_CLOSE_PAREN;
-  uint8_t args_num = 0;
+  wide_idx_t args_num = 0;
 
   JERRY_ASSERT (!(vlt != VARG_CALL_EXPR && this_arg_p != NULL));
 
@@ -575,6 +591,11 @@ parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, opera
       current_token_must_be (close_tt);
     }
 
+    if (args_num == UINT16_MAX)
+    {
+      EMIT_ERROR ("Too many arguments, elements or properties in the list");
+    }
+
     args_num++;
 
     dumper_finish_varg_code_sequence ();
@@ -612,6 +633,157 @@ parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, opera
   return res;
 }
 
+/**
+ * Check syntax of a function's body, which compilation is postponed till first call of the function
+ *
+ * The body is parsed in the same way as during a non-lazy parse (nested functions are parsed in place),
+ * but into a separate scope, that is freed after the check, so no byte-code of the body is kept,
+ * and any syntax error of the body is reported during parse of the enclosing code.
+ *
+ * Note:
+ *      Opening brace of the body should be the current token when the routine is called,
+ *      closing brace of the body is the current token upon return.
+ */
+static void
+jsp_check_lazy_function_body_syntax (void)
+{
+  current_token_must_be (TOK_OPEN_BRACE);
+
+  const jerry_api_char_t *lazy_source_p = parser_lazy_source_p;
+  const bool was_in_function = inside_function;
+
+  parser_lazy_source_p = NULL;
+  inside_function = true;
+
+  jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
+
+  dumper_flush_folded_constant ();
+  STACK_PUSH (scopes, scopes_tree_init (NULL));
+  serializer_set_scope (STACK_TOP (scopes));
+  scopes_tree_set_strict_mode (STACK_TOP (scopes), scopes_tree_strict_mode (STACK_HEAD (scopes, 2)));
+  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+
+  skip_newlines ();
+  parse_source_element_list (false);
+  next_token_must_be (TOK_CLOSE_BRACE);
+
+  dumper_flush_folded_constant ();
+  scopes_tree_free (STACK_TOP (scopes));
+  STACK_DROP (scopes, 1);
+  serializer_set_scope (STACK_TOP (scopes));
+  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+
+  jsp_label_restore_set (masked_label_set_p);
+
+  inside_function = was_in_function;
+  parser_lazy_source_p = lazy_source_p;
+} /* jsp_check_lazy_function_body_syntax */
+
+/**
+ * Skip body of a function, if the body should be compiled upon first call of the function
+ * (see also: JERRY_FLAG_LAZY_FUNCTIONS), and dump the body's stub (see also: dump_lazy_function_stub)
+ *
+ * Syntax of the skipped body is checked during the parse (see also: jsp_check_lazy_function_body_syntax),
+ * so a script with a syntax error in a function's body is rejected before it runs.
+ *
+ * The body's scope code flags are calculated in the same way as in preparse_scope, except that
+ * identifiers, referenced in nested functions, are also taken into account.
+ *
+ * Note:
+ *      Opening brace of the body should be the current token when the routine is called.
+ *      If the body was skipped, closing brace of the body is the current token upon return.
+ *
+ * @return true - if the body was skipped,
+ *         false - if the body should be parsed (the current token is not changed in the case).
+ */
+static bool
+jsp_skip_lazy_function_body (lit_cpointer_t name_lit_cp) /**< literal with the function's name
+                                                          *   (NOT_A_LITERAL - for anonymous functions) */
+{
+  current_token_must_be (TOK_OPEN_BRACE);
+
+  if (parser_lazy_source_p == NULL
+      || !serializer_can_register_lazy_function ())
+  {
+    return false;
+  }
+
+  const locus body_start_loc = tok.loc + 1;
+  const uint32_t body_first_line = lexer_get_current_line ();
+
+  jsp_check_lazy_function_body_syntax ();
+  lexer_seek (body_start_loc);
+
+  bool is_ref_arguments_identifier = false;
+  bool is_ref_eval_identifier = false;
+  bool is_use_strict = false;
+
+  skip_newlines ();
+
+  if (token_is (TOK_STRING) && lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()),
+                                                            "use strict"))
+  {
+    scopes_tree_set_strict_mode (STACK_TOP (scopes), true);
+    lexer_set_strict_mode (true);
+    is_use_strict = true;
+  }
+
+  size_t nesting_level = 0;
+  while (!token_is (TOK_EOF)
+         && (nesting_level > 0 || !token_is (TOK_CLOSE_BRACE)))
+  {
+    if (token_is (TOK_NAME))
+    {
+      if (lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()), "arguments"))
+      {
+        is_ref_arguments_identifier = true;
+      }
+      else if (lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()), "eval"))
+      {
+        is_ref_eval_identifier = true;
+      }
+    }
+    else if (token_is (TOK_OPEN_BRACE))
+    {
+      nesting_level++;
+    }
+    else if (token_is (TOK_CLOSE_BRACE))
+    {
+      nesting_level--;
+    }
+
+    skip_newlines ();
+  }
+
+  current_token_must_be (TOK_CLOSE_BRACE);
+
+  opcode_scope_code_flags_t scope_flags = OPCODE_SCOPE_CODE_FLAGS__EMPTY;
+
+  if (is_use_strict)
+  {
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_STRICT);
+  }
+
+  if (!is_ref_arguments_identifier)
+  {
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER);
+  }
+
+  if (!is_ref_eval_identifier)
+  {
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER);
+  }
+
+  uint32_t lazy_function_idx = serializer_register_lazy_function (parser_lazy_source_p + body_start_loc,
+                                                                  tok.loc - body_start_loc,
+                                                                  body_first_line,
+                                                                  name_lit_cp,
+                                                                  is_strict_mode ());
+  dump_lazy_function_stub (scope_flags, lazy_function_idx);
+
+  return true;
+} /* jsp_skip_lazy_function_body */
+
 /* function_declaration
   : 'function' LT!* Identifier LT!*
     '(' (LT!* Identifier (LT!* ',' LT!* Identifier)*) ? LT!* ')' LT!* function_body
@@ -629,11 +801,13 @@ parse_function_declaration (void)
   jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
 
   token_after_newlines_must_be (TOK_NAME);
-  const operand name = literal_operand (token_data_as_lit_cp ());
+  const lit_cpointer_t name_lit_cp = token_data_as_lit_cp ();
+  const operand name = literal_operand (name_lit_cp);
 
   syntax_check_for_eval_and_arguments_in_strict_mode (name, is_strict_mode (), tok.loc);
 
   skip_newlines ();
+  dumper_flush_folded_constant ();
   STACK_PUSH (scopes, scopes_tree_init (STACK_TOP (scopes)));
   serializer_set_scope (STACK_TOP (scopes));
   scopes_tree_set_strict_mode (STACK_TOP (scopes), scopes_tree_strict_mode (STACK_HEAD (scopes, 2)));
@@ -645,22 +819,28 @@ parse_function_declaration (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
-  bool was_in_function = inside_function;
-  inside_function = true;
+  if (!jsp_skip_lazy_function_body (name_lit_cp))
+  {
+    skip_newlines ();
 
-  parse_source_element_list (false);
+    bool was_in_function = inside_function;
+    inside_function = true;
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    parse_source_element_list (false);
 
-  dump_ret ();
-  rewrite_function_end (VARG_FUNC_DECL);
+    next_token_must_be (TOK_CLOSE_BRACE);
 
-  inside_function = was_in_function;
+    dump_ret ();
+
+    inside_function = was_in_function;
+  }
+
+  rewrite_function_end (VARG_FUNC_DECL);
 
   syntax_check_for_syntax_errors_in_formal_param_list (is_strict_mode (), tok.loc);
 
+  dumper_flush_folded_constant ();
   STACK_DROP (scopes, 1);
   serializer_set_scope (STACK_TOP (scopes));
   lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
@@ -684,10 +864,13 @@ parse_function_expression (void)
 
   syntax_start_checking_of_vargs ();
 
+  lit_cpointer_t name_lit_cp = NOT_A_LITERAL;
+
   skip_newlines ();
   if (token_is (TOK_NAME))
   {
-    const operand name = literal_operand (token_data_as_lit_cp ());
+    name_lit_cp = token_data_as_lit_cp ();
+    const operand name = literal_operand (name_lit_cp);
     syntax_check_for_eval_and_arguments_in_strict_mode (name, is_outer_scope_strict, tok.loc);
 
     skip_newlines ();
@@ -703,24 +886,28 @@ parse_function_expression (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
-  bool was_in_function = inside_function;
-  inside_function = true;
+  if (!jsp_skip_lazy_function_body (name_lit_cp))
+  {
+    skip_newlines ();
 
-  jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
+    bool was_in_function = inside_function;
+    inside_function = true;
 
-  parse_source_element_list (false);
+    jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
 
-  jsp_label_restore_set (masked_label_set_p);
+    parse_source_element_list (false);
 
+    jsp_label_restore_set (masked_label_set_p);
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    next_token_must_be (TOK_CLOSE_BRACE);
 
-  dump_ret ();
-  rewrite_function_end (VARG_FUNC_EXPR);
+    dump_ret ();
 
-  inside_function = was_in_function;
+    inside_function = was_in_function;
+  }
+
+  rewrite_function_end (VARG_FUNC_EXPR);
 
   syntax_check_for_syntax_errors_in_formal_param_list (is_strict_mode (), tok.loc);
 
@@ -2181,26 +2368,61 @@ parse_if_statement (void)
   assert_keyword (KW_IF);
 
   const operand cond = parse_expression_inside_parens ();
-  dump_conditional_check_for_rewrite (cond);
+
+  /* if the condition is evaluated at compile-time, the unreachable branch is not dumped */
+  bool cond_value;
+  const bool is_cond_folded = dumper_try_fold_condition (cond, &cond_value);
+
+  if (!is_cond_folded)
+  {
+    dump_conditional_check_for_rewrite (cond);
+  }
+  else if (!cond_value)
+  {
+    start_dumping_unreachable_code ();
+  }
 
   skip_newlines ();
   parse_statement (NULL);
 
+  if (is_cond_folded && !cond_value)
+  {
+    finish_dumping_unreachable_code ();
+  }
+
   skip_newlines ();
   if (is_keyword (KW_ELSE))
   {
-    dump_jump_to_end_for_rewrite ();
-    rewrite_conditional_check ();
+    if (!is_cond_folded)
+    {
+      dump_jump_to_end_for_rewrite ();
+      rewrite_conditional_check ();
+    }
+    else if (cond_value)
+    {
+      start_dumping_unreachable_code ();
+    }
 
     skip_newlines ();
     parse_statement (NULL);
 
-    rewrite_jump_to_end ();
+    if (!is_cond_folded)
+    {
+      rewrite_jump_to_end ();
+    }
+    else if (cond_value)
+    {
+      finish_dumping_unreachable_code ();
+    }
   }
   else
   {
     lexer_save_token (tok);
-    rewrite_conditional_check ();
+
+    if (!is_cond_folded)
+    {
+      rewrite_conditional_check ();
+    }
   }
 }
 
@@ -2509,7 +2731,7 @@ insert_semicolon (void)
     lexer_save_token (tok);
     return;
   }
-  if (token_is (TOK_CLOSE_BRACE))
+  if (token_is (TOK_CLOSE_BRACE) || token_is (TOK_EOF))
   {
     lexer_save_token (tok);
     return;
@@ -3073,10 +3295,14 @@ parse_source_element_list (bool is_global) /**< flag indicating if we are parsin
 static bool
 parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer */
                       size_t source_size, /**< source code size in bytes */
+                      uint32_t first_line, /**< number of the source code's first line */
                       bool in_function, /**< flag indicating if we are parsing body of a function */
                       bool in_eval, /**< flag indicating if we are parsing body of eval code */
                       bool is_strict, /**< flag, indicating whether current code
                                        *   inherited strict mode from code of an outer scope */
+                      bool is_lazy_functions, /**< compile bodies of functions, declared in the code,
+                                               *   upon first call of the functions (see also:
+                                               *   jsp_skip_lazy_function_body) */
                       const opcode_t **out_opcodes_p) /**< out: generated byte-code array
                                                        *  (in case there were no syntax errors) */
 {
@@ -3084,6 +3310,7 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 
   inside_function = in_function;
   inside_eval = in_eval;
+  parser_lazy_source_p = is_lazy_functions ? source_p : NULL;
 
 #ifndef JERRY_NDEBUG
   volatile bool is_parse_finished = false;
@@ -3094,7 +3321,12 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
   jsp_mm_init ();
   jsp_label_init ();
 
-  lexer_init (source_p, source_size, parser_show_opcodes);
+  lexer_init (source_p, source_size, first_line, parser_show_opcodes);
+
+  if (!in_function && !in_eval)
+  {
+    lexer_set_source_reader (parser_source_reader_p, parser_source_reader_user_p);
+  }
 
   serializer_set_show_opcodes (parser_show_opcodes);
   dumper_init ();
@@ -3136,6 +3368,7 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 
     syntax_free ();
 
+    dumper_flush_folded_constant ();
     *out_opcodes_p = serializer_merge_scopes_into_bytecode ();
 
     dumper_free ();
@@ -3166,6 +3399,8 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
   jsp_label_finalize ();
   jsp_mm_finalize ();
 
+  parser_lazy_source_p = NULL;
+
   return is_syntax_correct;
 } /* parser_parse_program */
 
@@ -3181,7 +3416,7 @@ parser_parse_script (const jerry_api_char_t *source, /**< source script */
                      const opcode_t **opcodes_p) /**< out: generated byte-code array
                                                   *  (in case there were no syntax errors) */
 {
-  return parser_parse_program (source, source_size, false, false, false, opcodes_p);
+  return parser_parse_program (source, source_size, 1, false, false, false, parser_lazy_functions, opcodes_p);
 } /* parser_parse_script */
 
 /**
@@ -3198,7 +3433,7 @@ parser_parse_eval (const jerry_api_char_t *source, /**< string passed to eval()
                    const opcode_t **opcodes_p) /**< out: generated byte-code array
                                                 *  (in case there were no syntax errors) */
 {
-  return parser_parse_program (source, source_size, false, true, is_strict, opcodes_p);
+  return parser_parse_program (source, source_size, 1, false, true, is_strict, false, opcodes_p);
 } /* parser_parse_eval */
 
 /**
@@ -3228,12 +3463,56 @@ parser_parse_new_function (const jerry_api_char_t **params, /**< array of argume
   }
   return parser_parse_program (params[params_count - 1],
                                params_size[params_count - 1],
+                               1,
                                true,
                                false,
                                false,
+                               false,
                                out_opcodes_p);
 } /* parser_parse_new_function */
 
+/**
+ * Compile body of a function, which compilation was postponed till first call of the function
+ * (see also: JERRY_FLAG_LAZY_FUNCTIONS)
+ *
+ * The body is compiled as separate program (in the same way as body of a function, created via new Function call),
+ * and the byte-code is shared between all function objects, created from the function's declaration or expression.
+ *
+ * @return true - if the body was compiled successfully (now or during one of previous calls),
+ *         false - if the body contains a syntax error.
+ */
+bool
+parser_compile_lazy_function (uint32_t lazy_function_idx, /**< index of the function's descriptor */
+                              const opcode_t **out_opcodes_p) /**< out: byte-code array, compiled from the body
+                                                               *        (in case there were no syntax errors) */
+{
+  const lazy_function_t *lazy_function_p = serializer_get_lazy_function (lazy_function_idx);
+
+  if (lazy_function_p->opcodes_p == NULL)
+  {
+    const opcode_t *opcodes_p;
+
+    if (!parser_parse_program (lazy_function_p->body_p,
+                               lazy_function_p->body_size,
+                               lazy_function_p->first_line,
+                               true,
+                               false,
+                               lazy_function_p->is_strict,
+                               true,
+                               &opcodes_p))
+    {
+      return false;
+    }
+
+    /* descriptors of nested functions could be registered during the parse, so the array could be reallocated */
+    serializer_get_lazy_function (lazy_function_idx)->opcodes_p = opcodes_p;
+  }
+
+  *out_opcodes_p = serializer_get_lazy_function (lazy_function_idx)->opcodes_p;
+
+  return true;
+} /* parser_compile_lazy_function */
+
 /**
  * Tell parser to dump bytecode
  */
@@ -3242,3 +3521,28 @@ parser_set_show_opcodes (bool show_opcodes) /**< flag indicating if to dump byte
 {
   parser_show_opcodes = show_opcodes;
 } /* parser_set_show_opcodes */
+
+/**
+ * Tell parser whether bodies of functions, declared in scripts (see also: parser_parse_script),
+ * should be compiled upon first call of the functions
+ */
+void
+parser_set_lazy_functions (bool lazy_functions) /**< flag indicating if to postpone compilation of functions */
+{
+  parser_lazy_functions = lazy_functions;
+} /* parser_set_lazy_functions */
+
+/**
+ * Set reader of source code of scripts (see also: parser_parse_script)
+ *
+ * If the reader is set, the source buffer, passed to parser_parse_script, contains only the beginning
+ * of the source code (maybe, empty), and the rest is appended to the buffer by the reader during the parse.
+ */
+void
+parser_set_source_reader (jerry_source_reader_t reader_p, /**< reader (NULL - the whole source code is passed
+                                                           *   to parser_parse_script) */
+                          void *reader_user_p) /**< user data, passed to the reader */
+{
+  parser_source_reader_p = reader_p;
+  parser_source_reader_user_p = reader_user_p;
+} /* parser_set_source_reader */
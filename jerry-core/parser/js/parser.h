@@ -19,8 +19,11 @@
 #include "jrt.h"
 
 void parser_set_show_opcodes (bool);
+void parser_set_lazy_functions (bool);
+void parser_set_source_reader (jerry_source_reader_t, void *);
 bool parser_parse_script (const jerry_api_char_t *, size_t, const opcode_t **);
 bool parser_parse_eval (const jerry_api_char_t *, size_t, bool, const opcode_t **);
 bool parser_parse_new_function (const jerry_api_char_t **, const size_t *, size_t, const opcode_t **);
+bool parser_compile_lazy_function (uint32_t, const opcode_t **);
 
 #endif /* PARSER_H */
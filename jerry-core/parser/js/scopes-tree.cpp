@@ -20,9 +20,16 @@
 #define OPCODE(op) (__op__idx_##op)
 #define HASH_SIZE 128
 
-static hash_table lit_id_to_uid = null_hash;
-static opcode_counter_t global_oc;
-static idx_t next_uid;
+static JERRY_THREAD_LOCAL hash_table lit_id_to_uid = null_hash;
+static JERRY_THREAD_LOCAL opcode_counter_t global_oc;
+static JERRY_THREAD_LOCAL wide_idx_t next_uid;
+static JERRY_THREAD_LOCAL uint32_t wide_operands_num;
+#ifdef JERRY_ENABLE_LINE_INFO
+static JERRY_THREAD_LOCAL uint32_t global_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+JERRY_STATIC_ASSERT (OPCODE_WIDE_OPERAND_LAST < LITERAL_TO_REWRITE);
+JERRY_STATIC_ASSERT (BLOCK_SIZE * 3 <= OPCODE_WIDE_OPERAND_LITERAL_FLAG);
 
 static void
 assert_tree (scopes_tree t)
@@ -68,6 +75,21 @@ scopes_tree_set_op_meta (scopes_tree tree, opcode_counter_t oc, op_meta op)
   linked_list_set_element (tree->opcodes, oc, &op);
 }
 
+#ifdef JERRY_ENABLE_LINE_INFO
+/**
+ * Set source code line of an instruction
+ */
+void
+scopes_tree_set_op_line (scopes_tree tree, /**< scope */
+                         opcode_counter_t oc, /**< opcode counter of the instruction in the scope */
+                         uint32_t line) /**< line number */
+{
+  assert_tree (tree);
+  JERRY_ASSERT (oc < tree->opcodes_num);
+  linked_list_set_element (tree->lines, oc, &line);
+} /* scopes_tree_set_op_line */
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 void
 scopes_tree_set_opcodes_num (scopes_tree tree, opcode_counter_t oc)
 {
@@ -89,7 +111,7 @@ scopes_tree_count_opcodes (scopes_tree t)
 {
   assert_tree (t);
   opcode_counter_t res = t->opcodes_num;
-  for (uint8_t i = 0; i < t->t.children_num; i++)
+  for (uint32_t i = 0; i < t->t.children_num; i++)
   {
     res = (opcode_counter_t) (
       res + scopes_tree_count_opcodes (
@@ -115,7 +137,7 @@ start_new_block_if_necessary (void)
       hash_table_free (lit_id_to_uid);
       lit_id_to_uid = null_hash;
     }
-    lit_id_to_uid = hash_table_init (sizeof (lit_cpointer_t), sizeof (idx_t), HASH_SIZE, lit_id_hash);
+    lit_id_to_uid = hash_table_init (sizeof (lit_cpointer_t), sizeof (wide_idx_t), HASH_SIZE, lit_id_hash);
   }
 }
 
@@ -145,73 +167,133 @@ is_possible_literal (uint16_t mask, uint8_t index)
   return res == 1;
 }
 
-static void
-change_uid (op_meta *om, lit_id_hash_table *lit_ids, uint16_t mask)
+/**
+ * Get identifier of the literal in the current block, assigning the next identifier, if the literal
+ * is not referred to in the block yet
+ *
+ * @return identifier of the literal
+ */
+static wide_idx_t
+get_uid_of_literal (lit_cpointer_t lit_id, /**< literal */
+                    lit_id_hash_table *lit_ids) /**< literal identifiers hash table to register new identifiers in
+                                                 *   (NULL - if identifiers are only counted) */
 {
-  for (uint8_t i = 0; i < 3; i++)
+  JERRY_ASSERT (lit_id.packed_value != MEM_CP_NULL);
+
+  wide_idx_t *uid = (wide_idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+  if (uid == NULL)
   {
-    if (is_possible_literal (mask, i))
+    hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
+    if (lit_ids != NULL)
     {
-      if (get_uid (om, i) == LITERAL_TO_REWRITE)
-      {
-        JERRY_ASSERT (om->lit_id[i].packed_value != MEM_CP_NULL);
-        lit_cpointer_t lit_id = om->lit_id[i];
-        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
-        if (uid == NULL)
-        {
-          hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
-          lit_id_hash_table_insert (lit_ids, next_uid, global_oc, lit_id);
-          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
-          JERRY_ASSERT (uid != NULL);
-          JERRY_ASSERT (*uid == next_uid);
-          next_uid++;
-        }
-        set_uid (om, i, *uid);
-      }
-      else
-      {
-        JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
-      }
-    }
-    else
-    {
-      JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
+      lit_id_hash_table_insert (lit_ids, next_uid, global_oc, lit_id);
     }
+    uid = (wide_idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+    JERRY_ASSERT (uid != NULL);
+    JERRY_ASSERT (*uid == next_uid);
+    next_uid++;
   }
-}
 
-static void
-insert_uids_to_lit_id_map (op_meta *om, uint16_t mask)
+  return *uid;
+} /* get_uid_of_literal */
+
+/**
+ * Check whether the operand is the second operand of an opcode counter's pair, which first operand is not
+ * a wide operand (see also: calc_opcode_counter_from_idx_idx)
+ *
+ * Note:
+ *      such operand is the counter's low byte and can have any value, including OPCODE_WIDE_OPERAND_FIRST ..
+ *      OPCODE_WIDE_OPERAND_LAST, while pair of a wide counter has both operands escaped.
+ *
+ * @return true / false
+ */
+static bool
+is_narrow_counter_low_operand (op_meta *om, /**< instruction */
+                               uint16_t mask, /**< mask of operands, that can refer to literals */
+                               uint16_t wide_mask, /**< mask of operands, that can be wide */
+                               uint8_t i) /**< index of the operand */
+{
+  if (i == 0
+      || is_possible_literal (mask, i)
+      || is_possible_literal (mask, (uint8_t) (i - 1))
+      || !is_possible_literal (wide_mask, (uint8_t) (i - 1)))
+  {
+    /* opcode counter is represented with a pair of operands, that are neither literals, nor registers */
+    return false;
+  }
+
+  return !OPCODE_IS_WIDE_OPERAND (get_uid (om, (uint8_t) (i - 1)));
+} /* is_narrow_counter_low_operand */
+
+/**
+ * Replace the instruction's operands, referring to literals, with identifiers of the literals,
+ * and operands, which values don't fit into idx_t, with references to wide operands table
+ * (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * If lit_ids is NULL, the instruction is not changed, and the identifiers are only counted.
+ *
+ * @return true - if the instruction has operands, stored in the wide operands table,
+ *         false - otherwise.
+ */
+static bool
+change_uid (op_meta *om, /**< instruction */
+            lit_id_hash_table *lit_ids, /**< literal identifiers hash table (or NULL) */
+            wide_operands_t *out_wide_operands_p) /**< out: wide operands table entry of the instruction
+                                                   *   (if lit_ids is not NULL) */
 {
+  const uint16_t mask = scopes_tree_get_literal_operands_mask (om->op);
+  const uint16_t wide_mask = scopes_tree_get_wide_operands_mask (om->op);
+
+  bool is_wide = false;
+
   for (uint8_t i = 0; i < 3; i++)
   {
-    if (is_possible_literal (mask, i))
+    const idx_t operand = get_uid (om, i);
+    wide_idx_t wide_value;
+
+    if (is_possible_literal (mask, i) && operand == LITERAL_TO_REWRITE)
     {
-      if (get_uid (om, i) == LITERAL_TO_REWRITE)
+      const wide_idx_t uid = get_uid_of_literal (om->lit_id[i], lit_ids);
+
+      if (uid < OPCODE_REG_FIRST)
       {
-        JERRY_ASSERT (om->lit_id[i].packed_value != MEM_CP_NULL);
-        lit_cpointer_t lit_id = om->lit_id[i];
-        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
-        if (uid == NULL)
+        if (lit_ids != NULL)
         {
-          hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
-          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
-          JERRY_ASSERT (uid != NULL);
-          JERRY_ASSERT (*uid == next_uid);
-          next_uid++;
+          set_uid (om, i, (idx_t) uid);
         }
+        continue;
       }
-      else
-      {
-        JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
-      }
+
+      wide_value = (wide_idx_t) (OPCODE_WIDE_OPERAND_LITERAL_FLAG | uid);
+    }
+    else if (is_possible_literal (wide_mask, i)
+             && OPCODE_IS_WIDE_OPERAND (operand)
+             && !is_narrow_counter_low_operand (om, mask, wide_mask, i))
+    {
+      JERRY_ASSERT (operand == OPCODE_WIDE_OPERAND_FIRST + i);
+
+      wide_value = (wide_idx_t) om->lit_id[i].packed_value;
     }
     else
     {
       JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
+      continue;
+    }
+
+    JERRY_ASSERT (is_possible_literal (wide_mask, i));
+    is_wide = true;
+
+    if (lit_ids != NULL)
+    {
+      set_uid (om, i, (idx_t) (OPCODE_WIDE_OPERAND_FIRST + i));
+
+      out_wide_operands_p->oc = global_oc;
+      out_wide_operands_p->operands[i] = wide_value;
     }
   }
-}
+
+  return is_wide;
+} /* change_uid */
 
 static op_meta *
 extract_op_meta (scopes_tree tree, opcode_counter_t opc_index)
@@ -219,18 +301,18 @@ extract_op_meta (scopes_tree tree, opcode_counter_t opc_index)
   return (op_meta *) linked_list_element (tree->opcodes, opc_index);
 }
 
-static opcode_t
-generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table *lit_ids)
+/**
+ * Get mask of the instruction's operands, that can refer to literals
+ *
+ * For each operand, the mask contains a hexadecimal digit: 0x100 - first operand, 0x010 - second operand
+ * and 0x001 - third operand. The digit is '1', if there is possible literal in the position, and '0' otherwise.
+ *
+ * @return the mask
+ */
+uint16_t
+scopes_tree_get_literal_operands_mask (opcode_t op) /**< instruction */
 {
-  start_new_block_if_necessary ();
-  op_meta *om = extract_op_meta (tree, opc_index);
-  /* Now we should change uids of opcodes.
-     Since different opcodes has different literals/tmps in different places,
-     we should change only them.
-     For each case possible literal positions are shown as 0xYYY literal,
-     where Y is set to '1' when there is a possible literal in this position,
-     and '0' otherwise.  */
-  switch (om->op.op_idx)
+  switch (op.op_idx)
   {
     case OPCODE (prop_getter):
     case OPCODE (prop_setter):
@@ -257,11 +339,9 @@ generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table
     case OPCODE (multiplication):
     case OPCODE (remainder):
     {
-      change_uid (om, lit_ids, 0x111);
-      break;
+      return 0x111;
     }
     case OPCODE (call_n):
-    case OPCODE (native_call):
     case OPCODE (construct_n):
     case OPCODE (func_expr_n):
     case OPCODE (delete_var):
@@ -275,32 +355,27 @@ generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table
     case OPCODE (unary_plus):
     case OPCODE (unary_minus):
     {
-      change_uid (om, lit_ids, 0x110);
-      break;
+      return 0x110;
     }
     case OPCODE (assignment):
     {
-      switch (om->op.data.assignment.type_value_right)
+      switch (op.data.assignment.type_value_right)
       {
         case OPCODE_ARG_TYPE_SIMPLE:
         case OPCODE_ARG_TYPE_SMALLINT:
         case OPCODE_ARG_TYPE_SMALLINT_NEGATE:
         {
-          change_uid (om, lit_ids, 0x100);
-          break;
+          return 0x100;
         }
-        case OPCODE_ARG_TYPE_NUMBER:
-        case OPCODE_ARG_TYPE_NUMBER_NEGATE:
-        case OPCODE_ARG_TYPE_REGEXP:
-        case OPCODE_ARG_TYPE_STRING:
-        case OPCODE_ARG_TYPE_VARIABLE:
+        default:
         {
-          change_uid (om, lit_ids, 0x101);
-          break;
+          /* OPCODE_ARG_TYPE_NUMBER, OPCODE_ARG_TYPE_NUMBER_NEGATE, OPCODE_ARG_TYPE_STRING,
+           * OPCODE_ARG_TYPE_VARIABLE and OPCODE_ARG_TYPE_REGEXP */
+          return 0x101;
         }
       }
-      break;
     }
+    case OPCODE (native_call): /* the second operand is identifier of the native call (opcode_native_call_t) */
     case OPCODE (func_decl_n):
     case OPCODE (array_decl):
     case OPCODE (obj_decl):
@@ -315,211 +390,155 @@ generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table
     case OPCODE (var_decl):
     case OPCODE (retval):
     {
-      change_uid (om, lit_ids, 0x100);
-      break;
-    }
-    case OPCODE (ret):
-    case OPCODE (try_block):
-    case OPCODE (jmp_up):
-    case OPCODE (jmp_down):
-    case OPCODE (nop):
-    case OPCODE (reg_var_decl):
-    {
-      change_uid (om, lit_ids, 0x000);
-      break;
+      return 0x100;
     }
     case OPCODE (meta):
     {
-      switch (om->op.data.meta.type)
+      switch (op.data.meta.type)
       {
         case OPCODE_META_TYPE_VARG_PROP_DATA:
         case OPCODE_META_TYPE_VARG_PROP_GETTER:
         case OPCODE_META_TYPE_VARG_PROP_SETTER:
         {
-          change_uid (om, lit_ids, 0x011);
-          break;
+          return 0x011;
         }
         case OPCODE_META_TYPE_VARG:
         case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
         {
-          change_uid (om, lit_ids, 0x010);
-          break;
+          return 0x010;
         }
-        case OPCODE_META_TYPE_UNDEFINED:
-        case OPCODE_META_TYPE_END_WITH:
-        case OPCODE_META_TYPE_FUNCTION_END:
-        case OPCODE_META_TYPE_CATCH:
-        case OPCODE_META_TYPE_FINALLY:
-        case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
-        case OPCODE_META_TYPE_CALL_SITE_INFO:
-        case OPCODE_META_TYPE_SCOPE_CODE_FLAGS:
+        default:
         {
-          change_uid (om, lit_ids, 0x000);
-          break;
+          return 0x000;
         }
       }
-      break;
+    }
+    default:
+    {
+      /* ret, try_block, jmp_up, jmp_down, jmp_break_continue, nop and reg_var_decl */
+      return 0x000;
     }
   }
-  return om->op;
-}
+} /* scopes_tree_get_literal_operands_mask */
 
-static idx_t
-count_new_literals_in_opcode (scopes_tree tree, opcode_counter_t opc_index)
+/**
+ * Get mask of the instruction's operands, which values can be stored in the wide operands table
+ * (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * The mask has the same format as the mask, returned by scopes_tree_get_literal_operands_mask.
+ *
+ * @return the mask
+ */
+uint16_t
+scopes_tree_get_wide_operands_mask (opcode_t op) /**< instruction */
 {
-  start_new_block_if_necessary ();
-  idx_t current_uid = next_uid;
-  op_meta *om = extract_op_meta (tree, opc_index);
-  switch (om->op.op_idx)
+  /* operands, that can refer to literals, can also refer to registers */
+  const uint16_t mask = scopes_tree_get_literal_operands_mask (op);
+
+  switch (op.op_idx)
   {
-    case OPCODE (prop_getter):
-    case OPCODE (prop_setter):
-    case OPCODE (delete_prop):
-    case OPCODE (b_shift_left):
-    case OPCODE (b_shift_right):
-    case OPCODE (b_shift_uright):
-    case OPCODE (b_and):
-    case OPCODE (b_or):
-    case OPCODE (b_xor):
-    case OPCODE (equal_value):
-    case OPCODE (not_equal_value):
-    case OPCODE (equal_value_type):
-    case OPCODE (not_equal_value_type):
-    case OPCODE (less_than):
-    case OPCODE (greater_than):
-    case OPCODE (less_or_equal_than):
-    case OPCODE (greater_or_equal_than):
-    case OPCODE (instanceof):
-    case OPCODE (in):
-    case OPCODE (addition):
-    case OPCODE (substraction):
-    case OPCODE (division):
-    case OPCODE (multiplication):
-    case OPCODE (remainder):
-    {
-      insert_uids_to_lit_id_map (om, 0x111);
-      break;
-    }
     case OPCODE (call_n):
     case OPCODE (native_call):
     case OPCODE (construct_n):
     case OPCODE (func_expr_n):
-    case OPCODE (delete_var):
-    case OPCODE (typeof):
-    case OPCODE (b_not):
-    case OPCODE (logical_not):
-    case OPCODE (post_incr):
-    case OPCODE (post_decr):
-    case OPCODE (pre_incr):
-    case OPCODE (pre_decr):
-    case OPCODE (unary_plus):
-    case OPCODE (unary_minus):
     {
-      insert_uids_to_lit_id_map (om, 0x110);
-      break;
-    }
-    case OPCODE (assignment):
-    {
-      switch (om->op.data.assignment.type_value_right)
-      {
-        case OPCODE_ARG_TYPE_SIMPLE:
-        case OPCODE_ARG_TYPE_SMALLINT:
-        case OPCODE_ARG_TYPE_SMALLINT_NEGATE:
-        {
-          insert_uids_to_lit_id_map (om, 0x100);
-          break;
-        }
-        case OPCODE_ARG_TYPE_NUMBER:
-        case OPCODE_ARG_TYPE_NUMBER_NEGATE:
-        case OPCODE_ARG_TYPE_REGEXP:
-        case OPCODE_ARG_TYPE_STRING:
-        case OPCODE_ARG_TYPE_VARIABLE:
-        {
-          insert_uids_to_lit_id_map (om, 0x101);
-          break;
-        }
-      }
-      break;
+      /* number of arguments */
+      return (uint16_t) (mask | 0x001);
     }
     case OPCODE (func_decl_n):
     case OPCODE (array_decl):
     case OPCODE (obj_decl):
-    case OPCODE (this_binding):
-    case OPCODE (with):
-    case OPCODE (throw_value):
-    case OPCODE (is_true_jmp_up):
-    case OPCODE (is_true_jmp_down):
-    case OPCODE (is_false_jmp_up):
-    case OPCODE (is_false_jmp_down):
-    case OPCODE (var_decl):
-    case OPCODE (retval):
+    case OPCODE (reg_var_decl):
     {
-      insert_uids_to_lit_id_map (om, 0x100);
-      break;
+      /* number of arguments, elements or properties, and identifier of last register */
+      return (uint16_t) (mask | 0x010);
     }
-    case OPCODE (ret):
-    case OPCODE (try_block):
     case OPCODE (jmp_up):
     case OPCODE (jmp_down):
-    case OPCODE (nop):
-    case OPCODE (reg_var_decl):
+    case OPCODE (jmp_break_continue):
+    case OPCODE (try_block):
     {
-      insert_uids_to_lit_id_map (om, 0x000);
-      break;
+      /* opcode counter */
+      return (uint16_t) (mask | 0x110);
+    }
+    case OPCODE (is_true_jmp_up):
+    case OPCODE (is_true_jmp_down):
+    case OPCODE (is_false_jmp_up):
+    case OPCODE (is_false_jmp_down):
+    case OPCODE (with):
+    case OPCODE (for_in):
+    {
+      /* opcode counter */
+      return (uint16_t) (mask | 0x011);
     }
     case OPCODE (meta):
     {
-      switch (om->op.data.meta.type)
+      switch (op.data.meta.type)
       {
-        case OPCODE_META_TYPE_VARG_PROP_DATA:
-        case OPCODE_META_TYPE_VARG_PROP_GETTER:
-        case OPCODE_META_TYPE_VARG_PROP_SETTER:
-        {
-          insert_uids_to_lit_id_map (om, 0x011);
-          break;
-        }
-        case OPCODE_META_TYPE_VARG:
-        case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+        case OPCODE_META_TYPE_CALL_SITE_INFO:
         {
-          insert_uids_to_lit_id_map (om, 0x010);
-          break;
+          /* register with 'this' argument */
+          return (uint16_t) (mask | 0x001);
         }
-        case OPCODE_META_TYPE_UNDEFINED:
-        case OPCODE_META_TYPE_END_WITH:
         case OPCODE_META_TYPE_FUNCTION_END:
         case OPCODE_META_TYPE_CATCH:
         case OPCODE_META_TYPE_FINALLY:
-        case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
-        case OPCODE_META_TYPE_CALL_SITE_INFO:
-        case OPCODE_META_TYPE_SCOPE_CODE_FLAGS:
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        {
+          /* opcode counter, or index of lazily compiled function's descriptor */
+          return (uint16_t) (mask | 0x011);
+        }
+        default:
         {
-          insert_uids_to_lit_id_map (om, 0x000);
-          break;
+          return mask;
         }
       }
-      break;
     }
+    default:
+    {
+      return mask;
+    }
+  }
+} /* scopes_tree_get_wide_operands_mask */
+
+static opcode_t
+generate_opcode (scopes_tree tree, opcode_counter_t opc_index, lit_id_hash_table *lit_ids,
+                 wide_operands_t *wide_operands_p)
+{
+  start_new_block_if_necessary ();
+  op_meta *om = extract_op_meta (tree, opc_index);
+  /* Now we should change uids of opcodes.
+     Since different opcodes has different literals/tmps in different places,
+     we should change only them. */
+  wide_operands_t wide_operands;
+  memset (&wide_operands, 0, sizeof (wide_operands));
+  if (change_uid (om, lit_ids, &wide_operands))
+  {
+    wide_operands_p[wide_operands_num++] = wide_operands;
   }
-  return (idx_t) (next_uid - current_uid);
+  return om->op;
 }
 
-/* Before filling literal indexes 'hash' table we shall initiate it with number of neccesary literal indexes.
-   Since bytecode is divided into blocks and id of the block is a part of hash key, we shall divide bytecode
-   into blocks and count unique literal indexes used in each block. */
-size_t
-scopes_tree_count_literals_in_blocks (scopes_tree tree)
+static size_t
+count_new_literals_in_opcode (scopes_tree tree, opcode_counter_t opc_index)
 {
-  assert_tree (tree);
-  size_t result = 0;
-  if (lit_id_to_uid != null_hash)
+  start_new_block_if_necessary ();
+  wide_idx_t current_uid = next_uid;
+  op_meta *om = extract_op_meta (tree, opc_index);
+  if (change_uid (om, NULL, NULL))
   {
-    hash_table_free (lit_id_to_uid);
-    lit_id_to_uid = null_hash;
+    wide_operands_num++;
   }
-  next_uid = 0;
-  global_oc = 0;
+  global_oc++;
+  return (size_t) (next_uid - current_uid);
+}
 
+/* Literal identifiers are counted in the same order, as they are assigned in merge_subscopes. */
+static size_t
+count_literals_in_blocks (scopes_tree tree)
+{
   assert_tree (tree);
+  size_t result = 0;
   opcode_counter_t opc_index;
   bool header = true;
   for (opc_index = 0; opc_index < tree->opcodes_num; opc_index++)
@@ -536,9 +555,9 @@ scopes_tree_count_literals_in_blocks (scopes_tree tree)
     }
     result += count_new_literals_in_opcode (tree, opc_index);
   }
-  for (uint8_t child_id = 0; child_id < tree->t.children_num; child_id++)
+  for (uint32_t child_id = 0; child_id < tree->t.children_num; child_id++)
   {
-    result += scopes_tree_count_literals_in_blocks (*(scopes_tree *) linked_list_element (tree->t.children, child_id));
+    result += count_literals_in_blocks (*(scopes_tree *) linked_list_element (tree->t.children, child_id));
   }
   for (; opc_index < tree->opcodes_num; opc_index++)
   {
@@ -548,6 +567,38 @@ scopes_tree_count_literals_in_blocks (scopes_tree tree)
   return result;
 }
 
+/* Before filling literal indexes 'hash' table we shall initiate it with number of neccesary literal indexes.
+   Since bytecode is divided into blocks and id of the block is a part of hash key, we shall divide bytecode
+   into blocks and count unique literal indexes used in each block.
+   Number of instructions, that require entries in the wide operands table, is counted at the same time. */
+size_t
+scopes_tree_count_literals_in_blocks (scopes_tree tree, /**< scopes tree */
+                                      uint32_t *out_wide_operands_number_p) /**< out: number of entries
+                                                                             *   in the wide operands table */
+{
+  assert_tree (tree);
+  if (lit_id_to_uid != null_hash)
+  {
+    hash_table_free (lit_id_to_uid);
+    lit_id_to_uid = null_hash;
+  }
+  next_uid = 0;
+  global_oc = 0;
+  wide_operands_num = 0;
+
+  const size_t result = count_literals_in_blocks (tree);
+
+  if (lit_id_to_uid != null_hash)
+  {
+    hash_table_free (lit_id_to_uid);
+    lit_id_to_uid = null_hash;
+  }
+
+  *out_wide_operands_number_p = wide_operands_num;
+
+  return result;
+}
+
 /* This function performs functions hoisting.
 
    Each scope consists of four parts:
@@ -563,7 +614,7 @@ scopes_tree_count_literals_in_blocks (scopes_tree tree)
    For each opcodes block (size of block is defined in bytecode-data.h)
    literal indexes 'hash' table is filled. */
 static void
-merge_subscopes (scopes_tree tree, opcode_t *data, lit_id_hash_table *lit_ids)
+merge_subscopes (scopes_tree tree, opcode_t *data, lit_id_hash_table *lit_ids, wide_operands_t *wide_operands_p)
 {
   assert_tree (tree);
   JERRY_ASSERT (data);
@@ -581,21 +632,109 @@ merge_subscopes (scopes_tree tree, opcode_t *data, lit_id_hash_table *lit_ids)
     {
       header = false;
     }
-    data[global_oc] = generate_opcode (tree, opc_index, lit_ids);
+    data[global_oc] = generate_opcode (tree, opc_index, lit_ids, wide_operands_p);
     global_oc++;
   }
-  for (uint8_t child_id = 0; child_id < tree->t.children_num; child_id++)
+  for (uint32_t child_id = 0; child_id < tree->t.children_num; child_id++)
   {
     merge_subscopes (*(scopes_tree *) linked_list_element (tree->t.children, child_id),
-                     data, lit_ids);
+                     data, lit_ids, wide_operands_p);
   }
   for (; opc_index < tree->opcodes_num; opc_index++)
   {
-    data[global_oc] = generate_opcode (tree, opc_index, lit_ids);
+    data[global_oc] = generate_opcode (tree, opc_index, lit_ids, wide_operands_p);
     global_oc++;
   }
 }
 
+#ifdef JERRY_ENABLE_LINE_INFO
+/**
+ * Add an instruction to line table, that is being generated for the byte-code (see also: scopes_tree_line_table)
+ */
+static void
+add_line_table_entry (scopes_tree tree, /**< scope */
+                      opcode_counter_t opc_index, /**< opcode counter of the instruction in the scope */
+                      line_table_entry_t *entries_p, /**< line table (NULL - if entries are only counted) */
+                      uint32_t *entries_num_p) /**< in-out: number of entries in the table */
+{
+  const uint32_t line = *(uint32_t *) linked_list_element (tree->lines, opc_index);
+
+  if (*entries_num_p == 0 || line != global_line)
+  {
+    if (entries_p != NULL)
+    {
+      entries_p[*entries_num_p].oc = global_oc;
+      entries_p[*entries_num_p].line = line;
+    }
+
+    (*entries_num_p)++;
+  }
+
+  global_line = line;
+  global_oc++;
+} /* add_line_table_entry */
+
+/**
+ * Generate line table of the scope and its subscopes, with instructions order of merge_subscopes
+ */
+static void
+merge_subscopes_lines (scopes_tree tree, /**< scope */
+                       line_table_entry_t *entries_p, /**< line table (NULL - if entries are only counted) */
+                       uint32_t *entries_num_p) /**< in-out: number of entries in the table */
+{
+  assert_tree (tree);
+  opcode_counter_t opc_index;
+  bool header = true;
+  for (opc_index = 0; opc_index < tree->opcodes_num; opc_index++)
+  {
+    op_meta *om = extract_op_meta (tree, opc_index);
+    if (om->op.op_idx != OPCODE (var_decl)
+        && om->op.op_idx != OPCODE (meta) && !header)
+    {
+      break;
+    }
+    if (om->op.op_idx == OPCODE (reg_var_decl))
+    {
+      header = false;
+    }
+    add_line_table_entry (tree, opc_index, entries_p, entries_num_p);
+  }
+  for (uint32_t child_id = 0; child_id < tree->t.children_num; child_id++)
+  {
+    merge_subscopes_lines (*(scopes_tree *) linked_list_element (tree->t.children, child_id),
+                           entries_p, entries_num_p);
+  }
+  for (; opc_index < tree->opcodes_num; opc_index++)
+  {
+    add_line_table_entry (tree, opc_index, entries_p, entries_num_p);
+  }
+} /* merge_subscopes_lines */
+
+/**
+ * Generate line table of byte-code, produced by scopes_tree_raw_data
+ *
+ * The table contains an entry for each instruction, which source code line differs from line
+ * of the preceding instruction, so the entries are sorted by opcode counters.
+ *
+ * @return number of entries in the table
+ */
+uint32_t
+scopes_tree_line_table (scopes_tree tree, /**< scopes tree */
+                        line_table_entry_t *entries_p) /**< buffer for the table (NULL - to only count
+                                                        *   number of the table's entries) */
+{
+  assert_tree (tree);
+
+  global_oc = 0;
+  global_line = 0;
+
+  uint32_t entries_num = 0;
+  merge_subscopes_lines (tree, entries_p, &entries_num);
+
+  return entries_num;
+} /* scopes_tree_line_table */
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /* Postparser.
    Init literal indexes 'hash' table.
    Reorder function declarations.
@@ -604,7 +743,10 @@ opcode_t *
 scopes_tree_raw_data (scopes_tree tree, /**< scopes tree to convert to byte-code array */
                       uint8_t *buffer_p, /**< buffer for byte-code array and literal identifiers hash table */
                       size_t opcodes_array_size, /**< size of space for byte-code array */
-                      lit_id_hash_table *lit_ids) /**< literal identifiers hash table */
+                      lit_id_hash_table *lit_ids, /**< literal identifiers hash table */
+                      wide_operands_t *wide_operands_p) /**< wide operands table, with number of entries,
+                                                         *   counted by scopes_tree_count_literals_in_blocks
+                                                         *   (NULL - if there are no such entries) */
 {
   JERRY_ASSERT (lit_ids);
   assert_tree (tree);
@@ -615,6 +757,7 @@ scopes_tree_raw_data (scopes_tree tree, /**< scopes tree to convert to byte-code
   }
   next_uid = 0;
   global_oc = 0;
+  wide_operands_num = 0;
 
   /* Dump bytecode and fill literal indexes 'hash' table. */
   JERRY_ASSERT (opcodes_array_size >=
@@ -624,14 +767,18 @@ scopes_tree_raw_data (scopes_tree tree, /**< scopes tree to convert to byte-code
   memset (opcodes_data, 0, opcodes_array_size);
 
   opcode_t *opcodes = (opcode_t *)(((uint8_t*) opcodes_data) + sizeof (opcodes_header_t));
-  merge_subscopes (tree, opcodes, lit_ids);
+  merge_subscopes (tree, opcodes, lit_ids, wide_operands_p);
   if (lit_id_to_uid != null_hash)
   {
     hash_table_free (lit_id_to_uid);
     lit_id_to_uid = null_hash;
   }
 
+  JERRY_ASSERT (wide_operands_p != NULL || wide_operands_num == 0);
+
   MEM_CP_SET_POINTER (opcodes_data->lit_id_hash_cp, lit_ids);
+  MEM_CP_SET_POINTER (opcodes_data->wide_operands_cp, wide_operands_p);
+  opcodes_data->wide_operands_number = wide_operands_num;
 
   return opcodes;
 } /* scopes_tree_raw_data */
@@ -672,6 +819,9 @@ scopes_tree_init (scopes_tree parent)
   tree->opcodes_num = 0;
   tree->strict_mode = 0;
   tree->opcodes = linked_list_init (sizeof (op_meta));
+#ifdef JERRY_ENABLE_LINE_INFO
+  tree->lines = linked_list_init (sizeof (uint32_t));
+#endif /* JERRY_ENABLE_LINE_INFO */
   return tree;
 }
 
@@ -681,12 +831,15 @@ scopes_tree_free (scopes_tree tree)
   assert_tree (tree);
   if (tree->t.children_num != 0)
   {
-    for (uint8_t i = 0; i < tree->t.children_num; ++i)
+    for (uint32_t i = 0; i < tree->t.children_num; ++i)
     {
       scopes_tree_free (*(scopes_tree *) linked_list_element (tree->t.children, i));
     }
     linked_list_free (tree->t.children);
   }
   linked_list_free (tree->opcodes);
+#ifdef JERRY_ENABLE_LINE_INFO
+  linked_list_free (tree->lines);
+#endif /* JERRY_ENABLE_LINE_INFO */
   jsp_mm_free (tree);
 }
@@ -23,6 +23,7 @@
 #include "opcodes.h"
 #include "lit-id-hash-table.h"
 #include "lit-literal.h"
+#include "bytecode-data.h"
 
 #define NOT_A_LITERAL (lit_cpointer_t::null_cp ())
 
@@ -36,13 +37,16 @@ typedef struct tree_header
 {
   struct tree_header *parent;
   linked_list children;
-  uint8_t children_num;
+  uint32_t children_num;
 } tree_header;
 
 typedef struct
 {
   tree_header t;
   linked_list opcodes;
+#ifdef JERRY_ENABLE_LINE_INFO
+  linked_list lines; /**< source code lines of the instructions (uint32_t values, parallel to opcodes list) */
+#endif /* JERRY_ENABLE_LINE_INFO */
   opcode_counter_t opcodes_num;
   unsigned strict_mode:1;
 } scopes_tree_int;
@@ -56,9 +60,15 @@ void scopes_tree_add_op_meta (scopes_tree, op_meta);
 void scopes_tree_set_op_meta (scopes_tree, opcode_counter_t, op_meta);
 void scopes_tree_set_opcodes_num (scopes_tree, opcode_counter_t);
 op_meta scopes_tree_op_meta (scopes_tree, opcode_counter_t);
-size_t scopes_tree_count_literals_in_blocks (scopes_tree);
+size_t scopes_tree_count_literals_in_blocks (scopes_tree, uint32_t *);
 opcode_counter_t scopes_tree_count_opcodes (scopes_tree);
-opcode_t *scopes_tree_raw_data (scopes_tree, uint8_t *, size_t, lit_id_hash_table *);
+opcode_t *scopes_tree_raw_data (scopes_tree, uint8_t *, size_t, lit_id_hash_table *, wide_operands_t *);
+uint16_t scopes_tree_get_literal_operands_mask (opcode_t);
+uint16_t scopes_tree_get_wide_operands_mask (opcode_t);
+#ifdef JERRY_ENABLE_LINE_INFO
+void scopes_tree_set_op_line (scopes_tree, opcode_counter_t, uint32_t);
+uint32_t scopes_tree_line_table (scopes_tree, line_table_entry_t *);
+#endif /* JERRY_ENABLE_LINE_INFO */
 void scopes_tree_set_strict_mode (scopes_tree, bool);
 bool scopes_tree_strict_mode (scopes_tree);
 
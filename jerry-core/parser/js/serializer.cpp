@@ -17,15 +17,114 @@
 #include "bytecode-data.h"
 #include "pretty-printer.h"
 #include "array-list.h"
+#include "jcontext.h"
+#include "opcodes-native-call.h"
 
-static bytecode_data_t bytecode_data;
-static scopes_tree current_scope;
-static bool print_opcodes;
+static JERRY_THREAD_LOCAL scopes_tree current_scope;
+static JERRY_THREAD_LOCAL bool print_opcodes;
 
 static void
 serializer_print_opcodes (const opcode_t *opcodes_p,
                           size_t opcodes_count);
 
+/**
+ * Flag, marking compressed pointers to byte-code, that is executed in place from a snapshot
+ * (other bits of such pointer contain compressed pointer to the byte-code's external_opcodes_header_t)
+ *
+ * See also:
+ *          serializer_compress_bytecode_pointer
+ */
+#define SERIALIZER_EXTERNAL_BYTECODE_FLAG (1u << 31)
+
+JERRY_STATIC_ASSERT (MEM_CP_WIDTH < 31);
+
+/**
+ * Find header of byte-code, executed in place from a snapshot
+ *
+ * Note:
+ *      byte-code on the heap is recognized by its address, without walking the list of headers
+ *      (the list contains at most one header, as a context executes at most one snapshot)
+ *
+ * @return pointer to the header - if the byte-code array is located in a snapshot,
+ *         NULL - if the byte-code array is located on the heap.
+ */
+static const external_opcodes_header_t *
+serializer_find_external_bytecode (const opcode_t *opcodes_p) /**< byte-code array */
+{
+  if (likely (JERRY_CONTEXT (bytecode_data).external_opcodes_cp == MEM_CP_NULL
+              || mem_is_heap_pointer (opcodes_p)))
+  {
+    return NULL;
+  }
+
+  mem_cpointer_t header_cp = JERRY_CONTEXT (bytecode_data).external_opcodes_cp;
+
+  while (header_cp != MEM_CP_NULL)
+  {
+    const external_opcodes_header_t *header_p = MEM_CP_GET_NON_NULL_POINTER (const external_opcodes_header_t,
+                                                                             header_cp);
+
+    if (header_p->opcodes_p == opcodes_p)
+    {
+      return header_p;
+    }
+
+    header_cp = header_p->next_external_opcodes_cp;
+  }
+
+  return NULL;
+} /* serializer_find_external_bytecode */
+
+/**
+ * Compress pointer to byte-code array
+ *
+ * Note:
+ *      unlike the heap's compressed pointers, the value can refer to byte-code, executed in place from a snapshot
+ *
+ * @return compressed pointer
+ */
+uint32_t
+serializer_compress_bytecode_pointer (const opcode_t *opcodes_p) /**< byte-code array */
+{
+  JERRY_ASSERT (opcodes_p != NULL);
+
+  const external_opcodes_header_t *external_header_p = serializer_find_external_bytecode (opcodes_p);
+
+  mem_cpointer_t cp;
+
+  if (external_header_p != NULL)
+  {
+    MEM_CP_SET_NON_NULL_POINTER (cp, external_header_p);
+
+    return (SERIALIZER_EXTERNAL_BYTECODE_FLAG | cp);
+  }
+
+  MEM_CP_SET_NON_NULL_POINTER (cp, opcodes_p);
+
+  return cp;
+} /* serializer_compress_bytecode_pointer */
+
+/**
+ * Decompress pointer to byte-code array
+ *
+ * See also:
+ *          serializer_compress_bytecode_pointer
+ *
+ * @return byte-code array
+ */
+const opcode_t *
+serializer_decompress_bytecode_pointer (uint32_t compressed_pointer) /**< compressed pointer */
+{
+  if (compressed_pointer & SERIALIZER_EXTERNAL_BYTECODE_FLAG)
+  {
+    mem_cpointer_t header_cp = (mem_cpointer_t) (compressed_pointer & ~SERIALIZER_EXTERNAL_BYTECODE_FLAG);
+
+    return MEM_CP_GET_NON_NULL_POINTER (const external_opcodes_header_t, header_cp)->opcodes_p;
+  }
+
+  return MEM_CP_GET_NON_NULL_POINTER (const opcode_t, (mem_cpointer_t) compressed_pointer);
+} /* serializer_decompress_bytecode_pointer */
+
 op_meta
 serializer_get_op_meta (opcode_counter_t oc)
 {
@@ -50,16 +149,83 @@ serializer_get_opcode (const opcode_t *opcodes_p, /**< pointer to byte-code arra
   }
   else
   {
-    JERRY_ASSERT (oc < GET_BYTECODE_HEADER (opcodes_p)->instructions_number);
+#ifndef JERRY_NDEBUG
+    const external_opcodes_header_t *external_header_p = serializer_find_external_bytecode (opcodes_p);
+
+    JERRY_ASSERT (oc < (external_header_p != NULL ? external_header_p->instructions_number
+                                                  : GET_BYTECODE_HEADER (opcodes_p)->instructions_number));
+#endif /* !JERRY_NDEBUG */
+
     return opcodes_p[oc];
   }
 } /* serializer_get_opcode */
 
+/**
+ * Get value of instruction's operand from wide operands table of the byte-code
+ * (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * @return value of the operand
+ */
+wide_idx_t
+serializer_get_wide_operand (const opcode_t *opcodes_p, /**< pointer to bytecode (or NULL,
+                                                         *   if the latest bytecode should be used) */
+                             opcode_counter_t oc, /**< opcode counter of the instruction */
+                             idx_t operand) /**< operand of the instruction (OPCODE_WIDE_OPERAND_FIRST + i) */
+{
+  JERRY_ASSERT (OPCODE_IS_WIDE_OPERAND (operand));
+
+  if (opcodes_p == NULL)
+  {
+    opcodes_p = JERRY_CONTEXT (bytecode_data).opcodes;
+  }
+
+  const external_opcodes_header_t *external_header_p = serializer_find_external_bytecode (opcodes_p);
+
+  const wide_operands_t *table_p;
+  uint32_t entries_number;
+
+  if (external_header_p != NULL)
+  {
+    table_p = external_header_p->wide_operands_p;
+    entries_number = external_header_p->wide_operands_number;
+  }
+  else
+  {
+    const opcodes_header_t *header_p = GET_BYTECODE_HEADER (opcodes_p);
+
+    table_p = MEM_CP_GET_POINTER (const wide_operands_t, header_p->wide_operands_cp);
+    entries_number = header_p->wide_operands_number;
+  }
+
+  /* the table is sorted by opcode counters */
+  uint32_t low = 0;
+  uint32_t high = entries_number;
+
+  while (low < high)
+  {
+    const uint32_t middle = low + (high - low) / 2;
+
+    if (table_p[middle].oc < oc)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  JERRY_ASSERT (low < entries_number && table_p[low].oc == oc);
+
+  return table_p[low].operands[operand - OPCODE_WIDE_OPERAND_FIRST];
+} /* serializer_get_wide_operand */
+
 /**
  * Convert literal id (operand value of instruction) to compressed pointer to literal
  *
  * Bytecode is divided into blocks of fixed size and each block has independent encoding of variable names,
- * which are represented by 8 bit numbers - ids.
+ * which are represented by 8 bit numbers - ids (ids, that don't fit into 7 bits, are stored
+ * in the wide operands table, see also: OPCODE_WIDE_OPERAND_FIRST).
  * This function performs conversion from id to literal.
  *
  * @return compressed pointer to literal
@@ -69,18 +235,48 @@ serializer_get_literal_cp_by_uid (uint8_t id, /**< literal idx */
                                   const opcode_t *opcodes_p, /**< pointer to bytecode */
                                   opcode_counter_t oc) /**< position in the bytecode */
 {
-  lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p == NULL ? bytecode_data.opcodes : opcodes_p);
+  wide_idx_t uid = id;
+
+  if (unlikely (OPCODE_IS_WIDE_OPERAND (id)))
+  {
+    uid = serializer_get_wide_operand (opcodes_p, oc, id);
+
+    JERRY_ASSERT ((uid & OPCODE_WIDE_OPERAND_LITERAL_FLAG) != 0);
+    uid = (wide_idx_t) (uid & ~OPCODE_WIDE_OPERAND_LITERAL_FLAG);
+  }
+
+  if (opcodes_p != NULL)
+  {
+    const external_opcodes_header_t *external_header_p = serializer_find_external_bytecode (opcodes_p);
+
+    if (unlikely (external_header_p != NULL))
+    {
+      const lit_cpointer_t *lit_cps_p = (const lit_cpointer_t *) (external_header_p + 1);
+      const size_t blocks_count = external_header_p->instructions_number / BLOCK_SIZE + 1u;
+
+      uint32_t lit_index = lit_id_hash_table_lookup_in_snapshot (external_header_p->lit_id_hash_table_p,
+                                                                 blocks_count,
+                                                                 uid,
+                                                                 oc);
+      JERRY_ASSERT (lit_index < external_header_p->lits_number);
+
+      return lit_cps_p[lit_index];
+    }
+  }
+
+  lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p == NULL ? JERRY_CONTEXT (bytecode_data).opcodes
+                                                                                   : opcodes_p);
   if (lit_id_hash == null_hash)
   {
     return INVALID_LITERAL;
   }
-  return lit_id_hash_table_lookup (lit_id_hash, id, oc);
+  return lit_id_hash_table_lookup (lit_id_hash, uid, oc);
 } /* serializer_get_literal_cp_by_uid */
 
 void
 serializer_set_strings_buffer (const ecma_char_t *s)
 {
-  bytecode_data.strings_buffer = s;
+  JERRY_CONTEXT (bytecode_data).strings_buffer = s;
 }
 
 void
@@ -92,10 +288,11 @@ serializer_set_scope (scopes_tree new_scope)
 const opcode_t *
 serializer_merge_scopes_into_bytecode (void)
 {
-  bytecode_data.opcodes_count = scopes_tree_count_opcodes (current_scope);
+  JERRY_CONTEXT (bytecode_data).opcodes_count = scopes_tree_count_opcodes (current_scope);
 
-  const size_t buckets_count = scopes_tree_count_literals_in_blocks (current_scope);
-  const size_t blocks_count = (size_t) bytecode_data.opcodes_count / BLOCK_SIZE + 1;
+  uint32_t wide_operands_number;
+  const size_t buckets_count = scopes_tree_count_literals_in_blocks (current_scope, &wide_operands_number);
+  const size_t blocks_count = (size_t) JERRY_CONTEXT (bytecode_data).opcodes_count / BLOCK_SIZE + 1;
   const opcode_counter_t opcodes_count = scopes_tree_count_opcodes (current_scope);
 
   const size_t opcodes_array_size = JERRY_ALIGNUP (sizeof (opcodes_header_t) + opcodes_count * sizeof (opcode_t),
@@ -103,25 +300,51 @@ serializer_merge_scopes_into_bytecode (void)
   const size_t lit_id_hash_table_size = JERRY_ALIGNUP (lit_id_hash_table_get_size_for_table (buckets_count,
                                                                                              blocks_count),
                                                        MEM_ALIGNMENT);
+  const size_t wide_operands_table_size = JERRY_ALIGNUP (wide_operands_number * sizeof (wide_operands_t),
+                                                         MEM_ALIGNMENT);
 
-  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (opcodes_array_size + lit_id_hash_table_size,
+  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (opcodes_array_size
+                                                       + lit_id_hash_table_size
+                                                       + wide_operands_table_size,
                                                        MEM_HEAP_ALLOC_LONG_TERM);
 
   lit_id_hash_table *lit_id_hash = lit_id_hash_table_init (buffer_p + opcodes_array_size,
                                                            lit_id_hash_table_size,
                                                            buckets_count, blocks_count);
 
-  const opcode_t *opcodes_p = scopes_tree_raw_data (current_scope, buffer_p, opcodes_array_size, lit_id_hash);
+  wide_operands_t *wide_operands_p = NULL;
+
+  if (wide_operands_number != 0)
+  {
+    wide_operands_p = (wide_operands_t *) (buffer_p + opcodes_array_size + lit_id_hash_table_size);
+  }
+
+  const opcode_t *opcodes_p = scopes_tree_raw_data (current_scope, buffer_p, opcodes_array_size,
+                                                    lit_id_hash, wide_operands_p);
+  JERRY_ASSERT (GET_BYTECODE_HEADER (opcodes_p)->wide_operands_number == wide_operands_number);
 
   opcodes_header_t *header_p = (opcodes_header_t*) buffer_p;
-  MEM_CP_SET_POINTER (header_p->next_opcodes_cp, bytecode_data.opcodes);
+  MEM_CP_SET_POINTER (header_p->next_opcodes_cp, JERRY_CONTEXT (bytecode_data).opcodes);
   header_p->instructions_number = opcodes_count;
-  bytecode_data.opcodes = opcodes_p;
+  JERRY_CONTEXT (bytecode_data).opcodes = opcodes_p;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  const uint32_t line_table_entries_number = scopes_tree_line_table (current_scope, NULL);
+  JERRY_ASSERT (line_table_entries_number != 0);
+
+  line_table_entry_t *line_table_p;
+  line_table_p = (line_table_entry_t *) mem_heap_alloc_block (line_table_entries_number * sizeof (line_table_entry_t),
+                                                              MEM_HEAP_ALLOC_LONG_TERM);
+  scopes_tree_line_table (current_scope, line_table_p);
+
+  MEM_CP_SET_NON_NULL_POINTER (header_p->line_table_cp, line_table_p);
+  header_p->line_table_entries_number = line_table_entries_number;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
   if (print_opcodes)
   {
     lit_dump_literals ();
-    serializer_print_opcodes (opcodes_p, bytecode_data.opcodes_count);
+    serializer_print_opcodes (opcodes_p, JERRY_CONTEXT (bytecode_data).opcodes_count);
   }
 
   return opcodes_p;
@@ -134,6 +357,12 @@ serializer_dump_op_meta (op_meta op)
 
   scopes_tree_add_op_meta (current_scope, op);
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  scopes_tree_set_op_line (current_scope,
+                           (opcode_counter_t) (scopes_tree_opcodes_num (current_scope) - 1),
+                           lexer_get_current_line ());
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 #ifdef JERRY_ENABLE_PRETTY_PRINTER
   if (print_opcodes)
   {
@@ -202,8 +431,12 @@ serializer_init ()
   current_scope = NULL;
   print_opcodes = false;
 
-  bytecode_data.strings_buffer = NULL;
-  bytecode_data.opcodes = NULL;
+  JERRY_CONTEXT (bytecode_data).strings_buffer = NULL;
+  JERRY_CONTEXT (bytecode_data).opcodes = NULL;
+  JERRY_CONTEXT (bytecode_data).external_opcodes_cp = MEM_CP_NULL;
+  JERRY_CONTEXT (bytecode_data).lazy_functions_cp = MEM_CP_NULL;
+  JERRY_CONTEXT (bytecode_data).lazy_functions_number = 0;
+  JERRY_CONTEXT (bytecode_data).lazy_functions_capacity = 0;
 
   lit_init ();
 }
@@ -216,18 +449,911 @@ void serializer_set_show_opcodes (bool show_opcodes)
 void
 serializer_free (void)
 {
-  if (bytecode_data.strings_buffer)
+  if (JERRY_CONTEXT (bytecode_data).strings_buffer)
   {
-    mem_heap_free_block ((uint8_t *) bytecode_data.strings_buffer);
+    mem_heap_free_block ((uint8_t *) JERRY_CONTEXT (bytecode_data).strings_buffer);
   }
 
   lit_finalize ();
 
-  while (bytecode_data.opcodes != NULL)
+  while (JERRY_CONTEXT (bytecode_data).opcodes != NULL)
+  {
+    opcodes_header_t *header_p = GET_BYTECODE_HEADER (JERRY_CONTEXT (bytecode_data).opcodes);
+    JERRY_CONTEXT (bytecode_data).opcodes = MEM_CP_GET_POINTER (opcode_t, header_p->next_opcodes_cp);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (header_p->line_table_cp != MEM_CP_NULL)
+    {
+      mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (line_table_entry_t, header_p->line_table_cp));
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+    mem_heap_free_block (header_p);
+  }
+
+  while (JERRY_CONTEXT (bytecode_data).external_opcodes_cp != MEM_CP_NULL)
   {
-    opcodes_header_t *header_p = GET_BYTECODE_HEADER (bytecode_data.opcodes);
-    bytecode_data.opcodes = MEM_CP_GET_POINTER (opcode_t, header_p->next_opcodes_cp);
+    mem_cpointer_t header_cp = JERRY_CONTEXT (bytecode_data).external_opcodes_cp;
+    external_opcodes_header_t *header_p = MEM_CP_GET_NON_NULL_POINTER (external_opcodes_header_t, header_cp);
+    JERRY_CONTEXT (bytecode_data).external_opcodes_cp = header_p->next_external_opcodes_cp;
 
     mem_heap_free_block (header_p);
   }
+
+  if (JERRY_CONTEXT (bytecode_data).lazy_functions_cp != MEM_CP_NULL)
+  {
+    mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (lazy_function_t,
+                                                      JERRY_CONTEXT (bytecode_data).lazy_functions_cp));
+    JERRY_CONTEXT (bytecode_data).lazy_functions_cp = MEM_CP_NULL;
+  }
 }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+/**
+ * Get source code line of an instruction
+ *
+ * @return line number - if the byte-code has a line table,
+ *         0 - otherwise (byte-code, loaded from a snapshot).
+ */
+uint32_t
+serializer_get_line (const opcode_t *opcodes_p, /**< byte-code array */
+                     opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  if (serializer_find_external_bytecode (opcodes_p) != NULL)
+  {
+    return 0;
+  }
+
+  const opcodes_header_t *header_p = GET_BYTECODE_HEADER (opcodes_p);
+
+  if (header_p->line_table_entries_number == 0)
+  {
+    return 0;
+  }
+
+  const line_table_entry_t *line_table_p = MEM_CP_GET_NON_NULL_POINTER (const line_table_entry_t,
+                                                                        header_p->line_table_cp);
+
+  /* binary search of the last entry, which opcode counter is not greater than the instruction's one */
+  uint32_t lower = 0;
+  uint32_t upper = header_p->line_table_entries_number;
+
+  while (upper - lower > 1)
+  {
+    const uint32_t middle = lower + (upper - lower) / 2;
+
+    if (line_table_p[middle].oc <= oc)
+    {
+      lower = middle;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+
+  return line_table_p[lower].line;
+} /* serializer_get_line */
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+/**
+ * Check whether one more lazily compiled function can be registered
+ *
+ * Note:
+ *      index of a function's descriptor is stored in two idx_t operands of the stub's 'meta' instruction,
+ *      so number of lazily compiled functions is limited with SERIALIZER_LAZY_FUNCTIONS_LIMIT.
+ *
+ * @return true - if the limit of lazily compiled functions is not reached yet,
+ *         false - otherwise.
+ */
+bool
+serializer_can_register_lazy_function (void)
+{
+  return (JERRY_CONTEXT (bytecode_data).lazy_functions_number < SERIALIZER_LAZY_FUNCTIONS_LIMIT);
+} /* serializer_can_register_lazy_function */
+
+/**
+ * Register descriptor of a function, which body is compiled upon first call
+ *
+ * @return index of the descriptor
+ */
+uint32_t
+serializer_register_lazy_function (const jerry_api_char_t *body_p, /**< source code of the body */
+                                   size_t body_size, /**< size of the source code */
+                                   uint32_t first_line, /**< line of the body's opening brace */
+                                   lit_cpointer_t name_lit_cp, /**< literal with the function's name
+                                                                *   (NOT_A_LITERAL - for anonymous functions) */
+                                   bool is_strict) /**< is the function's code strict mode code */
+{
+  JERRY_ASSERT (serializer_can_register_lazy_function ());
+
+  bytecode_data_t *bytecode_data_p = &JERRY_CONTEXT (bytecode_data);
+  lazy_function_t *lazy_functions_p = MEM_CP_GET_POINTER (lazy_function_t, bytecode_data_p->lazy_functions_cp);
+
+  if (bytecode_data_p->lazy_functions_number == bytecode_data_p->lazy_functions_capacity)
+  {
+    uint32_t new_capacity = JERRY_MAX (bytecode_data_p->lazy_functions_capacity * 2u, 16u);
+    new_capacity = JERRY_MIN (new_capacity, SERIALIZER_LAZY_FUNCTIONS_LIMIT);
+
+    lazy_function_t *new_lazy_functions_p;
+    new_lazy_functions_p = (lazy_function_t *) mem_heap_alloc_block (new_capacity * sizeof (lazy_function_t),
+                                                                     MEM_HEAP_ALLOC_LONG_TERM);
+
+    if (lazy_functions_p != NULL)
+    {
+      memcpy (new_lazy_functions_p,
+              lazy_functions_p,
+              bytecode_data_p->lazy_functions_number * sizeof (lazy_function_t));
+      mem_heap_free_block (lazy_functions_p);
+    }
+
+    lazy_functions_p = new_lazy_functions_p;
+    MEM_CP_SET_NON_NULL_POINTER (bytecode_data_p->lazy_functions_cp, lazy_functions_p);
+    bytecode_data_p->lazy_functions_capacity = new_capacity;
+  }
+
+  uint32_t lazy_function_idx = bytecode_data_p->lazy_functions_number++;
+
+  lazy_function_t *lazy_function_p = &lazy_functions_p[lazy_function_idx];
+  lazy_function_p->body_p = body_p;
+  lazy_function_p->body_size = body_size;
+  lazy_function_p->opcodes_p = NULL;
+  lazy_function_p->first_line = first_line;
+  lazy_function_p->name_lit_cp = name_lit_cp;
+  lazy_function_p->is_strict = is_strict;
+
+  return lazy_function_idx;
+} /* serializer_register_lazy_function */
+
+/**
+ * Get descriptor of a lazily compiled function
+ *
+ * @return pointer to the descriptor
+ */
+lazy_function_t *
+serializer_get_lazy_function (uint32_t lazy_function_idx) /**< index of the descriptor */
+{
+  JERRY_ASSERT (lazy_function_idx < JERRY_CONTEXT (bytecode_data).lazy_functions_number);
+
+  lazy_function_t *lazy_functions_p = MEM_CP_GET_NON_NULL_POINTER (lazy_function_t,
+                                                                   JERRY_CONTEXT (bytecode_data).lazy_functions_cp);
+
+  return &lazy_functions_p[lazy_function_idx];
+} /* serializer_get_lazy_function */
+
+#define OP_ARGS_NUMBER_0(a, name) 0u,
+#define OP_ARGS_NUMBER_1(a, name, arg1) 1u,
+#define OP_ARGS_NUMBER_2(a, name, arg1, arg2) 2u,
+#define OP_ARGS_NUMBER_3(a, name, arg1, arg2, arg3) 3u,
+
+/**
+ * Numbers of opcodes' operands
+ */
+static const uint8_t serializer_opcode_operands_number[LAST_OP] =
+{
+  OP_ARGS_LIST (OP_ARGS_NUMBER)
+};
+
+#undef OP_ARGS_NUMBER_0
+#undef OP_ARGS_NUMBER_1
+#undef OP_ARGS_NUMBER_2
+#undef OP_ARGS_NUMBER_3
+
+/**
+ * Value of serializer_get_counter_operand_index, indicating that the instruction has no opcode counter operands
+ */
+#define SERIALIZER_NO_COUNTER_OPERAND (3u)
+
+/**
+ * Get position of the pair of operands, representing an opcode counter (see also: calc_opcode_counter_from_idx_idx)
+ *
+ * @return index of the pair's first operand,
+ *         or SERIALIZER_NO_COUNTER_OPERAND - if the instruction doesn't have such operands.
+ */
+static uint32_t
+serializer_get_counter_operand_index (opcode_t op) /**< instruction */
+{
+  switch (op.op_idx)
+  {
+    case __op__idx_jmp_up:
+    case __op__idx_jmp_down:
+    case __op__idx_jmp_break_continue:
+    case __op__idx_try_block:
+    {
+      return 0;
+    }
+    case __op__idx_is_true_jmp_up:
+    case __op__idx_is_true_jmp_down:
+    case __op__idx_is_false_jmp_up:
+    case __op__idx_is_false_jmp_down:
+    case __op__idx_for_in:
+    case __op__idx_with:
+    {
+      return 1;
+    }
+    case __op__idx_meta:
+    {
+      switch (op.data.meta.type)
+      {
+        case OPCODE_META_TYPE_FUNCTION_END:
+        case OPCODE_META_TYPE_CATCH:
+        case OPCODE_META_TYPE_FINALLY:
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        {
+          return 1;
+        }
+        default:
+        {
+          return SERIALIZER_NO_COUNTER_OPERAND;
+        }
+      }
+    }
+    default:
+    {
+      return SERIALIZER_NO_COUNTER_OPERAND;
+    }
+  }
+} /* serializer_get_counter_operand_index */
+
+/**
+ * Check whether the specified operand of the instruction can refer to a literal
+ *
+ * @return true / false
+ */
+static bool
+serializer_is_literal_operand (opcode_t op, /**< instruction */
+                               uint32_t operand_index) /**< index of the operand */
+{
+  JERRY_ASSERT (operand_index < 3);
+
+  return (scopes_tree_get_literal_operands_mask (op) & (0x100u >> (4 * operand_index))) != 0;
+} /* serializer_is_literal_operand */
+
+/**
+ * Scope of byte-code, loaded from a snapshot (global code or a function's code),
+ * see also: serializer_check_loaded_bytecode
+ */
+typedef struct
+{
+  opcode_counter_t start_oc; /**< position of the scope's first instruction (meta SCOPE_CODE_FLAGS) */
+  opcode_counter_t end_oc; /**< position, following the scope's last instruction */
+  wide_idx_t min_reg_num; /**< first register of the scope */
+  wide_idx_t max_reg_num; /**< last register of the scope */
+} serializer_loaded_scope_t;
+
+/**
+ * Number of scopes, nested into each other, that are checked without allocation of heap memory
+ * (see also: serializer_check_loaded_bytecode)
+ */
+#define SERIALIZER_LOADED_SCOPES_ON_STACK_NUMBER (8u)
+
+/**
+ * Literals, referred to by byte-code, loaded from a snapshot
+ */
+typedef struct
+{
+  lit_id_hash_table *lit_id_hash_p; /**< hash table on the heap (or NULL - if the snapshot's section is used) */
+  const uint8_t *lit_id_hash_table_section_p; /**< hash table's snapshot section (if lit_id_hash_p is NULL) */
+  const lit_cpointer_t *lit_cps_p; /**< compressed pointers to the snapshot's literals, in order of the literal table
+                                    *   (if lit_id_hash_p is NULL) */
+  size_t blocks_count; /**< number of opcode blocks */
+} serializer_loaded_literals_t;
+
+/**
+ * Check operand of an instruction, loaded from a snapshot, that can refer to a literal
+ *
+ * The operand should be either a register of the scope, or an identifier of a literal, registered
+ * in the instruction's block (number literals can be referred to only by assignments of numbers).
+ *
+ * @return true - if the operand is correct,
+ *         false - otherwise.
+ */
+static bool
+serializer_check_loaded_literal_operand (wide_idx_t value, /**< value of the operand (resolved,
+                                                            *   if it is stored in the wide operands table) */
+                                         bool is_wide, /**< is the value stored in the wide operands table */
+                                         const serializer_loaded_scope_t *scope_p, /**< scope of the instruction */
+                                         const serializer_loaded_literals_t *literals_p, /**< literals */
+                                         size_t block_ids_number, /**< number of literal identifiers
+                                                                   *   in the instruction's block */
+                                         opcode_counter_t oc, /**< position of the instruction */
+                                         bool is_number_expected) /**< should the literal be a number literal */
+{
+  wide_idx_t uid;
+
+  if (is_wide)
+  {
+    if ((value & OPCODE_WIDE_OPERAND_LITERAL_FLAG) == 0)
+    {
+      return (!is_number_expected && value >= scope_p->min_reg_num && value <= scope_p->max_reg_num);
+    }
+
+    uid = (wide_idx_t) (value & ~OPCODE_WIDE_OPERAND_LITERAL_FLAG);
+  }
+  else if (value >= OPCODE_REG_FIRST)
+  {
+    return (!is_number_expected
+            && value <= OPCODE_REG_GENERAL_LAST
+            && value >= scope_p->min_reg_num
+            && value <= scope_p->max_reg_num);
+  }
+  else
+  {
+    uid = value;
+  }
+
+  if (uid >= block_ids_number)
+  {
+    return false;
+  }
+
+  lit_cpointer_t lit_cp;
+
+  if (literals_p->lit_id_hash_p != NULL)
+  {
+    lit_cp = lit_id_hash_table_lookup (literals_p->lit_id_hash_p, uid, oc);
+  }
+  else
+  {
+    lit_cp = literals_p->lit_cps_p[lit_id_hash_table_lookup_in_snapshot (literals_p->lit_id_hash_table_section_p,
+                                                                         literals_p->blocks_count,
+                                                                         uid,
+                                                                         oc)];
+  }
+
+  return (lit_get_literal_by_cp (lit_cp)->get_type () == LIT_NUMBER_T) == is_number_expected;
+} /* serializer_check_loaded_literal_operand */
+
+/**
+ * Check opcode counter operand of an instruction, loaded from a snapshot
+ *
+ * Targets of jumps and ends of blocks should be inside of the instruction's scope. For declarations of functions,
+ * the function's scope, starting right after the instruction, should be inside of the instruction's scope
+ * and should contain at least the scope's header and 'ret'.
+ *
+ * @return true - if the counter is correct,
+ *         false - otherwise.
+ */
+static bool
+serializer_check_loaded_counter (opcode_t op, /**< instruction */
+                                 opcode_counter_t oc, /**< position of the instruction */
+                                 opcode_counter_t counter, /**< value of the counter */
+                                 const serializer_loaded_scope_t *scope_p) /**< scope of the instruction */
+{
+  switch (op.op_idx)
+  {
+    case __op__idx_jmp_up:
+    case __op__idx_is_true_jmp_up:
+    case __op__idx_is_false_jmp_up:
+    {
+      return counter <= oc - scope_p->start_oc;
+    }
+    default:
+    {
+      if (op.op_idx == __op__idx_meta && op.data.meta.type == OPCODE_META_TYPE_FUNCTION_END
+          && counter <= 3)
+      {
+        return false;
+      }
+
+      return counter < scope_p->end_oc - oc;
+    }
+  }
+} /* serializer_check_loaded_counter */
+
+/**
+ * Check byte-code, loaded from a snapshot, before it is registered
+ *
+ * The check guarantees that the byte-code can be executed without accesses out of bounds of the byte-code array,
+ * the literal identifiers hash table, the wide operands table and registers of the code's scopes:
+ *  - opcodes, types of meta instructions and arguments of assignments are valid;
+ *  - the code is split into correctly nested scopes, each starting with meta SCOPE_CODE_FLAGS and reg_var_decl,
+ *    and ending with 'ret';
+ *  - targets of jumps and ends of blocks are inside of the scopes of the instructions;
+ *  - operands, that can refer to literals, are either registers of the scopes, or identifiers of literals,
+ *    registered for the operands' blocks in the literal identifiers hash table;
+ *  - operands, that are stored in the wide operands table, have entries in the table.
+ *
+ * @return true - if the byte-code is correct,
+ *         false - otherwise.
+ */
+static bool
+serializer_check_loaded_bytecode (const opcode_t *opcodes_p, /**< byte-code array */
+                                  uint32_t instructions_number, /**< number of instructions */
+                                  const wide_operands_t *wide_operands_p, /**< wide operands table, sorted by
+                                                                           *   opcode counters of the instructions */
+                                  uint32_t wide_operands_number, /**< number of entries in the table */
+                                  const serializer_loaded_literals_t *literals_p) /**< literals */
+{
+  serializer_loaded_scope_t scopes_on_stack[SERIALIZER_LOADED_SCOPES_ON_STACK_NUMBER];
+  serializer_loaded_scope_t *scopes_p = scopes_on_stack;
+  uint32_t scopes_capacity = SERIALIZER_LOADED_SCOPES_ON_STACK_NUMBER;
+  uint32_t scopes_number = 1;
+
+  scopes_p[0].start_oc = 0;
+  scopes_p[0].end_oc = instructions_number;
+  scopes_p[0].min_reg_num = 0;
+  scopes_p[0].max_reg_num = 0;
+
+  uint32_t wide_entry_index = 0;
+  size_t block_ids_number = 0;
+  bool is_ok = true;
+
+  for (opcode_counter_t oc = 0; is_ok && oc < instructions_number; oc++)
+  {
+    const opcode_t op = opcodes_p[oc];
+    const raw_opcode *raw_p = (const raw_opcode *) &op;
+
+    while (oc == scopes_p[scopes_number - 1].end_oc)
+    {
+      scopes_number--;
+    }
+
+    const serializer_loaded_scope_t *scope_p = &scopes_p[scopes_number - 1];
+
+    if (oc % BLOCK_SIZE == 0)
+    {
+      if (literals_p->lit_id_hash_p != NULL)
+      {
+        block_ids_number = lit_id_hash_table_get_block_ids_number (literals_p->lit_id_hash_p,
+                                                                   literals_p->blocks_count,
+                                                                   oc / BLOCK_SIZE);
+      }
+      else
+      {
+        block_ids_number = lit_id_hash_table_get_block_ids_number_in_snapshot (literals_p->lit_id_hash_table_section_p,
+                                                                               literals_p->blocks_count,
+                                                                               oc / BLOCK_SIZE);
+      }
+    }
+
+    const wide_operands_t *wide_entry_p = NULL;
+
+    if (wide_entry_index < wide_operands_number && wide_operands_p[wide_entry_index].oc == oc)
+    {
+      wide_entry_p = &wide_operands_p[wide_entry_index++];
+    }
+
+    if (op.op_idx >= LAST_OP
+        || (oc + 1 == scope_p->end_oc && op.op_idx != __op__idx_ret)
+        || (oc == scope_p->start_oc && (op.op_idx != __op__idx_meta
+                                        || op.data.meta.type != OPCODE_META_TYPE_SCOPE_CODE_FLAGS))
+        || (oc == scope_p->start_oc + 1 && op.op_idx != __op__idx_reg_var_decl)
+        || (op.op_idx == __op__idx_meta && (op.data.meta.type == OPCODE_META_TYPE_UNDEFINED
+                                            || op.data.meta.type >= OPCODE_META_TYPE_LAZY_FUNCTION))
+        || (op.op_idx == __op__idx_native_call && op.data.native_call.name >= OPCODE_NATIVE_CALL__COUNT)
+        || (op.op_idx == __op__idx_assignment && op.data.assignment.type_value_right > OPCODE_ARG_TYPE_REGEXP)
+        || (op.op_idx == __op__idx_assignment
+            && op.data.assignment.type_value_right == OPCODE_ARG_TYPE_SIMPLE
+            && (op.data.assignment.value_right == ECMA_SIMPLE_VALUE_EMPTY
+                || op.data.assignment.value_right >= ECMA_SIMPLE_VALUE_ARRAY_REDIRECT)))
+    {
+      is_ok = false;
+      break;
+    }
+
+    const bool is_number_assignment = (op.op_idx == __op__idx_assignment
+                                       && (op.data.assignment.type_value_right == OPCODE_ARG_TYPE_NUMBER
+                                           || op.data.assignment.type_value_right == OPCODE_ARG_TYPE_NUMBER_NEGATE));
+
+    const uint32_t operands_number = serializer_opcode_operands_number[op.op_idx];
+    const uint32_t counter_operand_index = serializer_get_counter_operand_index (op);
+    const uint16_t wide_mask = scopes_tree_get_wide_operands_mask (op);
+
+    opcode_counter_t counter = 0;
+
+    for (uint32_t operand_index = 0; is_ok && operand_index < operands_number; operand_index++)
+    {
+      const idx_t operand = raw_p->uids[operand_index + 1];
+      const bool is_wide = ((wide_mask & (0x100u >> (4 * operand_index))) != 0
+                            && OPCODE_IS_WIDE_OPERAND (operand));
+
+      if (is_wide && (operand != OPCODE_WIDE_OPERAND_FIRST + operand_index || wide_entry_p == NULL))
+      {
+        is_ok = false;
+      }
+      else if (operand_index == counter_operand_index)
+      {
+        JERRY_ASSERT (operand_index + 1 < operands_number);
+
+        if (is_wide)
+        {
+          is_ok = (raw_p->uids[operand_index + 2] == OPCODE_WIDE_OPERAND_FIRST + operand_index + 1);
+          counter = (opcode_counter_t) ((wide_entry_p->operands[operand_index] << (sizeof (wide_idx_t)
+                                                                                   * JERRY_BITSINBYTE))
+                                        | wide_entry_p->operands[operand_index + 1]);
+        }
+        else
+        {
+          counter = calc_opcode_counter_from_idx_idx (operand, raw_p->uids[operand_index + 2]);
+        }
+
+        is_ok = is_ok && serializer_check_loaded_counter (op, oc, counter, scope_p);
+
+        operand_index++;
+      }
+      else if (serializer_is_literal_operand (op, operand_index))
+      {
+        const bool is_number_expected = (is_number_assignment && operand_index == 2);
+
+        if (operand == INVALID_VALUE && op.op_idx == __op__idx_func_expr_n && operand_index == 1)
+        {
+          /* anonymous function expression */
+          continue;
+        }
+
+        is_ok = serializer_check_loaded_literal_operand (is_wide ? wide_entry_p->operands[operand_index] : operand,
+                                                         is_wide,
+                                                         scope_p,
+                                                         literals_p,
+                                                         block_ids_number,
+                                                         oc,
+                                                         is_number_expected);
+      }
+    }
+
+    if (!is_ok)
+    {
+      break;
+    }
+
+    if (oc == scope_p->start_oc + 1)
+    {
+      /* reg_var_decl of the scope */
+      const wide_idx_t min_reg_num = op.data.reg_var_decl.min;
+      const wide_idx_t max_reg_num = (OPCODE_IS_WIDE_OPERAND (op.data.reg_var_decl.max)
+                                      ? wide_entry_p->operands[1]
+                                      : op.data.reg_var_decl.max);
+
+      if (min_reg_num != OPCODE_REG_FIRST
+          || max_reg_num < OPCODE_REG_GENERAL_FIRST
+          || max_reg_num > OPCODE_REG_WIDE_LAST
+          || (max_reg_num > OPCODE_REG_GENERAL_LAST && max_reg_num < OPCODE_REG_WIDE_FIRST))
+      {
+        is_ok = false;
+        break;
+      }
+
+      scopes_p[scopes_number - 1].min_reg_num = min_reg_num;
+      scopes_p[scopes_number - 1].max_reg_num = max_reg_num;
+    }
+    else if (op.op_idx == __op__idx_meta && op.data.meta.type == OPCODE_META_TYPE_FUNCTION_END)
+    {
+      if (scopes_number == scopes_capacity)
+      {
+        const uint32_t new_capacity = scopes_capacity * 2;
+        serializer_loaded_scope_t *new_scopes_p;
+        new_scopes_p = (serializer_loaded_scope_t *) mem_heap_alloc_block (new_capacity
+                                                                          * sizeof (serializer_loaded_scope_t),
+                                                                          MEM_HEAP_ALLOC_SHORT_TERM);
+        memcpy (new_scopes_p, scopes_p, scopes_number * sizeof (serializer_loaded_scope_t));
+
+        if (scopes_p != scopes_on_stack)
+        {
+          mem_heap_free_block (scopes_p);
+        }
+
+        scopes_p = new_scopes_p;
+        scopes_capacity = new_capacity;
+      }
+
+      /* the function's end is already checked (see also: serializer_check_loaded_counter) */
+      scopes_p[scopes_number].start_oc = oc + 1;
+      scopes_p[scopes_number].end_oc = oc + counter;
+      scopes_p[scopes_number].min_reg_num = 0;
+      scopes_p[scopes_number].max_reg_num = 0;
+      scopes_number++;
+    }
+  }
+
+  if (scopes_p != scopes_on_stack)
+  {
+    mem_heap_free_block (scopes_p);
+  }
+
+  JERRY_ASSERT (!is_ok || wide_entry_index == wide_operands_number);
+
+  return is_ok;
+} /* serializer_check_loaded_bytecode */
+
+/**
+ * Dump byte-code, together with the literals it refers to, to a snapshot
+ *
+ * See also:
+ *          snapshot_header_t
+ *
+ * @return size of the snapshot, if it was dumped successfully,
+ *         0 - if the buffer is too small.
+ */
+size_t
+serializer_save_snapshot (const opcode_t *opcodes_p, /**< byte-code array */
+                          uint8_t *buffer_p, /**< buffer to dump the snapshot to */
+                          size_t buffer_size) /**< size of the buffer */
+{
+  JERRY_ASSERT (opcodes_p != NULL);
+
+  opcodes_header_t *bytecode_header_p = GET_BYTECODE_HEADER (opcodes_p);
+  lit_id_hash_table *lit_id_hash_p = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p);
+
+  snapshot_header_t header;
+  header.version = SNAPSHOT_VERSION;
+  header.config = SNAPSHOT_CONFIG;
+  header.instructions_number = bytecode_header_p->instructions_number;
+  header.wide_operands_number = bytecode_header_p->wide_operands_number;
+
+  size_t offset = sizeof (snapshot_header_t);
+
+  if (offset > buffer_size)
+  {
+    return 0;
+  }
+
+  lit_cpointer_t *lit_cps_p;
+
+  if (!lit_dump_literals_for_snapshot (buffer_p, buffer_size, &offset, &lit_cps_p, &header.lits_number))
+  {
+    return 0;
+  }
+
+  header.lit_table_size = (uint32_t) (offset - sizeof (snapshot_header_t));
+
+  bool is_ok = (jrt_align_buffer_offset (buffer_p, buffer_size, &offset, MEM_ALIGNMENT)
+                && jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &offset,
+                                                  opcodes_p, header.instructions_number * sizeof (opcode_t))
+                && jrt_align_buffer_offset (buffer_p, buffer_size, &offset, MEM_ALIGNMENT));
+
+  if (header.wide_operands_number != 0)
+  {
+    is_ok = (is_ok
+             && jrt_write_to_buffer_by_offset (buffer_p, buffer_size, &offset,
+                                               MEM_CP_GET_NON_NULL_POINTER (wide_operands_t,
+                                                                            bytecode_header_p->wide_operands_cp),
+                                               header.wide_operands_number * sizeof (wide_operands_t)));
+  }
+
+  is_ok = is_ok && jrt_align_buffer_offset (buffer_p, buffer_size, &offset, MEM_ALIGNMENT);
+
+  const size_t lit_id_hash_table_offset = offset;
+
+  is_ok = (is_ok
+           && lit_id_hash_table_dump_for_snapshot (buffer_p, buffer_size, &offset,
+                                                   lit_id_hash_p,
+                                                   header.instructions_number / BLOCK_SIZE + 1,
+                                                   lit_cps_p,
+                                                   header.lits_number));
+
+  header.lit_id_hash_table_size = (uint32_t) (offset - lit_id_hash_table_offset);
+
+  if (lit_cps_p != NULL)
+  {
+    mem_heap_free_block (lit_cps_p);
+  }
+
+  if (!is_ok)
+  {
+    return 0;
+  }
+
+  memcpy (buffer_p, &header, sizeof (header));
+
+  return offset;
+} /* serializer_save_snapshot */
+
+/**
+ * Load byte-code from a snapshot
+ *
+ * If is_copy is true, the byte-code is copied to the heap and is registered in the same way as byte-code,
+ * produced by the parser. Otherwise, the byte-code and the literal identifiers hash table are used in place,
+ * and only a header with the literals' compressed pointers is allocated on the heap (see also:
+ * external_opcodes_header_t). In the latter case, the snapshot should be aligned to sizeof (uint32_t)
+ * and should not be modified or released till the engine's cleanup.
+ *
+ * In both cases, the literals of the snapshot are registered in the literal storage,
+ * and the allocated memory is released upon serializer_free.
+ *
+ * The loaded byte-code is checked before it is registered (see also: serializer_check_loaded_bytecode).
+ *
+ * @return pointer to the loaded byte-code array,
+ *         or NULL - if the snapshot is corrupted, has incompatible version or build configuration,
+ *                   or is not aligned.
+ */
+const opcode_t *
+serializer_load_snapshot (const uint8_t *snapshot_p, /**< snapshot */
+                          size_t snapshot_size, /**< size of the snapshot */
+                          bool is_copy) /**< copy byte-code to the heap (true),
+                                         *   or execute it in place (false) */
+{
+  snapshot_header_t header;
+  size_t offset = 0;
+
+  if (!jrt_read_from_buffer_by_offset (snapshot_p, snapshot_size, &offset, &header, sizeof (header))
+      || header.version != SNAPSHOT_VERSION
+      || header.config != SNAPSHOT_CONFIG
+      || header.instructions_number == 0
+      || header.instructions_number > MAX_OPCODES
+      || (!is_copy && ((uintptr_t) snapshot_p) % sizeof (uint32_t) != 0))
+  {
+    return NULL;
+  }
+
+  const size_t lit_table_offset = offset;
+  offset += header.lit_table_size;
+
+  const size_t opcodes_offset = JERRY_ALIGNUP (offset, MEM_ALIGNMENT);
+  const size_t opcodes_size = header.instructions_number * sizeof (opcode_t);
+
+  const size_t wide_operands_offset = JERRY_ALIGNUP (opcodes_offset + opcodes_size, MEM_ALIGNMENT);
+  const size_t wide_operands_size = header.wide_operands_number * sizeof (wide_operands_t);
+
+  const size_t lit_id_hash_table_offset = JERRY_ALIGNUP (wide_operands_offset + wide_operands_size, MEM_ALIGNMENT);
+
+  if (header.wide_operands_number > header.instructions_number
+      || lit_id_hash_table_offset > snapshot_size
+      || header.lit_id_hash_table_size != snapshot_size - lit_id_hash_table_offset)
+  {
+    return NULL;
+  }
+
+  const uint8_t *lit_id_hash_table_section_p = snapshot_p + lit_id_hash_table_offset;
+  const size_t blocks_count = header.instructions_number / BLOCK_SIZE + 1;
+
+  /* the wide operands table should be sorted by opcode counters of the instructions */
+  opcode_counter_t prev_oc = 0;
+
+  for (uint32_t entry_index = 0; entry_index < header.wide_operands_number; entry_index++)
+  {
+    wide_operands_t entry;
+    memcpy (&entry, snapshot_p + wide_operands_offset + entry_index * sizeof (wide_operands_t), sizeof (entry));
+
+    if (entry.oc >= header.instructions_number
+        || (entry_index != 0 && entry.oc <= prev_oc))
+    {
+      return NULL;
+    }
+
+    prev_oc = entry.oc;
+  }
+
+  if (!is_copy)
+  {
+    if (!lit_id_hash_table_check_snapshot_table (lit_id_hash_table_section_p,
+                                                 header.lit_id_hash_table_size,
+                                                 blocks_count,
+                                                 header.lits_number))
+    {
+      return NULL;
+    }
+
+    const size_t external_header_size = (sizeof (external_opcodes_header_t)
+                                         + header.lits_number * sizeof (lit_cpointer_t));
+    external_opcodes_header_t *external_header_p;
+    external_header_p = (external_opcodes_header_t *) mem_heap_alloc_block (external_header_size,
+                                                                            MEM_HEAP_ALLOC_LONG_TERM);
+
+    lit_cpointer_t *lit_cps_p = (lit_cpointer_t *) (external_header_p + 1);
+
+    serializer_loaded_literals_t literals;
+    literals.lit_id_hash_p = NULL;
+    literals.lit_id_hash_table_section_p = lit_id_hash_table_section_p;
+    literals.lit_cps_p = lit_cps_p;
+    literals.blocks_count = blocks_count;
+
+    if (!lit_load_literals_from_snapshot (snapshot_p + lit_table_offset,
+                                          header.lit_table_size,
+                                          header.lits_number,
+                                          lit_cps_p)
+        || !serializer_check_loaded_bytecode ((const opcode_t *) (snapshot_p + opcodes_offset),
+                                              header.instructions_number,
+                                              (const wide_operands_t *) (snapshot_p + wide_operands_offset),
+                                              header.wide_operands_number,
+                                              &literals))
+    {
+      mem_heap_free_block (external_header_p);
+
+      return NULL;
+    }
+
+    external_header_p->opcodes_p = (const opcode_t *) (snapshot_p + opcodes_offset);
+    external_header_p->lit_id_hash_table_p = lit_id_hash_table_section_p;
+    external_header_p->wide_operands_p = (const wide_operands_t *) (snapshot_p + wide_operands_offset);
+    external_header_p->wide_operands_number = header.wide_operands_number;
+    external_header_p->lits_number = header.lits_number;
+    external_header_p->instructions_number = (opcode_counter_t) header.instructions_number;
+    external_header_p->next_external_opcodes_cp = JERRY_CONTEXT (bytecode_data).external_opcodes_cp;
+    MEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (bytecode_data).external_opcodes_cp, external_header_p);
+
+    return external_header_p->opcodes_p;
+  }
+
+  lit_cpointer_t *lit_cps_p = NULL;
+
+  if (header.lits_number != 0)
+  {
+    lit_cps_p = (lit_cpointer_t *) mem_heap_alloc_block (header.lits_number * sizeof (lit_cpointer_t),
+                                                         MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+
+  const size_t lit_id_hash_table_size = JERRY_ALIGNUP (
+    lit_id_hash_table_get_size_for_snapshot_table (lit_id_hash_table_section_p,
+                                                   header.lit_id_hash_table_size,
+                                                   blocks_count),
+    MEM_ALIGNMENT);
+
+  const opcode_t *opcodes_p = NULL;
+
+  if (lit_id_hash_table_size != 0
+      && lit_load_literals_from_snapshot (snapshot_p + lit_table_offset,
+                                          header.lit_table_size,
+                                          header.lits_number,
+                                          lit_cps_p))
+  {
+    const size_t opcodes_array_size = JERRY_ALIGNUP (sizeof (opcodes_header_t) + opcodes_size, MEM_ALIGNMENT);
+
+    uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (opcodes_array_size
+                                                         + lit_id_hash_table_size
+                                                         + JERRY_ALIGNUP (wide_operands_size, MEM_ALIGNMENT),
+                                                         MEM_HEAP_ALLOC_LONG_TERM);
+
+    opcode_t *loaded_opcodes_p = (opcode_t *) (buffer_p + sizeof (opcodes_header_t));
+    lit_id_hash_table *lit_id_hash_p = lit_id_hash_table_load_from_snapshot (lit_id_hash_table_section_p,
+                                                                             header.lit_id_hash_table_size,
+                                                                             blocks_count,
+                                                                             lit_cps_p,
+                                                                             header.lits_number,
+                                                                             buffer_p + opcodes_array_size,
+                                                                             lit_id_hash_table_size);
+
+    memcpy (loaded_opcodes_p, snapshot_p + opcodes_offset, opcodes_size);
+
+    wide_operands_t *wide_operands_p = NULL;
+
+    if (header.wide_operands_number != 0)
+    {
+      wide_operands_p = (wide_operands_t *) (buffer_p + opcodes_array_size + lit_id_hash_table_size);
+      memcpy (wide_operands_p, snapshot_p + wide_operands_offset, wide_operands_size);
+    }
+
+    serializer_loaded_literals_t literals;
+    literals.lit_id_hash_p = lit_id_hash_p;
+    literals.lit_id_hash_table_section_p = NULL;
+    literals.lit_cps_p = NULL;
+    literals.blocks_count = blocks_count;
+
+    if (lit_id_hash_p == NULL
+        || !serializer_check_loaded_bytecode (loaded_opcodes_p,
+                                              header.instructions_number,
+                                              wide_operands_p,
+                                              header.wide_operands_number,
+                                              &literals))
+    {
+      mem_heap_free_block (buffer_p);
+    }
+    else
+    {
+      opcodes_header_t *header_p = (opcodes_header_t *) buffer_p;
+
+      MEM_CP_SET_POINTER (header_p->lit_id_hash_cp, lit_id_hash_p);
+      MEM_CP_SET_POINTER (header_p->next_opcodes_cp, JERRY_CONTEXT (bytecode_data).opcodes);
+      MEM_CP_SET_POINTER (header_p->wide_operands_cp, wide_operands_p);
+      header_p->instructions_number = (opcode_counter_t) header.instructions_number;
+      header_p->wide_operands_number = header.wide_operands_number;
+#ifdef JERRY_ENABLE_LINE_INFO
+      /* snapshots don't contain line tables */
+      header_p->line_table_cp = MEM_CP_NULL;
+      header_p->line_table_entries_number = 0;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+      JERRY_CONTEXT (bytecode_data).opcodes = loaded_opcodes_p;
+      JERRY_CONTEXT (bytecode_data).opcodes_count = header_p->instructions_number;
+
+      opcodes_p = loaded_opcodes_p;
+    }
+  }
+
+  if (lit_cps_p != NULL)
+  {
+    mem_heap_free_block (lit_cps_p);
+  }
+
+  return opcodes_p;
+} /* serializer_load_snapshot */
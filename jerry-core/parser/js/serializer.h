@@ -21,12 +21,19 @@
 #include "opcodes.h"
 #include "vm.h"
 #include "scopes-tree.h"
+#include "bytecode-data.h"
+
+/**
+ * Maximum number of lazily compiled functions (see also: serializer_can_register_lazy_function)
+ */
+#define SERIALIZER_LAZY_FUNCTIONS_LIMIT (1u << (2 * sizeof (idx_t) * JERRY_BITSINBYTE))
 
 void serializer_init ();
 void serializer_set_show_opcodes (bool show_opcodes);
 op_meta serializer_get_op_meta (opcode_counter_t);
 opcode_t serializer_get_opcode (const opcode_t*, opcode_counter_t);
 lit_cpointer_t serializer_get_literal_cp_by_uid (uint8_t, const opcode_t*, opcode_counter_t);
+wide_idx_t serializer_get_wide_operand (const opcode_t *, opcode_counter_t, idx_t);
 void serializer_set_strings_buffer (const ecma_char_t *);
 void serializer_set_scope (scopes_tree);
 const opcode_t *serializer_merge_scopes_into_bytecode (void);
@@ -36,5 +43,15 @@ opcode_counter_t serializer_count_opcodes_in_subscopes (void);
 void serializer_set_writing_position (opcode_counter_t);
 void serializer_rewrite_op_meta (opcode_counter_t, op_meta);
 void serializer_free (void);
+size_t serializer_save_snapshot (const opcode_t *, uint8_t *, size_t);
+const opcode_t *serializer_load_snapshot (const uint8_t *, size_t, bool);
+uint32_t serializer_compress_bytecode_pointer (const opcode_t *);
+const opcode_t *serializer_decompress_bytecode_pointer (uint32_t);
+#ifdef JERRY_ENABLE_LINE_INFO
+uint32_t serializer_get_line (const opcode_t *, opcode_counter_t);
+#endif /* JERRY_ENABLE_LINE_INFO */
+bool serializer_can_register_lazy_function (void);
+uint32_t serializer_register_lazy_function (const jerry_api_char_t *, size_t, uint32_t, lit_cpointer_t, bool);
+lazy_function_t *serializer_get_lazy_function (uint32_t);
 
 #endif // SERIALIZER_H
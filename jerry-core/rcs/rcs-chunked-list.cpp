@@ -282,6 +282,25 @@ rcs_chunked_list_t::get_node_size (void)
   return size;
 } /* rcs_chunked_list_t::get_node_size */
 
+/**
+ * Get size of memory, occupied by the list's nodes
+ *
+ * @return size in bytes
+ */
+size_t
+rcs_chunked_list_t::get_allocated_size (void)
+const
+{
+  size_t nodes_number = 0;
+
+  for (node_t *node_p = get_first (); node_p != NULL; node_p = get_next (node_p))
+  {
+    nodes_number++;
+  }
+
+  return nodes_number * get_node_size ();
+} /* rcs_chunked_list_t::get_allocated_size */
+
 /**
  * Assert that the list state is correct
  */
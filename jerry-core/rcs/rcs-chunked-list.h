@@ -72,14 +72,15 @@ public:
   node_t *get_node_from_pointer (void *) const;
   uint8_t* get_data_space (node_t *) const;
 
+  static size_t get_node_size (void);
   static size_t get_data_space_size (void);
 
+  size_t get_allocated_size (void) const;
+
 private:
   void set_prev (node_t *, node_t *);
   void set_next (node_t *, node_t *);
 
-  static size_t get_node_size (void);
-
   void assert_list_is_correct (void) const;
   void assert_node_is_correct (const node_t *) const;
 
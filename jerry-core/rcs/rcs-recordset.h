@@ -33,8 +33,16 @@
 
 /**
  * Logarithm of a dynamic storage unit alignment
+ *
+ * Note:
+ *      with compressed pointers wider than 16 bits, the unit is extended to 64 bits,
+ *      so that headers of the records could hold the pointers.
  */
-#define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#if MEM_CP_WIDTH <= 16
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#else /* MEM_CP_WIDTH > 16 */
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (3u)
+#endif /* MEM_CP_WIDTH > 16 */
 
 /**
  * Dynamic storage unit alignment
@@ -47,7 +55,20 @@
  * See also:
  *          rcs_dyn_storage_length_t
  */
-#define RCS_DYN_STORAGE_LENGTH_UNIT   (4u)
+#if MEM_CP_WIDTH <= 16
+# define RCS_DYN_STORAGE_LENGTH_UNIT   (4u)
+#else /* MEM_CP_WIDTH > 16 */
+# define RCS_DYN_STORAGE_LENGTH_UNIT   (8u)
+#endif /* MEM_CP_WIDTH > 16 */
+
+/**
+ * Unit of dynamic storage, containing a record's header fields
+ */
+#if MEM_CP_WIDTH <= 16
+typedef uint32_t rcs_dyn_storage_unit_t;
+#else /* MEM_CP_WIDTH > 16 */
+typedef uint64_t rcs_dyn_storage_unit_t;
+#endif /* MEM_CP_WIDTH > 16 */
 
 /**
  * Dynamic storage
@@ -114,7 +135,7 @@ public:
                                                                                    *   addressing */
 #endif /* MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG */
         } value;
-        uint16_t packed_value;
+        mem_cpointer_t packed_value;
       };
 
       static cpointer_t compress (record_t *pointer_p);
@@ -154,6 +175,16 @@ public:
   record_t *get_first (void);
   record_t *get_next (record_t *rec_p);
 
+  /**
+   * Get size of memory, occupied by the recordset
+   *
+   * @return size in bytes
+   */
+  size_t get_allocated_size (void) const
+  {
+    return _chunk_list.get_allocated_size ();
+  } /* get_allocated_size */
+
 private:
   friend class rcs_record_iterator_t;
 
@@ -15,6 +15,7 @@
 
 #include "opcodes.h"
 #include "opcodes-ecma-support.h"
+#include "vm.h"
 
 /**
  * 'Jump down if true' opcode handler.
@@ -28,8 +29,10 @@ opfunc_is_true_jmp_down (opcode_t opdata, /**< operation data */
                          int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_true_jmp_down.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_true_jmp_down.opcode_1,
-                                                                    opdata.data.is_true_jmp_down.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.is_true_jmp_down.opcode_1,
+                                                          opdata.data.is_true_jmp_down.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -61,8 +64,10 @@ opfunc_is_true_jmp_up (opcode_t opdata, /**< operation data */
                        int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_true_jmp_up.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_true_jmp_up.opcode_1,
-                                                                    opdata.data.is_true_jmp_up.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.is_true_jmp_up.opcode_1,
+                                                          opdata.data.is_true_jmp_up.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -75,13 +80,15 @@ opfunc_is_true_jmp_up (opcode_t opdata, /**< operation data */
   {
     JERRY_ASSERT ((uint32_t) int_data->pos >= offset);
     int_data->pos = (opcode_counter_t) (int_data->pos - offset);
+
+    ret_value = vm_check_interrupt ();
   }
   else
   {
     int_data->pos++;
-  }
 
-  ret_value = ecma_make_empty_completion_value ();
+    ret_value = ecma_make_empty_completion_value ();
+  }
 
   ECMA_FINALIZE (cond_value);
 
@@ -100,8 +107,10 @@ opfunc_is_false_jmp_down (opcode_t opdata, /**< operation data */
                           int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_false_jmp_down.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_false_jmp_down.opcode_1,
-                                                                    opdata.data.is_false_jmp_down.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.is_false_jmp_down.opcode_1,
+                                                          opdata.data.is_false_jmp_down.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -133,8 +142,10 @@ opfunc_is_false_jmp_up (opcode_t opdata, /**< operation data */
                         int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_false_jmp_up.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_false_jmp_up.opcode_1,
-                                                                    opdata.data.is_false_jmp_up.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.is_false_jmp_up.opcode_1,
+                                                          opdata.data.is_false_jmp_up.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -147,13 +158,15 @@ opfunc_is_false_jmp_up (opcode_t opdata, /**< operation data */
   {
     JERRY_ASSERT ((uint32_t) int_data->pos >= offset);
     int_data->pos = (opcode_counter_t) (int_data->pos - offset);
+
+    ret_value = vm_check_interrupt ();
   }
   else
   {
     int_data->pos++;
-  }
 
-  ret_value = ecma_make_empty_completion_value ();
+    ret_value = ecma_make_empty_completion_value ();
+  }
 
   ECMA_FINALIZE (cond_value);
 
@@ -170,8 +183,10 @@ ecma_completion_value_t
 opfunc_jmp_down (opcode_t opdata, /**< operation data */
                  int_data_t *int_data) /**< interpreter context */
 {
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.jmp_down.opcode_1,
-                                                                    opdata.data.jmp_down.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.jmp_down.opcode_1,
+                                                          opdata.data.jmp_down.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
 
   JERRY_ASSERT (((uint32_t) int_data->pos + offset < MAX_OPCODES));
 
@@ -190,13 +205,15 @@ ecma_completion_value_t
 opfunc_jmp_up (opcode_t opdata, /**< operation data */
                int_data_t *int_data) /**< interpreter context */
 {
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.jmp_up.opcode_1,
-                                                                    opdata.data.jmp_up.opcode_2);
+  const opcode_counter_t offset = vm_calc_opcode_counter (opdata.data.jmp_up.opcode_1,
+                                                          opdata.data.jmp_up.opcode_2,
+                                                          int_data->opcodes_p,
+                                                          int_data->pos);
   JERRY_ASSERT ((uint32_t) int_data->pos >= offset);
 
   int_data->pos = (opcode_counter_t) (int_data->pos - offset);
 
-  return ecma_make_empty_completion_value ();
+  return vm_check_interrupt ();
 }
 
 /**
@@ -210,8 +227,10 @@ opfunc_jmp_break_continue (opcode_t opdata, /**< operation data */
                            int_data_t *int_data) /**< interpreter context */
 {
   opcode_counter_t target = int_data->pos;
-  target = (opcode_counter_t) (target + calc_opcode_counter_from_idx_idx (opdata.data.jmp_down.opcode_1,
-                                                                          opdata.data.jmp_down.opcode_2));
+  target = (opcode_counter_t) (target + vm_calc_opcode_counter (opdata.data.jmp_down.opcode_1,
+                                                                opdata.data.jmp_down.opcode_2,
+                                                                int_data->opcodes_p,
+                                                                int_data->pos));
 
   return ecma_make_jump_completion_value (target);
 } /* opfunc_jmp_break_continue */
@@ -134,9 +134,16 @@ opfunc_addition (opcode_t opdata, /**< operation data */
 
     ecma_string_t *concat_str_p = ecma_concat_ecma_strings (string1_p, string2_p);
 
-    ret_value = set_variable_value (int_data, int_data->pos, dst_var_idx, ecma_make_string_value (concat_str_p));
+    if (concat_str_p == NULL)
+    {
+      ret_value = ecma_raise_range_error ("String length limit is exceeded.");
+    }
+    else
+    {
+      ret_value = set_variable_value (int_data, int_data->pos, dst_var_idx, ecma_make_string_value (concat_str_p));
 
-    ecma_deref_ecma_string (concat_str_p);
+      ecma_deref_ecma_string (concat_str_p);
+    }
 
     ECMA_FINALIZE (str_right_value);
     ECMA_FINALIZE (str_left_value);
@@ -189,8 +189,10 @@ opfunc_for_in (opcode_t opdata, /**< operation data */
   const idx_t block_end_oc_idx_1 = opdata.data.for_in.oc_idx_1;
   const idx_t block_end_oc_idx_2 = opdata.data.for_in.oc_idx_2;
   const opcode_counter_t for_in_end_oc = (opcode_counter_t) (
-    calc_opcode_counter_from_idx_idx (block_end_oc_idx_1,
-                                      block_end_oc_idx_2) + int_data_p->pos);
+    vm_calc_opcode_counter (block_end_oc_idx_1,
+                            block_end_oc_idx_2,
+                            int_data_p->opcodes_p,
+                            int_data_p->pos) + int_data_p->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
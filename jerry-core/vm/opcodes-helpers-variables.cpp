@@ -60,7 +60,8 @@ do_strict_eval_arguments_check (ecma_object_t *ref_base_lex_env_p, /**< base of
  */
 bool
 is_reg_variable (int_data_t *int_data, /**< interpreter context */
-                 idx_t var_idx) /**< variable identifier */
+                 wide_idx_t var_idx) /**< variable identifier
+                                      *   (see also: vm_get_wide_operand_value) */
 {
   return (var_idx >= int_data->min_reg_num && var_idx <= int_data->max_reg_num);
 } /* is_reg_variable */
@@ -79,10 +80,12 @@ get_variable_value (int_data_t *int_data, /**< interpreter context */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  if (is_reg_variable (int_data, var_idx))
+  const wide_idx_t var_value = vm_get_wide_operand_value (var_idx, int_data->opcodes_p, int_data->pos);
+
+  if (is_reg_variable (int_data, var_value))
   {
     ecma_value_t reg_value = ecma_stack_frame_get_reg_value (&int_data->stack_frame,
-                                                             var_idx - int_data->min_reg_num);
+                                                             var_value - int_data->min_reg_num);
 
     JERRY_ASSERT (!ecma_is_value_empty (reg_value));
 
@@ -131,12 +134,14 @@ set_variable_value (int_data_t *int_data, /**< interpreter context */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  if (is_reg_variable (int_data, var_idx))
+  const wide_idx_t var_value = vm_get_wide_operand_value (var_idx, int_data->opcodes_p, lit_oc);
+
+  if (is_reg_variable (int_data, var_value))
   {
     ret_value = ecma_make_empty_completion_value ();
 
     ecma_value_t reg_value = ecma_stack_frame_get_reg_value (&int_data->stack_frame,
-                                                             var_idx - int_data->min_reg_num);
+                                                             var_value - int_data->min_reg_num);
 
     if (ecma_is_value_number (reg_value)
         && ecma_is_value_number (value))
@@ -151,7 +156,7 @@ set_variable_value (int_data_t *int_data, /**< interpreter context */
       }
 
       ecma_stack_frame_set_reg_value (&int_data->stack_frame,
-                                      var_idx - int_data->min_reg_num,
+                                      var_value - int_data->min_reg_num,
                                       ecma_copy_value (value, false));
     }
   }
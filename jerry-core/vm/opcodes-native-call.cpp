@@ -33,7 +33,9 @@ opfunc_native_call (opcode_t opdata, /**< operation data */
 {
   const idx_t dst_var_idx = opdata.data.native_call.lhs;
   const idx_t native_call_id_idx = opdata.data.native_call.name;
-  const idx_t args_number = opdata.data.native_call.arg_list;
+  const ecma_length_t args_number = vm_get_wide_operand_value (opdata.data.native_call.arg_list,
+                                                               int_data->opcodes_p,
+                                                               int_data->pos);
   const opcode_counter_t lit_oc = int_data->pos;
 
   JERRY_ASSERT (native_call_id_idx < OPCODE_NATIVE_CALL__COUNT);
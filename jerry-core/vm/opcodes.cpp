@@ -557,7 +557,9 @@ opfunc_func_decl_n (opcode_t opdata, /**< operation data */
                     int_data_t *int_data) /**< interpreter context */
 {
   const idx_t function_name_idx = opdata.data.func_decl_n.name_lit_idx;
-  const ecma_length_t params_number = opdata.data.func_decl_n.arg_list;
+  const ecma_length_t params_number = vm_get_wide_operand_value (opdata.data.func_decl_n.arg_list,
+                                                                 int_data->opcodes_p,
+                                                                 int_data->pos);
 
   lit_cpointer_t function_name_lit_cp = serializer_get_literal_cp_by_uid (function_name_idx,
                                                                           int_data->opcodes_p,
@@ -604,7 +606,9 @@ opfunc_func_expr_n (opcode_t opdata, /**< operation data */
 
   const idx_t dst_var_idx = opdata.data.func_expr_n.lhs;
   const idx_t function_name_lit_idx = opdata.data.func_expr_n.name_lit_idx;
-  const ecma_length_t params_number = opdata.data.func_expr_n.arg_list;
+  const ecma_length_t params_number = vm_get_wide_operand_value (opdata.data.func_expr_n.arg_list,
+                                                                 int_data->opcodes_p,
+                                                                 lit_oc);
   const bool is_named_func_expr = (function_name_lit_idx != INVALID_VALUE);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -724,7 +728,10 @@ vm_helper_call_get_call_flags_and_this_arg (int_data_t *int_data_p, /**< interpr
     if (call_flags & OPCODE_CALL_FLAGS_HAVE_THIS_ARG)
     {
       this_arg_var_idx = next_opcode.data.meta.data_2;
-      JERRY_ASSERT (is_reg_variable (int_data_p, this_arg_var_idx));
+      JERRY_ASSERT (is_reg_variable (int_data_p,
+                                     vm_get_wide_operand_value (this_arg_var_idx,
+                                                                int_data_p->opcodes_p,
+                                                                int_data_p->pos)));
 
       JERRY_ASSERT ((call_flags & OPCODE_CALL_FLAGS_DIRECT_CALL_TO_EVAL_FORM) == 0);
     }
@@ -775,7 +782,9 @@ opfunc_call_n (opcode_t opdata, /**< operation data */
 {
   const idx_t lhs_var_idx = opdata.data.call_n.lhs;
   const idx_t func_name_lit_idx = opdata.data.call_n.name_lit_idx;
-  const idx_t args_number_idx = opdata.data.call_n.arg_list;
+  const ecma_length_t args_number_idx = vm_get_wide_operand_value (opdata.data.call_n.arg_list,
+                                                                   int_data->opcodes_p,
+                                                                   int_data->pos);
   const opcode_counter_t lit_oc = int_data->pos;
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -875,7 +884,9 @@ opfunc_construct_n (opcode_t opdata, /**< operation data */
 {
   const idx_t lhs_var_idx = opdata.data.construct_n.lhs;
   const idx_t constructor_name_lit_idx = opdata.data.construct_n.name_lit_idx;
-  const idx_t args_number = opdata.data.construct_n.arg_list;
+  const ecma_length_t args_number = vm_get_wide_operand_value (opdata.data.construct_n.arg_list,
+                                                               int_data->opcodes_p,
+                                                               int_data->pos);
   const opcode_counter_t lit_oc = int_data->pos;
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -951,7 +962,9 @@ opfunc_array_decl (opcode_t opdata, /**< operation data */
                    int_data_t *int_data) /**< interpreter context */
 {
   const idx_t lhs_var_idx = opdata.data.array_decl.lhs;
-  const idx_t args_number = opdata.data.array_decl.list;
+  const ecma_length_t args_number = vm_get_wide_operand_value (opdata.data.array_decl.list,
+                                                               int_data->opcodes_p,
+                                                               int_data->pos);
   const opcode_counter_t lit_oc = int_data->pos;
 
   int_data->pos++;
@@ -1014,7 +1027,9 @@ opfunc_obj_decl (opcode_t opdata, /**< operation data */
                  int_data_t *int_data) /**< interpreter context */
 {
   const idx_t lhs_var_idx = opdata.data.obj_decl.lhs;
-  const idx_t args_number = opdata.data.obj_decl.list;
+  const ecma_length_t args_number = vm_get_wide_operand_value (opdata.data.obj_decl.list,
+                                                               int_data->opcodes_p,
+                                                               int_data->pos);
   const opcode_counter_t obj_lit_oc = int_data->pos;
 
   int_data->pos++;
@@ -1040,7 +1055,10 @@ opfunc_obj_decl (opcode_t opdata, /**< operation data */
                     || type == OPCODE_META_TYPE_VARG_PROP_SETTER);
 
       const idx_t prop_name_var_idx = next_opcode.data.meta.data_1;
-      JERRY_ASSERT (is_reg_variable (int_data, prop_name_var_idx));
+      JERRY_ASSERT (is_reg_variable (int_data,
+                                     vm_get_wide_operand_value (prop_name_var_idx,
+                                                                int_data->opcodes_p,
+                                                                int_data->pos)));
 
       const idx_t value_for_prop_desc_var_idx = next_opcode.data.meta.data_2;
 
@@ -1382,7 +1400,10 @@ opfunc_with (opcode_t opdata, /**< operation data */
   const idx_t block_end_oc_idx_1 = opdata.data.with.oc_idx_1;
   const idx_t block_end_oc_idx_2 = opdata.data.with.oc_idx_2;
   const opcode_counter_t with_end_oc = (opcode_counter_t) (
-    calc_opcode_counter_from_idx_idx (block_end_oc_idx_1, block_end_oc_idx_2) + int_data->pos);
+    vm_calc_opcode_counter (block_end_oc_idx_1,
+                            block_end_oc_idx_2,
+                            int_data->opcodes_p,
+                            int_data->pos) + int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -1485,7 +1506,7 @@ evaluate_arg_for_typeof (int_data_t *int_data, /**< interpreter context */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  if (is_reg_variable (int_data, var_idx))
+  if (is_reg_variable (int_data, vm_get_wide_operand_value (var_idx, int_data->opcodes_p, int_data->pos)))
   {
     // 2.b
     ret_value = get_variable_value (int_data,
@@ -1763,6 +1784,7 @@ opfunc_meta (opcode_t opdata, /**< operation data */
     case OPCODE_META_TYPE_CALL_SITE_INFO:
     case OPCODE_META_TYPE_FUNCTION_END:
     case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+    case OPCODE_META_TYPE_LAZY_FUNCTION:
     {
       JERRY_UNREACHABLE ();
     }
@@ -1789,6 +1811,50 @@ calc_opcode_counter_from_idx_idx (const idx_t oc_idx_1, /**< first idx */
   return counter;
 } /* calc_meta_opcode_counter_from_meta_data */
 
+JERRY_STATIC_ASSERT (OPCODE_COUNTER_WIDTH <= ECMA_COMPLETION_VALUE_TARGET_WIDTH);
+JERRY_STATIC_ASSERT (OPCODE_COUNTER_WIDTH <= 2 * sizeof (wide_idx_t) * JERRY_BITSINBYTE);
+
+/**
+ * Get value of instruction's operand, that can be stored in the wide operands table
+ * (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * @return value of the operand
+ */
+wide_idx_t
+vm_get_wide_operand_value (const idx_t operand, /**< operand of the instruction */
+                           const opcode_t *opcodes_p, /**< byte-code array */
+                           opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  if (likely (!OPCODE_IS_WIDE_OPERAND (operand)))
+  {
+    return operand;
+  }
+
+  return serializer_get_wide_operand (opcodes_p, oc, operand);
+} /* vm_get_wide_operand_value */
+
+/**
+ * Calculate opcode counter from pair of instruction's operands, that can be stored in the wide operands table
+ *
+ * @return opcode counter
+ */
+opcode_counter_t
+vm_calc_opcode_counter (const idx_t oc_idx_1, /**< first idx */
+                        const idx_t oc_idx_2, /**< second idx */
+                        const opcode_t *opcodes_p, /**< byte-code array */
+                        opcode_counter_t oc) /**< opcode counter of the instruction */
+{
+  if (likely (!OPCODE_IS_WIDE_OPERAND (oc_idx_1)))
+  {
+    return calc_opcode_counter_from_idx_idx (oc_idx_1, oc_idx_2);
+  }
+
+  const opcode_counter_t high = serializer_get_wide_operand (opcodes_p, oc, oc_idx_1);
+  const opcode_counter_t low = serializer_get_wide_operand (opcodes_p, oc, oc_idx_2);
+
+  return (opcode_counter_t) ((high << (sizeof (wide_idx_t) * JERRY_BITSINBYTE)) | low);
+} /* vm_calc_opcode_counter */
+
 /**
  * Read opcode counter from current opcode,
  * that should be 'meta' opcode of type 'opcode counter'.
@@ -1803,7 +1869,7 @@ read_meta_opcode_counter (opcode_meta_type expected_type, /**< expected type of
   const idx_t data_1 = meta_opcode.data.meta.data_1;
   const idx_t data_2 = meta_opcode.data.meta.data_2;
 
-  return calc_opcode_counter_from_idx_idx (data_1, data_2);
+  return vm_calc_opcode_counter (data_1, data_2, int_data->opcodes_p, int_data->pos);
 } /* read_meta_opcode_counter */
 
 #define GETOP_DEF_1(a, name, field1) \
@@ -20,8 +20,17 @@
 #include "ecma-stack.h"
 #include "jrt.h"
 
+/**
+ * Number of significant bits in opcode counters
+ *
+ * Note:
+ *      the width is limited by the field of jump completion values, holding target opcode counter
+ *      (see also: ECMA_COMPLETION_VALUE_TARGET_WIDTH)
+ */
+#define OPCODE_COUNTER_WIDTH (24u)
+
 /* Maximum opcodes number in bytecode.  */
-#define MAX_OPCODES (256*256 - 1)
+#define MAX_OPCODES ((1u << OPCODE_COUNTER_WIDTH) - 1u)
 
 #define OP_0(action, name) \
         __##action (name, void, void, void)
@@ -35,8 +44,9 @@
 #define OP_3(action, name, field1, field2, field3) \
         __##action (name, field1, field2, field3)
 
-typedef uint16_t opcode_counter_t; /** opcode counters */
+typedef uint32_t opcode_counter_t; /** opcode counters */
 typedef uint8_t idx_t; /** index values */
+typedef uint16_t wide_idx_t; /** index values, stored in wide operands table (see also: OPCODE_WIDE_OPERAND_FIRST) */
 
 /**
  * Descriptor of assignment's second argument
@@ -74,7 +84,9 @@ typedef enum
   OPCODE_META_TYPE_END_TRY_CATCH_FINALLY, /**< mark of end of try-catch, try-finally, try-catch-finally blocks */
   OPCODE_META_TYPE_SCOPE_CODE_FLAGS, /**< set of flags indicating various properties of the scope's code
                                       *   (See also: opcode_scope_code_flags_t) */
-  OPCODE_META_TYPE_END_FOR_IN /**< end of for-in statement */
+  OPCODE_META_TYPE_END_FOR_IN, /**< end of for-in statement */
+  OPCODE_META_TYPE_LAZY_FUNCTION /**< stub of a function's body, that is compiled upon first call of the function
+                                  *   (contains index of the function's descriptor, see also: lazy_function_t) */
 } opcode_meta_type;
 
 typedef enum : idx_t
@@ -113,10 +125,51 @@ typedef enum : idx_t
   OPCODE_REG_SPECIAL_FOR_IN_PROPERTY_NAME, /**< variable, containing property name,
                                             *   at start of for-in loop body */
   OPCODE_REG_GENERAL_FIRST, /** identifier of first non-special register */
-  OPCODE_REG_GENERAL_LAST = 253, /** identifier of last non-special register */
+  OPCODE_REG_GENERAL_LAST = 250, /** identifier of last non-special register, that fits into idx_t */
   OPCODE_REG_LAST = OPCODE_REG_GENERAL_FIRST /**< identifier of last register */
 } opcode_special_reg_t;
 
+/**
+ * Identifier of first register, that doesn't fit into idx_t
+ *
+ * Such registers are referred to through wide operands table (see also: OPCODE_WIDE_OPERAND_FIRST).
+ */
+#define OPCODE_REG_WIDE_FIRST ((wide_idx_t) (UINT8_MAX + 1u))
+
+/**
+ * Identifier of last register, that can be referred to through wide operands table
+ */
+#define OPCODE_REG_WIDE_LAST ((wide_idx_t) (OPCODE_WIDE_OPERAND_LITERAL_FLAG - 1u))
+
+/**
+ * Operand values, indicating that actual value of the operand is stored in the wide operands table
+ *
+ * The table is kept by the byte-code memory region (see also: wide_operands_t) and contains values
+ * that don't fit into idx_t: registers starting from OPCODE_REG_WIDE_FIRST, identifiers of literals
+ * starting from OPCODE_REG_FIRST (marked with OPCODE_WIDE_OPERAND_LITERAL_FLAG), numbers of elements
+ * in lists of arguments, and opcode counters, that don't fit into pair of idx_t operands (a counter
+ * is split into higher and lower 16 bits, stored as values of the pair's first and second operands).
+ *
+ * Operand with index i (0 - first operand, 1 - second, 2 - third) is replaced with OPCODE_WIDE_OPERAND_FIRST + i,
+ * so byte-code of programs, fitting into 8-bit operands, is not changed.
+ */
+#define OPCODE_WIDE_OPERAND_FIRST ((idx_t) 251u)
+
+/**
+ * Last operand value, indicating that actual value of the operand is stored in the wide operands table
+ */
+#define OPCODE_WIDE_OPERAND_LAST ((idx_t) (OPCODE_WIDE_OPERAND_FIRST + 2u))
+
+/**
+ * Flag of values in the wide operands table, indicating that the value is an identifier of literal
+ */
+#define OPCODE_WIDE_OPERAND_LITERAL_FLAG ((wide_idx_t) (1u << 15))
+
+/**
+ * Check whether the operand value indicates that actual value is stored in the wide operands table
+ */
+#define OPCODE_IS_WIDE_OPERAND(idx) ((idx) >= OPCODE_WIDE_OPERAND_FIRST && (idx) <= OPCODE_WIDE_OPERAND_LAST)
+
 /**
  * Forward declaration of opcode structure
  */
@@ -125,18 +178,21 @@ struct opcode_t;
 /**
  * Interpreter context
  */
-typedef struct
+typedef struct int_data_t
 {
   const opcode_t *opcodes_p; /**< pointer to array containing currently executed bytecode */
   opcode_counter_t pos; /**< current opcode to execute */
+  opcode_counter_t block_start_pos; /**< position of the code block's start (reg_var_decl) */
+  struct int_data_t *prev_context_p; /**< interpreter context of the calling code (NULL - for the bottom-most
+                                      *   context, see also: vm_top_context_p) */
   ecma_value_t this_binding; /**< this binding for current context */
   ecma_object_t *lex_env_p; /**< current lexical environment */
   bool is_strict; /**< is current code execution mode strict? */
   bool is_eval_code; /**< is current code executed with eval */
   bool is_call_in_direct_eval_form; /** flag, indicating if there is call of 'Direct call to eval' form in
                                      *  process (see also: OPCODE_CALL_FLAGS_DIRECT_CALL_TO_EVAL_FORM) */
-  idx_t min_reg_num; /**< minimum idx used for register identification */
-  idx_t max_reg_num; /**< maximum idx used for register identification */
+  wide_idx_t min_reg_num; /**< minimum idx used for register identification */
+  wide_idx_t max_reg_num; /**< maximum idx used for register identification */
   ecma_number_t* tmp_num_p; /**< an allocated number (to reduce temporary allocations) */
   ecma_stack_frame_t stack_frame; /**< ecma-stack frame associated with the context */
 
@@ -168,6 +224,8 @@ typedef struct
 } vm_run_scope_t;
 
 opcode_counter_t calc_opcode_counter_from_idx_idx (const idx_t oc_idx_1, const idx_t oc_idx_2);
+opcode_counter_t vm_calc_opcode_counter (const idx_t, const idx_t, const opcode_t *, opcode_counter_t);
+wide_idx_t vm_get_wide_operand_value (const idx_t, const opcode_t *, opcode_counter_t);
 opcode_counter_t read_meta_opcode_counter (opcode_meta_type expected_type, int_data_t *int_data);
 
 #define OP_CALLS_AND_ARGS(p, a)                                              \
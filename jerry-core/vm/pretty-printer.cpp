@@ -45,7 +45,7 @@ static uint8_t opcode_sizes[] =
   0
 };
 
-static char buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+static JERRY_THREAD_LOCAL char buff[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
 
 static void
 clear_temp_buffer (void)
@@ -61,34 +61,74 @@ lit_cp_to_str (lit_cpointer_t cp)
 }
 
 static const char *
-tmp_id_to_str (idx_t id)
+tmp_id_to_str (wide_idx_t id)
 {
   JERRY_ASSERT (id != LITERAL_TO_REWRITE);
   JERRY_ASSERT (id >= 128);
   clear_temp_buffer ();
   strncpy (buff, "tmp", 3);
-  if (id / 100 != 0)
+
+  size_t digits_num = 0;
+  for (wide_idx_t rest = id; rest != 0; rest /= 10)
+  {
+    digits_num++;
+  }
+
+  for (size_t i = 0; i < digits_num; i++, id /= 10)
+  {
+    buff[3 + digits_num - 1 - i] = (char) (id % 10 + '0');
+  }
+
+  return buff;
+}
+
+/**
+ * Get value of instruction's operand, resolving wide operands (see also: OPCODE_WIDE_OPERAND_FIRST)
+ *
+ * @return true - if the value is known,
+ *         false - otherwise (wide operand of a not yet generated instruction, printed without op_meta).
+ */
+static bool
+get_operand_value (const opcode_t *opcodes_p, /**< byte-code array, or NULL - if printing during parse */
+                   opcode_t opcode, /**< instruction */
+                   lit_cpointer_t lit_ids[], /**< instruction's literal identifiers, or NULL */
+                   opcode_counter_t oc, /**< position of the instruction */
+                   uint8_t current_arg, /**< index of the operand (1 - first operand) */
+                   wide_idx_t *out_value_p) /**< out: value of the operand */
+{
+  raw_opcode raw = *(raw_opcode*) &opcode;
+  const idx_t idx = raw.uids[current_arg];
+
+  if (!OPCODE_IS_WIDE_OPERAND (idx))
   {
-    buff[3] = (char) (id / 100 + '0');
-    buff[4] = (char) ((id % 100) / 10 + '0');
-    buff[5] = (char) (id % 10 + '0');
+    *out_value_p = idx;
   }
-  else if (id / 10 != 0)
+  else if (opcodes_p != NULL)
   {
-    buff[3] = (char) (id / 10 + '0');
-    buff[4] = (char) (id % 10 + '0');
+    *out_value_p = serializer_get_wide_operand (opcodes_p, oc, idx);
+  }
+  else if (lit_ids != NULL)
+  {
+    /* during parse, the wide operand's value is held in the op_meta's literal identifier field */
+    *out_value_p = (wide_idx_t) lit_ids[current_arg - 1].packed_value;
   }
   else
   {
-    buff[3] = (char) (id + '0');
+    return false;
   }
-  return buff;
-}
+
+  return true;
+} /* get_operand_value */
 
 static const char *
-var_to_str (opcode_t opcode, lit_cpointer_t lit_ids[], opcode_counter_t oc, uint8_t current_arg)
+var_to_str (const opcode_t *opcodes_p,
+            opcode_t opcode,
+            lit_cpointer_t lit_ids[],
+            opcode_counter_t oc,
+            uint8_t current_arg)
 {
   raw_opcode raw = *(raw_opcode*) &opcode;
+  wide_idx_t value;
   if (raw.uids[current_arg] == LITERAL_TO_REWRITE)
   {
     if (lit_ids == NULL)
@@ -98,18 +138,27 @@ var_to_str (opcode_t opcode, lit_cpointer_t lit_ids[], opcode_counter_t oc, uint
     JERRY_ASSERT (lit_ids[current_arg - 1].packed_value != MEM_CP_NULL);
     return lit_cp_to_str (lit_ids[current_arg - 1]);
   }
-  else if (raw.uids[current_arg] >= 128)
+  else if (!get_operand_value (opcodes_p, opcode, lit_ids, oc, current_arg, &value))
+  {
+    return "hz";
+  }
+  else if (value >= 128 && !(value & OPCODE_WIDE_OPERAND_LITERAL_FLAG))
   {
-    return tmp_id_to_str (raw.uids[current_arg]);
+    return tmp_id_to_str (value);
   }
   else
   {
-    return lit_cp_to_str (serializer_get_literal_cp_by_uid (raw.uids[current_arg], NULL, oc));
+    return lit_cp_to_str (serializer_get_literal_cp_by_uid (raw.uids[current_arg], opcodes_p, oc));
   }
 }
 
 static void
-pp_printf (const char *format, opcode_t opcode, lit_cpointer_t lit_ids[], opcode_counter_t oc, uint8_t start_arg)
+pp_printf (const char *format,
+           const opcode_t *opcodes_p,
+           opcode_t opcode,
+           lit_cpointer_t lit_ids[],
+           opcode_counter_t oc,
+           uint8_t start_arg)
 {
   uint8_t current_arg = start_arg;
   JERRY_ASSERT (current_arg <= 3);
@@ -128,14 +177,21 @@ pp_printf (const char *format, opcode_t opcode, lit_cpointer_t lit_ids[], opcode
       case 'd':
       {
         JERRY_ASSERT (current_arg <= 3);
-        raw_opcode raw = *(raw_opcode*) &opcode;
-        printf ("%d", raw.uids[current_arg]);
+        wide_idx_t value;
+        if (get_operand_value (opcodes_p, opcode, lit_ids, oc, current_arg, &value))
+        {
+          printf ("%d", value);
+        }
+        else
+        {
+          printf ("hz");
+        }
         break;
       }
       case 's':
       {
         JERRY_ASSERT (current_arg <= 3);
-        printf ("%s", var_to_str (opcode, lit_ids, oc, current_arg));
+        printf ("%s", var_to_str (opcodes_p, opcode, lit_ids, oc, current_arg));
         break;
       }
       default:
@@ -150,13 +206,18 @@ pp_printf (const char *format, opcode_t opcode, lit_cpointer_t lit_ids[], opcode
 }
 
 #define PP_OP(op_name, format) \
-  case NAME_TO_ID (op_name): pp_printf (format, opm.op, opm.lit_id, oc, 1); break;
-#define VAR(i) var_to_str (opm.op, opm.lit_id, oc, i)
+  case NAME_TO_ID (op_name): pp_printf (format, opcodes_p, opm.op, opm.lit_id, oc, 1); break;
+#define VAR(i) var_to_str (opcodes_p, opm.op, opm.lit_id, oc, i)
+#define VAL(i) __extension__({ wide_idx_t val = 0; \
+                               get_operand_value (opcodes_p, opm.op, opm.lit_id, oc, i, &val); \
+                               val; })
 #define OC(i, j) __extension__({ raw_opcode* raw = (raw_opcode *) &opm.op; \
-                                 calc_opcode_counter_from_idx_idx (raw->uids[i], raw->uids[j]); })
+                                 (OPCODE_IS_WIDE_OPERAND (raw->uids[i]) \
+                                  ? (opcode_counter_t) (((uint32_t) VAL (i) << 16) | VAL (j)) \
+                                  : calc_opcode_counter_from_idx_idx (raw->uids[i], raw->uids[j])); })
 
-static int vargs_num = 0;
-static int seen_vargs = 0;
+static JERRY_THREAD_LOCAL int vargs_num = 0;
+static JERRY_THREAD_LOCAL int seen_vargs = 0;
 
 static void
 dump_asm (opcode_counter_t oc, opcode_t opcode)
@@ -269,14 +330,14 @@ pp_op_meta (const opcode_t *opcodes_p,
     }
     case NAME_TO_ID (call_n):
     {
-      vargs_num = opm.op.data.call_n.arg_list;
+      vargs_num = VAL (3);
       seen_vargs = 0;
 
       break;
     }
     case NAME_TO_ID (native_call):
     {
-      if (opm.op.data.native_call.arg_list == 0)
+      if (VAL (3) == 0)
       {
         printf ("%s = ", VAR (1));
         switch (opm.op.data.native_call.name)
@@ -292,40 +353,40 @@ pp_op_meta (const opcode_t *opcodes_p,
       }
       else
       {
-        vargs_num = opm.op.data.native_call.arg_list;
+        vargs_num = VAL (3);
         seen_vargs = 0;
       }
       break;
     }
     case NAME_TO_ID (construct_n):
     {
-      if (opm.op.data.construct_n.arg_list == 0)
+      if (VAL (3) == 0)
       {
-        pp_printf ("%s = new %s;", opm.op, opm.lit_id, oc, 1);
+        pp_printf ("%s = new %s;", opcodes_p, opm.op, opm.lit_id, oc, 1);
       }
       else
       {
-        vargs_num = opm.op.data.construct_n.arg_list;
+        vargs_num = VAL (3);
         seen_vargs = 0;
       }
       break;
     }
     case NAME_TO_ID (func_decl_n):
     {
-      if (opm.op.data.func_decl_n.arg_list == 0)
+      if (VAL (2) == 0)
       {
         printf ("function %s ();", VAR (1));
       }
       else
       {
-        vargs_num = opm.op.data.func_decl_n.arg_list;
+        vargs_num = VAL (2);
         seen_vargs = 0;
       }
       break;
     }
     case NAME_TO_ID (func_expr_n):
     {
-      if (opm.op.data.func_expr_n.arg_list == 0)
+      if (VAL (3) == 0)
       {
         if (opm.op.data.func_expr_n.name_lit_idx == INVALID_VALUE)
         {
@@ -333,38 +394,38 @@ pp_op_meta (const opcode_t *opcodes_p,
         }
         else
         {
-          pp_printf ("%s = function %s ();", opm.op, opm.lit_id, oc, 1);
+          pp_printf ("%s = function %s ();", opcodes_p, opm.op, opm.lit_id, oc, 1);
         }
       }
       else
       {
-        vargs_num = opm.op.data.func_expr_n.arg_list;
+        vargs_num = VAL (3);
         seen_vargs = 0;
       }
       break;
     }
     case NAME_TO_ID (array_decl):
     {
-      if (opm.op.data.array_decl.list == 0)
+      if (VAL (2) == 0)
       {
         printf ("%s = [];", VAR (1));
       }
       else
       {
-        vargs_num = opm.op.data.array_decl.list;
+        vargs_num = VAL (2);
         seen_vargs = 0;
       }
       break;
     }
     case NAME_TO_ID (obj_decl):
     {
-      if (opm.op.data.obj_decl.list == 0)
+      if (VAL (2) == 0)
       {
         printf ("%s = {};", VAR (1));
       }
       else
       {
-        vargs_num = opm.op.data.obj_decl.list;
+        vargs_num = VAL (2);
         seen_vargs = 0;
       }
       break;
@@ -393,7 +454,7 @@ pp_op_meta (const opcode_t *opcodes_p,
           {
             bool found = false;
             opcode_counter_t start = oc;
-            while ((int16_t) start >= 0 && !found)
+            while ((int32_t) start >= 0 && !found)
             {
               start--;
               switch (serializer_get_opcode (opcodes_p, start).op_idx)
@@ -416,12 +477,12 @@ pp_op_meta (const opcode_t *opcodes_p,
             {
               case NAME_TO_ID (call_n):
               {
-                pp_printf ("%s = %s (", start_op, NULL, start, 1);
+                pp_printf ("%s = %s (", opcodes_p, start_op, NULL, start, 1);
                 break;
               }
               case NAME_TO_ID (native_call):
               {
-                pp_printf ("%s = ", start_op, NULL, start, 1);
+                pp_printf ("%s = ", opcodes_p, start_op, NULL, start, 1);
                 switch (start_op.data.native_call.name)
                 {
                   case OPCODE_NATIVE_CALL_LED_TOGGLE: printf ("LEDToggle ("); break;
@@ -436,34 +497,34 @@ pp_op_meta (const opcode_t *opcodes_p,
               }
               case NAME_TO_ID (construct_n):
               {
-                pp_printf ("%s = new %s (", start_op, NULL, start, 1);
+                pp_printf ("%s = new %s (", opcodes_p, start_op, NULL, start, 1);
                 break;
               }
               case NAME_TO_ID (func_decl_n):
               {
-                pp_printf ("function %s (", start_op, NULL, start, 1);
+                pp_printf ("function %s (", opcodes_p, start_op, NULL, start, 1);
                 break;
               }
               case NAME_TO_ID (func_expr_n):
               {
                 if (start_op.data.func_expr_n.name_lit_idx == INVALID_VALUE)
                 {
-                  pp_printf ("%s = function (", start_op, NULL, start, 1);
+                  pp_printf ("%s = function (", opcodes_p, start_op, NULL, start, 1);
                 }
                 else
                 {
-                  pp_printf ("%s = function %s (", start_op, NULL, start, 1);
+                  pp_printf ("%s = function %s (", opcodes_p, start_op, NULL, start, 1);
                 }
                 break;
               }
               case NAME_TO_ID (array_decl):
               {
-                pp_printf ("%s = [", start_op, NULL, start, 1);
+                pp_printf ("%s = [", opcodes_p, start_op, NULL, start, 1);
                 break;
               }
               case NAME_TO_ID (obj_decl):
               {
-                pp_printf ("%s = {", start_op, NULL, start, 1);
+                pp_printf ("%s = {", opcodes_p, start_op, NULL, start, 1);
                 break;
               }
               default:
@@ -487,7 +548,7 @@ pp_op_meta (const opcode_t *opcodes_p,
 
                       if (call_flags & OPCODE_CALL_FLAGS_HAVE_THIS_ARG)
                       {
-                        pp_printf ("this_arg = %s", meta_op, NULL, counter, 3);
+                        pp_printf ("this_arg = %s", opcodes_p, meta_op, NULL, counter, 3);
                       }
                       if (call_flags & OPCODE_CALL_FLAGS_DIRECT_CALL_TO_EVAL_FORM)
                       {
@@ -498,22 +559,22 @@ pp_op_meta (const opcode_t *opcodes_p,
                     }
                     case OPCODE_META_TYPE_VARG:
                     {
-                      pp_printf ("%s", meta_op, NULL, counter, 2);
+                      pp_printf ("%s", opcodes_p, meta_op, NULL, counter, 2);
                       break;
                     }
                     case OPCODE_META_TYPE_VARG_PROP_DATA:
                     {
-                      pp_printf ("%s:%s", meta_op, NULL, counter, 2);
+                      pp_printf ("%s:%s", opcodes_p, meta_op, NULL, counter, 2);
                       break;
                     }
                     case OPCODE_META_TYPE_VARG_PROP_GETTER:
                     {
-                      pp_printf ("%s = get %s ();", meta_op, NULL, counter, 2);
+                      pp_printf ("%s = get %s ();", opcodes_p, meta_op, NULL, counter, 2);
                       break;
                     }
                     case OPCODE_META_TYPE_VARG_PROP_SETTER:
                     {
-                      pp_printf ("%s = set (%s);", meta_op, NULL, counter, 2);
+                      pp_printf ("%s = set (%s);", opcodes_p, meta_op, NULL, counter, 2);
                       break;
                     }
                     default:
@@ -564,6 +625,11 @@ pp_op_meta (const opcode_t *opcodes_p,
           printf ("function end: %d;", oc + OC (2, 3));
           break;
         }
+        case OPCODE_META_TYPE_LAZY_FUNCTION:
+        {
+          printf ("lazy function body: %d;", OC (2, 3));
+          break;
+        }
         case OPCODE_META_TYPE_CATCH:
         {
           printf ("catch end: %d;", oc + OC (2, 3));
@@ -0,0 +1,412 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "vm-profiler.h"
+
+#ifdef VM_OPCODE_PROFILER
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmprofiler Opcode profiler
+ * @{
+ */
+
+/**
+ * Maximum number of probes upon lookup of an instruction's entry in the table
+ */
+#define VM_PROFILER_INSTRUCTIONS_TABLE_MAX_PROBES (8u)
+
+/**
+ * Number of rows in the dumped tables of hottest instructions and most frequent opcode pairs
+ */
+#define VM_PROFILER_DUMP_TOP_ROWS (32u)
+
+#define __OP_FUNC_NAME(name, arg1, arg2, arg3) #name,
+static const char *vm_profiler_op_names[LAST_OP] =
+{
+  OP_LIST (OP_FUNC_NAME)
+};
+#undef __OP_FUNC_NAME
+
+/**
+ * Initialize opcode profiler's state
+ */
+void
+vm_profiler_init (bool is_enabled) /**< should executions be profiled */
+{
+  memset (&JERRY_CONTEXT (vm_profiler), 0, sizeof (JERRY_CONTEXT (vm_profiler)));
+
+  JERRY_CONTEXT (vm_profiler).is_enabled = is_enabled;
+} /* vm_profiler_init */
+
+/**
+ * Start profiling an instruction's execution
+ */
+void
+vm_profiler_opcode_enter (vm_profiler_sample_t *out_sample_p, /**< out: sample of the execution */
+                          idx_t prev_op_idx, /**< opcode of the instruction, executed before
+                                              *   in the same code block, or LAST_OP - if there is none */
+                          idx_t op_idx) /**< opcode of the instruction */
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  if (likely (!state_p->is_enabled))
+  {
+    return;
+  }
+
+  if (prev_op_idx < LAST_OP)
+  {
+    state_p->pair_counts[prev_op_idx][op_idx]++;
+  }
+
+  out_sample_p->outer_nested_cycles = state_p->nested_cycles;
+  state_p->nested_cycles = 0;
+
+  out_sample_p->start_cycles = jrt_get_cycles ();
+} /* vm_profiler_opcode_enter */
+
+/**
+ * Find the instruction's entry in the table of per-instruction counters, creating the entry if necessary
+ *
+ * @return pointer to the entry - if the instruction is in the table or there is place for it,
+ *         NULL - otherwise.
+ */
+static vm_profiler_instruction_entry_t *
+vm_profiler_get_instruction_entry (const int_data_t *int_data_p, /**< interpreter context */
+                                   opcode_counter_t pos, /**< position of the instruction */
+                                   idx_t op_idx) /**< opcode of the instruction */
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  const uint32_t hash = (uint32_t) (((uintptr_t) int_data_p->opcodes_p >> 2u) ^ (pos * 2654435761u));
+
+  for (uint32_t probe = 0; probe < VM_PROFILER_INSTRUCTIONS_TABLE_MAX_PROBES; probe++)
+  {
+    vm_profiler_instruction_entry_t *entry_p;
+    entry_p = &state_p->instructions[(hash + probe) & (VM_PROFILER_INSTRUCTIONS_TABLE_SIZE - 1u)];
+
+    if (entry_p->opcodes_p == NULL)
+    {
+      entry_p->opcodes_p = int_data_p->opcodes_p;
+      entry_p->block_start_pos = int_data_p->block_start_pos;
+      entry_p->pos = pos;
+      entry_p->op_idx = op_idx;
+
+      return entry_p;
+    }
+    else if (entry_p->opcodes_p == int_data_p->opcodes_p
+             && entry_p->pos == pos
+             && entry_p->op_idx == op_idx)
+    {
+      return entry_p;
+    }
+  }
+
+  return NULL;
+} /* vm_profiler_get_instruction_entry */
+
+/**
+ * Finish profiling an instruction's execution
+ */
+void
+vm_profiler_opcode_exit (vm_profiler_sample_t *sample_p, /**< sample of the execution,
+                                                          *   started with vm_profiler_opcode_enter */
+                         const int_data_t *int_data_p, /**< interpreter context */
+                         opcode_counter_t pos) /**< position of the instruction */
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  if (likely (!state_p->is_enabled))
+  {
+    return;
+  }
+
+  const uint64_t total_cycles = jrt_get_cycles () - sample_p->start_cycles;
+  const uint64_t self_cycles = (total_cycles > state_p->nested_cycles) ? total_cycles - state_p->nested_cycles : 0;
+
+  state_p->nested_cycles = sample_p->outer_nested_cycles + total_cycles;
+
+  const idx_t op_idx = int_data_p->opcodes_p[pos].op_idx;
+
+  state_p->opcode_counts[op_idx]++;
+  state_p->opcode_cycles[op_idx] += self_cycles;
+
+  vm_profiler_instruction_entry_t *entry_p = vm_profiler_get_instruction_entry (int_data_p, pos, op_idx);
+
+  if (entry_p != NULL)
+  {
+    entry_p->count++;
+    entry_p->cycles += self_cycles;
+  }
+  else
+  {
+    state_p->untracked_instructions_count++;
+  }
+} /* vm_profiler_opcode_exit */
+
+/**
+ * Calculate percentage of a value from the total, multiplied by 100 (for printing with two decimal digits)
+ *
+ * @return the percentage
+ */
+static uint32_t
+vm_profiler_get_percentage (uint64_t value, /**< value */
+                            uint64_t total) /**< total */
+{
+  return (total == 0) ? 0 : (uint32_t) (value * 10000u / total);
+} /* vm_profiler_get_percentage */
+
+/**
+ * Print 64-bit unsigned integer, right-justified in the field of specified width, preceded by a space
+ *
+ * Note:
+ *      values are formatted here, as printf of jerry-libc is limited to 32-bit integers
+ */
+static void
+vm_profiler_print_uint64 (uint64_t value, /**< value */
+                          uint32_t width) /**< width of the field */
+{
+  char buffer[24];
+  char *str_p = buffer + sizeof (buffer) - 1;
+  *str_p = '\0';
+
+  do
+  {
+    *(--str_p) = (char) ('0' + (value % 10u));
+    value /= 10u;
+  }
+  while (value != 0);
+
+  for (uint32_t length = (uint32_t) (buffer + sizeof (buffer) - 1 - str_p); length < width; length++)
+  {
+    printf (" ");
+  }
+
+  printf (" %s", str_p);
+} /* vm_profiler_print_uint64 */
+
+/**
+ * Dump table of opcodes, sorted by spent cycles (or, if cycles are not available, by execution count)
+ */
+static void
+vm_profiler_dump_opcodes (void)
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  uint64_t total_count = 0;
+  uint64_t total_cycles = 0;
+
+  idx_t sorted_ops[LAST_OP];
+  uint32_t sorted_ops_num = 0;
+
+  for (idx_t op_idx = 0; op_idx < LAST_OP; op_idx++)
+  {
+    if (state_p->opcode_counts[op_idx] == 0)
+    {
+      continue;
+    }
+
+    total_count += state_p->opcode_counts[op_idx];
+    total_cycles += state_p->opcode_cycles[op_idx];
+
+    /* insertion sort by cycles, then by count, in descending order */
+    uint32_t i = sorted_ops_num++;
+    while (i > 0
+           && (state_p->opcode_cycles[sorted_ops[i - 1]] < state_p->opcode_cycles[op_idx]
+               || (state_p->opcode_cycles[sorted_ops[i - 1]] == state_p->opcode_cycles[op_idx]
+                   && state_p->opcode_counts[sorted_ops[i - 1]] < state_p->opcode_counts[op_idx])))
+    {
+      sorted_ops[i] = sorted_ops[i - 1];
+      i--;
+    }
+    sorted_ops[i] = op_idx;
+  }
+
+  printf ("\n----- Opcode execution profile (cycles exclude nested instructions) -----\n\n");
+  printf ("%-24s %14s %7s %18s %7s %12s\n", "Opcode", "Count", "%", "Cycles", "%", "Cycles/exec");
+
+  for (uint32_t i = 0; i < sorted_ops_num; i++)
+  {
+    const idx_t op_idx = sorted_ops[i];
+    const uint64_t count = state_p->opcode_counts[op_idx];
+    const uint64_t cycles = state_p->opcode_cycles[op_idx];
+    const uint32_t count_percentage = vm_profiler_get_percentage (count, total_count);
+    const uint32_t cycles_percentage = vm_profiler_get_percentage (cycles, total_cycles);
+
+    printf ("%-24s", vm_profiler_op_names[op_idx]);
+    vm_profiler_print_uint64 (count, 14);
+    printf (" %4u.%02u", count_percentage / 100u, count_percentage % 100u);
+    vm_profiler_print_uint64 (cycles, 18);
+    printf (" %4u.%02u", cycles_percentage / 100u, cycles_percentage % 100u);
+    vm_profiler_print_uint64 (cycles / count, 12);
+    printf ("\n");
+  }
+
+  printf ("%-24s", "Total");
+  vm_profiler_print_uint64 (total_count, 14);
+  printf (" %7s", "");
+  vm_profiler_print_uint64 (total_cycles, 18);
+  printf ("\n");
+} /* vm_profiler_dump_opcodes */
+
+/**
+ * Dump table of hottest instructions
+ */
+static void
+vm_profiler_dump_instructions (void)
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  uint32_t top[VM_PROFILER_DUMP_TOP_ROWS];
+  uint32_t top_num = 0;
+
+  for (uint32_t entry_idx = 0; entry_idx < VM_PROFILER_INSTRUCTIONS_TABLE_SIZE; entry_idx++)
+  {
+    const vm_profiler_instruction_entry_t *entry_p = &state_p->instructions[entry_idx];
+
+    if (entry_p->opcodes_p == NULL)
+    {
+      continue;
+    }
+
+    /* insertion into bounded list, sorted by cycles, then by count, in descending order */
+    uint32_t i = (top_num < VM_PROFILER_DUMP_TOP_ROWS) ? top_num++ : VM_PROFILER_DUMP_TOP_ROWS;
+
+    while (i > 0
+           && (state_p->instructions[top[i - 1]].cycles < entry_p->cycles
+               || (state_p->instructions[top[i - 1]].cycles == entry_p->cycles
+                   && state_p->instructions[top[i - 1]].count < entry_p->count)))
+    {
+      if (i < VM_PROFILER_DUMP_TOP_ROWS)
+      {
+        top[i] = top[i - 1];
+      }
+      i--;
+    }
+
+    if (i < VM_PROFILER_DUMP_TOP_ROWS)
+    {
+      top[i] = entry_idx;
+    }
+  }
+
+  printf ("\n----- Hottest instructions (code block is identified by byte-code and position of its start) -----\n\n");
+  printf ("%-18s %10s %10s %-24s %14s %18s\n", "Byte-code", "Block", "Position", "Opcode", "Count", "Cycles");
+
+  for (uint32_t i = 0; i < top_num; i++)
+  {
+    const vm_profiler_instruction_entry_t *entry_p = &state_p->instructions[top[i]];
+
+    printf ("%-18p %10u %10u %-24s",
+            (const void *) entry_p->opcodes_p,
+            (uint32_t) entry_p->block_start_pos,
+            (uint32_t) entry_p->pos,
+            vm_profiler_op_names[entry_p->op_idx]);
+    vm_profiler_print_uint64 (entry_p->count, 14);
+    vm_profiler_print_uint64 (entry_p->cycles, 18);
+    printf ("\n");
+  }
+
+  if (state_p->untracked_instructions_count != 0)
+  {
+    printf ("(");
+    vm_profiler_print_uint64 (state_p->untracked_instructions_count, 0);
+    printf (" executions of instructions, that didn't fit into the table, are not shown)\n");
+  }
+} /* vm_profiler_dump_instructions */
+
+/**
+ * Dump table of most frequent pairs of successively executed opcodes (candidates for superinstructions)
+ */
+static void
+vm_profiler_dump_pairs (void)
+{
+  vm_profiler_state_t *state_p = &JERRY_CONTEXT (vm_profiler);
+
+  uint32_t top[VM_PROFILER_DUMP_TOP_ROWS];
+  uint32_t top_num = 0;
+  uint64_t total_pairs = 0;
+
+  for (uint32_t pair_idx = 0; pair_idx < (uint32_t) LAST_OP * LAST_OP; pair_idx++)
+  {
+    const uint64_t count = state_p->pair_counts[pair_idx / LAST_OP][pair_idx % LAST_OP];
+
+    if (count == 0)
+    {
+      continue;
+    }
+
+    total_pairs += count;
+
+    uint32_t i = (top_num < VM_PROFILER_DUMP_TOP_ROWS) ? top_num++ : VM_PROFILER_DUMP_TOP_ROWS;
+
+    while (i > 0
+           && state_p->pair_counts[top[i - 1] / LAST_OP][top[i - 1] % LAST_OP] < count)
+    {
+      if (i < VM_PROFILER_DUMP_TOP_ROWS)
+      {
+        top[i] = top[i - 1];
+      }
+      i--;
+    }
+
+    if (i < VM_PROFILER_DUMP_TOP_ROWS)
+    {
+      top[i] = pair_idx;
+    }
+  }
+
+  printf ("\n----- Most frequent opcode pairs -----\n\n");
+  printf ("%-24s %-24s %14s %7s\n", "First", "Second", "Count", "%");
+
+  for (uint32_t i = 0; i < top_num; i++)
+  {
+    const uint64_t count = state_p->pair_counts[top[i] / LAST_OP][top[i] % LAST_OP];
+    const uint32_t percentage = vm_profiler_get_percentage (count, total_pairs);
+
+    printf ("%-24s %-24s", vm_profiler_op_names[top[i] / LAST_OP], vm_profiler_op_names[top[i] % LAST_OP]);
+    vm_profiler_print_uint64 (count, 14);
+    printf (" %4u.%02u\n", percentage / 100u, percentage % 100u);
+  }
+} /* vm_profiler_dump_pairs */
+
+/**
+ * Dump collected profile
+ */
+void
+vm_profiler_dump (void)
+{
+  if (!JERRY_CONTEXT (vm_profiler).is_enabled)
+  {
+    return;
+  }
+
+  vm_profiler_dump_opcodes ();
+  vm_profiler_dump_instructions ();
+  vm_profiler_dump_pairs ();
+
+  printf ("\n");
+} /* vm_profiler_dump */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* VM_OPCODE_PROFILER */
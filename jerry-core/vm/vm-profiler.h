@@ -0,0 +1,92 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_PROFILER_H
+#define VM_PROFILER_H
+
+#ifdef VM_OPCODE_PROFILER
+
+#include "opcodes.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmprofiler Opcode profiler
+ * @{
+ */
+
+/**
+ * Number of entries in the table of per-instruction counters (should be a power of 2)
+ *
+ * Note:
+ *      executions of instructions that don't fit into the table are counted only per opcode
+ */
+#define VM_PROFILER_INSTRUCTIONS_TABLE_SIZE (4096u)
+
+/**
+ * Counters of an instruction (byte-code, position) executions
+ *
+ * Note:
+ *      the byte-code can be freed before the profile is dumped (for example, byte-code of eval code),
+ *      so the instruction's opcode is stored in the entry, and the byte-code pointer is used only as identifier.
+ */
+typedef struct
+{
+  const opcode_t *opcodes_p; /**< byte-code (NULL marks entry empty) */
+  opcode_counter_t block_start_pos; /**< position of the code block's (function's) reg_var_decl */
+  opcode_counter_t pos; /**< position of the instruction */
+  idx_t op_idx; /**< opcode of the instruction */
+  uint64_t count; /**< number of executions */
+  uint64_t cycles; /**< cycles spent in the instruction's handler, excluding nested instructions */
+} vm_profiler_instruction_entry_t;
+
+/**
+ * State of the opcode profiler
+ */
+typedef struct
+{
+  bool is_enabled; /**< is profiling enabled (see also: JERRY_FLAG_OPCODE_PROFILE) */
+  uint64_t nested_cycles; /**< cycles spent in instructions, nested into currently executed instruction */
+  uint64_t opcode_counts[LAST_OP]; /**< number of executions of each opcode */
+  uint64_t opcode_cycles[LAST_OP]; /**< cycles spent in each opcode, excluding nested instructions */
+  uint64_t pair_counts[LAST_OP][LAST_OP]; /**< number of executions of each opcode after each other opcode
+                                           *   in the same code block */
+  uint64_t untracked_instructions_count; /**< executions of instructions, that don't fit into the table */
+  vm_profiler_instruction_entry_t instructions[VM_PROFILER_INSTRUCTIONS_TABLE_SIZE]; /**< per-instruction
+                                                                                      *   counters */
+} vm_profiler_state_t;
+
+/**
+ * Sample of an instruction execution
+ */
+typedef struct
+{
+  uint64_t start_cycles; /**< cycle counter's value at the start of the instruction */
+  uint64_t outer_nested_cycles; /**< nested cycles of the enclosing instruction, saved at the start */
+} vm_profiler_sample_t;
+
+extern void vm_profiler_init (bool);
+extern void vm_profiler_opcode_enter (vm_profiler_sample_t *, idx_t, idx_t);
+extern void vm_profiler_opcode_exit (vm_profiler_sample_t *, const int_data_t *, opcode_counter_t);
+extern void vm_profiler_dump (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* VM_OPCODE_PROFILER */
+
+#endif /* !VM_PROFILER_H */
@@ -0,0 +1,230 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "jrt-libc-includes.h"
+#include "serializer.h"
+#include "vm.h"
+#include "vm-sampling-profiler.h"
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmsamplingprofiler Sampling profiler
+ * @{
+ *
+ * The profiler writes a line for each sample, in the 'folded stacks' format, used by flamegraph.pl:
+ *
+ *   (global):12;outer:5;inner:7 1
+ *
+ * i.e. frames of the sampled call stack, from the bottom-most to the top-most one, separated with semicolons
+ * (each frame is described with name of the executed function and the line, executed in the frame),
+ * followed by number of samples. Samples with equal stacks are summed up by flamegraph.pl.
+ */
+
+/**
+ * Maximum size of a function's name in the output (longer names are truncated)
+ */
+#define VM_SAMPLING_PROFILER_MAX_NAME_SIZE (64u)
+
+/**
+ * Size of the buffer, a sample's line is formatted in before it is written to the output file
+ */
+#define VM_SAMPLING_PROFILER_OUTPUT_BUFFER_SIZE (512u)
+
+/**
+ * Buffer for formatting of a sample's line
+ */
+typedef struct
+{
+  FILE *file_p; /**< output file */
+  size_t size; /**< number of bytes in the buffer */
+  char data[VM_SAMPLING_PROFILER_OUTPUT_BUFFER_SIZE]; /**< the buffer */
+} vm_sampling_profiler_output_t;
+
+/**
+ * Append a string to the output buffer, writing the buffer's contents to the file, if it is full
+ */
+static void
+vm_sampling_profiler_append_string (vm_sampling_profiler_output_t *output_p, /**< output buffer */
+                                    const char *str_p) /**< zero-terminated string */
+{
+  while (*str_p != '\0')
+  {
+    if (output_p->size == sizeof (output_p->data))
+    {
+      fwrite (output_p->data, 1, output_p->size, output_p->file_p);
+      output_p->size = 0;
+    }
+
+    output_p->data[output_p->size++] = *str_p++;
+  }
+} /* vm_sampling_profiler_append_string */
+
+/**
+ * Append decimal representation of an unsigned integer to the output buffer
+ */
+static void
+vm_sampling_profiler_append_uint (vm_sampling_profiler_output_t *output_p, /**< output buffer */
+                                  uint32_t value) /**< the value */
+{
+  char str[11];
+  size_t pos = sizeof (str) - 1;
+  str[pos] = '\0';
+
+  do
+  {
+    str[--pos] = (char) ('0' + value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+
+  vm_sampling_profiler_append_string (output_p, str + pos);
+} /* vm_sampling_profiler_append_uint */
+
+/**
+ * Append descriptions of an interpreter context and of the contexts, it was called from, to the output buffer
+ */
+static void
+vm_sampling_profiler_append_frames (vm_sampling_profiler_output_t *output_p, /**< output buffer */
+                                    const int_data_t *frame_p, /**< interpreter context */
+                                    bool is_top_frame) /**< is the context the currently executed one */
+{
+  if (frame_p->prev_context_p != NULL)
+  {
+    vm_sampling_profiler_append_frames (output_p, frame_p->prev_context_p, false);
+    vm_sampling_profiler_append_string (output_p, ";");
+  }
+
+  lit_utf8_byte_t name_buffer[VM_SAMPLING_PROFILER_MAX_NAME_SIZE];
+
+  /*
+   * Call instructions advance position of the calling context past the call and its arguments' 'meta' instructions
+   * before the callee is executed, so line of a calling context is taken from the instruction, preceding the position
+   */
+  opcode_counter_t pos = frame_p->pos;
+
+  if (!is_top_frame && pos > frame_p->block_start_pos)
+  {
+    pos--;
+  }
+
+  vm_sampling_profiler_append_string (output_p, vm_get_function_name (frame_p, name_buffer, sizeof (name_buffer)));
+  vm_sampling_profiler_append_string (output_p, ":");
+  vm_sampling_profiler_append_uint (output_p, serializer_get_line (frame_p->opcodes_p, pos));
+} /* vm_sampling_profiler_append_frames */
+
+/**
+ * Initialize sampling profiler's state
+ */
+void
+vm_sampling_profiler_init (void)
+{
+  JERRY_CONTEXT (vm_sampling_profiler).output_file_p = NULL;
+  JERRY_CONTEXT (vm_sampling_profiler).samples_number = 0;
+  JERRY_CONTEXT (vm_sampling_profiler).is_sample_requested = 0;
+} /* vm_sampling_profiler_init */
+
+/**
+ * Start writing samples to the specified file (the file is truncated)
+ *
+ * @return true - if the file was opened successfully,
+ *         false - otherwise.
+ */
+bool
+vm_sampling_profiler_start (const char *file_name_p) /**< output file name */
+{
+  vm_sampling_profiler_stop ();
+
+  FILE *file_p = fopen (file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  JERRY_CONTEXT (vm_sampling_profiler).output_file_p = file_p;
+  JERRY_CONTEXT (vm_sampling_profiler).samples_number = 0;
+
+  return true;
+} /* vm_sampling_profiler_start */
+
+/**
+ * Stop writing samples and close the output file
+ *
+ * @return number of samples, written to the file since start of the profiler
+ */
+uint32_t
+vm_sampling_profiler_stop (void)
+{
+  if (JERRY_CONTEXT (vm_sampling_profiler).output_file_p != NULL)
+  {
+    fclose (JERRY_CONTEXT (vm_sampling_profiler).output_file_p);
+    JERRY_CONTEXT (vm_sampling_profiler).output_file_p = NULL;
+  }
+
+  return JERRY_CONTEXT (vm_sampling_profiler).samples_number;
+} /* vm_sampling_profiler_stop */
+
+/**
+ * Request a sample of the call stack, executed in the specified context
+ *
+ * The sample is taken by the interpreter loop before execution of the next instruction.
+ *
+ * Note:
+ *      the routine is async-signal-safe, so it can be called from a signal handler (for example, of SIGPROF)
+ */
+void
+vm_sampling_profiler_request_sample (jerry_ctx_t *ctx_p) /**< context to sample */
+{
+  ctx_p->vm_sampling_profiler.is_sample_requested = 1;
+} /* vm_sampling_profiler_request_sample */
+
+/**
+ * Take the requested sample of the call stack and write it to the output file
+ */
+void
+vm_sampling_profiler_take_sample (void)
+{
+  JERRY_CONTEXT (vm_sampling_profiler).is_sample_requested = 0;
+
+  const int_data_t *top_frame_p = JERRY_CONTEXT (vm_top_context_p);
+
+  if (JERRY_CONTEXT (vm_sampling_profiler).output_file_p == NULL
+      || top_frame_p == NULL)
+  {
+    return;
+  }
+
+  vm_sampling_profiler_output_t output;
+  output.file_p = JERRY_CONTEXT (vm_sampling_profiler).output_file_p;
+  output.size = 0;
+
+  vm_sampling_profiler_append_frames (&output, top_frame_p, true);
+  vm_sampling_profiler_append_string (&output, " 1\n");
+
+  fwrite (output.data, 1, output.size, output.file_p);
+
+  JERRY_CONTEXT (vm_sampling_profiler).samples_number++;
+} /* vm_sampling_profiler_take_sample */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
@@ -0,0 +1,59 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_SAMPLING_PROFILER_H
+#define VM_SAMPLING_PROFILER_H
+
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+
+#include <signal.h>
+
+#include "jerry.h"
+#include "jrt-libc-includes.h"
+#include "opcodes.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmsamplingprofiler Sampling profiler
+ * @{
+ */
+
+/**
+ * State of the sampling profiler
+ */
+typedef struct
+{
+  FILE *output_file_p; /**< file, the folded stacks are written to (NULL - if the profiler is stopped) */
+  uint32_t samples_number; /**< number of samples, taken since start of the profiler */
+  volatile sig_atomic_t is_sample_requested; /**< flag, indicating that a sample was requested
+                                              *   (see also: vm_sampling_profiler_request_sample);
+                                              *   checked by the interpreter loop before each instruction */
+} vm_sampling_profiler_state_t;
+
+extern void vm_sampling_profiler_init (void);
+extern bool vm_sampling_profiler_start (const char *);
+extern uint32_t vm_sampling_profiler_stop (void);
+extern void vm_sampling_profiler_request_sample (jerry_ctx_t *);
+extern void vm_sampling_profiler_take_sample (void);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
+
+#endif /* !VM_SAMPLING_PROFILER_H */
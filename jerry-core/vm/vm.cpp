@@ -15,21 +15,22 @@
 
 #include "ecma-alloc.h"
 #include "ecma-builtins.h"
+#include "ecma-exceptions.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lex-env.h"
 #include "ecma-stack.h"
+#include "jcontext.h"
 #include "jrt.h"
+#include "mem-heap.h"
+#include "serializer.h"
 #include "vm.h"
+#include "vm-profiler.h"
+#include "vm-sampling-profiler.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
 
-/**
- * Top (current) interpreter context
- */
-int_data_t *vm_top_context_p = NULL;
-
 #define __INIT_OP_FUNC(name, arg1, arg2, arg3) [ __op__idx_##name ] = opfunc_##name,
 static const opfunc __opfuncs[LAST_OP] =
 {
@@ -39,8 +40,6 @@ static const opfunc __opfuncs[LAST_OP] =
 
 JERRY_STATIC_ASSERT (sizeof (opcode_t) <= 4);
 
-const opcode_t *__program = NULL;
-
 #ifdef MEM_STATS
 #define __OP_FUNC_NAME(name, arg1, arg2, arg3) #name,
 static const char *__op_names[LAST_OP] =
@@ -51,13 +50,10 @@ static const char *__op_names[LAST_OP] =
 
 #define INTERP_MEM_PRINT_INDENTATION_STEP (5)
 #define INTERP_MEM_PRINT_INDENTATION_MAX  (125)
-static uint32_t interp_mem_stats_print_indentation = 0;
-static bool interp_mem_stats_enabled = false;
-
 static void
 interp_mem_stats_print_legend (void)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
@@ -81,7 +77,7 @@ interp_mem_get_stats (mem_heap_stats_t *out_heap_stats_p,
                       bool reset_peak_before,
                       bool reset_peak_after)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
@@ -109,12 +105,12 @@ static void
 interp_mem_stats_context_enter (int_data_t *int_data_p,
                                 opcode_counter_t block_position)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
 
-  const uint32_t indentation = JERRY_MIN (interp_mem_stats_print_indentation,
+  const uint32_t indentation = JERRY_MIN (JERRY_CONTEXT (vm_mem_stats_print_indentation),
                                           INTERP_MEM_PRINT_INDENTATION_MAX);
 
   char indent_prefix[INTERP_MEM_PRINT_INDENTATION_MAX + 2];
@@ -147,12 +143,12 @@ static void
 interp_mem_stats_context_exit (int_data_t *int_data_p,
                                opcode_counter_t block_position)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
 
-  const uint32_t indentation = JERRY_MIN (interp_mem_stats_print_indentation,
+  const uint32_t indentation = JERRY_MIN (JERRY_CONTEXT (vm_mem_stats_print_indentation),
                                           INTERP_MEM_PRINT_INDENTATION_MAX);
 
   char indent_prefix[INTERP_MEM_PRINT_INDENTATION_MAX + 2];
@@ -219,12 +215,12 @@ interp_mem_stats_opcode_enter (const opcode_t *opcodes_p,
                                mem_heap_stats_t *out_heap_stats_p,
                                mem_pools_stats_t *out_pools_stats_p)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
 
-  const uint32_t indentation = JERRY_MIN (interp_mem_stats_print_indentation,
+  const uint32_t indentation = JERRY_MIN (JERRY_CONTEXT (vm_mem_stats_print_indentation),
                                           INTERP_MEM_PRINT_INDENTATION_MAX);
 
   char indent_prefix[INTERP_MEM_PRINT_INDENTATION_MAX + 2];
@@ -241,7 +237,7 @@ interp_mem_stats_opcode_enter (const opcode_t *opcodes_p,
   printf ("%s-- Opcode: %s (position %u) --\n",
           indent_prefix, __op_names[opcode.op_idx], (uint32_t) opcode_position);
 
-  interp_mem_stats_print_indentation += INTERP_MEM_PRINT_INDENTATION_STEP;
+  JERRY_CONTEXT (vm_mem_stats_print_indentation) += INTERP_MEM_PRINT_INDENTATION_STEP;
 }
 
 static void
@@ -250,14 +246,14 @@ interp_mem_stats_opcode_exit (int_data_t *int_data_p,
                               mem_heap_stats_t *heap_stats_before_p,
                               mem_pools_stats_t *pools_stats_before_p)
 {
-  if (likely (!interp_mem_stats_enabled))
+  if (likely (!JERRY_CONTEXT (vm_mem_stats_enabled)))
   {
     return;
   }
 
-  interp_mem_stats_print_indentation -= INTERP_MEM_PRINT_INDENTATION_STEP;
+  JERRY_CONTEXT (vm_mem_stats_print_indentation) -= INTERP_MEM_PRINT_INDENTATION_STEP;
 
-  const uint32_t indentation = JERRY_MIN (interp_mem_stats_print_indentation,
+  const uint32_t indentation = JERRY_MIN (JERRY_CONTEXT (vm_mem_stats_print_indentation),
                                           INTERP_MEM_PRINT_INDENTATION_MAX);
 
   char indent_prefix[INTERP_MEM_PRINT_INDENTATION_MAX + 2];
@@ -341,14 +337,14 @@ vm_init (const opcode_t *program_p, /**< pointer to byte-code program */
          bool dump_mem_stats) /** dump per-opcode memory usage change statistics */
 {
 #ifdef MEM_STATS
-  interp_mem_stats_enabled = dump_mem_stats;
+  JERRY_CONTEXT (vm_mem_stats_enabled) = dump_mem_stats;
 #else /* MEM_STATS */
   JERRY_ASSERT (!dump_mem_stats);
 #endif /* !MEM_STATS */
 
-  JERRY_ASSERT (__program == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) == NULL);
 
-  __program = program_p;
+  JERRY_CONTEXT (vm_program_p) = program_p;
 } /* vm_init */
 
 /**
@@ -357,7 +353,7 @@ vm_init (const opcode_t *program_p, /**< pointer to byte-code program */
 void
 vm_finalize (void)
 {
-  __program = NULL;
+  JERRY_CONTEXT (vm_program_p) = NULL;
 } /* vm_finalize */
 
 /**
@@ -366,8 +362,8 @@ vm_finalize (void)
 jerry_completion_code_t
 vm_run_global (void)
 {
-  JERRY_ASSERT (__program != NULL);
-  JERRY_ASSERT (vm_top_context_p == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_program_p) != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) == NULL);
 
 #ifdef MEM_STATS
   interp_mem_stats_print_legend ();
@@ -376,7 +372,7 @@ vm_run_global (void)
   bool is_strict = false;
   opcode_counter_t start_pos = 0;
 
-  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (__program,
+  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (JERRY_CONTEXT (vm_program_p),
                                                               start_pos++);
 
   if (scope_flags & OPCODE_SCOPE_CODE_FLAGS_STRICT)
@@ -387,7 +383,7 @@ vm_run_global (void)
   ecma_object_t *glob_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_GLOBAL);
   ecma_object_t *lex_env_p = ecma_get_global_environment ();
 
-  ecma_completion_value_t completion = vm_run_from_pos (__program,
+  ecma_completion_value_t completion = vm_run_from_pos (JERRY_CONTEXT (vm_program_p),
                                                         start_pos,
                                                         ecma_make_object_value (glob_obj_p),
                                                         lex_env_p,
@@ -414,11 +410,113 @@ vm_run_global (void)
   ecma_deref_object (glob_obj_p);
   ecma_deref_object (lex_env_p);
 
-  JERRY_ASSERT (vm_top_context_p == NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) == NULL);
 
   return ret_code;
 } /* vm_run_global */
 
+/**
+ * Raise error upon exceeding budget of heap usage during current run (see also: mem_heap_start_budget)
+ *
+ * @return throw completion value
+ */
+static ecma_completion_value_t __attr_noinline___
+vm_raise_memory_budget_error (void)
+{
+  ecma_completion_value_t completion = ecma_raise_range_error ("Out of memory");
+
+  /* allocation of the error object could mark the budget as exceeded once more */
+  mem_heap_clear_budget_exceeded ();
+
+  return completion;
+} /* vm_raise_memory_budget_error */
+
+/**
+ * Request interruption of the current run in the specified context
+ *
+ * Note:
+ *      the function is async-signal-safe, so it can be called from a signal handler (for example, of SIGALRM);
+ *      runs in other contexts are not affected by the request.
+ */
+void
+vm_request_interrupt (jerry_ctx_t *ctx_p) /**< context to interrupt */
+{
+  ctx_p->vm_is_interrupt_requested = 1;
+} /* vm_request_interrupt */
+
+/**
+ * Start counting of interrupt checks against execution budget of a run,
+ * dropping interruption requests, that were received before the run
+ */
+void
+vm_start_execution_budget (uint32_t budget) /**< maximum number of interrupt checks during the run,
+                                             *   or 0 - if the number is not limited */
+{
+  JERRY_CONTEXT (vm_is_interrupt_requested) = 0;
+
+  JERRY_CONTEXT (vm_execution_budget_left) = budget;
+  JERRY_CONTEXT (vm_is_interrupted) = false;
+} /* vm_start_execution_budget */
+
+/**
+ * Stop counting of interrupt checks, started with vm_start_execution_budget
+ *
+ * @return true - if the run was interrupted,
+ *         false - otherwise.
+ */
+bool
+vm_stop_execution_budget (void)
+{
+  bool is_interrupted = JERRY_CONTEXT (vm_is_interrupted);
+
+  JERRY_CONTEXT (vm_is_interrupt_requested) = 0;
+
+  JERRY_CONTEXT (vm_execution_budget_left) = 0;
+  JERRY_CONTEXT (vm_is_interrupted) = false;
+
+  return is_interrupted;
+} /* vm_stop_execution_budget */
+
+/**
+ * Raise error, interrupting the current run
+ *
+ * @return throw completion value
+ */
+static ecma_completion_value_t __attr_noinline___
+vm_raise_interrupt_error (void)
+{
+  JERRY_CONTEXT (vm_is_interrupted) = true;
+
+  /* the request is kept, so each subsequent check raises the error again, even if the script catches it */
+  JERRY_CONTEXT (vm_is_interrupt_requested) = 1;
+
+  return ecma_raise_common_error ("Execution interrupted");
+} /* vm_raise_interrupt_error */
+
+/**
+ * Check whether the current run should be interrupted
+ *
+ * Note:
+ *      the check is performed upon backward jumps and upon entry to each function's code, so that any loop
+ *      or recursion passes through it (recursion, deeper than CONFIG_VM_MAX_CALL_DEPTH, is stopped
+ *      with RangeError, regardless of the budget).
+ *
+ * @return empty completion value - if the execution can be continued,
+ *         throw completion value - if the run is interrupted (upon request, or upon exhaustion of its budget).
+ */
+ecma_completion_value_t
+vm_check_interrupt (void)
+{
+  if (likely (!JERRY_CONTEXT (vm_is_interrupt_requested))
+      && (JERRY_CONTEXT (vm_execution_budget_left) == 0
+          || --JERRY_CONTEXT (vm_execution_budget_left) != 0))
+  {
+    return ecma_make_empty_completion_value ();
+  }
+
+  return vm_raise_interrupt_error ();
+} /* vm_check_interrupt */
+
 /**
  * Run interpreter loop using specified context
  *
@@ -444,6 +542,10 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
   memset (&pools_stats_before, 0, sizeof (pools_stats_before));
 #endif /* MEM_STATS */
 
+#ifdef VM_OPCODE_PROFILER
+  idx_t profiler_prev_op_idx = LAST_OP;
+#endif /* VM_OPCODE_PROFILER */
+
   while (true)
   {
     do
@@ -454,6 +556,13 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
 
       const opcode_t *curr = &int_data_p->opcodes_p[int_data_p->pos];
 
+#ifdef JERRY_ENABLE_SAMPLING_PROFILER
+      if (unlikely (JERRY_CONTEXT (vm_sampling_profiler).is_sample_requested))
+      {
+        vm_sampling_profiler_take_sample ();
+      }
+#endif /* JERRY_ENABLE_SAMPLING_PROFILER */
+
 #ifdef MEM_STATS
       const opcode_counter_t opcode_pos = int_data_p->pos;
 
@@ -463,12 +572,30 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
                                      &pools_stats_before);
 #endif /* MEM_STATS */
 
+#ifdef VM_OPCODE_PROFILER
+      const opcode_counter_t profiler_pos = int_data_p->pos;
+      vm_profiler_sample_t profiler_sample;
+
+      vm_profiler_opcode_enter (&profiler_sample, profiler_prev_op_idx, curr->op_idx);
+      profiler_prev_op_idx = curr->op_idx;
+#endif /* VM_OPCODE_PROFILER */
+
       completion = __opfuncs[curr->op_idx] (*curr, int_data_p);
 
+#ifdef VM_OPCODE_PROFILER
+      vm_profiler_opcode_exit (&profiler_sample, int_data_p, profiler_pos);
+#endif /* VM_OPCODE_PROFILER */
+
 #ifdef CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE
-      ecma_gc_run ();
+      ecma_gc_run (ECMA_GC_CAUSE_EACH_OPCODE);
 #endif /* CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE */
 
+      if (unlikely (JERRY_CONTEXT (mem_heap).is_budget_exceeded)
+          && ecma_is_completion_value_normal (completion))
+      {
+        completion = vm_raise_memory_budget_error ();
+      }
+
 #ifdef MEM_STATS
       interp_mem_stats_opcode_exit (int_data_p,
                                     opcode_pos,
@@ -525,8 +652,8 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   const opcode_t *curr = &opcodes_p[start_pos];
   JERRY_ASSERT (curr->op_idx == __op__idx_reg_var_decl);
 
-  const idx_t min_reg_num = curr->data.reg_var_decl.min;
-  const idx_t max_reg_num = curr->data.reg_var_decl.max;
+  const wide_idx_t min_reg_num = curr->data.reg_var_decl.min;
+  const wide_idx_t max_reg_num = vm_get_wide_operand_value (curr->data.reg_var_decl.max, opcodes_p, start_pos);
   JERRY_ASSERT (max_reg_num >= min_reg_num);
 
   const int32_t regs_num = max_reg_num - min_reg_num + 1;
@@ -536,6 +663,7 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   int_data_t int_data;
   int_data.opcodes_p = opcodes_p;
   int_data.pos = (opcode_counter_t) (start_pos + 1);
+  int_data.block_start_pos = start_pos;
   int_data.this_binding = this_binding_value;
   int_data.lex_env_p = lex_env_p;
   int_data.is_strict = is_strict;
@@ -546,19 +674,24 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   int_data.tmp_num_p = ecma_alloc_number ();
   ecma_stack_add_frame (&int_data.stack_frame, regs, regs_num);
 
-  int_data_t *prev_context_p = vm_top_context_p;
-  vm_top_context_p = &int_data;
+  int_data.prev_context_p = JERRY_CONTEXT (vm_top_context_p);
+  JERRY_CONTEXT (vm_top_context_p) = &int_data;
 
 #ifdef MEM_STATS
   interp_mem_stats_context_enter (&int_data, start_pos);
 #endif /* MEM_STATS */
 
-  completion = vm_loop (&int_data, NULL);
+  completion = vm_check_interrupt ();
+
+  if (ecma_is_completion_value_empty (completion))
+  {
+    completion = vm_loop (&int_data, NULL);
+  }
 
   JERRY_ASSERT (ecma_is_completion_value_throw (completion)
                 || ecma_is_completion_value_return (completion));
 
-  vm_top_context_p = prev_context_p;
+  JERRY_CONTEXT (vm_top_context_p) = int_data.prev_context_p;
 
   ecma_stack_free_frame (&int_data.stack_frame);
 
@@ -598,6 +731,144 @@ vm_get_scope_flags (const opcode_t *opcodes_p, /**< byte-code array */
   return (opcode_scope_code_flags_t) flags_opcode.data.meta.data_1;
 } /* vm_get_scope_flags */
 
+/**
+ * Check whether specified opcode is a stub of function's body, that is compiled upon first call of the function
+ *
+ * See also:
+ *          dump_lazy_function_stub
+ *
+ * @return true - if the opcode is the stub (in the case, index of the function's descriptor is returned
+ *                through out_lazy_function_idx_p),
+ *         false - otherwise.
+ */
+bool
+vm_is_lazy_function_stub (const opcode_t *opcodes_p, /**< byte-code array */
+                          opcode_counter_t counter, /**< opcode counter */
+                          uint32_t *out_lazy_function_idx_p) /**< out: index of the function's descriptor */
+{
+  opcode_t opcode = vm_get_opcode (opcodes_p, counter);
+
+  if (likely (opcode.op_idx != __op__idx_meta
+              || opcode.data.meta.type != OPCODE_META_TYPE_LAZY_FUNCTION))
+  {
+    return false;
+  }
+
+  *out_lazy_function_idx_p = vm_calc_opcode_counter (opcode.data.meta.data_1,
+                                                     opcode.data.meta.data_2,
+                                                     opcodes_p,
+                                                     counter);
+
+  return true;
+} /* vm_is_lazy_function_stub */
+
+/**
+ * Get contents of a literal with a function's name
+ *
+ * @return zero-terminated string
+ */
+static const char *
+vm_get_function_name_literal_string (lit_cpointer_t lit_cp, /**< literal */
+                                     lit_utf8_byte_t *buffer_p, /**< buffer for the name */
+                                     size_t buffer_size) /**< size of the buffer */
+{
+  memset (buffer_p, 0, buffer_size);
+
+  return (const char *) lit_literal_to_utf8_string (lit_get_literal_by_cp (lit_cp), buffer_p, buffer_size - 1);
+} /* vm_get_function_name_literal_string */
+
+/**
+ * Get name of the function, executed in an interpreter context (for diagnostic output of profilers)
+ *
+ * Note:
+ *      names of global code, eval code and anonymous functions are "(global)", "(eval)" and "(anonymous)";
+ *      names, longer than the buffer, are truncated
+ *
+ * @return zero-terminated string
+ */
+const char *
+vm_get_function_name (const int_data_t *int_data_p, /**< interpreter context */
+                      lit_utf8_byte_t *buffer_p, /**< buffer for the name */
+                      size_t buffer_size) /**< size of the buffer */
+{
+  const opcode_t *opcodes_p = int_data_p->opcodes_p;
+  const opcode_counter_t block_start_pos = int_data_p->block_start_pos;
+
+  if (int_data_p->is_eval_code)
+  {
+    return "(eval)";
+  }
+
+  /*
+   * Code of a function, declared in the byte-code, is preceded with the function's header:
+   *  func_decl_n / func_expr_n, arguments' 'meta' instructions, function end 'meta' and scope code flags 'meta'
+   */
+  if (block_start_pos >= 3
+      && opcodes_p[block_start_pos - 1].op_idx == __op__idx_meta
+      && opcodes_p[block_start_pos - 2].op_idx == __op__idx_meta
+      && opcodes_p[block_start_pos - 2].data.meta.type == OPCODE_META_TYPE_FUNCTION_END)
+  {
+    opcode_counter_t header_pos = (opcode_counter_t) (block_start_pos - 3);
+
+    while (header_pos > 0
+           && opcodes_p[header_pos].op_idx == __op__idx_meta
+           && opcodes_p[header_pos].data.meta.type == OPCODE_META_TYPE_VARG)
+    {
+      header_pos--;
+    }
+
+    const opcode_t header = opcodes_p[header_pos];
+    idx_t name_lit_idx = INVALID_VALUE;
+
+    if (header.op_idx == __op__idx_func_decl_n)
+    {
+      name_lit_idx = header.data.func_decl_n.name_lit_idx;
+    }
+    else if (header.op_idx == __op__idx_func_expr_n)
+    {
+      name_lit_idx = header.data.func_expr_n.name_lit_idx;
+
+      if (name_lit_idx == INVALID_VALUE)
+      {
+        return "(anonymous)";
+      }
+    }
+
+    if (name_lit_idx != INVALID_VALUE)
+    {
+      lit_cpointer_t name_lit_cp = serializer_get_literal_cp_by_uid (name_lit_idx, opcodes_p, header_pos);
+
+      return vm_get_function_name_literal_string (name_lit_cp, buffer_p, buffer_size);
+    }
+  }
+
+  if (opcodes_p == JERRY_CONTEXT (vm_program_p))
+  {
+    return "(global)";
+  }
+
+  /* body of a lazily compiled function (see also: JERRY_FLAG_LAZY_FUNCTIONS) */
+  for (uint32_t lazy_function_idx = 0;
+       lazy_function_idx < JERRY_CONTEXT (bytecode_data).lazy_functions_number;
+       lazy_function_idx++)
+  {
+    const lazy_function_t *lazy_function_p = serializer_get_lazy_function (lazy_function_idx);
+
+    if (lazy_function_p->opcodes_p == opcodes_p)
+    {
+      if (lazy_function_p->name_lit_cp.packed_value == NOT_A_LITERAL.packed_value)
+      {
+        return "(anonymous)";
+      }
+
+      return vm_get_function_name_literal_string (lazy_function_p->name_lit_cp, buffer_p, buffer_size);
+    }
+  }
+
+  /* body of a function, created through Function constructor */
+  return "(anonymous)";
+} /* vm_get_function_name */
+
 /**
  * Check whether currently executed code is strict mode code
  *
@@ -607,9 +878,9 @@ vm_get_scope_flags (const opcode_t *opcodes_p, /**< byte-code array */
 bool
 vm_is_strict_mode (void)
 {
-  JERRY_ASSERT (vm_top_context_p != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) != NULL);
 
-  return vm_top_context_p->is_strict;
+  return JERRY_CONTEXT (vm_top_context_p)->is_strict;
 } /* vm_is_strict_mode */
 
 /**
@@ -627,9 +898,9 @@ vm_is_strict_mode (void)
 bool
 vm_is_direct_eval_form_call (void)
 {
-  if (vm_top_context_p != NULL)
+  if (JERRY_CONTEXT (vm_top_context_p) != NULL)
   {
-    return vm_top_context_p->is_call_in_direct_eval_form;
+    return JERRY_CONTEXT (vm_top_context_p)->is_call_in_direct_eval_form;
   }
   else
   {
@@ -649,9 +920,9 @@ vm_is_direct_eval_form_call (void)
 ecma_value_t
 vm_get_this_binding (void)
 {
-  JERRY_ASSERT (vm_top_context_p != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) != NULL);
 
-  return ecma_copy_value (vm_top_context_p->this_binding, true);
+  return ecma_copy_value (JERRY_CONTEXT (vm_top_context_p)->this_binding, true);
 } /* vm_get_this_binding */
 
 /**
@@ -662,9 +933,9 @@ vm_get_this_binding (void)
 ecma_object_t*
 vm_get_lex_env (void)
 {
-  JERRY_ASSERT (vm_top_context_p != NULL);
+  JERRY_ASSERT (JERRY_CONTEXT (vm_top_context_p) != NULL);
 
-  ecma_ref_object (vm_top_context_p->lex_env_p);
+  ecma_ref_object (JERRY_CONTEXT (vm_top_context_p)->lex_env_p);
 
-  return vm_top_context_p->lex_env_p;
+  return JERRY_CONTEXT (vm_top_context_p)->lex_env_p;
 } /* vm_get_lex_env */
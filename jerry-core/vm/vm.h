@@ -31,8 +31,15 @@ extern ecma_completion_value_t vm_run_from_pos (const opcode_t *opcodes_p,
                                                 bool is_strict,
                                                 bool is_eval_code);
 
+extern void vm_request_interrupt (jerry_ctx_t *);
+extern void vm_start_execution_budget (uint32_t budget);
+extern bool vm_stop_execution_budget (void);
+extern ecma_completion_value_t vm_check_interrupt (void);
+
 extern opcode_t vm_get_opcode (const opcode_t*, opcode_counter_t counter);
 extern opcode_scope_code_flags_t vm_get_scope_flags (const opcode_t*, opcode_counter_t counter);
+extern bool vm_is_lazy_function_stub (const opcode_t *, opcode_counter_t, uint32_t *);
+extern const char *vm_get_function_name (const int_data_t *, lit_utf8_byte_t *, size_t);
 
 extern bool vm_is_strict_mode (void);
 extern bool vm_is_direct_eval_form_call (void);
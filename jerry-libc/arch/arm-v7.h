@@ -80,6 +80,41 @@
   \
   pop {r4-r12, pc};
 
+/*
+ * mov syscall_no (%r0) -> %r7
+ * mov arg1 (%r1) -> %r0
+ * mov arg2 (%r2) -> %r1
+ * mov arg3 (%r3) -> %r2
+ * ldr arg4 ([sp + 0x28]) -> %r3
+ * ldr arg5 ([sp + 0x2c]) -> %r4
+ * ldr arg6 ([sp + 0x30]) -> %r5
+ * svc #0
+ */
+#define SYSCALL_6 \
+  push {r4-r12, lr}; \
+  \
+  mov r7, r0; \
+  mov r0, r1; \
+  mov r1, r2; \
+  mov r2, r3; \
+  ldr r3, [sp, #40]; \
+  ldr r4, [sp, #44]; \
+  ldr r5, [sp, #48]; \
+  \
+  svc #0; \
+  \
+  pop {r4-r12, pc};
+
+/*
+ * Return from signal handler (restorer of signal handlers, set through rt_sigaction with SA_SIGINFO)
+ *
+ * mov __NR_rt_sigreturn (173) -> r7
+ * svc #0
+ */
+#define _SIGRETURN \
+  mov r7, #173; \
+  svc #0;
+
 /*
  * ldr argc ([sp + 0x0]) -> r0
  * add argv (sp + 0x4) -> r1
@@ -64,6 +64,37 @@
   syscall; \
   ret;
 
+/*
+ * mov syscall_no (%rdi) -> %rax
+ * mov arg1 (%rsi) -> %rdi
+ * mov arg2 (%rdx) -> %rsi
+ * mov arg3 (%rcx) -> %rdx
+ * mov arg4 (%r8) -> %r10
+ * mov arg5 (%r9) -> %r8
+ * mov arg6 ([%rsp + 0x8]) -> %r9
+ * syscall
+ */
+#define SYSCALL_6 \
+  mov %rdi, %rax; \
+  mov %rsi, %rdi; \
+  mov %rdx, %rsi; \
+  mov %rcx, %rdx; \
+  mov %r8, %r10; \
+  mov %r9, %r8; \
+  mov 0x8 (%rsp), %r9; \
+  syscall; \
+  ret;
+
+/*
+ * Return from signal handler (restorer of signal handlers, set through rt_sigaction)
+ *
+ * mov __NR_rt_sigreturn (15) -> %rax
+ * syscall
+ */
+#define _SIGRETURN \
+  mov $15, %rax; \
+  syscall;
+
 /*
  * mov argc ([%rsp]) -> %rdi
  * mov argv (%rsp + 0x8) -> %rsi
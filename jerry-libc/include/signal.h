@@ -0,0 +1,52 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SIGNAL_H
+#define JERRY_LIBC_SIGNAL_H
+
+#ifdef __cplusplus
+# define EXTERN_C "C"
+#else /* !__cplusplus */
+# define EXTERN_C
+#endif /* !__cplusplus */
+
+/**
+ * Signal numbers
+ */
+#define SIGABRT (6)
+#define SIGALRM (14)
+#define SIGPROF (27)
+
+/**
+ * Integer type, that can be accessed atomically, even in presence of asynchronous interrupts by signals
+ */
+typedef int sig_atomic_t;
+
+/**
+ * Signal handler
+ */
+typedef void (*sighandler_t) (int);
+
+/**
+ * Special values of signal handler
+ */
+#define SIG_DFL ((sighandler_t) 0)
+#define SIG_IGN ((sighandler_t) 1)
+#define SIG_ERR ((sighandler_t) -1)
+
+extern EXTERN_C sighandler_t signal (int, sighandler_t);
+extern EXTERN_C int raise (int);
+
+#endif /* !JERRY_LIBC_SIGNAL_H */
@@ -55,6 +55,7 @@ extern EXTERN_C size_t fread (void *ptr, size_t size, size_t nmemb, FILE *stream
 extern EXTERN_C size_t fwrite (const void *ptr, size_t size, size_t nmemb, FILE *stream);
 extern EXTERN_C int fseek (FILE *stream, long offset, int whence);
 extern EXTERN_C long ftell (FILE *stream);
+extern EXTERN_C int fileno (FILE *stream);
 extern EXTERN_C int printf (const char *format, ...);
 extern EXTERN_C void rewind (FILE *stream);
 extern EXTERN_C int fprintf (FILE *stream, const char *format, ...);
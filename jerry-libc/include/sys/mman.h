@@ -0,0 +1,50 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SYS_MMAN_H
+#define JERRY_LIBC_SYS_MMAN_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+# define EXTERN_C "C"
+#else /* !__cplusplus */
+# define EXTERN_C
+#endif /* !__cplusplus */
+
+/**
+ * Memory protection flags
+ */
+#define PROT_NONE  (0x0)
+#define PROT_READ  (0x1)
+#define PROT_WRITE (0x2)
+
+/**
+ * Mapping flags
+ */
+#define MAP_SHARED    (0x01)
+#define MAP_PRIVATE   (0x02)
+#define MAP_ANONYMOUS (0x20)
+#define MAP_NORESERVE (0x4000)
+
+/**
+ * Return value of mmap in case of failure
+ */
+#define MAP_FAILED ((void *) -1)
+
+extern EXTERN_C void *mmap (void *addr, size_t length, int prot, int flags, int fd, long offset);
+extern EXTERN_C int munmap (void *addr, size_t length);
+
+#endif /* !JERRY_LIBC_SYS_MMAN_H */
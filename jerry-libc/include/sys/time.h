@@ -0,0 +1,60 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JERRY_LIBC_SYS_TIME_H
+#define JERRY_LIBC_SYS_TIME_H
+
+#ifdef __cplusplus
+# define EXTERN_C "C"
+#else /* !__cplusplus */
+# define EXTERN_C
+#endif /* !__cplusplus */
+
+#ifndef __timeval_defined
+#define __timeval_defined 1
+
+/**
+ * Time interval
+ *
+ * Note:
+ *      the guard macro is the same, as the one of system headers, so the structure is not redefined
+ *      if system headers, defining it, are included with the header (for example, sys/types.h)
+ */
+struct timeval
+{
+  long tv_sec; /**< seconds */
+  long tv_usec; /**< microseconds */
+};
+#endif /* !__timeval_defined */
+
+/**
+ * Value of an interval timer
+ */
+struct itimerval
+{
+  struct timeval it_interval; /**< period of the timer (zero - the timer fires only once) */
+  struct timeval it_value; /**< time till next expiration of the timer (zero - the timer is disarmed) */
+};
+
+/**
+ * Interval timers
+ */
+#define ITIMER_REAL    (0) /**< real time, SIGALRM is delivered upon expiration */
+#define ITIMER_VIRTUAL (1) /**< user time of the process, SIGVTALRM is delivered upon expiration */
+#define ITIMER_PROF    (2) /**< user and system time of the process, SIGPROF is delivered upon expiration */
+
+extern EXTERN_C int setitimer (int, const struct itimerval *, struct itimerval *);
+
+#endif /* !JERRY_LIBC_SYS_TIME_H */
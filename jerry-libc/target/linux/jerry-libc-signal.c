@@ -0,0 +1,108 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Jerry libc signals and interval timers linux implementation
+ *
+ * Note:
+ *      the routines are implemented in a separate unit, as interface of struct timeval,
+ *      provided by jerry-libc, differs from the system one, used in jerry-libc-target.c
+ */
+
+#include <signal.h>
+#include <string.h>
+#include <syscall.h>
+#include <sys/time.h>
+
+#include "jerry-libc-defs.h"
+
+extern long int syscall_3_asm (long int syscall_no, long int arg1, long int arg2, long int arg3);
+extern long int syscall_6_asm (long int syscall_no, long int arg1, long int arg2, long int arg3,
+                               long int arg4, long int arg5, long int arg6);
+extern void syscall_sigreturn_asm (void);
+
+/**
+ * Flags of signal action
+ */
+#define LIBC_SA_SIGINFO  (0x00000004ul) /**< handler is invoked with siginfo and context arguments
+                                         *   (the arguments are ignored by handlers, registered through signal,
+                                         *    but the flag makes the kernel to set up rt signal frame
+                                         *    on all supported architectures, see also: _SIGRETURN) */
+#define LIBC_SA_RESTORER (0x04000000ul) /**< sa_restorer field is set */
+#define LIBC_SA_RESTART  (0x10000000ul) /**< system calls, interrupted by the signal, are restarted */
+
+/**
+ * Signal action, as it is passed to rt_sigaction system call
+ */
+typedef struct
+{
+  sighandler_t handler; /**< signal handler */
+  unsigned long flags; /**< flags (LIBC_SA_*) */
+  void (*restorer) (void); /**< routine, invoked upon return from the handler */
+  uint32_t mask[2]; /**< signals, blocked during execution of the handler */
+} libc_kernel_sigaction_t;
+
+/**
+ * signal
+ *
+ * Note:
+ *      the handler remains installed after delivery of the signal,
+ *      and system calls, interrupted by the signal, are restarted (BSD semantics).
+ *
+ * @return previous handler of the signal - upon successful completion,
+ *         SIG_ERR - otherwise.
+ */
+sighandler_t
+signal (int signum, /**< signal number */
+        sighandler_t handler) /**< new handler (or SIG_DFL / SIG_IGN) */
+{
+  libc_kernel_sigaction_t action, old_action;
+
+  memset (&action, 0, sizeof (action));
+  action.handler = handler;
+  action.flags = LIBC_SA_SIGINFO | LIBC_SA_RESTORER | LIBC_SA_RESTART;
+  action.restorer = syscall_sigreturn_asm;
+
+  long int ret = syscall_6_asm (__NR_rt_sigaction,
+                                signum,
+                                (long int) &action,
+                                (long int) &old_action,
+                                (long int) sizeof (action.mask),
+                                0,
+                                0);
+
+  if (ret < 0)
+  {
+    return SIG_ERR;
+  }
+
+  return old_action.handler;
+} /* signal */
+
+/**
+ * setitimer
+ *
+ * @return 0 - upon successful completion,
+ *         -1 - otherwise.
+ */
+int
+setitimer (int which, /**< timer (ITIMER_REAL, ITIMER_VIRTUAL or ITIMER_PROF) */
+           const struct itimerval *new_value_p, /**< new value of the timer */
+           struct itimerval *old_value_p) /**< out: previous value of the timer (or NULL) */
+{
+  long int ret = syscall_3_asm (__NR_setitimer, which, (long int) new_value_p, (long int) old_value_p);
+
+  return (ret < 0) ? -1 : 0;
+} /* setitimer */
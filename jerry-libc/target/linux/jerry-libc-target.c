@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <syscall.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -51,6 +52,8 @@ extern long int syscall_0_asm (long int syscall_no);
 extern long int syscall_1_asm (long int syscall_no, long int arg1);
 extern long int syscall_2_asm (long int syscall_no, long int arg1, long int arg2);
 extern long int syscall_3_asm (long int syscall_no, long int arg1, long int arg2, long int arg3);
+extern long int syscall_6_asm (long int syscall_no, long int arg1, long int arg2, long int arg3,
+                               long int arg4, long int arg5, long int arg6);
 
 /**
  * System call with no argument.
@@ -265,7 +268,13 @@ fopen (const char *path, /**< file path */
     flags |= O_APPEND;
   }
 
-  long int ret = syscall_3 (__NR_open, (long int) path, flags, access);
+  /* failure to open the file is reported to the caller, instead of exit with ERR_SYSCALL */
+  long int ret = syscall_3_asm (__NR_open, (long int) path, flags, access);
+
+  if (ret < 0)
+  {
+    return NULL;
+  }
 
   return (void*) (uintptr_t) (ret);
 } /* fopen */
@@ -319,6 +328,17 @@ ftell (FILE * fp) /**< stream pointer */
   return ret;
 } /* ftell */
 
+/**
+ * fileno
+ *
+ * @return file descriptor of the stream
+ */
+int
+fileno (FILE *stream) /**< stream pointer */
+{
+  return (int) (long int) stream;
+} /* fileno */
+
 /**
  * fread
  *
@@ -384,6 +404,64 @@ fwrite (const void *ptr, /**< data to write */
   return bytes_written / size;
 } /* fwrite */
 
+/**
+ * mmap
+ *
+ * Note:
+ *      the syscall's return value is checked manually instead of LIBC_EXIT_ON_ERROR,
+ *      as valid addresses above 2GB look negative on 32-bit hosts.
+ *
+ * @return address of the mapping - upon successful completion,
+ *         MAP_FAILED - otherwise.
+ */
+void *
+mmap (void *addr, /**< desired address of the mapping (or NULL) */
+      size_t length, /**< length of the mapping */
+      int prot, /**< memory protection of the mapping (PROT_*) */
+      int flags, /**< mapping flags (MAP_*) */
+      int fd, /**< file descriptor (-1 for anonymous mappings) */
+      long offset) /**< offset in the file, should be multiple of page size */
+{
+#ifdef __NR_mmap2
+  long int ret = syscall_6_asm (__NR_mmap2,
+                                (long int) addr,
+                                (long int) length,
+                                prot,
+                                flags,
+                                fd,
+                                offset / 4096);
+#else /* !__NR_mmap2 */
+  long int ret = syscall_6_asm (__NR_mmap,
+                                (long int) addr,
+                                (long int) length,
+                                prot,
+                                flags,
+                                fd,
+                                offset);
+#endif /* !__NR_mmap2 */
+
+  if ((unsigned long int) ret > (unsigned long int) -4096l)
+  {
+    return MAP_FAILED;
+  }
+
+  return (void *) (uintptr_t) ret;
+} /* mmap */
+
+/**
+ * munmap
+ *
+ * @return 0
+ */
+int
+munmap (void *addr, /**< address of the mapping */
+        size_t length) /**< length of the mapping */
+{
+  syscall_2 (__NR_munmap, (long int) addr, (long int) length);
+
+  return 0;
+} /* munmap */
+
 // FIXME
 #if 0
 /**
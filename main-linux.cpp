@@ -13,9 +13,12 @@
  * limitations under the License.
  */
 
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
 
 #include "jerry.h"
 #include "jrt/jrt.h"
@@ -26,9 +29,19 @@
 #define JERRY_MAX_COMMAND_LINE_ARGS (64)
 
 /**
- * Maximum size of source code buffer
+ * Size of address space area, reserved for source code of scripts
+ *
+ * Note:
+ *      the area's pages are allocated only upon reading of source code to them,
+ *      and if the size can't be reserved, the reservation is retried with lesser sizes
+ *      (see also: reserve_source_area)
+ */
+#define JERRY_SOURCE_AREA_SIZE ((size_t) 1024 * 1024 * 1024)
+
+/**
+ * Size of source code's part, read at once
  */
-#define JERRY_SOURCE_BUFFER_SIZE (1048576)
+#define JERRY_SOURCE_READ_PART_SIZE (64 * 1024)
 
 /**
  * Standalone Jerry exit codes
@@ -36,76 +49,208 @@
 #define JERRY_STANDALONE_EXIT_CODE_OK   (0)
 #define JERRY_STANDALONE_EXIT_CODE_FAIL (1)
 
-static uint8_t source_buffer[ JERRY_SOURCE_BUFFER_SIZE ];
+/**
+ * Maximum size of snapshot buffer
+ */
+#define JERRY_SNAPSHOT_BUFFER_SIZE (1048576)
+
+/**
+ * Interval of the profiling timer, that requests samples of the sampling profiler (in microseconds)
+ */
+#define JERRY_SAMPLING_PROFILER_INTERVAL_US (1000)
+
+/**
+ * Maximum time limit of the scripts' run (--time-limit), in milliseconds
+ */
+#define JERRY_MAX_TIME_LIMIT_MS (3600000)
+
+/**
+ * Number of allocation sites, listed in the allocation profile upon completion of the scripts (--alloc-profile)
+ */
+#define JERRY_ALLOC_PROFILE_SITES_NUMBER (20)
 
-static const jerry_api_char_t *
-read_sources (const char *script_file_names[],
-              int files_count,
-              size_t *out_source_size_p)
+/**
+ * State of reading of the scripts' source code
+ *
+ * Source code of the scripts is concatenated in the reserved area, and is read part by part,
+ * while the parser consumes it (see also: read_source_part).
+ */
+typedef struct
 {
-  int i;
-  uint8_t *source_buffer_tail = source_buffer;
+  const char **file_names_p; /**< names of the scripts' files */
+  int files_count; /**< number of the scripts */
+  int file_index; /**< index of the script, which is being read */
+  FILE *file_p; /**< the script's file (NULL - if the script is not opened yet) */
+  uint8_t *area_p; /**< area for the source code */
+  size_t area_size; /**< size of the area */
+  size_t source_size; /**< size of the source code, read so far */
+  bool is_failed; /**< flag, indicating that a script could not be read */
+} source_reader_state_t;
+
+static source_reader_state_t source_reader;
 
-  for (i = 0; i < files_count; i++)
+/**
+ * Reserve address space area for source code of the scripts
+ *
+ * @return true - if an area was reserved,
+ *         false - otherwise.
+ */
+static bool
+reserve_source_area (const char *script_file_names[], /**< names of the scripts' files */
+                     int files_count) /**< number of the scripts */
+{
+  for (size_t area_size = JERRY_SOURCE_AREA_SIZE; area_size >= JERRY_SOURCE_READ_PART_SIZE; area_size /= 2)
   {
-    const char *script_file_name = script_file_names[i];
+    void *area_p = mmap (NULL,
+                         area_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                         -1,
+                         0);
+
+    if (area_p != MAP_FAILED)
+    {
+      source_reader.file_names_p = script_file_names;
+      source_reader.files_count = files_count;
+      source_reader.file_index = 0;
+      source_reader.file_p = NULL;
+      source_reader.area_p = (uint8_t *) area_p;
+      source_reader.area_size = area_size;
+      source_reader.source_size = 0;
+      source_reader.is_failed = false;
+
+      return true;
+    }
+  }
 
-    FILE *file = fopen (script_file_name, "r");
+  JERRY_ERROR_MSG ("Failed to allocate memory for source code\n");
+
+  return false;
+} /* reserve_source_area */
+
+/**
+ * Read next part of source code of the scripts (see also: jerry_source_reader_t)
+ *
+ * @return size of the source code, read so far
+ */
+static size_t
+read_source_part (void *user_p) /**< unused */
+{
+  (void) user_p;
 
-    if (file == NULL)
+  while (source_reader.file_index < source_reader.files_count)
+  {
+    if (source_reader.file_p == NULL)
     {
-      break;
+      source_reader.file_p = fopen (source_reader.file_names_p[source_reader.file_index], "r");
+
+      if (source_reader.file_p == NULL)
+      {
+        break;
+      }
     }
 
-    int fseek_status = fseek (file, 0, SEEK_END);
+    /* one byte of the area is kept free, so the area's overflow can be distinguished from end of file */
+    size_t free_size = source_reader.area_size - source_reader.source_size - 1;
+    size_t part_size = (free_size < JERRY_SOURCE_READ_PART_SIZE) ? free_size : JERRY_SOURCE_READ_PART_SIZE;
 
-    if (fseek_status != 0)
+    if (part_size == 0)
     {
       break;
     }
 
-    long script_len = ftell (file);
+    size_t bytes_read = fread (source_reader.area_p + source_reader.source_size, 1, part_size, source_reader.file_p);
 
-    if (script_len < 0)
+    if (bytes_read != 0)
     {
-      break;
+      source_reader.source_size += bytes_read;
+
+      return source_reader.source_size;
     }
 
-    rewind (file);
+    fclose (source_reader.file_p);
+    source_reader.file_p = NULL;
+    source_reader.file_index++;
+  }
 
-    const size_t current_source_size = (size_t)script_len;
+  if (source_reader.file_index < source_reader.files_count)
+  {
+    JERRY_ERROR_MSG ("Failed to read script N%d\n", source_reader.file_index + 1);
 
-    if (source_buffer_tail + current_source_size >= source_buffer + sizeof (source_buffer))
+    if (source_reader.file_p != NULL)
     {
-      break;
+      fclose (source_reader.file_p);
+      source_reader.file_p = NULL;
     }
 
-    size_t bytes_read = fread (source_buffer_tail, 1, current_source_size, file);
-    if (bytes_read < current_source_size)
-    {
-      break;
-    }
+    source_reader.file_index = source_reader.files_count;
+    source_reader.is_failed = true;
+  }
 
-    fclose (file);
+  return source_reader.source_size;
+} /* read_source_part */
 
-    source_buffer_tail += current_source_size;
+/**
+ * Release the area, reserved for source code of the scripts
+ */
+static void
+release_source_area (void)
+{
+  if (source_reader.file_p != NULL)
+  {
+    fclose (source_reader.file_p);
+    source_reader.file_p = NULL;
   }
 
-  if (i < files_count)
-  {
-    JERRY_ERROR_MSG ("Failed to read script N%d\n", i + 1);
+  munmap (source_reader.area_p, source_reader.area_size);
+  source_reader.area_p = NULL;
+} /* release_source_area */
 
+/**
+ * Map the snapshot file to memory (read-only), so that the snapshot can be executed in place
+ *
+ * Note:
+ *      the mapping's pages are shared between all processes, running the snapshot.
+ *
+ * @return pointer to the mapping - upon successful completion,
+ *         NULL - otherwise.
+ */
+static const void *
+map_snapshot_file (const char *file_name_p, /**< snapshot file name */
+                   size_t *out_snapshot_size_p) /**< out: size of the snapshot */
+{
+  FILE *file = fopen (file_name_p, "r");
+
+  if (file == NULL)
+  {
     return NULL;
   }
-  else
+
+  void *snapshot_p = MAP_FAILED;
+
+  long snapshot_len = -1;
+
+  if (fseek (file, 0, SEEK_END) == 0)
+  {
+    snapshot_len = ftell (file);
+  }
+
+  if (snapshot_len > 0)
   {
-    const size_t source_size = (size_t) (source_buffer_tail - source_buffer);
+    snapshot_p = mmap (NULL, (size_t) snapshot_len, PROT_READ, MAP_PRIVATE, fileno (file), 0);
+  }
 
-    *out_source_size_p = source_size;
+  fclose (file);
 
-    return (const jerry_api_char_t *) source_buffer;
+  if (snapshot_p == MAP_FAILED)
+  {
+    return NULL;
   }
-}
+
+  *out_snapshot_size_p = (size_t) snapshot_len;
+
+  return snapshot_p;
+} /* map_snapshot_file */
 
 /**
  * Provide the 'assert' implementation for the engine.
@@ -130,6 +275,102 @@ assert_handler (const jerry_api_object_t *function_obj_p __attr_unused___, /** <
   return true;
 } /* assert_handler */
 
+/**
+ * Context, sampled by the sampling profiler
+ */
+static jerry_ctx_t *sampling_profiler_ctx_p = NULL;
+
+/**
+ * Handler of the profiling timer's signal (SIGPROF)
+ */
+static void
+sampling_profiler_signal_handler (int signal_number __attr_unused___) /**< signal number */
+{
+  jerry_sampling_profiler_request_sample (sampling_profiler_ctx_p);
+} /* sampling_profiler_signal_handler */
+
+/**
+ * Arm or disarm the profiling timer
+ *
+ * @return true - if the timer was set successfully,
+ *         false - otherwise.
+ */
+static bool
+set_sampling_profiler_timer (bool is_armed) /**< should the timer be armed */
+{
+  struct itimerval timer;
+  memset (&timer, 0, sizeof (timer));
+
+  if (is_armed)
+  {
+    timer.it_interval.tv_usec = JERRY_SAMPLING_PROFILER_INTERVAL_US;
+    timer.it_value.tv_usec = JERRY_SAMPLING_PROFILER_INTERVAL_US;
+  }
+
+  return (setitimer (ITIMER_PROF, &timer, NULL) == 0);
+} /* set_sampling_profiler_timer */
+
+/**
+ * Start sampling profiler, with samples requested by the profiling timer
+ *
+ * @return true - if the profiler was started successfully,
+ *         false - otherwise.
+ */
+static bool
+start_sampling_profiler (const char *output_file_name_p) /**< name of the profile's output file */
+{
+  sampling_profiler_ctx_p = jerry_get_active_ctx ();
+
+  return (jerry_sampling_profiler_start (output_file_name_p)
+          && signal (SIGPROF, sampling_profiler_signal_handler) != SIG_ERR
+          && set_sampling_profiler_timer (true));
+} /* start_sampling_profiler */
+
+/**
+ * Stop the profiling timer and sampling profiler
+ */
+static void
+stop_sampling_profiler (void)
+{
+  set_sampling_profiler_timer (false);
+  signal (SIGPROF, SIG_IGN);
+
+  jerry_sampling_profiler_stop ();
+} /* stop_sampling_profiler */
+
+/**
+ * Context, interrupted upon expiration of the time limit
+ */
+static jerry_ctx_t *time_limit_ctx_p = NULL;
+
+/**
+ * Handler of the time limit timer's signal (SIGALRM)
+ */
+static void
+time_limit_signal_handler (int signal_number __attr_unused___) /**< signal number */
+{
+  jerry_request_interrupt (time_limit_ctx_p);
+} /* time_limit_signal_handler */
+
+/**
+ * Arm or disarm the time limit timer
+ *
+ * @return true - if the timer was set successfully,
+ *         false - otherwise.
+ */
+static bool
+set_time_limit_timer (uint32_t time_limit_ms) /**< time limit, in milliseconds, or 0 - to disarm the timer */
+{
+  time_limit_ctx_p = jerry_get_active_ctx ();
+
+  struct itimerval timer;
+  memset (&timer, 0, sizeof (timer));
+
+  timer.it_value.tv_sec = (long) (time_limit_ms / 1000);
+  timer.it_value.tv_usec = (long) ((time_limit_ms % 1000) * 1000);
+
+  return (setitimer (ITIMER_REAL, &timer, NULL) == 0);
+} /* set_time_limit_timer */
 
 int
 main (int argc,
@@ -154,6 +395,16 @@ main (int argc,
 
   jerry_flag_t flags = JERRY_FLAG_EMPTY;
 
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+  size_t heap_size_mb = 0;
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
+
+  const char *save_snapshot_file_name = NULL;
+  const char *exec_snapshot_file_name = NULL;
+  const char *sampling_profile_file_name = NULL;
+  const char *heap_snapshot_file_name = NULL;
+  uint32_t time_limit_ms = 0;
+
 #ifdef JERRY_ENABLE_LOG
   const char *log_file_name = NULL;
 #endif /* JERRY_ENABLE_LOG */
@@ -178,6 +429,49 @@ main (int argc,
     {
       flags |= JERRY_FLAG_MEM_STATS_SEPARATE;
     }
+    else if (!strcmp ("--opcode-profile", argv[i]))
+    {
+      flags |= JERRY_FLAG_OPCODE_PROFILE;
+    }
+    else if (!strcmp ("--alloc-profile", argv[i]))
+    {
+      flags |= JERRY_FLAG_ALLOC_PROFILE;
+    }
+    else if (!strcmp ("--sampling-profile", argv[i]))
+    {
+      if (++i >= argc)
+      {
+        JERRY_ERROR_MSG ("Error: wrong format of the arguments\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      sampling_profile_file_name = argv[i];
+    }
+    else if (!strcmp ("--time-limit", argv[i]))
+    {
+      const char *digit_p = (++i < argc) ? argv[i] : "";
+
+      for (time_limit_ms = 0; *digit_p >= '0' && *digit_p <= '9' && time_limit_ms <= JERRY_MAX_TIME_LIMIT_MS; digit_p++)
+      {
+        time_limit_ms = time_limit_ms * 10 + (uint32_t) (*digit_p - '0');
+      }
+
+      if (*digit_p != '\0' || time_limit_ms == 0 || time_limit_ms > JERRY_MAX_TIME_LIMIT_MS)
+      {
+        JERRY_ERROR_MSG ("Error: time limit should be specified in milliseconds (1 - %d)\n", JERRY_MAX_TIME_LIMIT_MS);
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+    }
+    else if (!strcmp ("--heap-snapshot", argv[i]))
+    {
+      if (++i >= argc)
+      {
+        JERRY_ERROR_MSG ("Error: wrong format of the arguments\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      heap_snapshot_file_name = argv[i];
+    }
     else if (!strcmp ("--parse-only", argv[i]))
     {
       flags |= JERRY_FLAG_PARSE_ONLY;
@@ -186,6 +480,10 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--lazy-functions", argv[i]))
+    {
+      flags |= JERRY_FLAG_LAZY_FUNCTIONS;
+    }
     else if (!strcmp ("--log-level", argv[i]))
     {
       flags |= JERRY_FLAG_ENABLE_LOG;
@@ -220,22 +518,79 @@ main (int argc,
     {
       flags |= JERRY_FLAG_ABORT_ON_FAIL;
     }
+    else if (!strcmp ("--save-snapshot", argv[i])
+             || !strcmp ("--exec-snapshot", argv[i]))
+    {
+      if (i + 1 >= argc)
+      {
+        JERRY_ERROR_MSG ("Error: wrong format of the arguments\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+
+      if (!strcmp ("--save-snapshot", argv[i]))
+      {
+        save_snapshot_file_name = argv[++i];
+      }
+      else
+      {
+        exec_snapshot_file_name = argv[++i];
+      }
+    }
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+    else if (!strcmp ("--heap-size", argv[i]))
+    {
+      const char *digit_p = (++i < argc) ? argv[i] : "";
+
+      for (heap_size_mb = 0; *digit_p >= '0' && *digit_p <= '9' && heap_size_mb <= 2048; digit_p++)
+      {
+        heap_size_mb = heap_size_mb * 10 + (size_t) (*digit_p - '0');
+      }
+
+      if (*digit_p != '\0' || heap_size_mb == 0 || heap_size_mb > 2048)
+      {
+        JERRY_ERROR_MSG ("Error: heap size should be specified in megabytes (1 - 2048)\n");
+        return JERRY_STANDALONE_EXIT_CODE_FAIL;
+      }
+    }
+#endif /* CONFIG_JERRY_SERVER_PROFILE */
     else
     {
       file_names[files_counter++] = argv[i];
     }
   }
 
-  if (files_counter == 0)
+  if (exec_snapshot_file_name != NULL
+      && (files_counter != 0 || save_snapshot_file_name != NULL))
+  {
+    JERRY_ERROR_MSG ("Error: --exec-snapshot can't be combined with script files or --save-snapshot\n");
+    return JERRY_STANDALONE_EXIT_CODE_FAIL;
+  }
+
+  if (files_counter == 0 && exec_snapshot_file_name == NULL)
   {
     return JERRY_STANDALONE_EXIT_CODE_OK;
   }
   else
   {
-    size_t source_size;
-    const jerry_api_char_t *source_p = read_sources (file_names, files_counter, &source_size);
+    bool is_source_area_reserved = false;
+    const void *mapped_snapshot_p = NULL;
+    size_t mapped_snapshot_size = 0;
 
-    if (source_p == NULL)
+    if (exec_snapshot_file_name != NULL)
+    {
+      mapped_snapshot_p = map_snapshot_file (exec_snapshot_file_name, &mapped_snapshot_size);
+
+      if (mapped_snapshot_p == NULL)
+      {
+        JERRY_ERROR_MSG ("Failed to map snapshot: %s\n", exec_snapshot_file_name);
+      }
+    }
+    else
+    {
+      is_source_area_reserved = reserve_source_area (file_names, files_counter);
+    }
+
+    if (!is_source_area_reserved && mapped_snapshot_p == NULL)
     {
       return JERRY_STANDALONE_EXIT_CODE_FAIL;
     }
@@ -257,7 +612,18 @@ main (int argc,
       }
 #endif /* JERRY_ENABLE_LOG */
 
+#ifdef CONFIG_JERRY_SERVER_PROFILE
+      if (heap_size_mb != 0)
+      {
+        jerry_init_with_heap_size (flags, heap_size_mb * 1024 * 1024);
+      }
+      else
+      {
+        jerry_init (flags);
+      }
+#else /* CONFIG_JERRY_SERVER_PROFILE */
       jerry_init (flags);
+#endif /* !CONFIG_JERRY_SERVER_PROFILE */
 
       jerry_api_object_t *global_obj_p = jerry_api_get_global ();
       jerry_api_object_t *assert_func_p = jerry_api_create_external_function (assert_handler);
@@ -279,9 +645,73 @@ main (int argc,
 
       jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
-      if (!jerry_parse (source_p, source_size))
+      if (sampling_profile_file_name != NULL
+          && !start_sampling_profiler (sampling_profile_file_name))
       {
-        /* unhandled SyntaxError */
+        JERRY_ERROR_MSG ("Error: failed to start sampling profiler: %s\n", sampling_profile_file_name);
+        ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+      }
+      else if (time_limit_ms != 0
+               && (signal (SIGALRM, time_limit_signal_handler) == SIG_ERR
+                   || !set_time_limit_timer (time_limit_ms)))
+      {
+        JERRY_ERROR_MSG ("Error: failed to set time limit\n");
+        ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+      }
+      else if (exec_snapshot_file_name != NULL)
+      {
+        ret_code = jerry_exec_snapshot (mapped_snapshot_p, mapped_snapshot_size, false);
+
+        if (ret_code == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT)
+        {
+          JERRY_ERROR_MSG ("Error: invalid snapshot: %s\n", exec_snapshot_file_name);
+        }
+      }
+      else if (save_snapshot_file_name != NULL)
+      {
+        static uint8_t snapshot_buffer[ JERRY_SNAPSHOT_BUFFER_SIZE ];
+
+        /* the snapshot is generated from the whole source code */
+        size_t source_size;
+        do
+        {
+          source_size = source_reader.source_size;
+        }
+        while (read_source_part (NULL) != source_size);
+
+        size_t snapshot_size = 0;
+
+        if (!source_reader.is_failed)
+        {
+          snapshot_size = jerry_parse_and_save_snapshot (source_reader.area_p,
+                                                         source_size,
+                                                         snapshot_buffer,
+                                                         sizeof (snapshot_buffer));
+        }
+
+        FILE *snapshot_file_p = NULL;
+
+        if (snapshot_size != 0)
+        {
+          snapshot_file_p = fopen (save_snapshot_file_name, "w");
+        }
+
+        if (snapshot_file_p == NULL
+            || fwrite (snapshot_buffer, 1, snapshot_size, snapshot_file_p) != snapshot_size)
+        {
+          JERRY_ERROR_MSG ("Error: failed to save snapshot: %s\n", save_snapshot_file_name);
+          ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+        }
+
+        if (snapshot_file_p != NULL)
+        {
+          fclose (snapshot_file_p);
+        }
+      }
+      else if (!jerry_parse_from_reader (source_reader.area_p, read_source_part, NULL)
+               || source_reader.is_failed)
+      {
+        /* unhandled SyntaxError or the source code could not be read */
         ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
       }
       else
@@ -292,8 +722,46 @@ main (int argc,
         }
       }
 
+      if (time_limit_ms != 0)
+      {
+        set_time_limit_timer (0);
+        signal (SIGALRM, SIG_IGN);
+      }
+
+      if (ret_code == JERRY_COMPLETION_CODE_INTERRUPTED)
+      {
+        JERRY_ERROR_MSG ("Error: execution was interrupted upon exceeding of the time limit\n");
+      }
+
+      if (sampling_profile_file_name != NULL)
+      {
+        stop_sampling_profiler ();
+      }
+
+      if (flags & JERRY_FLAG_ALLOC_PROFILE)
+      {
+        jerry_alloc_profiler_dump (JERRY_ALLOC_PROFILE_SITES_NUMBER);
+      }
+
+      if (heap_snapshot_file_name != NULL
+          && !jerry_api_dump_heap_snapshot (heap_snapshot_file_name))
+      {
+        JERRY_ERROR_MSG ("Error: failed to write heap snapshot: %s\n", heap_snapshot_file_name);
+        ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
+      }
+
       jerry_cleanup ();
 
+      if (mapped_snapshot_p != NULL)
+      {
+        munmap ((void *) mapped_snapshot_p, mapped_snapshot_size);
+      }
+
+      if (is_source_area_reserved)
+      {
+        release_source_area ();
+      }
+
 #ifdef JERRY_ENABLE_LOG
       if (jerry_log_file && jerry_log_file != stdout)
       {
@@ -0,0 +1,908 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Benchmark harness
+ *
+ * Runs each of the specified benchmarks in a newly initialized engine: first, the warmup iterations,
+ * and then the measured iterations, timed with monotonic clock. Each iteration is an indirect eval
+ * of the benchmark's source code. The byte-code is compiled during the first iteration and is put to
+ * the eval cache (see also: ecma_eval_cache_lookup), so the following iterations reuse it, and the measured
+ * time is time of the code's execution without its parse. The first iteration's time, that includes
+ * the parse, is reported separately.
+ *
+ * Reported for each benchmark:
+ *  - time of the first iteration (parse and execution);
+ *  - median time of an iteration, with 95% confidence interval (by order statistics);
+ *  - 95th percentile of the time;
+ *  - mean time with 95% confidence interval (by Student's t-distribution) and standard deviation;
+ *  - peak heap and pools usage since the engine's initialization (if the harness is built with memory
+ *    statistics, see also: jerry_get_memory_stats).
+ *
+ * The harness is built in two configurations: jerry-bench with release configuration of the engine,
+ * which should be used for timing, and jerry-bench-mem with memory statistics (MEM_STATS), which collection
+ * slows down the engine, so only memory usage figures of jerry-bench-mem are representative.
+ *
+ * Usage:
+ *   jerry-bench [--warmup N] [--iterations N] [--output results.json] [--compare baseline.json]
+ *               [--mem-compare mem-baseline.json] [--mem-threshold PERCENT]
+ *               benchmark1.js [benchmark2.js ...]
+ *
+ * The results are written in JSON format with --output. With --compare, the results are compared with
+ * the results of another build, written with --output. A change is considered significant
+ * if the confidence intervals of the medians don't intersect.
+ *
+ * With --mem-compare, memory usage (peak heap bytes, peak pools' chunks, peak heap waste and size of
+ * the literal storage) is compared with a baseline in the same format, and exceeding a baseline value
+ * by more than the threshold (BENCH_DEFAULT_MEM_THRESHOLD_PERCENT by default) is reported as a regression
+ * (the literal storage's size is allowed to grow by a node, as it changes by whole nodes).
+ * Memory usage is deterministic, so the baseline can be checked in (see also: mem_bench target).
+ *
+ * Returns zero if all iterations of all the benchmarks have completed successfully,
+ * and no memory regressions were found.
+ */
+
+#include "jerry.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * Default number of warmup iterations
+ */
+#define BENCH_DEFAULT_WARMUP_ITERATIONS (2)
+
+/**
+ * Default number of measured iterations
+ */
+#define BENCH_DEFAULT_ITERATIONS (10)
+
+/**
+ * Maximum number of measured iterations
+ */
+#define BENCH_MAX_ITERATIONS (10000)
+
+/**
+ * Default threshold of memory usage regressions, in percents of baseline values
+ */
+#define BENCH_DEFAULT_MEM_THRESHOLD_PERCENT (2.0)
+
+/**
+ * Maximum length of a benchmark's name
+ */
+#define BENCH_MAX_NAME_LENGTH (64)
+
+/**
+ * Maximum length of a line in file with results of a benchmark run
+ */
+#define BENCH_MAX_LINE_LENGTH (1024)
+
+/**
+ * Results of a benchmark
+ */
+typedef struct
+{
+  char name[BENCH_MAX_NAME_LENGTH]; /**< name of the benchmark (file name without directory and extension) */
+  bool is_ok; /**< were all iterations completed successfully */
+  uint32_t iterations; /**< number of measured iterations */
+
+  double first_ms; /**< time of the first iteration (including parse of the benchmark's source code) */
+  double median_ms; /**< median time of an iteration */
+  double median_ci_low_ms; /**< lower bound of the median's confidence interval */
+  double median_ci_high_ms; /**< upper bound of the median's confidence interval */
+  double p95_ms; /**< 95th percentile of the time */
+  double mean_ms; /**< mean time */
+  double mean_ci_ms; /**< half-width of the mean's confidence interval */
+  double stddev_ms; /**< standard deviation of the time */
+  double min_ms; /**< minimum time */
+  double max_ms; /**< maximum time */
+
+  bool has_mem_stats; /**< are memory statistics available (see also: jerry_get_memory_stats) */
+  jerry_memory_stats_t mem_stats; /**< memory usage statistics */
+} bench_result_t;
+
+/**
+ * Flag, indicating that an assertion failed in current iteration
+ */
+static bool bench_is_assertion_failed;
+
+/**
+ * Read the whole file into a newly allocated buffer
+ *
+ * @return pointer to the buffer (should be freed with free) - if the file was read successfully,
+ *         NULL - otherwise.
+ */
+static jerry_api_char_t *
+bench_read_file (const char *file_name_p, /**< name of the file */
+                 size_t *out_size_p) /**< out: size of the file */
+{
+  FILE *file_p = fopen (file_name_p, "r");
+
+  if (file_p == NULL)
+  {
+    return NULL;
+  }
+
+  bool is_ok = (fseek (file_p, 0, SEEK_END) == 0);
+  long file_size = is_ok ? ftell (file_p) : -1;
+
+  if (file_size < 0 || fseek (file_p, 0, SEEK_SET) != 0)
+  {
+    fclose (file_p);
+    return NULL;
+  }
+
+  jerry_api_char_t *buffer_p = (jerry_api_char_t *) malloc ((size_t) file_size + 1);
+
+  if (buffer_p != NULL
+      && fread (buffer_p, 1, (size_t) file_size, file_p) != (size_t) file_size)
+  {
+    free (buffer_p);
+    buffer_p = NULL;
+  }
+
+  fclose (file_p);
+
+  *out_size_p = (size_t) file_size;
+  return buffer_p;
+} /* bench_read_file */
+
+/**
+ * Get benchmark's name from name of its file
+ */
+static void
+bench_get_name (const char *file_name_p, /**< name of the benchmark's file */
+                char *out_name_p) /**< out: buffer of BENCH_MAX_NAME_LENGTH characters */
+{
+  const char *start_p = strrchr (file_name_p, '/');
+  start_p = (start_p == NULL) ? file_name_p : start_p + 1;
+
+  const char *end_p = strrchr (start_p, '.');
+  size_t length = (end_p == NULL) ? strlen (start_p) : (size_t) (end_p - start_p);
+
+  if (length >= BENCH_MAX_NAME_LENGTH)
+  {
+    length = BENCH_MAX_NAME_LENGTH - 1;
+  }
+
+  memcpy (out_name_p, start_p, length);
+  out_name_p[length] = '\0';
+} /* bench_get_name */
+
+/**
+ * Get current value of monotonic clock
+ *
+ * @return time in milliseconds
+ */
+static double
+bench_get_time_ms (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return (double) ts.tv_sec * 1000.0 + (double) ts.tv_nsec / 1000000.0;
+} /* bench_get_time_ms */
+
+/**
+ * The 'assert' implementation for the benchmarks
+ *
+ * @return true
+ */
+static bool
+bench_assert_handler (const jerry_api_object_t *function_obj_p, /**< function object */
+                      const jerry_api_value_t *this_p, /**< this arg */
+                      jerry_api_value_t *ret_val_p, /**< return argument */
+                      const jerry_api_value_t args_p[], /**< function arguments */
+                      const jerry_api_length_t args_cnt) /**< number of function arguments */
+{
+  (void) function_obj_p;
+  (void) this_p;
+  (void) ret_val_p;
+
+  if (args_cnt > 0
+      && args_p[0].type == JERRY_API_DATA_TYPE_BOOLEAN
+      && args_p[0].v_bool != true)
+  {
+    bench_is_assertion_failed = true;
+  }
+
+  return true;
+} /* bench_assert_handler */
+
+/**
+ * Register 'assert' function in the global object
+ *
+ * @return true - if the function was registered successfully,
+ *         false - otherwise.
+ */
+static bool
+bench_register_assert (void)
+{
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  jerry_api_object_t *assert_func_p = jerry_api_create_external_function (bench_assert_handler);
+  jerry_api_value_t assert_value;
+  assert_value.type = JERRY_API_DATA_TYPE_OBJECT;
+  assert_value.v_object = assert_func_p;
+
+  bool is_ok = jerry_api_set_object_field_value (global_obj_p, (const jerry_api_char_t *) "assert", &assert_value);
+
+  jerry_api_release_value (&assert_value);
+  jerry_api_release_object (global_obj_p);
+
+  return is_ok;
+} /* bench_register_assert */
+
+/**
+ * Run an iteration of the benchmark
+ *
+ * @return true - if the iteration completed successfully,
+ *         false - otherwise.
+ */
+static bool
+bench_run_iteration (const jerry_api_char_t *source_p, /**< source code of the benchmark */
+                     size_t source_size) /**< size of the source code */
+{
+  jerry_api_value_t ret_value;
+
+  bench_is_assertion_failed = false;
+
+  jerry_completion_code_t status = jerry_api_eval (source_p, source_size, false, false, &ret_value);
+  jerry_api_release_value (&ret_value);
+
+  return (status == JERRY_COMPLETION_CODE_OK && !bench_is_assertion_failed);
+} /* bench_run_iteration */
+
+/**
+ * Comparator of time samples for qsort
+ *
+ * @return -1, 0 or 1 - if the first sample is less, equal or greater than the second one, correspondingly
+ */
+static int
+bench_compare_samples (const void *sample1_p, /**< first sample */
+                       const void *sample2_p) /**< second sample */
+{
+  const double v1 = *(const double *) sample1_p;
+  const double v2 = *(const double *) sample2_p;
+
+  return (v1 < v2) ? -1 : ((v1 > v2) ? 1 : 0);
+} /* bench_compare_samples */
+
+/**
+ * Get two-sided 95% quantile of Student's t-distribution
+ *
+ * @return the quantile
+ */
+static double
+bench_get_t_quantile (uint32_t degrees_of_freedom) /**< degrees of freedom */
+{
+  static const double t_quantiles[] =
+  {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+  };
+
+  const uint32_t table_size = (uint32_t) (sizeof (t_quantiles) / sizeof (t_quantiles[0]));
+
+  if (degrees_of_freedom == 0)
+  {
+    return 0.0;
+  }
+  else if (degrees_of_freedom <= table_size)
+  {
+    return t_quantiles[degrees_of_freedom - 1];
+  }
+  else
+  {
+    /* normal distribution's quantile */
+    return 1.960;
+  }
+} /* bench_get_t_quantile */
+
+/**
+ * Calculate statistics of the measured iterations' time
+ */
+static void
+bench_calc_stats (double *samples_p, /**< time samples (are sorted by the routine) */
+                  uint32_t n, /**< number of samples */
+                  bench_result_t *result_p) /**< in-out: results of the benchmark */
+{
+  qsort (samples_p, n, sizeof (double), bench_compare_samples);
+
+  result_p->iterations = n;
+  result_p->min_ms = samples_p[0];
+  result_p->max_ms = samples_p[n - 1];
+
+  result_p->median_ms = (n % 2 == 1) ? samples_p[n / 2] : (samples_p[n / 2 - 1] + samples_p[n / 2]) / 2.0;
+
+  /* nearest-rank percentile */
+  uint32_t p95_rank = (uint32_t) ceil (0.95 * (double) n);
+  result_p->p95_ms = samples_p[(p95_rank > 0 ? p95_rank : 1) - 1];
+
+  /* distribution-free confidence interval of the median: ranks n / 2 -+ 1.96 * sqrt (n) / 2 (1-based) */
+  const double ci_half_width_ranks = 1.96 * sqrt ((double) n) / 2.0;
+  double low_rank = floor ((double) n / 2.0 - ci_half_width_ranks);
+  double high_rank = ceil ((double) n / 2.0 + 1.0 + ci_half_width_ranks);
+
+  low_rank = (low_rank < 1.0) ? 1.0 : low_rank;
+  high_rank = (high_rank > (double) n) ? (double) n : high_rank;
+
+  result_p->median_ci_low_ms = samples_p[(uint32_t) low_rank - 1];
+  result_p->median_ci_high_ms = samples_p[(uint32_t) high_rank - 1];
+
+  double sum = 0.0;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    sum += samples_p[i];
+  }
+  result_p->mean_ms = sum / (double) n;
+
+  double sum_of_squares = 0.0;
+  for (uint32_t i = 0; i < n; i++)
+  {
+    const double diff = samples_p[i] - result_p->mean_ms;
+    sum_of_squares += diff * diff;
+  }
+  result_p->stddev_ms = (n > 1) ? sqrt (sum_of_squares / (double) (n - 1)) : 0.0;
+
+  result_p->mean_ci_ms = bench_get_t_quantile (n - 1) * result_p->stddev_ms / sqrt ((double) n);
+} /* bench_calc_stats */
+
+/**
+ * Run the benchmark in a newly initialized engine
+ */
+static void
+bench_run (const char *file_name_p, /**< name of the benchmark's file */
+           uint32_t warmup_iterations, /**< number of warmup iterations */
+           uint32_t iterations, /**< number of measured iterations */
+           bench_result_t *result_p) /**< out: results of the benchmark */
+{
+  memset (result_p, 0, sizeof (*result_p));
+  bench_get_name (file_name_p, result_p->name);
+
+  size_t source_size;
+  jerry_api_char_t *source_p = bench_read_file (file_name_p, &source_size);
+
+  if (source_p == NULL)
+  {
+    printf ("Failed to read '%s'\n", file_name_p);
+    return;
+  }
+
+  double *samples_p = (double *) malloc (iterations * sizeof (double));
+
+  if (samples_p == NULL)
+  {
+    free (source_p);
+    return;
+  }
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  jerry_reset_memory_stats_peak ();
+
+  bool is_ok = bench_register_assert ();
+
+  for (uint32_t i = 0; is_ok && i < warmup_iterations; i++)
+  {
+    const double start_ms = bench_get_time_ms ();
+    is_ok = bench_run_iteration (source_p, source_size);
+
+    if (i == 0)
+    {
+      result_p->first_ms = bench_get_time_ms () - start_ms;
+    }
+  }
+
+  for (uint32_t i = 0; is_ok && i < iterations; i++)
+  {
+    const double start_ms = bench_get_time_ms ();
+    is_ok = bench_run_iteration (source_p, source_size);
+    samples_p[i] = bench_get_time_ms () - start_ms;
+
+    if (i == 0 && warmup_iterations == 0)
+    {
+      result_p->first_ms = samples_p[i];
+    }
+  }
+
+  result_p->has_mem_stats = jerry_get_memory_stats (&result_p->mem_stats);
+
+  jerry_cleanup ();
+
+  if (is_ok)
+  {
+    bench_calc_stats (samples_p, iterations, result_p);
+    result_p->is_ok = true;
+  }
+  else
+  {
+    printf ("FAIL: %s\n", file_name_p);
+  }
+
+  free (samples_p);
+  free (source_p);
+} /* bench_run */
+
+/**
+ * Write results of the benchmarks in JSON format (one benchmark per line, see also: bench_read_baseline)
+ *
+ * @return true - if the results were written successfully,
+ *         false - otherwise.
+ */
+static bool
+bench_write_json (const char *file_name_p, /**< name of output file */
+                  const bench_result_t *results_p, /**< results */
+                  uint32_t results_number, /**< number of results */
+                  uint32_t warmup_iterations) /**< number of warmup iterations */
+{
+  FILE *file_p = fopen (file_name_p, "w");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  fprintf (file_p, "{\n");
+  fprintf (file_p, "  \"engine\": {\"commit\": \"%s\", \"branch\": \"%s\", \"build_date\": \"%s\"},\n",
+           jerry_commit_hash, jerry_branch_name, jerry_build_date);
+  fprintf (file_p, "  \"warmup_iterations\": %u,\n", warmup_iterations);
+  fprintf (file_p, "  \"benchmarks\": [\n");
+
+  bool is_first = true;
+
+  for (uint32_t i = 0; i < results_number; i++)
+  {
+    const bench_result_t *result_p = &results_p[i];
+
+    if (!result_p->is_ok)
+    {
+      continue;
+    }
+
+    fprintf (file_p,
+             "%s    {\"name\": \"%s\", \"iterations\": %u, \"first_ms\": %.4f, "
+             "\"median_ms\": %.4f, \"median_ci_low_ms\": %.4f, \"median_ci_high_ms\": %.4f, \"p95_ms\": %.4f, "
+             "\"mean_ms\": %.4f, \"mean_ci_ms\": %.4f, \"stddev_ms\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f",
+             is_first ? "" : ",\n",
+             result_p->name,
+             result_p->iterations,
+             result_p->first_ms,
+             result_p->median_ms,
+             result_p->median_ci_low_ms,
+             result_p->median_ci_high_ms,
+             result_p->p95_ms,
+             result_p->mean_ms,
+             result_p->mean_ci_ms,
+             result_p->stddev_ms,
+             result_p->min_ms,
+             result_p->max_ms);
+
+    if (result_p->has_mem_stats)
+    {
+      fprintf (file_p,
+               ", \"heap_peak_bytes\": %zu, \"heap_peak_waste_bytes\": %zu, \"pools_peak_bytes\": %zu"
+               ", \"pools_peak_chunks\": %zu, \"literals_bytes\": %zu",
+               result_p->mem_stats.heap_peak_allocated_bytes,
+               result_p->mem_stats.heap_peak_waste_bytes,
+               result_p->mem_stats.pools_peak_allocated_bytes,
+               result_p->mem_stats.pools_peak_allocated_chunks,
+               result_p->mem_stats.literals_bytes);
+    }
+
+    fprintf (file_p, "}");
+
+    is_first = false;
+  }
+
+  fprintf (file_p, "\n  ]\n}\n");
+
+  return (fclose (file_p) == 0);
+} /* bench_write_json */
+
+/**
+ * Get value of a number field from a line of JSON results
+ *
+ * @return true - if the field exists,
+ *         false - otherwise.
+ */
+static bool
+bench_get_json_number (const char *line_p, /**< line */
+                       const char *field_name_p, /**< name of the field */
+                       double *out_value_p) /**< out: value */
+{
+  char pattern[BENCH_MAX_NAME_LENGTH];
+  snprintf (pattern, sizeof (pattern), "\"%s\": ", field_name_p);
+
+  const char *field_p = strstr (line_p, pattern);
+
+  if (field_p == NULL)
+  {
+    return false;
+  }
+
+  *out_value_p = strtod (field_p + strlen (pattern), NULL);
+
+  return true;
+} /* bench_get_json_number */
+
+/**
+ * Find line with results of the benchmark in JSON results of another build, written with bench_write_json
+ *
+ * @return true - if the line was found,
+ *         false - otherwise.
+ */
+static bool
+bench_find_baseline_line (const char *file_name_p, /**< name of file with results of another build */
+                          const char *name_p, /**< name of the benchmark */
+                          char *out_line_p, /**< out: the line */
+                          size_t line_size) /**< size of the line's buffer */
+{
+  FILE *file_p = fopen (file_name_p, "r");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  char name_pattern[BENCH_MAX_NAME_LENGTH + 16];
+  snprintf (name_pattern, sizeof (name_pattern), "{\"name\": \"%s\",", name_p);
+
+  bool is_found = false;
+
+  while (!is_found && fgets (out_line_p, (int) line_size, file_p) != NULL)
+  {
+    is_found = (strstr (out_line_p, name_pattern) != NULL);
+  }
+
+  fclose (file_p);
+
+  return is_found;
+} /* bench_find_baseline_line */
+
+/**
+ * Find results of the benchmark in JSON results of another build, written with bench_write_json
+ *
+ * @return true - if results of the benchmark were found,
+ *         false - otherwise.
+ */
+static bool
+bench_read_baseline (const char *file_name_p, /**< name of file with results of another build */
+                     const char *name_p, /**< name of the benchmark */
+                     bench_result_t *out_result_p) /**< out: the benchmark's results (timing only) */
+{
+  char line[BENCH_MAX_LINE_LENGTH];
+
+  return (bench_find_baseline_line (file_name_p, name_p, line, sizeof (line))
+          && bench_get_json_number (line, "median_ms", &out_result_p->median_ms)
+          && bench_get_json_number (line, "median_ci_low_ms", &out_result_p->median_ci_low_ms)
+          && bench_get_json_number (line, "median_ci_high_ms", &out_result_p->median_ci_high_ms));
+} /* bench_read_baseline */
+
+/**
+ * Number of memory usage values, compared with the baseline
+ */
+#define BENCH_MEM_VALUES_NUMBER (4)
+
+/**
+ * Names of memory usage values' fields in JSON results
+ */
+static const char *bench_mem_value_names[BENCH_MEM_VALUES_NUMBER] =
+{
+  "heap_peak_bytes",
+  "pools_peak_chunks",
+  "heap_peak_waste_bytes",
+  "literals_bytes"
+};
+
+/**
+ * Get memory usage values, compared with the baseline, in order of bench_mem_value_names
+ *
+ * Size of the literal storage changes by whole nodes, so growth by a single node is not considered
+ * a regression, even if it exceeds the threshold.
+ */
+static void
+bench_get_mem_values (const jerry_memory_stats_t *mem_stats_p, /**< memory usage statistics */
+                      double *out_values_p, /**< out: the values */
+                      double *out_min_tolerances_p) /**< out: growth of the values, that is always allowed */
+{
+  out_values_p[0] = (double) mem_stats_p->heap_peak_allocated_bytes;
+  out_values_p[1] = (double) mem_stats_p->pools_peak_allocated_chunks;
+  out_values_p[2] = (double) mem_stats_p->heap_peak_waste_bytes;
+  out_values_p[3] = (double) mem_stats_p->literals_bytes;
+
+  out_min_tolerances_p[0] = 0.0;
+  out_min_tolerances_p[1] = 0.0;
+  out_min_tolerances_p[2] = 0.0;
+  out_min_tolerances_p[3] = (double) mem_stats_p->literals_node_size;
+} /* bench_get_mem_values */
+
+/**
+ * Compare memory usage of the benchmarks with the baseline, and print the comparison
+ *
+ * @return number of the values, that exceed their baseline values by more than the threshold
+ */
+static uint32_t
+bench_compare_mem_results (const bench_result_t *results_p, /**< results */
+                           uint32_t results_number, /**< number of results */
+                           const char *baseline_file_name_p, /**< name of file with the baseline */
+                           double threshold_percent) /**< threshold of regressions */
+{
+  uint32_t regressions_number = 0;
+
+  printf ("\nMemory usage compared with '%s' (threshold %.2f%%):\n", baseline_file_name_p, threshold_percent);
+  printf ("%-24s %-22s %12s %12s %9s\n", "Benchmark", "Value", "Current", "Baseline", "Change");
+
+  for (uint32_t i = 0; i < results_number; i++)
+  {
+    const bench_result_t *result_p = &results_p[i];
+
+    if (!result_p->is_ok || !result_p->has_mem_stats)
+    {
+      continue;
+    }
+
+    char line[BENCH_MAX_LINE_LENGTH];
+
+    if (!bench_find_baseline_line (baseline_file_name_p, result_p->name, line, sizeof (line)))
+    {
+      printf ("%-24s (no baseline)\n", result_p->name);
+      continue;
+    }
+
+    double values[BENCH_MEM_VALUES_NUMBER];
+    double min_tolerances[BENCH_MEM_VALUES_NUMBER];
+    bench_get_mem_values (&result_p->mem_stats, values, min_tolerances);
+
+    for (uint32_t value_index = 0; value_index < BENCH_MEM_VALUES_NUMBER; value_index++)
+    {
+      double baseline_value;
+
+      if (!bench_get_json_number (line, bench_mem_value_names[value_index], &baseline_value))
+      {
+        continue;
+      }
+
+      const double change = (baseline_value == 0.0) ? 0.0 : (values[value_index] / baseline_value - 1.0) * 100.0;
+      double tolerance = baseline_value * threshold_percent / 100.0;
+
+      if (tolerance < min_tolerances[value_index])
+      {
+        tolerance = min_tolerances[value_index];
+      }
+
+      const bool is_regression = (values[value_index] > baseline_value + tolerance);
+
+      printf ("%-24s %-22s %12.0f %12.0f %+8.2f%%%s\n",
+              result_p->name,
+              bench_mem_value_names[value_index],
+              values[value_index],
+              baseline_value,
+              change,
+              is_regression ? " (REGRESSION)" : "");
+
+      if (is_regression)
+      {
+        regressions_number++;
+      }
+    }
+  }
+
+  return regressions_number;
+} /* bench_compare_mem_results */
+
+/**
+ * Print results of the benchmarks, and comparison with results of another build (if specified)
+ */
+static void
+bench_print_results (const bench_result_t *results_p, /**< results */
+                     uint32_t results_number, /**< number of results */
+                     const char *baseline_file_name_p) /**< name of file with results of another build,
+                                                        *   or NULL - if comparison is not required */
+{
+  printf ("%-24s %10s %10s %23s %10s %18s %10s %10s",
+          "Benchmark", "First,ms", "Median,ms", "95% CI of median", "P95,ms", "Mean,ms", "Heap,KB", "Pools,KB");
+
+  if (baseline_file_name_p != NULL)
+  {
+    printf (" %10s %9s", "Base,ms", "Change");
+  }
+
+  printf ("\n");
+
+  for (uint32_t i = 0; i < results_number; i++)
+  {
+    const bench_result_t *result_p = &results_p[i];
+
+    if (!result_p->is_ok)
+    {
+      printf ("%-24s FAILED\n", result_p->name);
+      continue;
+    }
+
+    printf ("%-24s %10.2f %10.2f [%10.2f,%10.2f] %10.2f %9.2f+-%6.2f",
+            result_p->name,
+            result_p->first_ms,
+            result_p->median_ms,
+            result_p->median_ci_low_ms,
+            result_p->median_ci_high_ms,
+            result_p->p95_ms,
+            result_p->mean_ms,
+            result_p->mean_ci_ms);
+
+    if (result_p->has_mem_stats)
+    {
+      printf (" %10.1f %10.1f",
+              (double) result_p->mem_stats.heap_peak_allocated_bytes / 1024.0,
+              (double) result_p->mem_stats.pools_peak_allocated_bytes / 1024.0);
+    }
+    else
+    {
+      printf (" %10s %10s", "-", "-");
+    }
+
+    if (baseline_file_name_p != NULL)
+    {
+      bench_result_t baseline;
+
+      if (bench_read_baseline (baseline_file_name_p, result_p->name, &baseline))
+      {
+        const double change = (result_p->median_ms / baseline.median_ms - 1.0) * 100.0;
+        const bool is_significant = (result_p->median_ci_low_ms > baseline.median_ci_high_ms
+                                     || result_p->median_ci_high_ms < baseline.median_ci_low_ms);
+
+        printf (" %10.2f %+8.2f%%%s", baseline.median_ms, change, is_significant ? " (significant)" : "");
+      }
+      else
+      {
+        printf (" %10s", "-");
+      }
+    }
+
+    printf ("\n");
+  }
+} /* bench_print_results */
+
+int
+main (int argc,
+      char **argv)
+{
+  uint32_t warmup_iterations = BENCH_DEFAULT_WARMUP_ITERATIONS;
+  uint32_t iterations = BENCH_DEFAULT_ITERATIONS;
+  const char *output_file_name_p = NULL;
+  const char *baseline_file_name_p = NULL;
+  const char *mem_baseline_file_name_p = NULL;
+  double mem_threshold_percent = BENCH_DEFAULT_MEM_THRESHOLD_PERCENT;
+
+  const char **file_names_p = (const char **) calloc ((size_t) argc, sizeof (const char *));
+  uint32_t benchmarks_number = 0;
+
+  if (file_names_p == NULL)
+  {
+    return 1;
+  }
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp ("--warmup", argv[i]) && i + 1 < argc)
+    {
+      warmup_iterations = (uint32_t) atol (argv[++i]);
+    }
+    else if (!strcmp ("--iterations", argv[i]) && i + 1 < argc)
+    {
+      iterations = (uint32_t) atol (argv[++i]);
+    }
+    else if (!strcmp ("--output", argv[i]) && i + 1 < argc)
+    {
+      output_file_name_p = argv[++i];
+    }
+    else if (!strcmp ("--compare", argv[i]) && i + 1 < argc)
+    {
+      baseline_file_name_p = argv[++i];
+    }
+    else if (!strcmp ("--mem-compare", argv[i]) && i + 1 < argc)
+    {
+      mem_baseline_file_name_p = argv[++i];
+    }
+    else if (!strcmp ("--mem-threshold", argv[i]) && i + 1 < argc)
+    {
+      mem_threshold_percent = atof (argv[++i]);
+    }
+    else
+    {
+      file_names_p[benchmarks_number++] = argv[i];
+    }
+  }
+
+  if (benchmarks_number == 0 || iterations == 0 || iterations > BENCH_MAX_ITERATIONS)
+  {
+    printf ("Usage: %s [--warmup N] [--iterations N (1..%d)] [--output results.json] [--compare baseline.json]\n"
+            "       [--mem-compare mem-baseline.json] [--mem-threshold PERCENT]\n"
+            "       benchmark1.js [benchmark2.js ...]\n",
+            argv[0],
+            BENCH_MAX_ITERATIONS);
+    free (file_names_p);
+    return 1;
+  }
+
+  bench_result_t *results_p = (bench_result_t *) calloc (benchmarks_number, sizeof (bench_result_t));
+
+  if (results_p == NULL)
+  {
+    free (file_names_p);
+    return 1;
+  }
+
+  uint32_t failed_number = 0;
+
+  for (uint32_t i = 0; i < benchmarks_number; i++)
+  {
+    bench_run (file_names_p[i], warmup_iterations, iterations, &results_p[i]);
+
+    if (!results_p[i].is_ok)
+    {
+      failed_number++;
+    }
+  }
+
+  bench_print_results (results_p, benchmarks_number, baseline_file_name_p);
+
+  /* memory statistics are collected, if the harness is built with MEM_STATS (jerry-bench-mem) */
+  bool has_mem_stats = false;
+
+  for (uint32_t i = 0; i < benchmarks_number; i++)
+  {
+    has_mem_stats = has_mem_stats || results_p[i].has_mem_stats;
+  }
+
+  if (has_mem_stats)
+  {
+    printf ("\nNote: the time is measured with memory statistics collection, so it is not representative\n"
+            "      of release builds (use jerry-bench for timing)\n");
+  }
+
+  if (mem_baseline_file_name_p != NULL && !has_mem_stats)
+  {
+    printf ("Memory statistics are not collected in the build (use jerry-bench-mem for --mem-compare)\n");
+    failed_number++;
+  }
+  else if (mem_baseline_file_name_p != NULL)
+  {
+    uint32_t regressions_number = bench_compare_mem_results (results_p,
+                                                             benchmarks_number,
+                                                             mem_baseline_file_name_p,
+                                                             mem_threshold_percent);
+
+    if (regressions_number != 0)
+    {
+      printf ("%u memory usage regression(s) found\n", regressions_number);
+      failed_number++;
+    }
+  }
+
+  if (output_file_name_p != NULL
+      && !bench_write_json (output_file_name_p, results_p, benchmarks_number, warmup_iterations))
+  {
+    printf ("Failed to write '%s'\n", output_file_name_p);
+    failed_number++;
+  }
+
+  free (results_p);
+  free (file_names_p);
+
+  return (failed_number == 0) ? 0 : 1;
+} /* main */
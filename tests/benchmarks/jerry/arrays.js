@@ -0,0 +1,37 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var arr = [];
+
+for (var i = 0; i < 1000; i++)
+{
+  arr.push (i);
+}
+
+var sum = 0;
+
+for (var i = 0; i < 10; i++)
+{
+  var copy = arr.slice (0);
+  copy.reverse ();
+  sum += copy.indexOf (i) + copy.pop ();
+}
+
+for (var i = 0; i < arr.length; i++)
+{
+  arr[i] = arr[i] * 2;
+  sum += arr[i];
+}
+
+assert (sum > 0);
@@ -0,0 +1,34 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function make_counter (start)
+{
+  var value = start;
+
+  return function ()
+  {
+    return value++;
+  };
+}
+
+var total = 0;
+
+for (var i = 0; i < 20000; i++)
+{
+  var counter = make_counter (i);
+  var tmp = { f: counter, arr: [i, i + 1] };
+  total += tmp.f () + tmp.arr[1];
+}
+
+assert (total > 0);
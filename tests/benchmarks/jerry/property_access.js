@@ -0,0 +1,26 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var obj = { x: 1, y: 2, z: 3 };
+var count = 0;
+
+for (var i = 0; i < 20000; i++)
+{
+  obj.x = obj.y + obj.z;
+  obj['y'] = obj.z;
+  obj.z = obj.x - obj.y;
+  count += obj['x'] - obj.z;
+}
+
+assert (count === 50000);
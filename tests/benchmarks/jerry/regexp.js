@@ -0,0 +1,29 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var re = /([a-z]+)([0-9]+)/;
+var words = ['abc123', 'hello42', 'x7', 'no digits', 'jerry2015'];
+var matched = 0;
+
+for (var i = 0; i < 2000; i++)
+{
+  var word = words[i % words.length];
+
+  if (re.test (word))
+  {
+    matched += re.exec (word)[2].length;
+  }
+}
+
+assert (matched === 4000);
@@ -0,0 +1,35 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var str = '';
+
+for (var i = 0; i < 200; i++)
+{
+  str += String.fromCharCode (97 + i % 26);
+}
+
+var count = 0;
+
+for (var i = 0; i < 50; i++)
+{
+  var part = str.slice (i, i + 20);
+  var padded = ('  ' + part + '  ').trim ();
+
+  if (padded === part && part.concat ('!') > part)
+  {
+    count += part.length;
+  }
+}
+
+assert (count > 0);
@@ -0,0 +1,155 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var one = 1, zero = 0, a = "a";
+
+// arithmetics
+assert (60 * 60 * 1000 === 3600000);
+assert (0.1 + 0.2 === one / 10 + 2 / 10);
+assert (7 - 10 === -3);
+assert (5 % 3 === 2);
+assert (-5 % 3 === -2);
+assert (5.5 % -2 === 1.5);
+assert (1 / 0 === Infinity);
+assert (-1 / 0 === -Infinity);
+assert (isNaN (0 / 0));
+assert (1 / -0 === -Infinity);
+assert (1 / (0 * -1) === -Infinity);
+assert (1 / (-zero) === 1 / -0);
+assert (250 + 2 === 252);
+assert (255 + 1 === 256);
+assert (-(250 + 3) === -253);
+assert (+"12" === 12);
+assert ("6" * "7" === 42);
+assert (true + 1 === 2);
+
+// bitwise operations
+assert (~5 === -6);
+assert (~-1 === 0);
+assert ((1 << 31) === -2147483648);
+assert ((1 << 32) === 1);
+assert ((-1 >>> 0) === 4294967295);
+assert ((-16 >> 2) === -4);
+assert ((0xf0 | 0x0f) === 255);
+assert ((0xf0 & 0x3c) === 0x30);
+assert ((0xff ^ 0x0f) === 0xf0);
+assert ((4294967296 + 5 | 0) === 5);
+
+// string concatenation
+assert ("a" + "b" === "ab");
+assert ("a" + "b" === a + "b");
+assert ("" + "" === "");
+assert ("x" + 1 + 2 === "x12");
+assert (1 + 2 + "x" === "3x");
+assert ("" + -0 === "0");
+assert ("" + true === "true");
+assert (("long string " + "long string " + "long string " + "long string " + "long string " + "long string ").length
+        === 72);
+
+// intermediate results of constant expressions
+assert (60 * 60 * 24.5 === 88200);
+assert (60 * 60 * (2.5 * 3) === 27000);
+assert ("a" + "b" + "c" + "d" === "abcd");
+var ab = "a" + "b" + "c"
+ab = ab + ab
+assert (ab === "abcabc");
+var half = 0.5 * 3
+function after_folded_constant () { return 1.5 * 3 * 7; }
+assert (half === 1.5 && after_folded_constant () === 31.5);
+if (2.5 * 2.5) { half = 2.5 * 2.5 * 2.5; }
+assert (half === 15.625);
+
+// logical operations
+assert (!true === false);
+assert (!0 === true);
+assert (!"" === true);
+assert (!"0" === false);
+assert (!!NaN === false);
+
+// unreachable branches
+var count = 0;
+
+if (false)
+{
+  assert (false);
+}
+
+if (0)
+{
+  assert (false);
+}
+else
+{
+  count++;
+}
+
+if ("non-empty")
+{
+  count++;
+}
+else
+{
+  assert (false);
+}
+
+if (!1)
+{
+  var f = function () { assert (false); };
+  f ();
+}
+
+for (var i = 0; i < 3; i++)
+{
+  if (false)
+  {
+    break;
+  }
+
+  if (0)
+  {
+    continue;
+  }
+
+  count++;
+}
+
+outer: for (var j = 0; j < 2; j++)
+{
+  while (true)
+  {
+    if (1)
+    {
+      continue outer;
+    }
+    else
+    {
+      break outer;
+    }
+  }
+}
+
+assert (j === 2);
+assert (count === 5);
+
+function unreachable_with_return ()
+{
+  if (false)
+  {
+    return 1;
+  }
+
+  return 2;
+}
+
+assert (unreachable_with_return () === 2);
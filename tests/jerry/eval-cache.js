@@ -0,0 +1,87 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Repeated evaluation of the same code (the code's byte-code is taken from cache of compiled eval code)
+var sum = 0;
+for (var i = 0; i < 100; i++)
+{
+  sum += eval ("var q = i * 2; q + 1");
+}
+assert (sum === 100 * 99 + 100);
+
+// Strictness of the caller is considered
+function strict_eval ()
+{
+  "use strict";
+  eval ("var v = 1;");
+  return eval ("this");
+}
+
+function non_strict_eval ()
+{
+  eval ("var v = 1;");
+  return typeof v;
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (strict_eval () === undefined);
+  assert (non_strict_eval () === "number");
+}
+
+// Direct and indirect calls
+var x = "global";
+function direct_and_indirect ()
+{
+  var x = "local";
+  var indirect_eval = eval;
+  return eval ("x") + " " + indirect_eval ("x");
+}
+assert (direct_and_indirect () === "local global");
+assert (direct_and_indirect () === "local global");
+
+// Errors are reported upon each evaluation
+for (var i = 0; i < 2; i++)
+{
+  try
+  {
+    eval ("var =");
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+// Function constructor's arguments are not merged
+var f1 = Function ("ab", "c", "return ab + c;");
+var f2 = Function ("a", "bc", "return a - bc;");
+assert (f1 (5, 3) === 8);
+assert (f2 (5, 3) === 2);
+
+for (var i = 0; i < 20; i++)
+{
+  var f = new Function ("x", "return x * " + (i % 4) + ";");
+  assert (f (i) === i * (i % 4));
+}
+
+// More code strings, than the cache can hold
+for (var i = 0; i < 3; i++)
+{
+  for (var j = 0; j < 20; j++)
+  {
+    assert (eval (j + " + 1") === j + 1);
+  }
+}
@@ -0,0 +1,83 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function f (n)
+{
+  if (n > 0)
+  {
+    return f (n - 1);
+  }
+
+  return 0;
+}
+
+function check_range_error (func)
+{
+  try
+  {
+    func ();
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof RangeError);
+  }
+}
+
+assert (f (200) === 0);
+
+check_range_error (function () { return f (1500); });
+check_range_error (function () { return f (100000); });
+
+/* the depth of calls is restored after the error */
+assert (f (200) === 0);
+
+var obj = {
+  m: function (a, n)
+  {
+    return (n > 0) ? this.m (this, n - 1) : 0;
+  }
+};
+
+check_range_error (function () { return obj.m (obj, 1500); });
+assert (obj.m (obj, 200) === 0);
+
+/* calls through built-in routines are counted as well */
+function g (n)
+{
+  return (n > 0) ? [n].map (function () { return g (n - 1); })[0] : 0;
+}
+
+check_range_error (function () { return g (1500); });
+check_range_error (function () { return new function h () { new h (); }; });
+
+/* the error can be caught at any depth */
+var depth = 0;
+
+function count_depth ()
+{
+  depth++;
+
+  try
+  {
+    count_depth ();
+  }
+  catch (e)
+  {
+    assert (e instanceof RangeError);
+  }
+}
+
+count_depth ();
+assert (depth > 200);
@@ -0,0 +1,67 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Runs of identifiers' characters, whitespace, string and comment characters,
+// that are longer than and cross boundaries of 16-byte blocks
+var a_very_long_identifier_name_with_$dollar_and_DIGITS_0123456789 = 1;
+var a_very_long_identifier_name_with_$dollar_and_DIGITS_012345678 = 2;
+assert (a_very_long_identifier_name_with_$dollar_and_DIGITS_0123456789 === 1);
+assert (a_very_long_identifier_name_with_$dollar_and_DIGITS_012345678 === 2);
+
+var abcdefghijklmnopqrstuvwxyz = 3;
+assert (abcdefghijklmnopqrstuvwxyz === 3);
+var abcdefghijklmnopqrstuvwxyz_ = 4;
+assert (abcdefghijklmnopqrstuvwxyz_ === 4);
+
+var s1 = "a string, that is longer than sixteen characters, and contains 'quotes' of other kind";
+assert (s1.length === 85);
+var s2 = 'a string, that is longer than sixteen characters, and contains "quotes" of other kind';
+assert (s2.length === 85);
+var s3 = "0123456789abcde\"0123456789abcdef\\0123456789abcdef\x41";
+assert (s3 === '0123456789abcde"0123456789abcdef\\0123456789abcdefA');
+assert (s3.length === 50);
+var s4 = "line \
+continuation";
+assert (s4 === "line continuation");
+assert ("" === '');
+
+var x =                                                                       5		 		 	;
+assert (x === 5);
+
+/* a multi-line comment, that is longer than sixteen characters, with a '*' and a '/' inside
+ * that spans several lines ***/
+assert (x /* a short one */ === 5);
+// a single-line comment, that is longer than sixteen characters /* */
+assert (x === 5); // ends at end of line
+
+// Keywords, literals and future reserved words
+var o = { if: 1, while: 2, instanceof: 3, typeof: 4, var: 5, do: 6 };
+assert (o.if + o.while + o.instanceof + o.typeof + o.var + o.do === 21);
+assert (true !== false && null === null && typeof null === "object");
+
+var implements = 7, package = 8, yield = 9;
+assert (implements + package + yield === 24);
+
+try
+{
+  eval ("'use strict'; var implements = 1;");
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof SyntaxError);
+}
+
+var iff = 10, While = 11, nulls = 12, truee = 13;
+assert (iff + While + nulls + truee === 46);
@@ -0,0 +1,74 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function list (n, gen, separator)
+{
+  var str = gen (0);
+  for (var i = 1; i < n; i++)
+  {
+    str += separator + gen (i);
+  }
+  return str;
+}
+
+function repeat (str, n)
+{
+  var ret = '';
+  for (; n > 0; n >>= 1, str += str)
+  {
+    if (n & 1)
+    {
+      ret += str;
+    }
+  }
+  return ret;
+}
+
+function index (i)
+{
+  return i;
+}
+
+// array and object literals with more than 255 elements / properties
+var arr = eval ('[' + list (300, index, ', ') + ']');
+assert (arr.length === 300);
+assert (arr[299] === 299);
+
+var obj = eval ('({' + list (300, function (i) { return 'p' + i + ': ' + i; }, ', ') + '})');
+assert (obj.p0 === 0);
+assert (obj.p299 === 299);
+
+// call with more than 255 arguments
+function count_args ()
+{
+  return arguments.length + arguments[arguments.length - 1];
+}
+assert (eval ('count_args (' + list (300, index, ', ') + ')') === 599);
+
+// more than 128 literals in a single block of byte-code
+var sum = eval ('var v = 0; ' + list (200, function (i) { return 'v += ' + (i + 0.5); }, '; ') + '; v');
+assert (sum === 20000);
+
+// expression, requiring more than 250 registers
+var expr = repeat ('(1 + ', 300) + '0' + repeat (')', 300);
+assert (eval (expr) === 300);
+
+// expression, requiring more than 250 registers, which operands are not constant (so it is not folded)
+var one = 1;
+expr = repeat ('(one + ', 300) + 'one' + repeat (')', 300);
+assert (eval (expr) === 301);
+
+// chain of logical checks, some of which jump over 0x..fb - 0x..fd instructions
+var x = 1;
+assert (eval ('x' + repeat (' && x', 399)) === 1);
@@ -0,0 +1,315 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Multi-threaded stress test
+ *
+ * Runs the specified scripts concurrently in worker threads (by default, one thread per online CPU),
+ * each script - in a new engine context, created in memory area of the worker.
+ *
+ * Usage:
+ *   stress-test-threads [--threads N] [--iterations N] script1.js [script2.js ...]
+ *
+ * Returns zero if all runs of all the scripts have completed successfully.
+ */
+
+#include "jerry.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * Size of memory area for an engine context of a worker
+ */
+#define STRESS_CTX_AREA_SIZE (320 * 1024)
+
+/**
+ * Maximum number of worker threads
+ */
+#define STRESS_MAX_THREADS (256)
+
+/**
+ * A script to run
+ */
+typedef struct
+{
+  const char *file_name_p; /**< name of the script's file */
+  jerry_api_char_t *source_p; /**< source code */
+  size_t source_size; /**< size of the source code */
+} stress_script_t;
+
+static stress_script_t *stress_scripts_p;
+static uint32_t stress_scripts_number;
+static uint32_t stress_iterations = 1;
+
+/**
+ * Index of the next job (script run) to be taken by a worker
+ */
+static uint32_t stress_next_job;
+
+/**
+ * Number of failed script runs
+ */
+static uint32_t stress_failed_jobs;
+
+/**
+ * Lock for failure reports
+ */
+static pthread_mutex_t stress_report_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Flag, indicating that an assertion failed in script, that is run by the current thread
+ */
+static __thread bool stress_is_assertion_failed;
+
+/**
+ * Read the whole file into a newly allocated buffer
+ *
+ * @return true - if the file was read successfully,
+ *         false - otherwise.
+ */
+static bool
+stress_read_file (stress_script_t *script_p) /**< script descriptor */
+{
+  FILE *file_p = fopen (script_p->file_name_p, "r");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  bool is_ok = (fseek (file_p, 0, SEEK_END) == 0);
+  long file_size = is_ok ? ftell (file_p) : -1;
+
+  if (file_size < 0 || fseek (file_p, 0, SEEK_SET) != 0)
+  {
+    fclose (file_p);
+    return false;
+  }
+
+  script_p->source_size = (size_t) file_size;
+  script_p->source_p = (jerry_api_char_t *) malloc (script_p->source_size + 1);
+
+  is_ok = (script_p->source_p != NULL
+           && fread (script_p->source_p, 1, script_p->source_size, file_p) == script_p->source_size);
+
+  fclose (file_p);
+
+  return is_ok;
+} /* stress_read_file */
+
+/**
+ * The 'assert' implementation for the scripts
+ *
+ * Unlike the standalone engine, the handler can't exit the process upon failed assertion,
+ * so it just marks the run of the current thread as failed.
+ *
+ * @return true
+ */
+static bool
+stress_assert_handler (const jerry_api_object_t *function_obj_p, /**< function object */
+                       const jerry_api_value_t *this_p, /**< this arg */
+                       jerry_api_value_t *ret_val_p, /**< return argument */
+                       const jerry_api_value_t args_p[], /**< function arguments */
+                       const jerry_api_length_t args_cnt) /**< number of function arguments */
+{
+  (void) function_obj_p;
+  (void) this_p;
+  (void) ret_val_p;
+
+  if (args_cnt > 0
+      && args_p[0].type == JERRY_API_DATA_TYPE_BOOLEAN
+      && args_p[0].v_bool != true)
+  {
+    stress_is_assertion_failed = true;
+  }
+
+  return true;
+} /* stress_assert_handler */
+
+/**
+ * Run the script in the active context
+ *
+ * @return true - if the script was executed successfully,
+ *         false - otherwise.
+ */
+static bool
+stress_run_script (const stress_script_t *script_p) /**< script descriptor */
+{
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  jerry_api_object_t *assert_func_p = jerry_api_create_external_function (stress_assert_handler);
+  jerry_api_value_t assert_value;
+  assert_value.type = JERRY_API_DATA_TYPE_OBJECT;
+  assert_value.v_object = assert_func_p;
+
+  bool is_ok = jerry_api_set_object_field_value (global_obj_p, (const jerry_api_char_t *) "assert", &assert_value);
+
+  jerry_api_release_value (&assert_value);
+  jerry_api_release_object (global_obj_p);
+
+  stress_is_assertion_failed = false;
+
+  is_ok = (is_ok
+           && jerry_parse (script_p->source_p, script_p->source_size)
+           && jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  return (is_ok && !stress_is_assertion_failed);
+} /* stress_run_script */
+
+/**
+ * Worker thread's routine
+ *
+ * Takes jobs until all of them are done and runs each of them in a new engine context.
+ *
+ * @return NULL
+ */
+static void *
+stress_worker (void *arg_p) /**< unused */
+{
+  (void) arg_p;
+
+  void *area_p = malloc (STRESS_CTX_AREA_SIZE);
+
+  if (area_p == NULL)
+  {
+    __sync_fetch_and_add (&stress_failed_jobs, 1);
+    return NULL;
+  }
+
+  const uint32_t jobs_number = stress_scripts_number * stress_iterations;
+
+  while (true)
+  {
+    uint32_t job = __sync_fetch_and_add (&stress_next_job, 1);
+
+    if (job >= jobs_number)
+    {
+      break;
+    }
+
+    const stress_script_t *script_p = &stress_scripts_p[job % stress_scripts_number];
+
+    jerry_ctx_t *ctx_p = jerry_new_ctx (JERRY_FLAG_EMPTY, area_p, STRESS_CTX_AREA_SIZE);
+
+    bool is_ok = (ctx_p != NULL);
+
+    if (is_ok)
+    {
+      jerry_push_ctx (ctx_p);
+      is_ok = stress_run_script (script_p);
+      jerry_pop_ctx ();
+
+      jerry_cleanup_ctx (ctx_p);
+    }
+
+    if (!is_ok)
+    {
+      __sync_fetch_and_add (&stress_failed_jobs, 1);
+
+      pthread_mutex_lock (&stress_report_mutex);
+      printf ("FAIL: %s\n", script_p->file_name_p);
+      pthread_mutex_unlock (&stress_report_mutex);
+    }
+  }
+
+  free (area_p);
+
+  return NULL;
+} /* stress_worker */
+
+int
+main (int argc,
+      char **argv)
+{
+  long threads_number = sysconf (_SC_NPROCESSORS_ONLN);
+
+  stress_scripts_p = (stress_script_t *) calloc ((size_t) argc, sizeof (stress_script_t));
+
+  if (stress_scripts_p == NULL)
+  {
+    return 1;
+  }
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp ("--threads", argv[i]) && i + 1 < argc)
+    {
+      threads_number = atol (argv[++i]);
+    }
+    else if (!strcmp ("--iterations", argv[i]) && i + 1 < argc)
+    {
+      stress_iterations = (uint32_t) atol (argv[++i]);
+    }
+    else
+    {
+      stress_script_t *script_p = &stress_scripts_p[stress_scripts_number++];
+      script_p->file_name_p = argv[i];
+
+      if (!stress_read_file (script_p))
+      {
+        printf ("Failed to read '%s'\n", argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  if (stress_scripts_number == 0 || stress_iterations == 0)
+  {
+    printf ("Usage: %s [--threads N] [--iterations N] script1.js [script2.js ...]\n", argv[0]);
+    return 1;
+  }
+
+  if (threads_number < 1)
+  {
+    threads_number = 1;
+  }
+  else if (threads_number > STRESS_MAX_THREADS)
+  {
+    threads_number = STRESS_MAX_THREADS;
+  }
+
+  pthread_t threads[STRESS_MAX_THREADS];
+
+  for (long i = 0; i < threads_number; i++)
+  {
+    if (pthread_create (&threads[i], NULL, stress_worker, NULL) != 0)
+    {
+      printf ("Failed to create worker thread\n");
+      return 1;
+    }
+  }
+
+  for (long i = 0; i < threads_number; i++)
+  {
+    pthread_join (threads[i], NULL);
+  }
+
+  for (uint32_t i = 0; i < stress_scripts_number; i++)
+  {
+    free (stress_scripts_p[i].source_p);
+  }
+  free (stress_scripts_p);
+
+  printf ("Threads: %ld, scripts: %u, runs: %u, failed: %u\n",
+          threads_number,
+          stress_scripts_number,
+          stress_scripts_number * stress_iterations,
+          stress_failed_jobs);
+
+  return (stress_failed_jobs == 0) ? 0 : 1;
+} /* main */
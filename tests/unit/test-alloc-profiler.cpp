@@ -0,0 +1,290 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+#include <signal.h>
+
+/**
+ * The test is built with the allocation-site profiler (see also: alloc_prof build modifier)
+ */
+#ifndef MEM_ALLOC_PROFILER
+# error "!MEM_ALLOC_PROFILER in the allocation profiler's unit test"
+#endif /* !MEM_ALLOC_PROFILER */
+
+/**
+ * File, the profiler's reports are redirected to
+ */
+#define TEST_REPORT_FILE_PATH "/tmp/jerry-unit-test-alloc-profiler.txt"
+
+/**
+ * Maximum number of sites, requested in the dump (all sites are listed)
+ */
+#define TEST_MAX_SITES_NUMBER (1024u)
+
+/**
+ * Number of objects, kept reachable by the script
+ */
+#define TEST_HELD_OBJECTS_NUMBER (64u)
+
+/**
+ * Script, keeping the objects, allocated at line 4 of a function, reachable
+ */
+static const char *test_hold_source_p = ("function hold () {\n"
+                                         "  var a = [];\n"
+                                         "  for (var i = 0; i < 64; i++) {\n"
+                                         "    a.push ({ x: i });\n"
+                                         "  }\n"
+                                         "  return a;\n"
+                                         "}\n"
+                                         "var held = hold ();\n");
+
+/**
+ * Script, running out of memory with the objects, allocated at line 3 of a function
+ */
+static const char *test_grow_source_p = ("function grow () {\n"
+                                         "  var a = [];\n"
+                                         "  while (true) { a.push ({ x: a.length }); }\n"
+                                         "}\n"
+                                         "grow ();\n");
+
+/**
+ * Buffer for contents of a report
+ */
+static char test_report_buffer[64 * 1024];
+
+/**
+ * Read the report file into test_report_buffer
+ *
+ * @return true - if the file was read,
+ *         false - otherwise.
+ */
+static bool
+test_read_report (void)
+{
+  FILE *file_p = fopen (TEST_REPORT_FILE_PATH, "r");
+
+  if (file_p == NULL)
+  {
+    return false;
+  }
+
+  size_t size = fread (test_report_buffer, 1, sizeof (test_report_buffer) - 1, file_p);
+  fclose (file_p);
+
+  test_report_buffer[size] = '\0';
+
+  return (size != 0);
+} /* test_read_report */
+
+/**
+ * Find a substring in a zero-terminated string
+ *
+ * @return pointer to the first occurrence of the substring,
+ *         NULL - if there is no occurrence.
+ */
+static const char *
+test_find (const char *str_p, /**< string */
+           const char *substr_p) /**< substring */
+{
+  const size_t substr_size = strlen (substr_p);
+
+  for (; *str_p != '\0'; str_p++)
+  {
+    if (strncmp (str_p, substr_p, substr_size) == 0)
+    {
+      return str_p;
+    }
+  }
+
+  return NULL;
+} /* test_find */
+
+/**
+ * Parse a decimal number, skipping leading spaces
+ *
+ * @return the number
+ */
+static size_t
+test_parse_number (const char **str_p_p) /**< in: start of the number,
+                                          *   out: position after the number */
+{
+  const char *str_p = *str_p_p;
+  size_t num = 0;
+
+  while (*str_p == ' ')
+  {
+    str_p++;
+  }
+
+  while (*str_p >= '0' && *str_p <= '9')
+  {
+    num = num * 10 + (size_t) (*str_p++ - '0');
+  }
+
+  *str_p_p = str_p;
+
+  return num;
+} /* test_parse_number */
+
+/**
+ * Sum counters of the report's lines for the sites, that contain the specified description
+ */
+static void
+test_sum_sites (const char *site_descr_p, /**< description (function:line) */
+                size_t *out_live_bytes_p, /**< out: live bytes at the sites */
+                size_t *out_live_blocks_p) /**< out: live blocks at the sites */
+{
+  *out_live_bytes_p = 0;
+  *out_live_blocks_p = 0;
+
+  const char *line_p = test_report_buffer;
+
+  while (*line_p != '\0')
+  {
+    const char *line_end_p = line_p;
+
+    while (*line_end_p != '\0' && *line_end_p != '\n')
+    {
+      line_end_p++;
+    }
+
+    const char *descr_p = test_find (line_p, site_descr_p);
+
+    if (descr_p != NULL && descr_p < line_end_p)
+    {
+      const char *field_p = line_p;
+
+      size_t live_bytes = test_parse_number (&field_p);
+      size_t peak_bytes = test_parse_number (&field_p);
+      size_t live_blocks = test_parse_number (&field_p);
+      size_t allocs_number = test_parse_number (&field_p);
+
+      JERRY_ASSERT (live_bytes <= peak_bytes && live_blocks <= allocs_number);
+
+      *out_live_bytes_p += live_bytes;
+      *out_live_blocks_p += live_blocks;
+    }
+
+    line_p = (*line_end_p == '\0') ? line_end_p : line_end_p + 1;
+  }
+} /* test_sum_sites */
+
+/**
+ * Check report, printed before termination of the engine upon out-of-memory
+ *
+ * @return true - if the report lists the sites, holding the memory, before the fatal error's message,
+ *         false - otherwise.
+ */
+static bool
+test_check_out_of_memory_report (void)
+{
+  if (!test_read_report ())
+  {
+    return false;
+  }
+
+  const char *header_p = test_find (test_report_buffer, "Allocation sites (top 20 by live bytes");
+  const char *site_p = test_find (test_report_buffer, " grow:3 @");
+  const char *fatal_p = test_find (test_report_buffer, "ERR_OUT_OF_MEMORY");
+
+  return (header_p != NULL
+          && site_p != NULL
+          && fatal_p != NULL
+          && header_p < site_p
+          && site_p < fatal_p);
+} /* test_check_out_of_memory_report */
+
+/**
+ * Handler of SIGABRT, raised upon out-of-memory (see also: JERRY_FLAG_ABORT_ON_FAIL)
+ *
+ * Note:
+ *      the engine can't continue after the fatal error, so the test is completed in the handler
+ *      (assertions are not used there, as they would raise SIGABRT again)
+ */
+static void
+test_out_of_memory_handler (int signum) /**< signal number */
+{
+  (void) signum;
+
+  /* abort closed the standard streams, so they are reopened for exit, that closes them again */
+  stdin = fopen ("/dev/null", "r");
+  stdout = fopen ("/dev/null", "w");
+  stderr = fopen ("/dev/null", "w");
+
+  exit (test_check_out_of_memory_report () ? 0 : 1);
+} /* test_out_of_memory_handler */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  FILE *stdout_p = stdout;
+
+  /* profiling is disabled, if it is not requested */
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (!jerry_alloc_profiler_dump (TEST_MAX_SITES_NUMBER));
+  jerry_cleanup ();
+
+  /* live bytes are attributed to the JavaScript instruction, executed upon the allocation */
+  jerry_init (JERRY_FLAG_ALLOC_PROFILE);
+
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_hold_source_p, strlen (test_hold_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  stdout = fopen (TEST_REPORT_FILE_PATH, "w");
+  JERRY_ASSERT (stdout != NULL);
+
+  bool is_dumped = jerry_alloc_profiler_dump (TEST_MAX_SITES_NUMBER);
+
+  fclose (stdout);
+  stdout = stdout_p;
+
+  JERRY_ASSERT (is_dumped);
+  JERRY_ASSERT (test_read_report ());
+
+  size_t live_bytes, live_blocks;
+
+  test_sum_sites (" hold:4 @", &live_bytes, &live_blocks);
+  JERRY_ASSERT (live_blocks >= TEST_HELD_OBJECTS_NUMBER);
+  JERRY_ASSERT (live_bytes >= live_blocks * sizeof (uint64_t));
+
+  /* sites of the script's other lines don't hold the objects */
+  test_sum_sites (" (global):", &live_bytes, &live_blocks);
+  JERRY_ASSERT (live_blocks < TEST_HELD_OBJECTS_NUMBER);
+
+  jerry_cleanup ();
+
+  /* the sites, holding most of the memory, are reported before termination upon out-of-memory */
+  JERRY_ASSERT (signal (SIGABRT, test_out_of_memory_handler) != SIG_ERR);
+
+  jerry_init (JERRY_FLAG_ALLOC_PROFILE | JERRY_FLAG_ABORT_ON_FAIL);
+
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_grow_source_p, strlen (test_grow_source_p)));
+
+  stdout = fopen (TEST_REPORT_FILE_PATH, "w");
+  JERRY_ASSERT (stdout != NULL);
+
+  jerry_run ();
+
+  /* the script is expected to run out of memory, so the run should not complete */
+  stdout = stdout_p;
+  signal (SIGABRT, SIG_DFL);
+
+  return 1;
+} /* main */
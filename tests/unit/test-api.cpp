@@ -54,6 +54,12 @@ const char *test_source = (
                            "function throw_reference_error() { "
                            " throw new ReferenceError ();"
                            "} "
+                           "function call_external_fast () { "
+                           "  return this.external_fast (7.9, '2.5', 'str'); "
+                           "} "
+                           "function sum_fields (o) { "
+                           "  return o.x + o.y; "
+                           "} "
                            );
 
 bool test_api_is_free_callback_was_called = false;
@@ -152,6 +158,67 @@ handler_throw_test (const jerry_api_object_t *function_obj_p,
   return false;
 }
 
+/**
+ * Signature of fast external function handler: (int32, float64, raw)
+ */
+static const jerry_api_fast_arg_type_t handler_fast_arg_types[] =
+{
+  JERRY_API_FAST_ARG_INT32,
+  JERRY_API_FAST_ARG_FLOAT64
+};
+
+static const jerry_api_fast_signature_t handler_fast_signature =
+{
+  handler_fast_arg_types,
+  sizeof (handler_fast_arg_types) / sizeof (handler_fast_arg_types[0])
+};
+
+/**
+ * Signature with an unknown argument type
+ */
+static const jerry_api_fast_arg_type_t handler_fast_invalid_arg_types[] =
+{
+  JERRY_API_FAST_ARG_INT32,
+  (jerry_api_fast_arg_type_t) (JERRY_API_FAST_ARG_FLOAT64 + 1)
+};
+
+static const jerry_api_fast_signature_t handler_fast_invalid_signature =
+{
+  handler_fast_invalid_arg_types,
+  sizeof (handler_fast_invalid_arg_types) / sizeof (handler_fast_invalid_arg_types[0])
+};
+
+static bool
+handler_fast (const jerry_api_object_t *function_obj_p,
+              const jerry_api_raw_value_t this_val,
+              jerry_api_raw_value_t *ret_val_p,
+              const jerry_api_fast_arg_t args_p[],
+              const jerry_api_length_t args_cnt)
+{
+  char buffer[32];
+  ssize_t sz;
+
+  printf ("ok fast %p %p %d %p\n", function_obj_p, args_p, args_cnt, ret_val_p);
+
+  JERRY_ASSERT (jerry_api_raw_is_object (this_val));
+  JERRY_ASSERT (jerry_api_raw_is_undefined (*ret_val_p));
+
+  JERRY_ASSERT (args_cnt == 3);
+  JERRY_ASSERT (args_p[0].v_int32 == 7);
+  JERRY_ASSERT (args_p[1].v_float64 == 2.5);
+
+  JERRY_ASSERT (jerry_api_raw_is_string (args_p[2].v_raw));
+  sz = jerry_api_raw_get_string_bytes (args_p[2].v_raw, NULL, 0);
+  JERRY_ASSERT (sz == -3);
+  sz = jerry_api_raw_get_string_bytes (args_p[2].v_raw, (jerry_api_char_t *) buffer, -sz);
+  JERRY_ASSERT (sz == 3);
+  JERRY_ASSERT (!strncmp (buffer, "str", 3));
+
+  *ret_val_p = jerry_api_raw_make_number (args_p[0].v_int32 + args_p[1].v_float64);
+
+  return true;
+} /* handler_fast */
+
 static void
 handler_construct_freecb (uintptr_t native_p)
 {
@@ -384,6 +451,37 @@ main (void)
   jerry_api_release_value (&res);
   JERRY_ASSERT (!strcmp (buffer, "string from handler"));
 
+  // Fast native handler with invalid signature is rejected
+  external_func_p = jerry_api_create_external_function_fast (handler_fast, &handler_fast_invalid_signature);
+  JERRY_ASSERT (external_func_p == NULL);
+
+  // Create fast native handler bound function object and set it to 'external_fast' variable
+  external_func_p = jerry_api_create_external_function_fast (handler_fast, &handler_fast_signature);
+  JERRY_ASSERT (external_func_p != NULL
+                && jerry_api_is_function (external_func_p));
+
+  test_api_init_api_value_object (&val_external, external_func_p);
+  is_ok = jerry_api_set_object_field_value (global_obj_p,
+                                            (jerry_api_char_t *) "external_fast",
+                                            &val_external);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&val_external);
+  jerry_api_release_object (external_func_p);
+
+  // Call 'call_external_fast' function that should call fast external function created above
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "call_external_fast", &val_t);
+  JERRY_ASSERT (is_ok
+                && val_t.type == JERRY_API_DATA_TYPE_OBJECT);
+  is_ok = jerry_api_call_function (val_t.v_object,
+                                   global_obj_p,
+                                   &res,
+                                   NULL, 0);
+  jerry_api_release_value (&val_t);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == 9.5);
+  jerry_api_release_value (&res);
+
   // Create native handler bound function object and set it to 'external_construct' variable
   external_construct_p = jerry_api_create_external_function (handler_construct);
   JERRY_ASSERT (external_construct_p != NULL
@@ -532,6 +630,53 @@ main (void)
 
   jerry_api_release_value (&val_t);
 
+  // Create object from several fields, using interned name handles, and pass it to 'sum_fields'
+  jerry_api_string_t *field_names[3];
+  field_names[0] = jerry_api_create_interned_string_sz ((jerry_api_char_t *) "x", 1);
+  field_names[1] = jerry_api_create_interned_string_sz ((jerry_api_char_t *) "y", 1);
+  field_names[2] = jerry_api_create_interned_string_sz ((jerry_api_char_t *) "t", 1);
+
+  jerry_api_object_field_t fields[3];
+  fields[0].name_p = field_names[0];
+  test_api_init_api_value_float64 (&fields[0].value, 1.0);
+  fields[1].name_p = field_names[1];
+  test_api_init_api_value_float64 (&fields[1].value, 2.5);
+  fields[2].name_p = field_names[0];
+  test_api_init_api_value_float64 (&fields[2].value, 3.0);
+
+  jerry_api_object_t *fields_obj_p = jerry_api_create_object_with_fields (fields, 3);
+  JERRY_ASSERT (fields_obj_p != NULL);
+
+  is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "sum_fields", &val_t);
+  JERRY_ASSERT (is_ok
+                && val_t.type == JERRY_API_DATA_TYPE_OBJECT);
+  test_api_init_api_value_object (&args[0], fields_obj_p);
+  is_ok = jerry_api_call_function (val_t.v_object,
+                                   NULL,
+                                   &res,
+                                   args, 1);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == 5.5);
+  jerry_api_release_value (&res);
+  jerry_api_release_value (&args[0]);
+  jerry_api_release_value (&val_t);
+  jerry_api_release_object (fields_obj_p);
+
+  // Read several fields of the global object at once
+  jerry_api_value_t field_values[3];
+  is_ok = jerry_api_get_object_field_values (global_obj_p, field_names, field_values, 3);
+  JERRY_ASSERT (is_ok);
+  JERRY_ASSERT (field_values[0].type == JERRY_API_DATA_TYPE_UNDEFINED);
+  JERRY_ASSERT (field_values[1].type == JERRY_API_DATA_TYPE_UNDEFINED);
+  JERRY_ASSERT (field_values[2].type == JERRY_API_DATA_TYPE_STRING);
+  jerry_api_release_value (&field_values[2]);
+
+  for (int i = 0; i < 3; i++)
+  {
+    jerry_api_release_string (field_names[i]);
+  }
+
   // cleanup.
   jerry_api_release_object (global_obj_p);
 
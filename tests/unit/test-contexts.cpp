@@ -0,0 +1,108 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Size of memory area for a run context
+ */
+#define TEST_CTX_AREA_SIZE (128 * 1024)
+
+static uint8_t test_ctx_area_1[TEST_CTX_AREA_SIZE];
+static uint8_t test_ctx_area_2[TEST_CTX_AREA_SIZE];
+
+/**
+ * Evaluate specified source in the active context and check that result is the specified number
+ */
+static void
+test_eval_number (const char *source_p, /**< source code */
+                  double expected_value) /**< expected result */
+{
+  jerry_api_value_t res;
+
+  jerry_completion_code_t status = jerry_api_eval ((const jerry_api_char_t *) source_p,
+                                                   strlen (source_p),
+                                                   false,
+                                                   false,
+                                                   &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == expected_value);
+
+  jerry_api_release_value (&res);
+} /* test_eval_number */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  /* too small area */
+  JERRY_ASSERT (jerry_new_ctx (JERRY_FLAG_EMPTY, test_ctx_area_1, 16) == NULL);
+
+  jerry_ctx_t *ctx1_p = jerry_new_ctx (JERRY_FLAG_EMPTY, test_ctx_area_1, sizeof (test_ctx_area_1));
+  jerry_ctx_t *ctx2_p = jerry_new_ctx (JERRY_FLAG_EMPTY, test_ctx_area_2, sizeof (test_ctx_area_2));
+  JERRY_ASSERT (ctx1_p != NULL && ctx2_p != NULL);
+
+  const char *source_p = "var a = 1; var o = { v: 'default' };";
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) source_p, strlen (source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  jerry_push_ctx (ctx1_p);
+
+  source_p = "var a = 10; function f (x) { return a + x; }";
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) source_p, strlen (source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+  test_eval_number ("f (5)", 15.0);
+
+  /* nested context */
+  jerry_push_ctx (ctx2_p);
+
+  test_eval_number ("typeof f === 'undefined' ? a = 20 : -1", 20.0);
+  test_eval_number ("Math.max (a, 7)", 20.0);
+
+  jerry_pop_ctx ();
+
+  test_eval_number ("a++; f (0)", 11.0);
+
+  jerry_pop_ctx ();
+
+  test_eval_number ("o.v === 'default' ? a : -1", 1.0);
+
+  jerry_push_ctx (ctx2_p);
+  test_eval_number ("a", 20.0);
+  jerry_pop_ctx ();
+
+  jerry_cleanup_ctx (ctx1_p);
+  jerry_cleanup_ctx (ctx2_p);
+
+  /* area of cleaned up context can be reused */
+  ctx1_p = jerry_new_ctx (JERRY_FLAG_EMPTY, test_ctx_area_1, sizeof (test_ctx_area_1));
+  JERRY_ASSERT (ctx1_p != NULL);
+
+  jerry_push_ctx (ctx1_p);
+  test_eval_number ("typeof a === 'undefined' ? 0 : -1", 0.0);
+  jerry_pop_ctx ();
+
+  jerry_cleanup_ctx (ctx1_p);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
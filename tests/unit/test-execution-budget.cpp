@@ -0,0 +1,165 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Execution budget of each run
+ */
+#define TEST_EXECUTION_BUDGET (10000u)
+
+/**
+ * Script with an infinite loop
+ */
+static const char *test_loop_source_p = ("var i = 0;\n"
+                                         "while (true) { i++; }\n");
+
+/**
+ * Script with an infinite loop, that catches all errors
+ */
+static const char *test_catch_source_p = ("while (true) {\n"
+                                          "  try { for (;;) {} } catch (e) {}\n"
+                                          "}\n");
+
+/**
+ * Script with an infinite recursion, that catches all errors (including errors of exceeded depth of calls)
+ */
+static const char *test_recursion_source_p = ("function f () { try { f (); } catch (e) {} f (); }\n"
+                                              "f ();\n");
+
+/**
+ * Script, that calls the external function from a loop
+ */
+static const char *test_interrupt_source_p = ("for (var i = 0; i < 100; i++) { interrupt (); }\n");
+
+/**
+ * Script, that completes within the budget
+ */
+static const char *test_finite_source_p = ("var s = 0;\n"
+                                           "for (var i = 0; i < 100; i++) { s += i; }\n"
+                                           "s;\n");
+
+/**
+ * Size of memory area for a context, that is not active during the runs
+ */
+#define TEST_CTX_AREA_SIZE (128 * 1024)
+
+static uint8_t test_ctx_area[TEST_CTX_AREA_SIZE];
+
+/**
+ * Context, interrupted by the external function
+ */
+static jerry_ctx_t *test_interrupted_ctx_p = NULL;
+
+/**
+ * External function, requesting interruption of the run in test_interrupted_ctx_p
+ * (as a timer's signal handler would do)
+ */
+static bool
+test_interrupt_handler (const jerry_api_object_t *function_obj_p __attr_unused___, /**< function object */
+                        const jerry_api_value_t *this_p __attr_unused___, /**< this arg */
+                        jerry_api_value_t *ret_val_p __attr_unused___, /**< return argument */
+                        const jerry_api_value_t args_p[] __attr_unused___, /**< function arguments */
+                        const jerry_api_length_t args_cnt __attr_unused___) /**< function arguments number */
+{
+  jerry_request_interrupt (test_interrupted_ctx_p);
+
+  return true;
+} /* test_interrupt_handler */
+
+/**
+ * Run the script with jerry_api_eval
+ *
+ * @return completion code
+ */
+static jerry_completion_code_t
+test_eval (const char *source_p) /**< script */
+{
+  jerry_api_value_t value;
+
+  jerry_completion_code_t ret_code = jerry_api_eval ((const jerry_api_char_t *) source_p,
+                                                     strlen (source_p),
+                                                     false,
+                                                     false,
+                                                     &value);
+  jerry_api_release_value (&value);
+
+  return ret_code;
+} /* test_eval */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  jerry_set_execution_budget (TEST_EXECUTION_BUDGET);
+
+  /* an infinite loop is interrupted upon exhaustion of the budget */
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_loop_source_p, strlen (test_loop_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_INTERRUPTED);
+
+  /* the interruption can't be suppressed by catching the error */
+  JERRY_ASSERT (test_eval (test_catch_source_p) == JERRY_COMPLETION_CODE_INTERRUPTED);
+
+  JERRY_ASSERT (test_eval (test_recursion_source_p) == JERRY_COMPLETION_CODE_INTERRUPTED);
+
+  /* the budget is renewed for each run */
+  jerry_api_value_t value;
+
+  JERRY_ASSERT (jerry_api_eval ((const jerry_api_char_t *) test_finite_source_p,
+                                strlen (test_finite_source_p),
+                                false,
+                                false,
+                                &value) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (value.type == JERRY_API_DATA_TYPE_FLOAT64 && value.v_float64 == 4950.0);
+  jerry_api_release_value (&value);
+
+  /* without a budget, the run is interrupted upon request */
+  jerry_set_execution_budget (0);
+
+  jerry_api_object_t *global_obj_p = jerry_api_get_global ();
+  jerry_api_object_t *interrupt_func_p = jerry_api_create_external_function (test_interrupt_handler);
+  jerry_api_value_t interrupt_value;
+  interrupt_value.type = JERRY_API_DATA_TYPE_OBJECT;
+  interrupt_value.v_object = interrupt_func_p;
+
+  JERRY_ASSERT (jerry_api_set_object_field_value (global_obj_p,
+                                                  (const jerry_api_char_t *) "interrupt",
+                                                  &interrupt_value));
+  jerry_api_release_object (interrupt_func_p);
+  jerry_api_release_object (global_obj_p);
+
+  test_interrupted_ctx_p = jerry_get_active_ctx ();
+  JERRY_ASSERT (test_eval (test_interrupt_source_p) == JERRY_COMPLETION_CODE_INTERRUPTED);
+  JERRY_ASSERT (test_eval ("i;") == JERRY_COMPLETION_CODE_OK);
+
+  /* a request, addressed to another context, doesn't affect the run */
+  test_interrupted_ctx_p = jerry_new_ctx (JERRY_FLAG_EMPTY, test_ctx_area, sizeof (test_ctx_area));
+  JERRY_ASSERT (test_interrupted_ctx_p != NULL);
+  JERRY_ASSERT (test_eval (test_interrupt_source_p) == JERRY_COMPLETION_CODE_OK);
+  jerry_cleanup_ctx (test_interrupted_ctx_p);
+
+  /* a request, received before a run, doesn't affect the run */
+  jerry_request_interrupt (jerry_get_active_ctx ());
+  JERRY_ASSERT (test_eval (test_finite_source_p) == JERRY_COMPLETION_CODE_OK);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
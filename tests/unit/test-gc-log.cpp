@@ -0,0 +1,76 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Script, producing enough garbage to trigger collections
+ */
+static const char *test_source_p = ("var a = [];\n"
+                                    "for (var i = 0; i < 20000; i++) {\n"
+                                    "  a.push ({ x: i, s: 'str' + i });\n"
+                                    "  if (a.length > 100) { a = []; }\n"
+                                    "}\n");
+
+/**
+ * Maximum number of collections' descriptions, requested by the test
+ */
+#define TEST_MAX_EVENTS_NUMBER (64u)
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_gc_event_t events[TEST_MAX_EVENTS_NUMBER];
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  /* nothing was collected yet */
+  JERRY_ASSERT (jerry_get_gc_events (events, TEST_MAX_EVENTS_NUMBER) == 0);
+
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_source_p, strlen (test_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  uint32_t events_number = jerry_get_gc_events (events, TEST_MAX_EVENTS_NUMBER);
+
+  /* the log keeps a limited number of the most recent collections, ordered from the oldest to the newest one */
+  JERRY_ASSERT (events_number > 0 && events_number < TEST_MAX_EVENTS_NUMBER);
+
+  for (uint32_t i = 0; i < events_number; i++)
+  {
+    JERRY_ASSERT (events[i].cause == JERRY_GC_CAUSE_LOW_MEMORY);
+    JERRY_ASSERT (events[i].objects_after < events[i].objects_before);
+    JERRY_ASSERT (events[i].bytes_after < events[i].bytes_before);
+
+    if (i != 0)
+    {
+      JERRY_ASSERT (events[i].sequence_number == events[i - 1].sequence_number + 1);
+    }
+  }
+
+  /* if fewer descriptions are requested, the most recent ones are returned */
+  jerry_gc_event_t last_event;
+
+  JERRY_ASSERT (jerry_get_gc_events (&last_event, 1) == 1);
+  JERRY_ASSERT (last_event.sequence_number == events[events_number - 1].sequence_number);
+  JERRY_ASSERT (jerry_get_gc_events (events, 0) == 0);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
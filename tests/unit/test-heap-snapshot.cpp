@@ -0,0 +1,327 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * File, the snapshot is written to
+ */
+#define TEST_SNAPSHOT_FILE_PATH "/tmp/jerry-unit-test-heap-snapshot.json"
+
+/**
+ * File in a non-existent directory
+ */
+#define TEST_UNWRITABLE_FILE_PATH "/nonexistent-directory/heap-snapshot.json"
+
+/**
+ * Maximum number of nodes in the snapshot, checked by the test
+ */
+#define TEST_MAX_NODES_NUMBER (4096u)
+
+/**
+ * Maximum length of a chain of lexical environments, walked by the test
+ */
+#define TEST_MAX_SCOPE_DEPTH (8u)
+
+/**
+ * Script, building the graph: an object, referencing another object with a named property, and a closure
+ */
+static const char *test_source_p = ("var target = { tag: 'target' };\n"
+                                    "var holder = { child: target };\n"
+                                    "function make_counter () {\n"
+                                    "  var count = 0;\n"
+                                    "  return function counter () { return ++count; };\n"
+                                    "}\n"
+                                    "var closure = make_counter ();\n");
+
+/**
+ * Buffer for contents of the snapshot
+ */
+static char test_snapshot_buffer[256 * 1024];
+
+/**
+ * Identifiers of the snapshot's nodes
+ */
+static uint32_t test_node_ids[TEST_MAX_NODES_NUMBER];
+
+/**
+ * Find a substring in a range of the snapshot
+ *
+ * @return pointer to the first occurrence of the substring,
+ *         NULL - if there is no occurrence in the range.
+ */
+static const char *
+test_find (const char *begin_p, /**< start of the range */
+           const char *end_p, /**< end of the range */
+           const char *substr_p) /**< zero-terminated substring */
+{
+  const size_t substr_size = strlen (substr_p);
+
+  for (; begin_p + substr_size <= end_p; begin_p++)
+  {
+    if (strncmp (begin_p, substr_p, substr_size) == 0)
+    {
+      return begin_p;
+    }
+  }
+
+  return NULL;
+} /* test_find */
+
+/**
+ * Parse a decimal number
+ *
+ * @return the number
+ */
+static uint32_t
+test_parse_number (const char *str_p) /**< start of the number */
+{
+  uint32_t num = 0;
+
+  while (*str_p >= '0' && *str_p <= '9')
+  {
+    num = num * 10 + (uint32_t) (*str_p++ - '0');
+  }
+
+  return num;
+} /* test_parse_number */
+
+/**
+ * End of the snapshot's contents
+ *
+ * @return pointer after the last character
+ */
+static const char *
+test_snapshot_end (void)
+{
+  return test_snapshot_buffer + strlen (test_snapshot_buffer);
+} /* test_snapshot_end */
+
+/**
+ * Find description of a node
+ *
+ * @return pointer to start of the description (description ends at start of the next node)
+ */
+static const char *
+test_find_node (uint32_t id) /**< node's identifier */
+{
+  const char *id_p = test_snapshot_buffer;
+
+  while ((id_p = test_find (id_p, test_snapshot_end (), "{\"id\":")) != NULL)
+  {
+    if (test_parse_number (id_p + strlen ("{\"id\":")) == id)
+    {
+      return id_p;
+    }
+
+    id_p++;
+  }
+
+  JERRY_UNREACHABLE ();
+} /* test_find_node */
+
+/**
+ * End of a node's description
+ *
+ * @return pointer to start of the next node, or to end of the snapshot
+ */
+static const char *
+test_node_end (const char *node_p) /**< start of the node's description */
+{
+  const char *next_node_p = test_find (node_p + 1, test_snapshot_end (), "{\"id\":");
+
+  return (next_node_p != NULL) ? next_node_p : test_snapshot_end ();
+} /* test_node_end */
+
+/**
+ * Find an edge, referencing another node
+ *
+ * @return true - if the node contains the edge (the referenced node's identifier is returned in *out_to_p),
+ *         false - otherwise.
+ */
+static bool
+test_find_edge (uint32_t id, /**< node's identifier */
+                const char *name_p, /**< edge's name */
+                uint32_t *out_to_p) /**< out: identifier of the referenced node */
+{
+  const char *node_p = test_find_node (id);
+  const char *node_end_p = test_node_end (node_p);
+
+  const char *name_begin_p = node_p;
+
+  while ((name_begin_p = test_find (name_begin_p, node_end_p, "\"name\":\"")) != NULL)
+  {
+    name_begin_p += strlen ("\"name\":\"");
+
+    const size_t name_size = strlen (name_p);
+
+    if (strncmp (name_begin_p, name_p, name_size) == 0
+        && strncmp (name_begin_p + name_size, "\",\"to\":", strlen ("\",\"to\":")) == 0)
+    {
+      *out_to_p = test_parse_number (name_begin_p + name_size + strlen ("\",\"to\":"));
+      return true;
+    }
+  }
+
+  return false;
+} /* test_find_edge */
+
+/**
+ * Check whether a node's description contains the specified text
+ *
+ * @return true - if the text is in the node's description,
+ *         false - otherwise.
+ */
+static bool
+test_node_contains (uint32_t id, /**< node's identifier */
+                    const char *text_p) /**< the text */
+{
+  const char *node_p = test_find_node (id);
+
+  return (test_find (node_p, test_node_end (node_p), text_p) != NULL);
+} /* test_node_contains */
+
+/**
+ * Check that each edge references a node of the snapshot
+ */
+static void
+test_check_edges (void)
+{
+  uint32_t nodes_number = 0;
+  const char *pos_p = test_snapshot_buffer;
+
+  while ((pos_p = test_find (pos_p, test_snapshot_end (), "{\"id\":")) != NULL)
+  {
+    JERRY_ASSERT (nodes_number < TEST_MAX_NODES_NUMBER);
+
+    pos_p += strlen ("{\"id\":");
+    test_node_ids[nodes_number++] = test_parse_number (pos_p);
+  }
+
+  JERRY_ASSERT (nodes_number > 1 && test_node_ids[0] == 0);
+
+  uint32_t edges_number = 0;
+  pos_p = test_snapshot_buffer;
+
+  while ((pos_p = test_find (pos_p, test_snapshot_end (), "\"to\":")) != NULL)
+  {
+    pos_p += strlen ("\"to\":");
+
+    const uint32_t to = test_parse_number (pos_p);
+    bool is_found = false;
+
+    for (uint32_t i = 0; i < nodes_number && !is_found; i++)
+    {
+      is_found = (test_node_ids[i] == to);
+    }
+
+    JERRY_ASSERT (is_found);
+
+    edges_number++;
+  }
+
+  JERRY_ASSERT (edges_number >= nodes_number - 1);
+} /* test_check_edges */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_source_p, strlen (test_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  JERRY_ASSERT (jerry_api_dump_heap_snapshot (TEST_SNAPSHOT_FILE_PATH));
+
+  FILE *file_p = fopen (TEST_SNAPSHOT_FILE_PATH, "r");
+  JERRY_ASSERT (file_p != NULL);
+
+  size_t size = fread (test_snapshot_buffer, 1, sizeof (test_snapshot_buffer) - 1, file_p);
+  fclose (file_p);
+
+  JERRY_ASSERT (size != 0 && size < sizeof (test_snapshot_buffer) - 1);
+  test_snapshot_buffer[size] = '\0';
+
+  JERRY_ASSERT (strncmp (test_snapshot_buffer,
+                         "{\"format\":\"jerry-heap-snapshot\",\"version\":1,",
+                         strlen ("{\"format\":\"jerry-heap-snapshot\",\"version\":1,")) == 0);
+
+  /* no edge is dangling */
+  test_check_edges ();
+
+  /* global object -> holder -> target */
+  const char *holder_edge_p = test_find (test_snapshot_buffer, test_snapshot_end (), "\"name\":\"holder\",\"to\":");
+  JERRY_ASSERT (holder_edge_p != NULL);
+
+  const char *global_node_p = holder_edge_p;
+
+  while (strncmp (global_node_p, "{\"id\":", strlen ("{\"id\":")) != 0)
+  {
+    global_node_p--;
+  }
+
+  const uint32_t global_id = test_parse_number (global_node_p + strlen ("{\"id\":"));
+  uint32_t holder_id, target_id, to_id;
+
+  JERRY_ASSERT (test_find_edge (0, "(engine)", &to_id));
+  JERRY_ASSERT (test_find_edge (global_id, "holder", &holder_id));
+  JERRY_ASSERT (test_find_edge (global_id, "target", &target_id));
+  JERRY_ASSERT (test_node_contains (holder_id, "\"type\":\"object\",\"class\":\"Object\""));
+
+  JERRY_ASSERT (test_find_edge (holder_id, "child", &to_id) && to_id == target_id);
+  JERRY_ASSERT (test_node_contains (target_id, "{\"type\":\"property\",\"name\":\"tag\",\"value_type\":\"string\""));
+  JERRY_ASSERT (test_node_contains (target_id, "\"value\":\"target\""));
+
+  /* global object -> closure -> [[Scope]] -> ... -> lexical environment with the captured variable */
+  uint32_t closure_id, scope_id;
+
+  JERRY_ASSERT (test_find_edge (global_id, "closure", &closure_id));
+  JERRY_ASSERT (test_node_contains (closure_id, "\"type\":\"function\",\"class\":\"Function\""));
+  JERRY_ASSERT (test_find_edge (closure_id, "[[Scope]]", &scope_id));
+
+  uint32_t depth = 0;
+
+  while (!test_node_contains (scope_id, "{\"type\":\"variable\",\"name\":\"count\""))
+  {
+    JERRY_ASSERT (test_node_contains (scope_id, "\"type\":\"lexical environment\""));
+    JERRY_ASSERT (++depth < TEST_MAX_SCOPE_DEPTH);
+    JERRY_ASSERT (test_find_edge (scope_id, "(outer)", &scope_id));
+  }
+
+  JERRY_ASSERT (test_node_contains (scope_id, "\"class\":\"declarative\""));
+
+  /* the engine remains usable after the snapshot */
+  jerry_api_value_t value;
+  const char *call_source_p = "closure ()";
+
+  JERRY_ASSERT (jerry_api_eval ((const jerry_api_char_t *) call_source_p,
+                                strlen (call_source_p),
+                                false,
+                                false,
+                                &value) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (value.type == JERRY_API_DATA_TYPE_FLOAT64 && value.v_float64 == 1.0);
+  jerry_api_release_value (&value);
+
+  /* the file can't be created */
+  JERRY_ASSERT (!jerry_api_dump_heap_snapshot (TEST_UNWRITABLE_FILE_PATH));
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
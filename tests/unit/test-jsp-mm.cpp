@@ -0,0 +1,129 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jsp-mm.h"
+#include "mem-allocator.h"
+#include "mem-heap.h"
+
+#include "test-common.h"
+
+// Heap size is 32K
+#define test_heap_size (32 * 1024)
+
+// Number of blocks, allocated at once
+#define test_blocks_number (64)
+
+// Maximum size of a small block
+#define test_max_small_block_size (128)
+
+// Size of a large block (greater than half of the parser arena's chunk)
+#define test_large_block_size (6 * 1024)
+
+// Number of large blocks, allocated one after another (their total size exceeds the heap's size)
+#define test_large_blocks_number (32)
+
+uint8_t *ptrs[test_blocks_number];
+size_t sizes[test_blocks_number];
+
+uint8_t test_native_heap[test_heap_size] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT,
+                                                                             MEM_HEAP_CHUNK_SIZE))));
+
+/**
+ * Allocate the block with the specified index and fill it with the index
+ */
+static void
+test_alloc_block (uint32_t index) /**< index of the block */
+{
+  sizes[index] = 1 + (size_t) rand () % test_max_small_block_size;
+  ptrs[index] = (uint8_t *) jsp_mm_alloc (sizes[index]);
+
+  JERRY_ASSERT (ptrs[index] != NULL && ((uintptr_t) ptrs[index]) % MEM_ALIGNMENT == 0);
+  memset (ptrs[index], (int) index, sizes[index]);
+} /* test_alloc_block */
+
+/**
+ * Check that contents of all allocated blocks are not changed
+ */
+static void
+test_check_blocks (void)
+{
+  for (uint32_t i = 0; i < test_blocks_number; i++)
+  {
+    for (size_t k = 0; ptrs[i] != NULL && k < sizes[i]; k++)
+    {
+      JERRY_ASSERT (ptrs[i][k] == (uint8_t) i);
+    }
+  }
+} /* test_check_blocks */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  mem_heap_init (test_native_heap, sizeof (test_native_heap));
+
+  for (uint32_t iter = 0; iter < 2; iter++)
+  {
+    jsp_mm_init ();
+
+    /* blocks are allocated in the arena, and freed blocks are reused without corrupting other blocks */
+    for (uint32_t i = 0; i < test_blocks_number; i++)
+    {
+      test_alloc_block (i);
+    }
+
+    for (uint32_t round = 0; round < 16; round++)
+    {
+      for (uint32_t i = 0; i < test_blocks_number; i++)
+      {
+        if (rand () % 2)
+        {
+          jsp_mm_free (ptrs[i]);
+          test_alloc_block (i);
+        }
+      }
+
+      test_check_blocks ();
+    }
+
+    /* space of the last allocated block is reused by the next allocation */
+    uint8_t *last_block_p = (uint8_t *) jsp_mm_alloc (8);
+    jsp_mm_free (last_block_p);
+    JERRY_ASSERT (jsp_mm_alloc (8) == last_block_p);
+
+    /* large blocks are returned to the heap as soon as they are freed */
+    for (uint32_t i = 0; i < test_large_blocks_number; i++)
+    {
+      /* each block is greater than the freed ones, so it can't reuse their space in the arena */
+      const size_t large_block_size = test_large_block_size + i * MEM_ALIGNMENT;
+
+      uint8_t *large_block_p = (uint8_t *) jsp_mm_alloc (large_block_size);
+      memset (large_block_p, 0xff, large_block_size);
+
+      jsp_mm_free (large_block_p);
+    }
+
+    test_check_blocks ();
+
+    /* all blocks are released at once, and the arena is used again in the next iteration */
+    jsp_mm_finalize ();
+  }
+
+  mem_heap_finalize ();
+
+  return 0;
+} /* main */
@@ -0,0 +1,88 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Script, which functions are compiled upon first call
+ */
+static const char *test_source_p = ("function add (a, b) { return a + b }\n"
+                                    "function outer (x) { function inner (y) { return x * y; } return inner; }\n"
+                                    "var strict_fn = function () { 'use strict'; return this; };\n"
+                                    "function count_args () { return arguments.length; }\n"
+                                    "var counter = (function () { var c = 0; return function () { return ++c; }; }) ();\n");
+
+/**
+ * Evaluate specified source in the active context and check that result is the specified number
+ */
+static void
+test_eval_number (const char *source_p, /**< source code */
+                  double expected_value) /**< expected result */
+{
+  jerry_api_value_t res;
+
+  jerry_completion_code_t status = jerry_api_eval ((const jerry_api_char_t *) source_p,
+                                                   strlen (source_p),
+                                                   false,
+                                                   false,
+                                                   &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == expected_value);
+
+  jerry_api_release_value (&res);
+} /* test_eval_number */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_LAZY_FUNCTIONS);
+
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_source_p, strlen (test_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  test_eval_number ("add (1, 2)", 3);
+  test_eval_number ("outer (3) (4) + outer (5) (6)", 42);
+  test_eval_number ("strict_fn () === undefined ? 1 : 0", 1);
+  test_eval_number ("count_args (1, 2, 3)", 3);
+
+  /* the function objects, created from the same function expression, share the compiled body */
+  test_eval_number ("counter () + counter () * 10", 21);
+
+  jerry_cleanup ();
+
+  /* lexical and other syntax errors in bodies of functions are reported during the parse, before the script runs */
+  const char *error_sources_p[] =
+  {
+    "function f () { var s = 'abc; }",
+    "var r = 1; function never () { var = ; }",
+    "var g = function () { function nested () { return ) } };",
+    "lbl: for (;;) { (function () { break lbl; }) (); }",
+    "function strict () { 'use strict'; var eval = 1; }"
+  };
+
+  for (size_t i = 0; i < sizeof (error_sources_p) / sizeof (error_sources_p[0]); i++)
+  {
+    jerry_init (JERRY_FLAG_LAZY_FUNCTIONS);
+    JERRY_ASSERT (!jerry_parse ((const jerry_api_char_t *) error_sources_p[i], strlen (error_sources_p[i])));
+    jerry_cleanup ();
+  }
+
+  return 0;
+} /* main */
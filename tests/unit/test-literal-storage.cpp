@@ -14,6 +14,7 @@
  */
 
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
 #include "test-common.h"
@@ -133,8 +134,8 @@ main (int __attr_unused___ argc,
     // Check empty string exists
     JERRY_ASSERT (lit_find_literal_by_utf8_string (NULL, 0));
 
-    lit_storage.cleanup ();
-    JERRY_ASSERT (lit_storage.get_first () == NULL);
+    JERRY_CONTEXT (lit_storage).cleanup ();
+    JERRY_ASSERT (JERRY_CONTEXT (lit_storage).get_first () == NULL);
   }
 
   lit_finalize ();
@@ -0,0 +1,119 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Budget of heap usage for each run
+ */
+#define TEST_MEMORY_BUDGET (16u * 1024u)
+
+/**
+ * Script, catching the error, raised upon exceeding of the budget by a function's local data
+ */
+static const char *test_caught_source_p = ("function grow () {\n"
+                                           "  var a = [];\n"
+                                           "  while (true) { a.push ({ x: a.length }); }\n"
+                                           "}\n"
+                                           "var is_caught = false;\n"
+                                           "try { grow (); } catch (e) { is_caught = (e instanceof RangeError); }\n"
+                                           "if (!is_caught) { throw new Error ('not caught'); }\n");
+
+/**
+ * Script, exceeding the budget with data, that remains reachable
+ */
+static const char *test_uncaught_source_p = ("var a = [];\n"
+                                             "while (true) { a.push ({ x: a.length }); }\n");
+
+/**
+ * Script, exceeding maximum length of strings' concatenation
+ */
+static const char *test_concat_source_p = ("var s = 'abcdefgh';\n"
+                                           "try { while (true) { s += s; } }\n"
+                                           "catch (e) { s = e instanceof RangeError; }\n"
+                                           "s;\n");
+
+/**
+ * Script, exceeding maximum length of strings' concatenation in built-in routines
+ */
+static const char *test_builtin_concat_source_p = ("var s = 'abcdefgh';\n"
+                                                   "try { while (true) { s += s; } } catch (e) {}\n"
+                                                   "var errors = 0;\n"
+                                                   "try { [s, s].join (''); }\n"
+                                                   "catch (e) { errors += (e instanceof RangeError); }\n"
+                                                   "try { s.concat (s); }\n"
+                                                   "catch (e) { errors += (e instanceof RangeError); }\n"
+                                                   "errors;\n");
+
+/**
+ * Script, allocating garbage (only a small part of the allocated memory is reachable at any moment)
+ */
+static const char *test_garbage_source_p = ("for (var i = 0; i < 10000; i++) { var o = { x: i, y: [i, i] }; }\n");
+
+/**
+ * Run the script with jerry_api_eval
+ *
+ * @return completion code
+ */
+static jerry_completion_code_t
+test_eval (const char *source_p, /**< script */
+           jerry_api_value_t *out_value_p) /**< out: completion value */
+{
+  return jerry_api_eval ((const jerry_api_char_t *) source_p, strlen (source_p), false, false, out_value_p);
+} /* test_eval */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_api_value_t value;
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  jerry_set_memory_budget (TEST_MEMORY_BUDGET);
+
+  /* the error is raised in the script, and can be caught */
+  JERRY_ASSERT (jerry_parse ((const jerry_api_char_t *) test_caught_source_p, strlen (test_caught_source_p)));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  /* the engine remains usable after an unhandled error */
+  JERRY_ASSERT (test_eval (test_uncaught_source_p, &value) == JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION);
+  jerry_api_release_value (&value);
+
+  /* garbage is collected before the budget is considered exceeded */
+  JERRY_ASSERT (test_eval ("a = undefined;", &value) == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&value);
+
+  JERRY_ASSERT (test_eval (test_garbage_source_p, &value) == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&value);
+
+  /* exceeding of maximum length of strings' concatenation is reported with RangeError, even without a budget */
+  jerry_set_memory_budget (0);
+
+  JERRY_ASSERT (test_eval (test_concat_source_p, &value) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (value.type == JERRY_API_DATA_TYPE_BOOLEAN && value.v_bool);
+  jerry_api_release_value (&value);
+
+  JERRY_ASSERT (test_eval (test_builtin_concat_source_p, &value) == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (value.type == JERRY_API_DATA_TYPE_FLOAT64 && value.v_float64 == 2.0);
+  jerry_api_release_value (&value);
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
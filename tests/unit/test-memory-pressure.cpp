@@ -0,0 +1,137 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Number of objects, cached by the test (as an embedder's cache of objects)
+ */
+#define TEST_CACHED_OBJECTS_NUMBER (16u)
+
+/**
+ * Number of objects, allocated by the test to cause allocation of heap memory
+ */
+#define TEST_ALLOCATED_OBJECTS_NUMBER (1024u)
+
+/**
+ * Objects, cached by the test
+ */
+static jerry_api_object_t *test_cached_objects[TEST_CACHED_OBJECTS_NUMBER];
+
+/**
+ * Objects, allocated by the test
+ */
+static jerry_api_object_t *test_allocated_objects[TEST_ALLOCATED_OBJECTS_NUMBER];
+
+/**
+ * Number of memory pressure notifications with each severity
+ */
+static uint32_t test_notifications_number[JERRY_API_MEMORY_PRESSURE_CRITICAL + 1];
+
+/**
+ * Memory pressure callback, releasing the cached objects
+ */
+static void
+test_memory_pressure_callback (jerry_api_memory_pressure_severity_t severity) /**< severity */
+{
+  test_notifications_number[severity]++;
+
+  for (uint32_t i = 0; i < TEST_CACHED_OBJECTS_NUMBER; i++)
+  {
+    if (test_cached_objects[i] != NULL)
+    {
+      jerry_api_release_object (test_cached_objects[i]);
+      test_cached_objects[i] = NULL;
+    }
+  }
+} /* test_memory_pressure_callback */
+
+/**
+ * Another memory pressure callback
+ */
+static void
+test_other_memory_pressure_callback (jerry_api_memory_pressure_severity_t severity) /**< severity */
+{
+  (void) severity;
+
+  JERRY_UNREACHABLE ();
+} /* test_other_memory_pressure_callback */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  /* the soft limit can not be greater than the hard limit */
+  JERRY_ASSERT (!jerry_api_set_heap_limits (2048, 1024));
+
+  for (uint32_t i = 0; i < TEST_CACHED_OBJECTS_NUMBER; i++)
+  {
+    test_cached_objects[i] = jerry_api_create_object ();
+  }
+
+  JERRY_ASSERT (jerry_api_register_memory_pressure_callback (test_memory_pressure_callback));
+  /* only one callback can be registered */
+  JERRY_ASSERT (!jerry_api_register_memory_pressure_callback (test_other_memory_pressure_callback));
+
+  /* heap usage can't return under the soft limit, so the callback is called once with each of low..high severities
+   * (besides, notifications with low severity are sent upon reaching the engine's own threshold of heap usage) */
+  JERRY_ASSERT (jerry_api_set_heap_limits (1, 0));
+
+  /* objects are allocated from pools, so the heap is not necessarily allocated upon creation of each object */
+  for (uint32_t i = 0; i < TEST_ALLOCATED_OBJECTS_NUMBER; i++)
+  {
+    test_allocated_objects[i] = jerry_api_create_object ();
+  }
+
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_LOW] >= 1);
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_MEDIUM] == 1);
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_HIGH] == 1);
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_CRITICAL] == 0);
+
+  for (uint32_t i = 0; i < TEST_CACHED_OBJECTS_NUMBER; i++)
+  {
+    JERRY_ASSERT (test_cached_objects[i] == NULL);
+  }
+
+  /* till heap usage returns under the soft limit, there are no more notifications */
+  for (uint32_t i = 0; i < TEST_ALLOCATED_OBJECTS_NUMBER; i++)
+  {
+    jerry_api_release_object (test_allocated_objects[i]);
+    test_allocated_objects[i] = jerry_api_create_object ();
+  }
+
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_MEDIUM] == 1);
+  JERRY_ASSERT (test_notifications_number[JERRY_API_MEMORY_PRESSURE_HIGH] == 1);
+
+  for (uint32_t i = 0; i < TEST_ALLOCATED_OBJECTS_NUMBER; i++)
+  {
+    jerry_api_release_object (test_allocated_objects[i]);
+  }
+
+  /* removing the limits */
+  JERRY_ASSERT (jerry_api_set_heap_limits (0, 0));
+
+  jerry_api_unregister_memory_pressure_callback (test_memory_pressure_callback);
+  JERRY_ASSERT (jerry_api_register_memory_pressure_callback (test_other_memory_pressure_callback));
+
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
@@ -0,0 +1,138 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Script, which source code is read part by part
+ */
+static const char *test_source_p = ("var sum = 0;\n"
+                                    "function add (a, b) { return a + b; }\n"
+                                    "for (var i = 0; i < 10; i++) { sum = add (sum, i); }\n"
+                                    "var str = 'string, split between parts';\n"
+                                    "/* comment,\n"
+                                    "   split between parts */\n"
+                                    "var result = sum + str.length;");
+
+/**
+ * Buffer, to which the source code is read
+ */
+static jerry_api_char_t test_source_buffer[1024];
+
+/**
+ * Size of the source code, read so far
+ */
+static size_t test_read_size;
+
+/**
+ * Number of the reader's invocations
+ */
+static uint32_t test_reads_number;
+
+/**
+ * Size of a part, read at once
+ */
+static size_t test_part_size;
+
+/**
+ * Test reader, that appends next part of the source code to the buffer
+ *
+ * @return size of the source code, read so far
+ */
+static size_t
+test_reader (void *user_p) /**< pointer to the source code */
+{
+  const char *source_p = (const char *) user_p;
+  size_t source_size = strlen (source_p);
+
+  size_t part_size = source_size - test_read_size;
+  if (part_size > test_part_size)
+  {
+    part_size = test_part_size;
+  }
+
+  memcpy (test_source_buffer + test_read_size, source_p + test_read_size, part_size);
+  test_read_size += part_size;
+  test_reads_number++;
+
+  return test_read_size;
+} /* test_reader */
+
+/**
+ * Parse the source code, reading it by parts of specified size
+ *
+ * @return true - if the source code was parsed successfully,
+ *         false - otherwise.
+ */
+static bool
+test_parse_by_parts (const char *source_p, /**< source code */
+                     size_t part_size) /**< size of a part */
+{
+  memset (test_source_buffer, 0, sizeof (test_source_buffer));
+  test_read_size = 0;
+  test_reads_number = 0;
+  test_part_size = part_size;
+
+  return jerry_parse_from_reader (test_source_buffer, test_reader, (void *) source_p);
+} /* test_parse_by_parts */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  const size_t part_sizes[] = { 1, 3, 7, 64, 4096 };
+  const double expected_result = 45.0 + (double) strlen ("string, split between parts");
+
+  for (uint32_t i = 0; i < sizeof (part_sizes) / sizeof (part_sizes[0]); i++)
+  {
+    jerry_init (JERRY_FLAG_EMPTY);
+
+    JERRY_ASSERT (test_parse_by_parts (test_source_p, part_sizes[i]));
+    JERRY_ASSERT (test_read_size == strlen (test_source_p));
+    JERRY_ASSERT (test_reads_number >= strlen (test_source_p) / part_sizes[i]);
+    JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+    jerry_api_value_t res;
+    const char *check_p = "result";
+    JERRY_ASSERT (jerry_api_eval ((const jerry_api_char_t *) check_p,
+                                  strlen (check_p),
+                                  false,
+                                  false,
+                                  &res) == JERRY_COMPLETION_CODE_OK);
+    JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                  && res.v_float64 == expected_result);
+    jerry_api_release_value (&res);
+
+    jerry_cleanup ();
+  }
+
+  /* syntax error in a part, other than the first one */
+  const char *wrong_source_p = "var a = 1;\nvar b = 2;\nvar = 3;\n";
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (!test_parse_by_parts (wrong_source_p, 4));
+  jerry_cleanup ();
+
+  /* empty source code */
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (test_parse_by_parts ("", 4));
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+  jerry_cleanup ();
+
+  return 0;
+} /* main */
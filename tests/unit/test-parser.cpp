@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "lit-literal.h"
 #include "mem-allocator.h"
 #include "opcodes.h"
 #include "parser.h"
@@ -113,6 +114,22 @@ main (int __attr_unused___ argc,
 
   serializer_free ();
 
+  // #3 intermediate results of constant expressions are not registered in literal storage
+  char program3[] = "var x = 60 * 60 * 24.5, s = 'a' + 'b' + 'c';";
+
+  serializer_init ();
+  parser_set_show_opcodes (false);
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program3, strlen (program3), &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+
+  JERRY_ASSERT (lit_find_literal_by_num (88200) != NULL);
+  JERRY_ASSERT (lit_find_literal_by_num (3600) == NULL);
+  JERRY_ASSERT (lit_find_literal_by_utf8_string ((const lit_utf8_byte_t *) "abc", 3) != NULL);
+  JERRY_ASSERT (lit_find_literal_by_utf8_string ((const lit_utf8_byte_t *) "ab", 2) == NULL);
+
+  serializer_free ();
+
   mem_finalize (false);
 
   return 0;
@@ -0,0 +1,256 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bytecode-data.h"
+#include "jerry.h"
+
+#include "test-common.h"
+
+/**
+ * Size of buffer for snapshots
+ */
+#define TEST_SNAPSHOT_BUFFER_SIZE (16 * 1024)
+
+static uint8_t test_snapshot_buffer[TEST_SNAPSHOT_BUFFER_SIZE];
+
+/**
+ * Buffer for executing snapshots in place (aligned to sizeof (uint32_t))
+ */
+static uint32_t test_xip_buffer[TEST_SNAPSHOT_BUFFER_SIZE / sizeof (uint32_t)];
+
+/**
+ * Script, that is saved to the snapshot
+ */
+static const char *test_source_p = ("var str = 'snapshot string'; "
+                                    "var num = 3.25; "
+                                    "function sum (a, b) { return a + b; } "
+                                    "var obj = { prop: str, 'length': 15 }; "
+                                    "var res = sum (num, obj.length) + str.length;");
+
+/**
+ * Buffer for script with an array literal, which number of elements doesn't fit into a byte
+ * (the script's byte-code has wide operands, see also: OPCODE_WIDE_OPERAND_FIRST)
+ */
+static char test_wide_source[64 + 300 * 3];
+
+/**
+ * Get header of the snapshot
+ *
+ * @return copy of the header
+ */
+static snapshot_header_t
+test_get_snapshot_header (const uint8_t *snapshot_p) /**< snapshot */
+{
+  snapshot_header_t header;
+  memcpy (&header, snapshot_p, sizeof (header));
+
+  return header;
+} /* test_get_snapshot_header */
+
+/**
+ * Get byte-code array of the snapshot (see also: snapshot_header_t)
+ *
+ * @return pointer to the byte-code array inside of the snapshot
+ */
+static opcode_t *
+test_get_snapshot_opcodes (uint8_t *snapshot_p) /**< snapshot */
+{
+  const snapshot_header_t header = test_get_snapshot_header (snapshot_p);
+
+  return (opcode_t *) (snapshot_p + JERRY_ALIGNUP (sizeof (header) + header.lit_table_size, MEM_ALIGNMENT));
+} /* test_get_snapshot_opcodes */
+
+/**
+ * Check that the snapshot is rejected both upon copying and upon in-place execution,
+ * and restore the instruction, that was changed to corrupt the snapshot
+ */
+static void
+test_check_corrupted_opcode (uint8_t *snapshot_p, /**< snapshot */
+                             size_t snapshot_size, /**< size of the snapshot */
+                             opcode_t *op_p, /**< the changed instruction */
+                             opcode_t original_op) /**< original value of the instruction */
+{
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (snapshot_p, snapshot_size, true) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  jerry_cleanup ();
+
+  memcpy (test_xip_buffer, snapshot_p, snapshot_size);
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (test_xip_buffer, snapshot_size, false) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  jerry_cleanup ();
+
+  *op_p = original_op;
+} /* test_check_corrupted_opcode */
+
+/**
+ * Evaluate specified source in the active context and check that result is the specified number
+ */
+static void
+test_eval_number (const char *source_p, /**< source code */
+                  double expected_value) /**< expected result */
+{
+  jerry_api_value_t res;
+
+  jerry_completion_code_t status = jerry_api_eval ((const jerry_api_char_t *) source_p,
+                                                   strlen (source_p),
+                                                   false,
+                                                   false,
+                                                   &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == expected_value);
+
+  jerry_api_release_value (&res);
+} /* test_eval_number */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  /* syntax error */
+  JERRY_ASSERT (jerry_parse_and_save_snapshot ((const jerry_api_char_t *) "var = ;", 7,
+                                               test_snapshot_buffer, sizeof (test_snapshot_buffer)) == 0);
+
+  /* too small buffer */
+  JERRY_ASSERT (jerry_parse_and_save_snapshot ((const jerry_api_char_t *) test_source_p, strlen (test_source_p),
+                                               test_snapshot_buffer, 16) == 0);
+
+  size_t snapshot_size = jerry_parse_and_save_snapshot ((const jerry_api_char_t *) test_source_p,
+                                                        strlen (test_source_p),
+                                                        test_snapshot_buffer,
+                                                        sizeof (test_snapshot_buffer));
+  JERRY_ASSERT (snapshot_size != 0);
+
+  jerry_cleanup ();
+
+  /* corrupted snapshots are rejected */
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (test_snapshot_buffer, snapshot_size - 1, true)
+                == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  test_snapshot_buffer[0] ^= 0xff;
+  JERRY_ASSERT (jerry_exec_snapshot (test_snapshot_buffer, snapshot_size, true)
+                == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  test_snapshot_buffer[0] ^= 0xff;
+  jerry_cleanup ();
+
+  /* snapshots of engines with another build configuration are rejected */
+  snapshot_header_t header = test_get_snapshot_header (test_snapshot_buffer);
+  header.config ^= 0xffu;
+  memcpy (test_snapshot_buffer, &header, sizeof (header));
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (test_snapshot_buffer, snapshot_size, true)
+                == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  jerry_cleanup ();
+
+  header.config ^= 0xffu;
+  memcpy (test_snapshot_buffer, &header, sizeof (header));
+
+  /* byte-code with invalid opcodes, out of range jumps or registers, or without 'ret' at the end is rejected */
+  opcode_t *opcodes_p = test_get_snapshot_opcodes (test_snapshot_buffer);
+  const uint32_t instructions_number = header.instructions_number;
+
+  opcode_t *op_p = &opcodes_p[instructions_number - 1];
+  opcode_t original_op = *op_p;
+  JERRY_ASSERT (original_op.op_idx == __op__idx_ret);
+
+  op_p->op_idx = LAST_OP;
+  test_check_corrupted_opcode (test_snapshot_buffer, snapshot_size, op_p, original_op);
+
+  op_p->op_idx = __op__idx_nop;
+  test_check_corrupted_opcode (test_snapshot_buffer, snapshot_size, op_p, original_op);
+
+  op_p = &opcodes_p[1];
+  original_op = *op_p;
+  JERRY_ASSERT (original_op.op_idx == __op__idx_reg_var_decl);
+
+  op_p->data.reg_var_decl.max = OPCODE_REG_FIRST;
+  test_check_corrupted_opcode (test_snapshot_buffer, snapshot_size, op_p, original_op);
+
+  for (uint32_t oc = 0; oc < instructions_number; oc++)
+  {
+    if (opcodes_p[oc].op_idx == __op__idx_meta
+        && opcodes_p[oc].data.meta.type == OPCODE_META_TYPE_FUNCTION_END)
+    {
+      /* the function's end is moved out of the byte-code */
+      op_p = &opcodes_p[oc];
+      original_op = *op_p;
+
+      op_p->data.meta.data_1 = 0;
+      op_p->data.meta.data_2 = (idx_t) (instructions_number - oc);
+      test_check_corrupted_opcode (test_snapshot_buffer, snapshot_size, op_p, original_op);
+    }
+  }
+
+  /* the snapshot is run in a fresh engine, that hasn't seen the script's source */
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (test_snapshot_buffer, snapshot_size, true) == JERRY_COMPLETION_CODE_OK);
+
+  test_eval_number ("res", 33.25);
+  test_eval_number ("sum (obj.prop === 'snapshot string' ? 1 : 0, num)", 4.25);
+  jerry_cleanup ();
+
+  /* in-place execution requires aligned snapshot */
+  uint8_t *xip_buffer_p = (uint8_t *) test_xip_buffer;
+  memcpy (xip_buffer_p + 1, test_snapshot_buffer, snapshot_size);
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (xip_buffer_p + 1, snapshot_size, false) == JERRY_COMPLETION_CODE_INVALID_SNAPSHOT);
+  jerry_cleanup ();
+
+  /* the snapshot is executed in place, and the functions, created by it, remain callable after the run */
+  memcpy (xip_buffer_p, test_snapshot_buffer, snapshot_size);
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (xip_buffer_p, snapshot_size, false) == JERRY_COMPLETION_CODE_OK);
+
+  test_eval_number ("res", 33.25);
+  test_eval_number ("sum (obj.prop === 'snapshot string' ? 1 : 0, num)", 4.25);
+  jerry_cleanup ();
+
+  /* byte-code with wide operands is saved together with its wide operands table */
+  const char *wide_source_head_p = "var x = 1; var arr = [x";
+  const char *wide_source_tail_p = "]; var len = arr.length + arr[299];";
+  size_t wide_source_size = strlen (wide_source_head_p);
+
+  memcpy (test_wide_source, wide_source_head_p, wide_source_size);
+  for (int i = 1; i < 300; i++)
+  {
+    memcpy (test_wide_source + wide_source_size, ", x", 3);
+    wide_source_size += 3;
+  }
+  memcpy (test_wide_source + wide_source_size, wide_source_tail_p, strlen (wide_source_tail_p));
+  wide_source_size += strlen (wide_source_tail_p);
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  size_t wide_snapshot_size = jerry_parse_and_save_snapshot ((const jerry_api_char_t *) test_wide_source,
+                                                             wide_source_size,
+                                                             test_snapshot_buffer,
+                                                             sizeof (test_snapshot_buffer));
+  JERRY_ASSERT (wide_snapshot_size != 0);
+  jerry_cleanup ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+  JERRY_ASSERT (jerry_exec_snapshot (test_snapshot_buffer, wide_snapshot_size, true) == JERRY_COMPLETION_CODE_OK);
+
+  test_eval_number ("len", 301);
+  jerry_cleanup ();
+
+  return 0;
+} /* main */